@@ -69,5 +69,6 @@ end
     dofile( scriptDir .. "/plugins/forms.lua" )
     dofile( scriptDir .. "/plugins/layout.lua" )
     dofile( scriptDir .. "/wxformbuilder.lua" )
+    dofile( scriptDir .. "/tests.lua" )
     dofile( scriptDir .. "/utilities.lua" )
 
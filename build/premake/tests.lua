@@ -0,0 +1,85 @@
+-----------------------------------------------------------------------------
+--  Name:        tests.lua
+--  Purpose:     Test programs, each one returns the number of failed tests.
+--  Author:      wxFormBuilder Team
+--  Modified by: 
+--  Created:     19/10/2026
+--  Copyright:   (c) wxFormBuilder Team
+--  Licence:     GNU General Public License Version 2
+-----------------------------------------------------------------------------
+project "xmlwriter-test"
+    kind                "ConsoleApp"
+    targetname          "xmlwritertest"
+    targetdir           "../../output/bin"
+    files               {"../../src/tests/xmlwritertest.cpp", "../../src/utils/xmlwriter.cpp"}
+    includedirs         {"../../src", "../../sdk/tinyxml"}
+    defines             {"TIXML_USE_TICPP"}
+    libdirs             {"../../sdk/lib"}
+    links               {"TiCPP"}
+
+    configuration "Debug"
+        targetsuffix    "d"
+
+project "xrcconv-test"
+    kind                "ConsoleApp"
+    targetname          "xrcconvtest"
+    targetdir           "../../output/bin"
+    files               {"../../src/tests/xrcconvtest.cpp", "../../plugins/layout/layout.cpp"}
+    includedirs         {"../../sdk/tinyxml", "../../sdk/plugin_interface"}
+    defines             {"TIXML_USE_TICPP"}
+    libdirs             {"../../sdk/lib"}
+    links               {"plugin-interface", "TiCPP"}
+
+    configuration "Debug"
+        targetsuffix    "d"
+        wx_config       { Debug="yes" }
+
+    configuration "Release"
+        buildoptions    {"-fno-strict-aliasing"}
+        wx_config       {}
+
+project "projectwriter-test"
+    kind                "ConsoleApp"
+    targetname          "projectwritertest"
+    targetdir           "../../output/bin"
+
+    -- The sources of the application, without its entry point
+    files               {"../../src/**.cpp"}
+    excludes
+    {
+        "../../src/maingui.cpp",
+        "../../src/controls/**",
+        "../../src/rad/designer/resizablepanel.*",
+        "../../src/tests/xmlwritertest.cpp",
+        "../../src/tests/xrcconvtest.cpp"
+    }
+    includedirs
+    {
+        "../../src", "../../src/boost",
+        "../../sdk/tinyxml", "../../sdk/plugin_interface"
+    }
+
+    local libs = ""
+if wxVersion < "2.9" then
+    includedirs         {"../../src/controls/include"}
+    defines             {"USE_FLATNOTEBOOK"}
+    links               {"wxPropertyGrid", "wxScintilla", "wxFlatNotebook"}
+else
+    libs                = "std,stc,richtext,propgrid,aui,ribbon"
+end
+    defines             {"NO_GCC_PRAGMA", "TIXML_USE_TICPP", "APPEND_WXVERSION"}
+    libdirs             {"../../sdk/lib"}
+    links               {"TiCPP", "plugin-interface"}
+
+    configuration "not windows"
+        libdirs         {"../../output/lib/wxformbuilder"}
+        links           {"dl"}
+
+    configuration "Debug"
+        defines         {"__WXFB_DEBUG__"}
+        targetsuffix    "d"
+        wx_config       { Libs=libs, Debug="yes" }
+
+    configuration "Release"
+        buildoptions    {"-fno-strict-aliasing"}
+        wx_config       { Libs=libs }
@@ -75,9 +75,96 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Properties read by the components
+PROPERTY_HANDLE( autosize_cols )
+PROPERTY_HANDLE( autosize_rows )
+PROPERTY_HANDLE( backspace_unindents )
+PROPERTY_HANDLE( bitmap )
+PROPERTY_HANDLE( cancel_button )
+PROPERTY_HANDLE( cell_bg )
+PROPERTY_HANDLE( cell_font )
+PROPERTY_HANDLE( cell_horiz_alignment )
+PROPERTY_HANDLE( cell_text )
+PROPERTY_HANDLE( cell_vert_alignment )
+PROPERTY_HANDLE( choices )
+PROPERTY_HANDLE( class )
+PROPERTY_HANDLE( col_label_horiz_alignment )
+PROPERTY_HANDLE( col_label_size )
+PROPERTY_HANDLE( col_label_values )
+PROPERTY_HANDLE( col_label_vert_alignment )
+PROPERTY_HANDLE( colour )
+PROPERTY_HANDLE( cols )
+PROPERTY_HANDLE( column_sizes )
+PROPERTY_HANDLE( defaultfilter )
+PROPERTY_HANDLE( defaultfolder )
+PROPERTY_HANDLE( drag_col_move )
+PROPERTY_HANDLE( drag_col_size )
+PROPERTY_HANDLE( drag_grid_size )
+PROPERTY_HANDLE( drag_row_size )
+PROPERTY_HANDLE( editing )
+PROPERTY_HANDLE( extra_style )
+PROPERTY_HANDLE( file )
+PROPERTY_HANDLE( filter )
+PROPERTY_HANDLE( folding )
+PROPERTY_HANDLE( font )
+PROPERTY_HANDLE( grid_line_color )
+PROPERTY_HANDLE( grid_lines )
+PROPERTY_HANDLE( help )
+PROPERTY_HANDLE( hover_color )
+PROPERTY_HANDLE( id )
+PROPERTY_HANDLE( include_advanced )
+PROPERTY_HANDLE( indentation_guides )
+PROPERTY_HANDLE( initial )
+PROPERTY_HANDLE( label )
+PROPERTY_HANDLE( label_bg )
+PROPERTY_HANDLE( label_font )
+PROPERTY_HANDLE( label_text )
+PROPERTY_HANDLE( line_numbers )
+PROPERTY_HANDLE( margin_height )
+PROPERTY_HANDLE( margin_width )
+PROPERTY_HANDLE( max )
+PROPERTY_HANDLE( max_point_size )
+PROPERTY_HANDLE( message )
+PROPERTY_HANDLE( min )
+PROPERTY_HANDLE( name )
+PROPERTY_HANDLE( normal_color )
+PROPERTY_HANDLE( pagesize )
+PROPERTY_HANDLE( play )
+PROPERTY_HANDLE( playback_rate )
+PROPERTY_HANDLE( player_controls )
+PROPERTY_HANDLE( pos )
+PROPERTY_HANDLE( range )
+PROPERTY_HANDLE( row_label_horiz_alignment )
+PROPERTY_HANDLE( row_label_size )
+PROPERTY_HANDLE( row_label_values )
+PROPERTY_HANDLE( row_label_vert_alignment )
+PROPERTY_HANDLE( row_sizes )
+PROPERTY_HANDLE( rows )
+PROPERTY_HANDLE( search_button )
+PROPERTY_HANDLE( select )
+PROPERTY_HANDLE( show_header )
+PROPERTY_HANDLE( show_hidden )
+PROPERTY_HANDLE( size )
+PROPERTY_HANDLE( style )
+PROPERTY_HANDLE( tab_indents )
+PROPERTY_HANDLE( tab_width )
+PROPERTY_HANDLE( theme )
+PROPERTY_HANDLE( thumbsize )
+PROPERTY_HANDLE( type )
+PROPERTY_HANDLE( url )
+PROPERTY_HANDLE( use_tabs )
+PROPERTY_HANDLE( value )
+PROPERTY_HANDLE( view_eol )
+PROPERTY_HANDLE( view_whitespace )
+PROPERTY_HANDLE( visited_color )
+PROPERTY_HANDLE( volume )
+PROPERTY_HANDLE( wildcard )
+PROPERTY_HANDLE( window_style )
+
 /**
 Event handler for events generated by controls in this plugin
 */
+
 class ComponentEvtHandler : public wxEvtHandler
 {
 private:
@@ -170,14 +257,14 @@ public:
 	{
 		return new wxCalendarCtrl((wxWindow *)parent,-1,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxCalendarCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxCalendarCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -197,14 +284,14 @@ public:
 	{
 		return new wxDatePickerCtrl((wxWindow *)parent,-1,
 			wxDefaultDateTime,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxDatePickerCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxDatePickerCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -225,9 +312,9 @@ public:
 		wxRichTextCtrl* richText = new wxRichTextCtrl( 	(wxWindow*)parent,
 															wxID_ANY,
 															wxEmptyString,
-															obj->GetPropertyAsPoint(_("pos")),
-															obj->GetPropertyAsSize(_("size")),
-															obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+															obj->GetPropertyAsPointByHandle(PROP_pos),
+															obj->GetPropertyAsSizeByHandle(PROP_size),
+															obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		wxFont textFont = wxFont(12, wxROMAN, wxNORMAL, wxNORMAL);
 		wxFont boldFont = wxFont(12, wxROMAN, wxNORMAL, wxBOLD);
@@ -364,7 +451,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsStringByHandle(PROP_name));
 		//xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -383,9 +470,9 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxHtmlWindow *hw = new wxHtmlWindow((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		wxString dummy_page(
 			wxT("<b>wxHtmlWindow</b><br />")
@@ -398,7 +485,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxHtmlWindow"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxHtmlWindow"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -419,12 +506,12 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxToggleButton* window = new wxToggleButton((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		window->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		window->SetValue( ( obj->GetPropertyAsIntegerByHandle(PROP_value) != 0 ) );
 		window->Connect( wxEVT_COMMAND_TOGGLEBUTTON_CLICKED, wxCommandEventHandler( ToggleButtonComponent::OnToggle ), NULL, this );
 		return window;
 	}
@@ -453,7 +540,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxToggleButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxToggleButton"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("value"),_("checked"), XRC_TYPE_BOOL);
@@ -476,11 +563,11 @@ class TreeCtrlComponent : public ComponentBase
 public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
-		int style = obj->GetPropertyAsInteger(_("style"));
+		int style = obj->GetPropertyAsIntegerByHandle(PROP_style);
 		wxTreeCtrl *tc = new wxTreeCtrl((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			style | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			style | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		// dummy nodes
 		wxTreeItemId root = tc->AddRoot(wxT("root node"));
@@ -500,7 +587,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxTreeCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxTreeCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -519,20 +606,20 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxScrollBar *sb = new wxScrollBar((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-
-        sb->SetScrollbar(obj->GetPropertyAsInteger(_T("value")),
-            obj->GetPropertyAsInteger(_T("thumbsize")),
-            obj->GetPropertyAsInteger(_T("range")),
-            obj->GetPropertyAsInteger(_T("pagesize")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
+
+        sb->SetScrollbar(obj->GetPropertyAsIntegerByHandle(PROP_value),
+            obj->GetPropertyAsIntegerByHandle(PROP_thumbsize),
+            obj->GetPropertyAsIntegerByHandle(PROP_range),
+            obj->GetPropertyAsIntegerByHandle(PROP_pagesize));
         return sb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxScrollBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxScrollBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("thumbsize"), _("thumbsize"), XRC_TYPE_INTEGER);
@@ -559,13 +646,13 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxSpinCtrl* window = new wxSpinCtrl((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsInteger(_("min")),
-			obj->GetPropertyAsInteger(_("max")),
-			obj->GetPropertyAsInteger(_("initial")));
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style),
+			obj->GetPropertyAsIntegerByHandle(PROP_min),
+			obj->GetPropertyAsIntegerByHandle(PROP_max),
+			obj->GetPropertyAsIntegerByHandle(PROP_initial));
 
 		window->Connect( wxEVT_COMMAND_SPINCTRL_UPDATED, wxSpinEventHandler( SpinCtrlComponent::OnSpin ), NULL, this );
 		return window;
@@ -595,7 +682,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxSpinCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxSpinCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("initial"),_("value"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("min"),_("min"), XRC_TYPE_INTEGER);
@@ -622,14 +709,14 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		return new wxSpinButton((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxSpinButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxSpinButton"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -648,20 +735,20 @@ public:
 
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
-		wxArrayString choices (obj->GetPropertyAsArrayString(_("choices")));
+		wxArrayString choices (obj->GetPropertyAsArrayStringByHandle(PROP_choices));
 		wxCheckListBox *cl =
 			new wxCheckListBox((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			choices,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		return cl;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxCheckListBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxCheckListBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
@@ -683,84 +770,84 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxGrid *grid = new wxGrid((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		grid->CreateGrid(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")));
-
-		grid->EnableDragColMove( obj->GetPropertyAsInteger( _("drag_col_move") ) != 0 );
-		grid->EnableDragColSize( obj->GetPropertyAsInteger( _("drag_col_size") ) != 0 );
-		grid->EnableDragGridSize( obj->GetPropertyAsInteger( _("drag_grid_size") ) != 0 );
-		grid->EnableDragRowSize( obj->GetPropertyAsInteger( _("drag_row_size") ) != 0 );
-		grid->EnableEditing( obj->GetPropertyAsInteger( _("editing") ) != 0 );
-		grid->EnableGridLines( obj->GetPropertyAsInteger( _("grid_lines") ) != 0 );
-		if ( !obj->IsNull( _("grid_line_color") ) )
+			obj->GetPropertyAsIntegerByHandle(PROP_rows),
+			obj->GetPropertyAsIntegerByHandle(PROP_cols));
+
+		grid->EnableDragColMove( obj->GetPropertyAsIntegerByHandle( PROP_drag_col_move ) != 0 );
+		grid->EnableDragColSize( obj->GetPropertyAsIntegerByHandle( PROP_drag_col_size ) != 0 );
+		grid->EnableDragGridSize( obj->GetPropertyAsIntegerByHandle( PROP_drag_grid_size ) != 0 );
+		grid->EnableDragRowSize( obj->GetPropertyAsIntegerByHandle( PROP_drag_row_size ) != 0 );
+		grid->EnableEditing( obj->GetPropertyAsIntegerByHandle( PROP_editing ) != 0 );
+		grid->EnableGridLines( obj->GetPropertyAsIntegerByHandle( PROP_grid_lines ) != 0 );
+		if ( !obj->IsNullByHandle( PROP_grid_line_color ) )
 		{
-			grid->SetGridLineColour( obj->GetPropertyAsColour( _("grid_line_color") ) );
+			grid->SetGridLineColour( obj->GetPropertyAsColourByHandle( PROP_grid_line_color ) );
 		}
-		grid->SetMargins( obj->GetPropertyAsInteger( _("margin_width") ), obj->GetPropertyAsInteger( _("margin_height") ) );
+		grid->SetMargins( obj->GetPropertyAsIntegerByHandle( PROP_margin_width ), obj->GetPropertyAsIntegerByHandle( PROP_margin_height ) );
 
 		// Label Properties
-		grid->SetColLabelAlignment( obj->GetPropertyAsInteger( _("col_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("col_label_vert_alignment") ) );
-		grid->SetColLabelSize( obj->GetPropertyAsInteger( _("col_label_size") ) );
+		grid->SetColLabelAlignment( obj->GetPropertyAsIntegerByHandle( PROP_col_label_horiz_alignment ), obj->GetPropertyAsIntegerByHandle( PROP_col_label_vert_alignment ) );
+		grid->SetColLabelSize( obj->GetPropertyAsIntegerByHandle( PROP_col_label_size ) );
 
-		wxArrayString columnLabels = obj->GetPropertyAsArrayString( _("col_label_values") );
+		wxArrayString columnLabels = obj->GetPropertyAsArrayStringByHandle( PROP_col_label_values );
 		for ( int i = 0; i < (int)columnLabels.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColLabelValue( i, columnLabels[i] );
 		}
 
-		wxArrayInt columnSizes = obj->GetPropertyAsArrayInt( _("column_sizes") );
+		wxArrayInt columnSizes = obj->GetPropertyAsArrayIntByHandle( PROP_column_sizes );
 		for ( int i = 0; i < (int)columnSizes.size() && i < grid->GetNumberCols(); ++i )
 		{
 			grid->SetColSize( i, columnSizes[i] );
 		}
 
-		grid->SetRowLabelAlignment( obj->GetPropertyAsInteger( _("row_label_horiz_alignment") ), obj->GetPropertyAsInteger( _("row_label_vert_alignment") ) );
-		grid->SetRowLabelSize( obj->GetPropertyAsInteger( _("row_label_size") ) );
+		grid->SetRowLabelAlignment( obj->GetPropertyAsIntegerByHandle( PROP_row_label_horiz_alignment ), obj->GetPropertyAsIntegerByHandle( PROP_row_label_vert_alignment ) );
+		grid->SetRowLabelSize( obj->GetPropertyAsIntegerByHandle( PROP_row_label_size ) );
 
-		wxArrayString rowLabels = obj->GetPropertyAsArrayString( _("row_label_values") );
+		wxArrayString rowLabels = obj->GetPropertyAsArrayStringByHandle( PROP_row_label_values );
 		for ( int i = 0; i < (int)rowLabels.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowLabelValue( i, rowLabels[i] );
 		}
 
-		wxArrayInt rowSizes = obj->GetPropertyAsArrayInt( _("row_sizes") );
+		wxArrayInt rowSizes = obj->GetPropertyAsArrayIntByHandle( PROP_row_sizes );
 		for ( int i = 0; i < (int)rowSizes.size() && i < grid->GetNumberRows(); ++i )
 		{
 			grid->SetRowSize( i, rowSizes[i] );
 		}
 
-		if ( !obj->IsNull( _("label_bg") ) )
+		if ( !obj->IsNullByHandle( PROP_label_bg ) )
 		{
-			grid->SetLabelBackgroundColour( obj->GetPropertyAsColour( _("label_bg") ) );
+			grid->SetLabelBackgroundColour( obj->GetPropertyAsColourByHandle( PROP_label_bg ) );
 		}
-		if ( !obj->IsNull( _("label_text") ) )
+		if ( !obj->IsNullByHandle( PROP_label_text ) )
 		{
-			grid->SetLabelTextColour( obj->GetPropertyAsColour( _("label_text") ) );
+			grid->SetLabelTextColour( obj->GetPropertyAsColourByHandle( PROP_label_text ) );
 		}
-		if ( !obj->IsNull( _("label_font") ) )
+		if ( !obj->IsNullByHandle( PROP_label_font ) )
 		{
-			grid->SetLabelFont( obj->GetPropertyAsFont( _("label_font") ) );
+			grid->SetLabelFont( obj->GetPropertyAsFontByHandle( PROP_label_font ) );
 		}
 
 		// Default Cell Properties
-		grid->SetDefaultCellAlignment( obj->GetPropertyAsInteger( _("cell_horiz_alignment") ), obj->GetPropertyAsInteger( _("cell_vert_alignment") ) );
+		grid->SetDefaultCellAlignment( obj->GetPropertyAsIntegerByHandle( PROP_cell_horiz_alignment ), obj->GetPropertyAsIntegerByHandle( PROP_cell_vert_alignment ) );
 
-		if ( !obj->IsNull( _("cell_bg") ) )
+		if ( !obj->IsNullByHandle( PROP_cell_bg ) )
 		{
-			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColour( _("cell_bg") ) );
+			grid->SetDefaultCellBackgroundColour( obj->GetPropertyAsColourByHandle( PROP_cell_bg ) );
 		}
-		if ( !obj->IsNull( _("cell_text") ) )
+		if ( !obj->IsNullByHandle( PROP_cell_text ) )
 		{
-			grid->SetDefaultCellTextColour( obj->GetPropertyAsColour( _("cell_text") ) );
+			grid->SetDefaultCellTextColour( obj->GetPropertyAsColourByHandle( PROP_cell_text ) );
 		}
-		if ( !obj->IsNull( _("cell_font") ) )
+		if ( !obj->IsNullByHandle( PROP_cell_font ) )
 		{
-			grid->SetDefaultCellFont( obj->GetPropertyAsFont( _("cell_font") ) );
+			grid->SetDefaultCellFont( obj->GetPropertyAsFontByHandle( PROP_cell_font ) );
 		}
 
 		// Example Cell Values
@@ -772,11 +859,11 @@ public:
 			}
 		}
 
-		if ( obj->GetPropertyAsInteger( _("autosize_rows") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_autosize_rows ) != 0 )
 		{
 			grid->AutoSizeRows();
 		}
-		if ( obj->GetPropertyAsInteger( _("autosize_cols") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_autosize_cols ) != 0 )
 		{
 			grid->AutoSizeColumns();
 		}
@@ -788,7 +875,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxGrid"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxGrid"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -901,11 +988,11 @@ public:
 	{
 		wxColourPickerCtrl* colourpicker = new wxColourPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsColour(_("colour")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByHandle(PROP_id),
+			obj->GetPropertyAsColourByHandle(PROP_colour),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)
 			);
 
 		colourpicker->PushEventHandler( new ComponentEvtHandler( colourpicker, GetManager() ) );
@@ -914,7 +1001,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxColourPickerCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxColourPickerCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("colour"),_("value"),XRC_TYPE_COLOUR);
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
@@ -946,16 +1033,16 @@ public:
 	{
 		wxFontPickerCtrl* picker = new wxFontPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsFont(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByHandle(PROP_id),
+			obj->GetPropertyAsFontByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)
 			);
 
-		if ( !obj->IsNull( _("max_point_size") ) )
+		if ( !obj->IsNullByHandle( PROP_max_point_size ) )
 		{
-			picker->SetMaxPointSize( obj->GetPropertyAsInteger( _("max_point_size") ) );
+			picker->SetMaxPointSize( obj->GetPropertyAsIntegerByHandle( PROP_max_point_size ) );
 		}
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -964,8 +1051,8 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxFontPickerCtrl"), obj->GetPropertyAsString(_("name")));
-		if ( !obj->IsNull( _("value") ) )
+		ObjectToXrcFilter xrc(obj, _("wxFontPickerCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
+		if ( !obj->IsNullByHandle( PROP_value ) )
 		{
 			xrc.AddProperty(_("value"),_("value"),XRC_TYPE_FONT);
 		}
@@ -999,13 +1086,13 @@ public:
 	{
 		wxFilePickerCtrl* picker = new wxFilePickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsString(_("wildcard")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByHandle(PROP_id),
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsStringByHandle(PROP_message),
+			obj->GetPropertyAsStringByHandle(PROP_wildcard),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1014,7 +1101,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxFilePickerCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxFilePickerCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("wildcard"),_("wildcard"),XRC_TYPE_TEXT);
@@ -1049,12 +1136,12 @@ public:
 	{
 		wxDirPickerCtrl* picker = new wxDirPickerCtrl(
 			(wxWindow*)parent,
-			obj->GetPropertyAsInteger(_("id")),
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsString(_("message")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsIntegerByHandle(PROP_id),
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsStringByHandle(PROP_message),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)
 			);
 
 		picker->PushEventHandler( new ComponentEvtHandler( picker, GetManager() ) );
@@ -1063,7 +1150,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxDirPickerCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxDirPickerCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("message"),_("message"),XRC_TYPE_TEXT);
 		xrc.AddWindowProperties();
@@ -1096,24 +1183,24 @@ public:
 	{
 		wxHyperlinkCtrl* ctrl = new wxHyperlinkCtrl(
 			(wxWindow*)parent, -1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsString(_("url")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsStringByHandle(PROP_url),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)
 			);
 
-		if ( !obj->IsNull( _("hover_color") ) )
+		if ( !obj->IsNullByHandle( PROP_hover_color ) )
 		{
-			ctrl->SetHoverColour( obj->GetPropertyAsColour( _("hover_color") ) );
+			ctrl->SetHoverColour( obj->GetPropertyAsColourByHandle( PROP_hover_color ) );
 		}
-		if ( !obj->IsNull( _("normal_color") ) )
+		if ( !obj->IsNullByHandle( PROP_normal_color ) )
 		{
-			ctrl->SetNormalColour( obj->GetPropertyAsColour( _("normal_color") ) );
+			ctrl->SetNormalColour( obj->GetPropertyAsColourByHandle( PROP_normal_color ) );
 		}
-		if ( !obj->IsNull( _("visited_color") ) )
+		if ( !obj->IsNullByHandle( PROP_visited_color ) )
 		{
-			ctrl->SetVisitedColour( obj->GetPropertyAsColour( _("visited_color") ) );
+			ctrl->SetVisitedColour( obj->GetPropertyAsColourByHandle( PROP_visited_color ) );
 		}
 
 		return ctrl;
@@ -1121,9 +1208,9 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxHyperlinkCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxHyperlinkCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
-		xrc.AddPropertyValue(_("url"), obj->GetPropertyAsString(_("url")));
+		xrc.AddPropertyValue(_("url"), obj->GetPropertyAsStringByHandle(PROP_url));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -1135,10 +1222,12 @@ public:
 
 		try
 		{
-			ticpp::Element *urlElement = xrcObj->FirstChildElement("url");
-			wxString url(urlElement->GetText().c_str(), wxConvUTF8);
-
-			filter.AddPropertyValue(_("url"), url);
+			ticpp::Element *urlElement = filter.GetXrcProperty("url");
+			if ( urlElement )
+			{
+				wxString url(urlElement->GetText().c_str(), wxConvUTF8);
+				filter.AddPropertyValue(_("url"), url);
+			}
 		}
 		catch(ticpp::Exception&)
 		{
@@ -1159,22 +1248,22 @@ public:
 		wxGenericDirCtrl* ctrl = new wxGenericDirCtrl(
 			(wxWindow*)parent,
 			wxID_ANY,
-			obj->GetPropertyAsString(_("defaultfolder")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")),
-			obj->GetPropertyAsString(_("filter")),
-			obj->GetPropertyAsInteger(_("defaultfilter"))
+			obj->GetPropertyAsStringByHandle(PROP_defaultfolder),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style),
+			obj->GetPropertyAsStringByHandle(PROP_filter),
+			obj->GetPropertyAsIntegerByHandle(PROP_defaultfilter)
 			);
 
-		ctrl->ShowHidden( obj->GetPropertyAsInteger( _("show_hidden") ) != 0 );
+		ctrl->ShowHidden( obj->GetPropertyAsIntegerByHandle( PROP_show_hidden ) != 0 );
 		ctrl->GetTreeCtrl()->PushEventHandler( new GenericDirCtrlEvtHandler( ctrl, GetManager() ) );
 		return ctrl;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxGenericDirCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxGenericDirCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("defaultfolder"),_("defaultfolder"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("filter"),_("filter"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("defaultfilter"),_("defaultfilter"),XRC_TYPE_INTEGER);
@@ -1209,7 +1298,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, obj->GetPropertyAsString(_("class")), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, obj->GetPropertyAsStringByHandle(PROP_class), obj->GetPropertyAsStringByHandle(PROP_name));
 		return xrc.GetXrcObject();
 	}
 };
@@ -1221,19 +1310,19 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxSearchCtrl* sc = new wxSearchCtrl((wxWindow *)parent, wxID_ANY,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		if ( !obj->IsNull( _("search_button") ) )
+		if ( !obj->IsNullByHandle( PROP_search_button ) )
 		{
-			sc->ShowSearchButton( obj->GetPropertyAsInteger( _("search_button") ) );
+			sc->ShowSearchButton( obj->GetPropertyAsIntegerByHandle( PROP_search_button ) );
 		}
 		
-		if ( !obj->IsNull( _("cancel_button") ) )
+		if ( !obj->IsNullByHandle( PROP_cancel_button ) )
 		{
-			sc->ShowCancelButton( obj->GetPropertyAsInteger( _("cancel_button") ) );
+			sc->ShowCancelButton( obj->GetPropertyAsIntegerByHandle( PROP_cancel_button ) );
 		}
 
 		sc->PushEventHandler( new ComponentEvtHandler( sc, GetManager() ) );
@@ -1244,10 +1333,10 @@ public:
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
 		#if wxVERSION_NUMBER < 2900
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsStringByHandle(PROP_name));
 		return xrc.GetXrcObject();
 		#else
-		ObjectToXrcFilter xrc(obj, _("wxSearchCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxSearchCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
@@ -1283,27 +1372,27 @@ class MediaCtrlComponent : public ComponentBase
 public:
     wxObject* Create(IObject *obj, wxObject *parent)
 	{
-		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+		wxMediaCtrl* mc = new wxMediaCtrl((wxWindow *)parent, wxID_ANY, wxT(""),obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 		
-		if ( !obj->IsNull( _("file") ) )
+		if ( !obj->IsNullByHandle( PROP_file ) )
 		{
-			if( mc->Load( obj->GetPropertyAsString( _("file") ) ) )
+			if( mc->Load( obj->GetPropertyAsStringByHandle( PROP_file ) ) )
 			{
-				if (!obj->IsNull( _("playback_rate"))) mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("playback_rate")));
-				if (!obj->IsNull( _("volume")) && (obj->GetPropertyAsFloat(_("volume"))>=0)&&(obj->GetPropertyAsFloat(_("volume"))<=1)) 
-						mc->SetPlaybackRate(obj->GetPropertyAsFloat(_("volume")));
-				if (!obj->IsNull(_("player_controls")))
+				if (!obj->IsNullByHandle( PROP_playback_rate)) mc->SetPlaybackRate(obj->GetPropertyAsFloatByHandle(PROP_playback_rate));
+				if (!obj->IsNullByHandle( PROP_volume) && (obj->GetPropertyAsFloatByHandle(PROP_volume)>=0)&&(obj->GetPropertyAsFloatByHandle(PROP_volume)<=1)) 
+						mc->SetPlaybackRate(obj->GetPropertyAsFloatByHandle(PROP_volume));
+				if (!obj->IsNullByHandle(PROP_player_controls))
 				{
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
-					if(  obj->GetPropertyAsString( _("player_controls") ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
+					if(  obj->GetPropertyAsStringByHandle( PROP_player_controls ) == wxT("STEP") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+					if(  obj->GetPropertyAsStringByHandle( PROP_player_controls ) == wxT("VOLUME") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_VOLUME);
+					if(  obj->GetPropertyAsStringByHandle( PROP_player_controls ) == wxT("DEFAULT") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
+					if(  obj->GetPropertyAsStringByHandle( PROP_player_controls ) == wxT("NONE") )	mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_NONE);
 						
 				}
 				
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) mc->Play();
+				if ( !obj->IsNullByHandle( PROP_play ) && ( obj->GetPropertyAsIntegerByHandle( PROP_play ) == 1 ) ) mc->Play();
 				else
 					mc->Stop();
 				
@@ -1311,7 +1400,7 @@ public:
 			}
 		}
 		
-		if(!obj->IsNull(_("style"))) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
+		if(!obj->IsNullByHandle(PROP_style)) mc->ShowPlayerControls(wxMEDIACTRLPLAYERCONTROLS_STEP);
 
 		mc->PushEventHandler( new ComponentEvtHandler( mc, GetManager() ) );
 
@@ -1320,7 +1409,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMediaCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxMediaCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -1346,14 +1435,14 @@ public:
     wxObject* Create(IObject *obj, wxObject *parent)
     {
         wxPropertyGrid* pg = new wxPropertyGrid((wxWindow *)parent,-1,
-                                                obj->GetPropertyAsPoint(wxT("pos")),
-                                                obj->GetPropertyAsSize(wxT("size")),
-                                                obj->GetPropertyAsInteger(wxT("style")) |
-                                                obj->GetPropertyAsInteger(wxT("window_style")) );
+                                                obj->GetPropertyAsPointByHandle(PROP_pos),
+                                                obj->GetPropertyAsSizeByHandle(PROP_size),
+                                                obj->GetPropertyAsIntegerByHandle(PROP_style) |
+                                                obj->GetPropertyAsIntegerByHandle(PROP_window_style) );
 
-        if ( !obj->GetPropertyAsString(wxT("extra_style")).empty() )
+        if ( !obj->GetPropertyAsStringByHandle(PROP_extra_style).empty() )
         {
-            pg->SetExtraStyle( obj->GetPropertyAsInteger( wxT("extra_style") ) );
+            pg->SetExtraStyle( obj->GetPropertyAsIntegerByHandle( PROP_extra_style ) );
         }
 
         return pg;
@@ -1380,22 +1469,22 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("propGridItem"))
 			{
-				if (childObj->GetPropertyAsString( _("type") ) == _("Category") )
+				if (childObj->GetPropertyAsStringByHandle( PROP_type ) == _("Category") )
 				{
-					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsString( _("label") ) ) );
+					pg->Append( new wxPropertyCategory( childObj->GetPropertyAsStringByHandle( PROP_label ), childObj->GetPropertyAsStringByHandle( PROP_label ) ) );
 				}
 				else
 				{
-					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+					wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (childObj->GetPropertyAsStringByHandle( PROP_type ) ) + wxT("Property") ), wxPGProperty );
 					if( prop )
 					{
-						prop->SetLabel( childObj->GetPropertyAsString( _("label") ) );
-						prop->SetName( childObj->GetPropertyAsString( _("label") ) );
+						prop->SetLabel( childObj->GetPropertyAsStringByHandle( PROP_label ) );
+						prop->SetName( childObj->GetPropertyAsStringByHandle( PROP_label ) );
 						pg->Append( prop );
 						
-						if( childObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+						if( childObj->GetPropertyAsStringByHandle( PROP_help ) != wxEmptyString )
 						{
-							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsString( _("help") ) );
+							pg->SetPropertyHelpString( prop, childObj->GetPropertyAsStringByHandle( PROP_help ) );
 						}
 					}
 				}
@@ -1410,17 +1499,17 @@ public:
     wxObject* Create(IObject *obj, wxObject *parent)
     {
         wxPropertyGridManager* pgman = new wxPropertyGridManager((wxWindow *)parent, -1,
-                                                                obj->GetPropertyAsPoint(wxT("pos")),
-                                                                obj->GetPropertyAsSize(wxT("size")),
-                                                                obj->GetPropertyAsInteger(wxT("style")) |
-                                                                obj->GetPropertyAsInteger(wxT("window_style")));
+                                                                obj->GetPropertyAsPointByHandle(PROP_pos),
+                                                                obj->GetPropertyAsSizeByHandle(PROP_size),
+                                                                obj->GetPropertyAsIntegerByHandle(PROP_style) |
+                                                                obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-        if ( !obj->GetPropertyAsString( wxT("extra_style") ).empty() )
+        if ( !obj->GetPropertyAsStringByHandle( PROP_extra_style ).empty() )
         {
-            pgman->SetExtraStyle( obj->GetPropertyAsInteger( wxT("extra_style") ) );
+            pgman->SetExtraStyle( obj->GetPropertyAsIntegerByHandle( PROP_extra_style ) );
         }
 		
-        pgman->ShowHeader( obj->GetPropertyAsInteger( wxT("show_header") ) );
+        pgman->ShowHeader( obj->GetPropertyAsIntegerByHandle( PROP_show_header ) );
 		
         // Adding a page sets target page to the one added, so
         // we don't have to call SetTargetPage if we are filling
@@ -1485,7 +1574,7 @@ public:
 
         pg2->AppendIn( carProp2, new wxIntProperty( _("Price ($)"), wxPG_LABEL, 300000 ) );
 
-        if ( obj->GetPropertyAsInteger( wxT("include_advanced") ) )
+        if ( obj->GetPropertyAsIntegerByHandle( PROP_include_advanced ) )
         {
             pg2->Append( new wxPropertyCategory( _("Advanced Properties"), wxPG_LABEL ) );
             // wxArrayStringProperty embeds a wxArrayString.
@@ -1535,29 +1624,29 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("propGridPage"))
 			{
-				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsString( _("label") ), childObj->GetPropertyAsBitmap( _("bitmap") ) );
+				wxPropertyGridPage *page = pgm->AddPage( childObj->GetPropertyAsStringByHandle( PROP_label ), childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ) );
 				
 				for( size_t j = 0; j < childObj->GetChildCount(); ++j )
 				{
 					IObject* innerChildObj = childObj->GetChildPtr( j );
 					if (innerChildObj->GetClassName() == _("propGridItem"))
 					{
-						if (innerChildObj->GetPropertyAsString( _("type") ) == _("Category") )
+						if (innerChildObj->GetPropertyAsStringByHandle( PROP_type ) == _("Category") )
 						{
-							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsString( _("label") ), innerChildObj->GetPropertyAsString( _("label") ) ) );
+							page->Append( new wxPropertyCategory( innerChildObj->GetPropertyAsStringByHandle( PROP_label ), innerChildObj->GetPropertyAsStringByHandle( PROP_label ) ) );
 						}
 						else
 						{
-							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsString( _("type") ) ) + wxT("Property") ), wxPGProperty );
+							wxPGProperty *prop = wxDynamicCast( wxCreateDynamicObject( wxT("wx") + (innerChildObj->GetPropertyAsStringByHandle( PROP_type ) ) + wxT("Property") ), wxPGProperty );
 							if( prop )
 							{
-								prop->SetLabel( innerChildObj->GetPropertyAsString( _("label") ) );
-								prop->SetName( innerChildObj->GetPropertyAsString( _("label") ) );
+								prop->SetLabel( innerChildObj->GetPropertyAsStringByHandle( PROP_label ) );
+								prop->SetName( innerChildObj->GetPropertyAsStringByHandle( PROP_label ) );
 								page->Append( prop );
 								
-								if( innerChildObj->GetPropertyAsString( _("help") ) != wxEmptyString )
+								if( innerChildObj->GetPropertyAsStringByHandle( PROP_help ) != wxEmptyString )
 								{
-									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsString( _("help") ) );
+									page->SetPropertyHelpString( prop, innerChildObj->GetPropertyAsStringByHandle( PROP_help ) );
 								}
 							}
 						}
@@ -1584,14 +1673,14 @@ public:
 	wxObject* Create( IObject* obj, wxObject* parent )
 	{
 		wxStyledTextCtrl* m_code = new wxStyledTextCtrl( 	(wxWindow *)parent, -1,
-												obj->GetPropertyAsPoint(_("pos")),
-												obj->GetPropertyAsSize(_("size")),
-												obj->GetPropertyAsInteger(_("window_style")),
-												obj->GetPropertyAsString(_("name"))
+												obj->GetPropertyAsPointByHandle(PROP_pos),
+												obj->GetPropertyAsSizeByHandle(PROP_size),
+												obj->GetPropertyAsIntegerByHandle(PROP_window_style),
+												obj->GetPropertyAsStringByHandle(PROP_name)
 											);
 
 		// Line Numbers
-		if ( 0 != obj->GetPropertyAsInteger(_("line_numbers") ) )
+		if ( 0 != obj->GetPropertyAsIntegerByHandle(PROP_line_numbers ) )
 		{
 			m_code->SetMarginType( 0, wxSTC_MARGIN_NUMBER );
 			m_code->SetMarginWidth( 0, m_code->TextWidth (wxSTC_STYLE_LINENUMBER, wxT("_99999"))  );
@@ -1619,7 +1708,7 @@ public:
 		m_code->MarkerDefine (wxSTC_MARKNUM_FOLDERTAIL, wxSTC_MARK_EMPTY);
 
 		// folding
-		if ( 0 != obj->GetPropertyAsInteger(_("folding") ) )
+		if ( 0 != obj->GetPropertyAsIntegerByHandle(PROP_folding ) )
 		{
 			m_code->SetMarginType (1, wxSTC_MARGIN_SYMBOL);
 			m_code->SetMarginMask (1, wxSTC_MASK_FOLDERS);
@@ -1633,7 +1722,7 @@ public:
 		{
 			m_code->SetMarginWidth( 1, 0 );
 		}
-		m_code->SetIndentationGuides( ( 0 != obj->GetPropertyAsInteger( _("indentation_guides") ) ) );
+		m_code->SetIndentationGuides( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_indentation_guides ) ) );
 
 		m_code->SetMarginWidth( 2, 0 );
 
@@ -1648,9 +1737,9 @@ public:
 							   while"));
 
 		wxFont font(10, wxMODERN, wxNORMAL, wxNORMAL);
-		if ( !obj->GetPropertyAsString(_("font")).empty() )
+		if ( !obj->GetPropertyAsStringByHandle(PROP_font).empty() )
 		{
-			font = obj->GetPropertyAsFont(_("font"));
+			font = obj->GetPropertyAsFontByHandle(PROP_font);
 		}
 
 		m_code->StyleSetFont(wxSTC_STYLE_DEFAULT, font );
@@ -1666,15 +1755,15 @@ public:
 		m_code->StyleSetForeground(wxSTC_C_COMMENTDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_COMMENTLINEDOC, wxColour(0, 128, 0));
 		m_code->StyleSetForeground(wxSTC_C_NUMBER, *wxBLUE );
-		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsInteger( _("use_tabs") ) ) );
-		m_code->SetTabWidth( obj->GetPropertyAsInteger( _("tab_width") ) );
-		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsInteger( _("tab_indents") ) ) );
-		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsInteger( _("backspace_unindents") ) ) );
-		m_code->SetIndent( obj->GetPropertyAsInteger( _("tab_width") ) );
+		m_code->SetUseTabs( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_use_tabs ) ) );
+		m_code->SetTabWidth( obj->GetPropertyAsIntegerByHandle( PROP_tab_width ) );
+		m_code->SetTabIndents( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_tab_indents ) ) );
+		m_code->SetBackSpaceUnIndents( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_backspace_unindents ) ) );
+		m_code->SetIndent( obj->GetPropertyAsIntegerByHandle( PROP_tab_width ) );
 		m_code->SetSelBackground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHT));
 		m_code->SetSelForeground(true, wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHTTEXT));
-		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsInteger( _("view_eol") ) ) );
-		m_code->SetViewWhiteSpace( ( 0 != obj->GetPropertyAsInteger( _("view_whitespace") ) ) );
+		m_code->SetViewEOL( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_view_eol ) ) );
+		m_code->SetViewWhiteSpace( ( 0 != obj->GetPropertyAsIntegerByHandle( PROP_view_whitespace ) ) );
 
 		m_code->SetCaretWidth(2);
 
@@ -1723,9 +1812,9 @@ public:
 	{
 		wxDataViewListCtrl* dataViewCtrl = new wxDataViewListCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 			
 	return dataViewCtrl;
 	}
@@ -1739,9 +1828,9 @@ public:
 	{
 		wxDataViewTreeCtrl* dataViewTreeCtrl = new wxDataViewTreeCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 			
 	return dataViewTreeCtrl;
 	}
@@ -1754,9 +1843,9 @@ public:
 	{
 		wxDataViewListCtrl* dataViewListCtrl = new wxDataViewListCtrl((wxWindow *)parent,
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 			
 		return dataViewListCtrl;
 	}
@@ -1776,21 +1865,21 @@ public:
 			IObject* childObj = GetManager()->GetIObject( child );
 			if (childObj->GetClassName() == _("dataViewListColumn"))
 			{
-				if (childObj->GetPropertyAsString( _("type")) == _("Text"))
+				if (childObj->GetPropertyAsStringByHandle( PROP_type) == _("Text"))
 				{
-					list->AppendTextColumn(childObj->GetPropertyAsString( _("label")));
+					list->AppendTextColumn(childObj->GetPropertyAsStringByHandle( PROP_label));
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Toggle"))
+				else if (childObj->GetPropertyAsStringByHandle( PROP_type) == _("Toggle"))
 				{
-					list->AppendToggleColumn(childObj->GetPropertyAsString( _("label")));
+					list->AppendToggleColumn(childObj->GetPropertyAsStringByHandle( PROP_label));
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("Progress"))
+				else if (childObj->GetPropertyAsStringByHandle( PROP_type) == _("Progress"))
 				{
-					list->AppendProgressColumn(childObj->GetPropertyAsString( _("label")));
+					list->AppendProgressColumn(childObj->GetPropertyAsStringByHandle( PROP_label));
 				}
-				else if (childObj->GetPropertyAsString( _("type")) == _("IconText"))
+				else if (childObj->GetPropertyAsStringByHandle( PROP_type) == _("IconText"))
 				{
-					list->AppendIconTextColumn(childObj->GetPropertyAsString( _("label")));
+					list->AppendIconTextColumn(childObj->GetPropertyAsStringByHandle( PROP_label));
 				}
 			}
 		}
@@ -1805,15 +1894,15 @@ class RibbonBarComponent : public ComponentBase
 	{
 		wxRibbonBar *rb = new wxRibbonBar((wxWindow*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)  );
 
-		if( obj->GetPropertyAsString( _("theme"))  == _("Default")) 
+		if( obj->GetPropertyAsStringByHandle( PROP_theme)  == _("Default")) 
 				rb->SetArtProvider( new wxRibbonDefaultArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("Generic")) 
+		else if( obj->GetPropertyAsStringByHandle( PROP_theme)  == _("Generic")) 
 				rb->SetArtProvider( new wxRibbonAUIArtProvider );
-		else if( obj->GetPropertyAsString( _("theme"))  == _("MSW") ) 
+		else if( obj->GetPropertyAsStringByHandle( PROP_theme)  == _("MSW") ) 
 				rb->SetArtProvider( new wxRibbonMSWArtProvider );
 
 		rb->PushEventHandler( new ComponentEvtHandler( rb, GetManager() ) );
@@ -1856,11 +1945,11 @@ void ComponentEvtHandler::OnRibbonBarPageChanged( wxRibbonBarEvent& event )
 		IObject*  iChild = m_manager->GetIObject( wxChild );
 		if ( iChild )
 		{
-			if ( (int)i == selPage && !iChild->GetPropertyAsInteger( _("select") ) )
+			if ( (int)i == selPage && !iChild->GetPropertyAsIntegerByHandle( PROP_select ) )
 			{
 				m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
 			}
-			else if ( (int)i != selPage && iChild->GetPropertyAsInteger( _("select") ) )
+			else if ( (int)i != selPage && iChild->GetPropertyAsIntegerByHandle( PROP_select ) )
 			{
 				m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
 			}
@@ -1880,11 +1969,11 @@ class RibbonPageComponent : public ComponentBase
 	{
 		wxRibbonPage *rbpage = new wxRibbonPage((wxRibbonBar*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsBitmapByHandle(PROP_bitmap),
 			0);
 			
-		if( obj->GetPropertyAsInteger(_("select") ) ) {
+		if( obj->GetPropertyAsIntegerByHandle(PROP_select ) ) {
 			((wxRibbonBar*)parent)->SetActivePage(rbpage);
 		}
 			
@@ -1900,11 +1989,11 @@ class RibbonPanelComponent : public ComponentBase
 	{
 		wxRibbonPanel *rbp = new wxRibbonPanel((wxRibbonPage*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))  );
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsBitmapByHandle(PROP_bitmap),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)  );
 			
 		//rbp->PushEventHandler( new ComponentEvtHandler( rbp, GetManager() ) );
 
@@ -1919,8 +2008,8 @@ class RibbonButtonBarComponent : public ComponentBase
 	{
 		wxRibbonButtonBar *rbb = new wxRibbonButtonBar((wxRibbonPanel*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0);
 			
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -1944,27 +2033,27 @@ class RibbonButtonBarComponent : public ComponentBase
 			if (childObj->GetClassName() == wxT("ribbonButton"))
 			{
 				rb->AddButton(wxID_ANY,
-							childObj->GetPropertyAsString( _("label") ),
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );				
+							childObj->GetPropertyAsStringByHandle( PROP_label ),
+							childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+							childObj->GetPropertyAsStringByHandle( PROP_help ) );				
 			} else if (childObj->GetClassName() == wxT("ribbonDropdownButton"))
 			{
 				rb->AddDropdownButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsStringByHandle( PROP_label ),
+									childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+									childObj->GetPropertyAsStringByHandle( PROP_help ) );
 			} else if (childObj->GetClassName() == wxT("ribbonHybridButton"))
 			{
 				rb->AddHybridButton(wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsStringByHandle( PROP_label ),
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ) );
 			} else if (childObj->GetClassName() == wxT("ribbonToggleButton"))
 			{
 				rb->AddToggleButton(wxID_ANY,
-									childObj->GetPropertyAsString( _("label") ),
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsStringByHandle( PROP_label ),
+									childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+									childObj->GetPropertyAsStringByHandle( PROP_help ) );
 			}
 		}
 	}
@@ -1981,8 +2070,8 @@ class RibbonToolBarComponent : public ComponentBase
 	{
 		wxRibbonToolBar *rbb = new wxRibbonToolBar((wxRibbonPanel*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0 );
 			
 		//rbb->PushEventHandler( new ComponentEvtHandler( rbb, GetManager() ) );
@@ -2006,23 +2095,23 @@ class RibbonToolBarComponent : public ComponentBase
 			if (wxT("ribbonTool") == childObj->GetClassName() )
 			{
 				rb->AddTool(wxID_ANY,
-							childObj->GetPropertyAsBitmap( _("bitmap") ),
-							childObj->GetPropertyAsString( _("help") ) );				
+							childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+							childObj->GetPropertyAsStringByHandle( PROP_help ) );				
 			} else if (wxT("ribbonDropdownTool") == childObj->GetClassName() )
 			{
 				rb->AddDropdownTool(wxID_ANY,
-									childObj->GetPropertyAsBitmap( _("bitmap") ),
-									childObj->GetPropertyAsString( _("help") ) );
+									childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+									childObj->GetPropertyAsStringByHandle( PROP_help ) );
 			} else if (wxT("ribbonHybridTool") == childObj->GetClassName() )
 			{
 				rb->AddHybridTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ) );
 			} else if (wxT("ribbonToggleTool") == childObj->GetClassName() )
 			{
 				rb->AddToggleTool(wxID_ANY,
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
-								childObj->GetPropertyAsString( _("help") ) );
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ) );
 
 			}
 		}
@@ -2040,8 +2129,8 @@ class RibbonGalleryComponent : public ComponentBase
 	{
 		wxRibbonGallery *ribbonGallery = new wxRibbonGallery((wxRibbonPanel*)parent, 
 			wxID_ANY,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0);
 			
 		//ribbonGallery->PushEventHandler( new ComponentEvtHandler( ribbonGallery, GetManager() ) );
@@ -2064,7 +2153,7 @@ class RibbonGalleryComponent : public ComponentBase
 			IObject* childObj = GetManager()->GetIObject( child );
 			if ( wxT("ribbonGalleryItem") == childObj->GetClassName() )
 			{
-				rg->Append(childObj->GetPropertyAsBitmap( _("bitmap") ), wxID_ANY );					
+				rg->Append(childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ), wxID_ANY );					
 			}
 		}
 	}
@@ -41,9 +41,52 @@
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
+
+// Properties read by the components
+PROPERTY_HANDLE( animation )
+PROPERTY_HANDLE( bitmap )
+PROPERTY_HANDLE( bitmapsize )
+PROPERTY_HANDLE( checked )
+PROPERTY_HANDLE( choices )
+PROPERTY_HANDLE( context_menu )
+PROPERTY_HANDLE( default )
+PROPERTY_HANDLE( disabled )
+PROPERTY_HANDLE( duration )
+PROPERTY_HANDLE( enabled )
+PROPERTY_HANDLE( fields )
+PROPERTY_HANDLE( focus )
+PROPERTY_HANDLE( help )
+PROPERTY_HANDLE( hide_effect )
+PROPERTY_HANDLE( hover )
+PROPERTY_HANDLE( inactive_bitmap )
+PROPERTY_HANDLE( kind )
+PROPERTY_HANDLE( label )
+PROPERTY_HANDLE( majorDimension )
+PROPERTY_HANDLE( margins )
+PROPERTY_HANDLE( maxlength )
+PROPERTY_HANDLE( maxValue )
+PROPERTY_HANDLE( minValue )
+PROPERTY_HANDLE( name )
+PROPERTY_HANDLE( packing )
+PROPERTY_HANDLE( play )
+PROPERTY_HANDLE( pos )
+PROPERTY_HANDLE( range )
+PROPERTY_HANDLE( selected )
+PROPERTY_HANDLE( selection )
+PROPERTY_HANDLE( separation )
+PROPERTY_HANDLE( shortcut )
+PROPERTY_HANDLE( show_effect )
+PROPERTY_HANDLE( size )
+PROPERTY_HANDLE( style )
+PROPERTY_HANDLE( unchecked_bitmap )
+PROPERTY_HANDLE( value )
+PROPERTY_HANDLE( window_style )
+PROPERTY_HANDLE( wrap )
+
 // Custom status bar class for windows to prevent the status bar gripper from
 // moving the entire wxFB window
 #if defined(__WIN32__) && wxUSE_NATIVE_STATUSBAR
+
 class wxIndependentStatusBar : public wxStatusBar
 {
 public:
@@ -180,19 +223,19 @@ END_EVENT_TABLE()
 // WIDGETS
 ///////////////////////////////////////////////////////////////////////////////
 
-class ButtonComponent : public ComponentBase
+class ButtonComponent : public ComponentBase, public IPropertyUpdateComponent
 {
 public:
 
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxButton* button = new wxButton((wxWindow*)parent,-1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_default ) != 0 )
 		{
 			button->SetDefault();
 		}
@@ -200,9 +243,20 @@ public:
 		return button;
 	}
 
+	bool UpdateProperty( wxObject* wxobject, IObject* obj, const PropertyHandle& property )
+	{
+		wxButton* button = wxDynamicCast( wxobject, wxButton );
+		if ( button && property == PROP_label )
+		{
+			button->SetLabel( obj->GetPropertyAsStringByHandle( PROP_label ) );
+			return true;
+		}
+		return false;
+	}
+
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxButton"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("default"),_("default"),XRC_TYPE_BOOL);
@@ -226,56 +280,56 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxBitmapButton* button = new wxBitmapButton((wxWindow*)parent,-1,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmapByHandle(PROP_bitmap),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		if ( obj->GetPropertyAsInteger( _("default") ) != 0 )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_default ) != 0 )
 		{
 			button->SetDefault();
 		}
 
-		if ( !obj->IsNull( _("disabled") ) )
+		if ( !obj->IsNullByHandle( PROP_disabled ) )
 		{
-			button->SetBitmapDisabled( obj->GetPropertyAsBitmap( _("disabled") ) );
+			button->SetBitmapDisabled( obj->GetPropertyAsBitmapByHandle( PROP_disabled ) );
 		}
 
-		if ( !obj->IsNull( _("selected") ) )
+		if ( !obj->IsNullByHandle( PROP_selected ) )
 		{
-			button->SetBitmapSelected( obj->GetPropertyAsBitmap( _("selected") ) );
+			button->SetBitmapSelected( obj->GetPropertyAsBitmapByHandle( PROP_selected ) );
 		}
 
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNullByHandle( PROP_focus ) )
 		{
-			button->SetBitmapFocus( obj->GetPropertyAsBitmap( _("focus") ) );
+			button->SetBitmapFocus( obj->GetPropertyAsBitmapByHandle( PROP_focus ) );
 		}
 
-		if ( !obj->IsNull( _("hover") ) )
+		if ( !obj->IsNullByHandle( PROP_hover ) )
 		{
-			button->SetBitmapHover( obj->GetPropertyAsBitmap( _("hover") ) );
+			button->SetBitmapHover( obj->GetPropertyAsBitmapByHandle( PROP_hover ) );
 		}
 		return button;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxBitmapButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxBitmapButton"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
-		if ( !obj->IsNull( _("disabled") ) )
+		if ( !obj->IsNullByHandle( PROP_disabled ) )
 		{
 			xrc.AddProperty(_("disabled"),_("disabled"),XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("selected") ) )
+		if ( !obj->IsNullByHandle( PROP_selected ) )
 		{
 			xrc.AddProperty(_("selected"),_("selected"),XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("focus") ) )
+		if ( !obj->IsNullByHandle( PROP_focus ) )
 		{
 			xrc.AddProperty(_("focus"),_("focus"),XRC_TYPE_BITMAP);
 		}
-		if ( !obj->IsNull( _("hover") ) )
+		if ( !obj->IsNullByHandle( PROP_hover ) )
 		{
 			xrc.AddProperty(_("hover"),_("hover"),XRC_TYPE_BITMAP);
 		}
@@ -298,21 +352,21 @@ public:
 };
 
 
-class TextCtrlComponent : public ComponentBase
+class TextCtrlComponent : public ComponentBase, public IPropertyUpdateComponent
 {
 public:
 
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxTextCtrl* tc = new wxTextCtrl((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		if ( !obj->IsNull( _("maxlength") ) )
+		if ( !obj->IsNullByHandle( PROP_maxlength ) )
 		{
-			tc->SetMaxLength( obj->GetPropertyAsInteger( _("maxlength") ) );
+			tc->SetMaxLength( obj->GetPropertyAsIntegerByHandle( PROP_maxlength ) );
 		}
 
 		tc->PushEventHandler( new ComponentEvtHandler( tc, GetManager() ) );
@@ -320,12 +374,28 @@ public:
 		return tc;
 	}
 
+	bool UpdateProperty( wxObject* wxobject, IObject* obj, const PropertyHandle& property )
+	{
+		wxTextCtrl* tc = wxDynamicCast( wxobject, wxTextCtrl );
+		if ( tc && property == PROP_value )
+		{
+			// Typing in the control modifies the property, the text is already there then
+			wxString value = obj->GetPropertyAsStringByHandle( PROP_value );
+			if ( tc->GetValue() != value )
+			{
+				tc->ChangeValue( value );
+			}
+			return true;
+		}
+		return false;
+	}
+
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxTextCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxTextCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
-        if (!obj->IsNull(_("maxlength")))
+        if (!obj->IsNullByHandle(PROP_maxlength))
             xrc.AddProperty(_("maxlength"), _("maxlength"), XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
 	}
@@ -362,26 +432,39 @@ void ComponentEvtHandler::OnText( wxCommandEvent& )
 	}
 }
 
-class StaticTextComponent : public ComponentBase
+class StaticTextComponent : public ComponentBase, public IPropertyUpdateComponent
 {
 public:
 
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxStaticText* st = new wxStaticText((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		st->Wrap( obj->GetPropertyAsInteger( _("wrap") ) );
+		st->Wrap( obj->GetPropertyAsIntegerByHandle( PROP_wrap ) );
 
 		return st;
 	}
 
+	bool UpdateProperty( wxObject* wxobject, IObject* obj, const PropertyHandle& property )
+	{
+		// The label is set again to undo the previous wrapping
+		wxStaticText* st = wxDynamicCast( wxobject, wxStaticText );
+		if ( st && ( property == PROP_label || property == PROP_wrap ) )
+		{
+			st->SetLabel( obj->GetPropertyAsStringByHandle( PROP_label ) );
+			st->Wrap( obj->GetPropertyAsIntegerByHandle( PROP_wrap ) );
+			return true;
+		}
+		return false;
+	}
+
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		wxString name = obj->GetPropertyAsString(_("name"));
+		wxString name = obj->GetPropertyAsStringByHandle(PROP_name);
 		ObjectToXrcFilter xrc(obj, _("wxStaticText"), name);
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
@@ -405,19 +488,19 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxComboBox *combo = new wxComboBox((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByHandle(PROP_choices);
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 			combo->Append(choices[i]);
 		
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByHandle(PROP_selection);
 		if( sel > -1 && sel < (int) choices.GetCount() ) combo->SetSelection(sel);
 
 		combo->PushEventHandler( new ComponentEvtHandler( combo, GetManager() ) );
@@ -427,7 +510,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxComboBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxComboBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
@@ -450,22 +533,22 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxBitmapComboBox *bcombo = new wxBitmapComboBox((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("value")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByHandle(PROP_value),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByHandle(PROP_choices);
 		for (unsigned int i=0; i<choices.GetCount(); i++)
 		{
 			wxImage img(choices[i].BeforeFirst(wxChar(58)));
 			bcombo->Append(choices[i].AfterFirst(wxChar(58)), wxBitmap(img));
 		}
 		
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByHandle(PROP_selection);
 		if( sel > -1 && sel < (int) choices.GetCount() ) bcombo->SetSelection(sel);
 		
 		bcombo->PushEventHandler( new ComponentEvtHandler( bcombo, GetManager() ) );
@@ -475,7 +558,7 @@ public:
 	
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxBitmapComboBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxBitmapComboBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"),_("value"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("choices"),_("content"),XRC_TYPE_STRINGLIST);
@@ -498,11 +581,11 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxCheckBox *res = new wxCheckBox((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_T("style")));
-        res->SetValue(obj->GetPropertyAsInteger(_T("checked")) != 0);
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style) | obj->GetPropertyAsIntegerByHandle(PROP_style));
+        res->SetValue(obj->GetPropertyAsIntegerByHandle(PROP_checked) != 0);
 
         res->PushEventHandler( new ComponentEvtHandler( res, GetManager() ) );
 
@@ -511,7 +594,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxCheckBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxCheckBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("checked"),_("checked"),XRC_TYPE_BOOL);
@@ -546,15 +629,15 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		return new wxStaticBitmap((wxWindow *)parent,-1,
-			obj->GetPropertyAsBitmap(_("bitmap")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsBitmapByHandle(PROP_bitmap),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxStaticBitmap"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxStaticBitmap"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( _("bitmap"), _("bitmap"), XRC_TYPE_BITMAP );
 		return xrc.GetXrcObject();
@@ -579,14 +662,14 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		return new wxStaticLine((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxStaticLine"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxStaticLine"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -605,9 +688,9 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxListCtrl *lc = new wxListCtrl((wxWindow*)parent, -1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxLC_VIRTUAL);
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			(obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)) & ~wxLC_VIRTUAL);
 
 
 		// Refilling
@@ -642,7 +725,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxListCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxListCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -661,14 +744,14 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxListBox *listbox = new wxListBox((wxWindow*)parent, -1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			0,
 			NULL,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		// choices
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByHandle(PROP_choices);
 		for (unsigned int i=0; i<choices.Count(); i++)
 			listbox->Append(choices[i]);
 
@@ -677,7 +760,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxListBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxListBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
 		return xrc.GetXrcObject();
@@ -697,7 +780,7 @@ class RadioBoxComponent : public ComponentBase, public wxEvtHandler
 public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByHandle(PROP_choices);
 		int count = choices.Count();
 		if ( 0 == count )
 		{
@@ -705,7 +788,7 @@ public:
 		    count = 1;
 		}
 
-		int majorDim = obj->GetPropertyAsInteger(_("majorDimension"));
+		int majorDim = obj->GetPropertyAsIntegerByHandle(PROP_majorDimension);
 		if (majorDim < 1)
 		{
 			wxLogWarning(_("majorDimension must be greater than zero."));
@@ -713,14 +796,14 @@ public:
 		}
 
 		wxRadioBox *radiobox = new wxRadioBox((wxWindow*)parent, -1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			choices,
 			majorDim,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		int selection = obj->GetPropertyAsInteger( _("selection") );
+		int selection = obj->GetPropertyAsIntegerByHandle( PROP_selection );
 		if ( selection < count )
 		{
 			radiobox->SetSelection( selection );
@@ -757,7 +840,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxRadioBox"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxRadioBox"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER );
@@ -784,18 +867,18 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxRadioButton *rb = new wxRadioButton((wxWindow *)parent,-1,
-			obj->GetPropertyAsString(_("label")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsStringByHandle(PROP_label),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		rb->SetValue( ( obj->GetPropertyAsInteger(_("value")) != 0 ) );
+		rb->SetValue( ( obj->GetPropertyAsIntegerByHandle(PROP_value) != 0 ) );
 		return rb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxRadioButton"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxRadioButton"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("label"),_("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("value"),_("value"), XRC_TYPE_BOOL);
@@ -818,8 +901,8 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxStatusBar *sb = new wxIndependentStatusBar((wxWindow*)parent, -1,
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		sb->SetFieldsCount(obj->GetPropertyAsInteger(_("fields")));
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
+		sb->SetFieldsCount(obj->GetPropertyAsIntegerByHandle(PROP_fields));
 
 		#ifndef __WXMSW__
 		sb->PushEventHandler( new wxLeftDownRedirect( sb, GetManager() ) );
@@ -829,7 +912,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxStatusBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxStatusBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("fields"),_("fields"),XRC_TYPE_INTEGER);
 		return xrc.GetXrcObject();
@@ -850,14 +933,14 @@ public:
 
 	wxObject* Create(IObject *obj, wxObject* /*parent*/)
 	{
-		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(_("style")) |
-			obj->GetPropertyAsInteger(_("window_style")));
+		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsIntegerByHandle(PROP_style) |
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 		return mb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMenuBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxMenuBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
@@ -876,7 +959,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
@@ -895,7 +978,7 @@ class SubMenuComponent : public ComponentBase
 
   ticpp::Element* ExportToXrc(IObject *obj)
   {
-    ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsString(_("name")));
+    ObjectToXrcFilter xrc(obj, _("wxMenu"), obj->GetPropertyAsStringByHandle(PROP_name));
     xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
     return xrc.GetXrcObject();
   }
@@ -914,26 +997,26 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxMenuItem"), obj->GetPropertyAsString(_("name")));
-		wxString shortcut = obj->GetPropertyAsString(_("shortcut"));
+		ObjectToXrcFilter xrc(obj, _("wxMenuItem"), obj->GetPropertyAsStringByHandle(PROP_name));
+		wxString shortcut = obj->GetPropertyAsStringByHandle(PROP_shortcut);
 		wxString label;
 		if (shortcut.IsEmpty())
-			label = obj->GetPropertyAsString(_("label"));
+			label = obj->GetPropertyAsStringByHandle(PROP_label);
 		else
-			label = obj->GetPropertyAsString(_("label")) + wxT("\t") + shortcut;
+			label = obj->GetPropertyAsStringByHandle(PROP_label) + wxT("\t") + shortcut;
 
 		xrc.AddPropertyValue(_("label"), label, true);
 		xrc.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
 
-	    if (!obj->IsNull(_("bitmap")))
+	    if (!obj->IsNullByHandle(PROP_bitmap))
 	      xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
 
-		int kind = obj->GetPropertyAsInteger(_("kind"));
+		int kind = obj->GetPropertyAsIntegerByHandle(PROP_kind);
 
-		if (obj->GetPropertyAsInteger(_("checked")) && (kind == wxITEM_RADIO || kind == wxITEM_CHECK))
+		if (obj->GetPropertyAsIntegerByHandle(PROP_checked) && (kind == wxITEM_RADIO || kind == wxITEM_CHECK))
 			xrc.AddProperty(_("checked"), _("checked"), XRC_TYPE_BOOL);
 
-		if (obj->GetPropertyAsInteger(_("enabled")) == 0)
+		if (obj->GetPropertyAsIntegerByHandle(PROP_enabled) == 0)
 			xrc.AddProperty(_("enabled"), _("enabled"), XRC_TYPE_BOOL);
 
 		switch (kind)
@@ -949,24 +1032,27 @@ public:
 	{
 		XrcToXfbFilter filter(xrcObj, _("wxMenuItem"));
 
-		try
+		ticpp::Element *labelElement = filter.GetXrcProperty("label");
+		if ( labelElement )
 		{
-			ticpp::Element *labelElement = xrcObj->FirstChildElement("label");
-			wxString label( labelElement->GetText().c_str(), wxConvUTF8 );
+			try
+			{
+				wxString label( labelElement->GetText().c_str(), wxConvUTF8 );
+
+				wxString shortcut;
+				int pos = label.Find( wxT("\\t") );
+				if ( pos >= 0 )
+				{
+					shortcut = label.Mid( pos + 2 );
+					label = label.Left( pos );
+				}
 
-			wxString shortcut;
-			int pos = label.Find( wxT("\\t") );
-			if ( pos >= 0 )
+				filter.AddPropertyValue( _("label"), label, true );
+				filter.AddPropertyValue( _("shortcut"), shortcut );
+			}
+			catch( ticpp::Exception& )
 			{
-				shortcut = label.Mid( pos + 2 );
-				label = label.Left( pos );
 			}
-
-			filter.AddPropertyValue( _("label"), label, true );
-			filter.AddPropertyValue( _("shortcut"), shortcut );
-		}
-		catch( ticpp::Exception& )
-		{
 		}
 
 		filter.AddProperty(_("help"),_("help"),XRC_TYPE_TEXT);
@@ -998,21 +1084,21 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxToolBar *tb = new wxToolBar((wxWindow*)parent, -1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNullByHandle(PROP_bitmapsize))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByHandle(PROP_bitmapsize));
+		if (!obj->IsNullByHandle(PROP_margins))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByHandle(PROP_margins));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNullByHandle(PROP_packing))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByHandle(PROP_packing));
+		if (!obj->IsNullByHandle(PROP_separation))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByHandle(PROP_separation));
 
 		tb->PushEventHandler( new ComponentEvtHandler( tb, GetManager() ) );
 		
@@ -1036,11 +1122,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsStringByHandle( PROP_label ),
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByHandle( PROP_kind ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ),
 								wxEmptyString,
 								child
 							);
@@ -1064,7 +1150,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxToolBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxToolBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
@@ -1094,7 +1180,7 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 		IObject *menuItem = menu->GetChildPtr( j );
 		if ( menuItem->GetObjectTypeName() == wxT("submenu") )
 		{
-			menuWidget->Append( lastMenuId++, menuItem->GetPropertyAsString( wxT("label") ), GetMenuFromObject( menuItem ) );
+			menuWidget->Append( lastMenuId++, menuItem->GetPropertyAsStringByHandle( PROP_label ), GetMenuFromObject( menuItem ) );
 		}
 		else if ( menuItem->GetClassName() == wxT("separator") )
 		{
@@ -1102,8 +1188,8 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 		}
 		else
 		{
-			wxString label = menuItem->GetPropertyAsString( wxT("label") );
-			wxString shortcut = menuItem->GetPropertyAsString( wxT("shortcut") );
+			wxString label = menuItem->GetPropertyAsStringByHandle( PROP_label );
+			wxString shortcut = menuItem->GetPropertyAsStringByHandle( PROP_shortcut );
 			if ( !shortcut.IsEmpty() )
 			{
 				label = label + wxChar('\t') + shortcut;
@@ -1112,41 +1198,41 @@ wxMenu* AuiToolBar::GetMenuFromObject(IObject *menu)
 			wxMenuItem *item = new wxMenuItem( 	menuWidget,
 												lastMenuId++,
 												label,
-												menuItem->GetPropertyAsString( wxT("help") ),
-												( wxItemKind ) menuItem->GetPropertyAsInteger( wxT("kind") )
+												menuItem->GetPropertyAsStringByHandle( PROP_help ),
+												( wxItemKind ) menuItem->GetPropertyAsIntegerByHandle( PROP_kind )
 											);
 
-			if ( !menuItem->IsNull( wxT("bitmap") ) )
+			if ( !menuItem->IsNullByHandle( PROP_bitmap ) )
 			{
 				wxBitmap unchecked = wxNullBitmap;
-				if ( !menuItem->IsNull( wxT("unchecked_bitmap") ) )
+				if ( !menuItem->IsNullByHandle( PROP_unchecked_bitmap ) )
 				{
-					unchecked = menuItem->GetPropertyAsBitmap( wxT("unchecked_bitmap") );
+					unchecked = menuItem->GetPropertyAsBitmapByHandle( PROP_unchecked_bitmap );
 				}
 				#ifdef __WXMSW__
-					item->SetBitmaps( menuItem->GetPropertyAsBitmap( wxT("bitmap") ), unchecked );
+					item->SetBitmaps( menuItem->GetPropertyAsBitmapByHandle( PROP_bitmap ), unchecked );
 				#elif defined( __WXGTK__ )
-					item->SetBitmap( menuItem->GetPropertyAsBitmap( wxT("bitmap") ) );
+					item->SetBitmap( menuItem->GetPropertyAsBitmapByHandle( PROP_bitmap ) );
 				#endif
 			}
 			else
 			{
-				if ( !menuItem->IsNull( wxT("unchecked_bitmap") ) )
+				if ( !menuItem->IsNullByHandle( PROP_unchecked_bitmap ) )
 				{
 					#ifdef __WXMSW__
-						item->SetBitmaps( wxNullBitmap,  menuItem->GetPropertyAsBitmap( wxT("unchecked_bitmap") ) );
+						item->SetBitmaps( wxNullBitmap,  menuItem->GetPropertyAsBitmapByHandle( PROP_unchecked_bitmap ) );
 					#endif
 				}
 			}
 
 			menuWidget->Append( item );
 
-			if ( item->GetKind() == wxITEM_CHECK && menuItem->GetPropertyAsInteger( wxT("checked") ) )
+			if ( item->GetKind() == wxITEM_CHECK && menuItem->GetPropertyAsIntegerByHandle( PROP_checked ) )
 			{
 				item->Check( true );
 			}
 
-			item->Enable( ( menuItem->GetPropertyAsInteger( wxT("enabled") ) != 0 ) );
+			item->Enable( ( menuItem->GetPropertyAsIntegerByHandle( PROP_enabled ) != 0 ) );
 		}
 	}
 
@@ -1214,21 +1300,21 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		AuiToolBar *tb = new AuiToolBar((wxWindow*)parent, GetManager(), -1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) );// | obj->GetPropertyAsInteger(_("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) );// | obj->GetPropertyAsIntegerByHandle(PROP_window_style) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(_("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(_("bitmapsize")));
-		if (!obj->IsNull(_("margins")))
+		if (!obj->IsNullByHandle(PROP_bitmapsize))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByHandle(PROP_bitmapsize));
+		if (!obj->IsNullByHandle(PROP_margins))
 		{
-			wxSize margins(obj->GetPropertyAsSize(_("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByHandle(PROP_margins));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(_("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(_("packing")));
-		if (!obj->IsNull(_("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(_("separation")));
+		if (!obj->IsNullByHandle(PROP_packing))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByHandle(PROP_packing));
+		if (!obj->IsNullByHandle(PROP_separation))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByHandle(PROP_separation));
 		
 		return tb;
 	}
@@ -1249,19 +1335,19 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( _("label") ),
-								childObj->GetPropertyAsBitmap( _("bitmap") ),
+								childObj->GetPropertyAsStringByHandle( PROP_label ),
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( _("kind") ),
-								childObj->GetPropertyAsString( _("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByHandle( PROP_kind ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ),
 								wxEmptyString,
 								child
 							);
 				wxAuiToolBarItem* itm = tb->FindToolByIndex( i );
 				itm->SetUserData( (long) child );
-				if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 1 && !itm->HasDropDown() )
+				if ( childObj->GetPropertyAsIntegerByHandle(PROP_context_menu ) == 1 && !itm->HasDropDown() )
                     tb->SetToolDropDown( itm->GetId(), true );
-				else if ( childObj->GetPropertyAsInteger(_("context_menu") ) == 0 && itm->HasDropDown() )
+				else if ( childObj->GetPropertyAsIntegerByHandle(PROP_context_menu ) == 0 && itm->HasDropDown() )
 					tb->SetToolDropDown( itm->GetId(), false );
 			}
 			else if ( wxT("toolSeparator") == childObj->GetClassName() )
@@ -1282,7 +1368,7 @@ public:
 /*
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxAuiToolBar"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxAuiToolBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("bitmapsize"), _("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("margins"), _("margins"), XRC_TYPE_SIZE);
@@ -1328,13 +1414,13 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("tool"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("tool"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("tooltip"), _("tooltip"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("statusbar"), _("longhelp"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
 
-		wxItemKind kind = (wxItemKind)obj->GetPropertyAsInteger(_("kind"));
+		wxItemKind kind = (wxItemKind)obj->GetPropertyAsIntegerByHandle(PROP_kind);
 		if ( wxITEM_CHECK == kind )
 		{
 			xrc.AddPropertyValue( wxT("toggle"), wxT("1") );
@@ -1355,7 +1441,7 @@ public:
 		filter.AddProperty(_("bitmap"), _("bitmap"), XRC_TYPE_BITMAP);
 		bool gotToggle = false;
 		bool gotRadio = false;
-		ticpp::Element* toggle = xrcObj->FirstChildElement( "toggle", false );
+		ticpp::Element* toggle = filter.GetXrcProperty( "toggle" );
 		if ( toggle )
 		{
 			toggle->GetTextOrDefault( &gotToggle, false );
@@ -1366,7 +1452,7 @@ public:
 		}
 		if ( !gotToggle )
 		{
-			ticpp::Element* radio = xrcObj->FirstChildElement( "radio", false );
+			ticpp::Element* radio = filter.GetXrcProperty( "radio" );
 			if ( radio )
 			{
 				radio->GetTextOrDefault( &gotRadio, false );
@@ -1406,19 +1492,19 @@ class ChoiceComponent : public ComponentBase
 public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
-		wxArrayString choices = obj->GetPropertyAsArrayString(_("choices"));
+		wxArrayString choices = obj->GetPropertyAsArrayStringByHandle(PROP_choices);
 		wxString *strings = new wxString[choices.GetCount()];
 		for (unsigned int i=0; i < choices.GetCount(); i++)
 			strings[i] = choices[i];
 
 		wxChoice *choice = new wxChoice((wxWindow*)parent, -1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
 			(int)choices.Count(),
 			strings,
-			obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		int sel = obj->GetPropertyAsInteger(_("selection"));
+		int sel = obj->GetPropertyAsIntegerByHandle(PROP_selection);
 		if( sel < (int) choices.GetCount() ) choice->SetSelection(sel);
 
 		delete []strings;
@@ -1430,7 +1516,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxChoice"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxChoice"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("selection"), _("selection"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("choices"), _("content"), XRC_TYPE_STRINGLIST);
@@ -1478,17 +1564,17 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		return new wxSlider((wxWindow *)parent,-1,
-			obj->GetPropertyAsInteger(_("value")),
-			obj->GetPropertyAsInteger(_("minValue")),
-			obj->GetPropertyAsInteger(_("maxValue")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsIntegerByHandle(PROP_value),
+			obj->GetPropertyAsIntegerByHandle(PROP_minValue),
+			obj->GetPropertyAsIntegerByHandle(PROP_maxValue),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxSlider"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxSlider"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
 		xrc.AddProperty( _("minValue"), _("min"), XRC_TYPE_INTEGER);
@@ -1514,17 +1600,17 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxGauge *gauge = new wxGauge((wxWindow *)parent,-1,
-			obj->GetPropertyAsInteger(_("range")),
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
-		gauge->SetValue(obj->GetPropertyAsInteger(_("value")));
+			obj->GetPropertyAsIntegerByHandle(PROP_range),
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
+		gauge->SetValue(obj->GetPropertyAsIntegerByHandle(PROP_value));
 		return gauge;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxGauge"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxGauge"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("range"), _("range"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("value"), _("value"), XRC_TYPE_INTEGER);
@@ -1549,23 +1635,23 @@ public:
 	{
 		wxAnimationCtrl* ac = new wxAnimationCtrl((wxWindow *)parent, wxID_ANY,
 			wxNullAnimation,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		if ( !obj->IsNull( _("animation") ) )
+		if ( !obj->IsNullByHandle( PROP_animation ) )
 		{
-			if( ac->LoadFile( obj->GetPropertyAsString( _("animation") ) ) )
+			if( ac->LoadFile( obj->GetPropertyAsStringByHandle( PROP_animation ) ) )
 			{
-				if ( !obj->IsNull( _("play") ) && ( obj->GetPropertyAsInteger( _("play") ) == 1 ) ) ac->Play();
+				if ( !obj->IsNullByHandle( PROP_play ) && ( obj->GetPropertyAsIntegerByHandle( PROP_play ) == 1 ) ) ac->Play();
 				else
 					ac->Stop();
 			}
 		}
 		
-		if ( !obj->IsNull( _("inactive_bitmap") ) )
+		if ( !obj->IsNullByHandle( PROP_inactive_bitmap ) )
 		{
-			wxBitmap bmp = obj->GetPropertyAsBitmap( _("inactive_bitmap") );
+			wxBitmap bmp = obj->GetPropertyAsBitmapByHandle( PROP_inactive_bitmap );
 			if( bmp.IsOk() ) ac->SetInactiveBitmap( bmp );
 			else
 				ac->SetInactiveBitmap( wxNullBitmap );
@@ -1578,7 +1664,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxAnimationCtrl"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxAnimationCtrl"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("animation"),_("animation"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
@@ -1601,9 +1687,9 @@ public:
 	{
 		wxInfoBar* ib = new wxInfoBar((wxWindow *)parent);
 			
-		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsInteger(_("show_effect")),
-								(wxShowEffect)obj->GetPropertyAsInteger(_("hide_effect")) );
-		ib->SetEffectDuration( obj->GetPropertyAsInteger(_("duration")) );
+		ib->SetShowHideEffects( (wxShowEffect)obj->GetPropertyAsIntegerByHandle(PROP_show_effect),
+								(wxShowEffect)obj->GetPropertyAsIntegerByHandle(PROP_hide_effect) );
+		ib->SetEffectDuration( obj->GetPropertyAsIntegerByHandle(PROP_duration) );
 		ib->ShowMessage( wxT("Message ..."), wxICON_INFORMATION );
 
 		ib->PushEventHandler( new ComponentEvtHandler( ib, GetManager() ) );
@@ -1613,9 +1699,9 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("unknown"), obj->GetPropertyAsStringByHandle(PROP_name));
 		
-		/*ObjectToXrcFilter xrc(obj, _("wxInfoBar"), obj->GetPropertyAsString(_("name")));
+		/*ObjectToXrcFilter xrc(obj, _("wxInfoBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();*/
 		
 		return xrc.GetXrcObject();
@@ -1686,152 +1772,155 @@ WINDOW_COMPONENT("wxAnimationCtrl", AnimCtrlComponent)
 WINDOW_COMPONENT("wxInfoBar", InfoBarComponent)
 #endif
 
+BEGIN_MACROS()
+
 // wxButton
-MACRO(wxBU_LEFT)
-MACRO(wxBU_TOP)
-MACRO(wxBU_RIGHT)
-MACRO(wxBU_BOTTOM)
-MACRO(wxBU_EXACTFIT)
-MACRO(wxBU_AUTODRAW)
+MACRO_ENTRY(wxBU_LEFT)
+MACRO_ENTRY(wxBU_TOP)
+MACRO_ENTRY(wxBU_RIGHT)
+MACRO_ENTRY(wxBU_BOTTOM)
+MACRO_ENTRY(wxBU_EXACTFIT)
+MACRO_ENTRY(wxBU_AUTODRAW)
 
 // wxStaticText
-MACRO(wxALIGN_LEFT)
-MACRO(wxALIGN_CENTRE)
-MACRO(wxALIGN_RIGHT)
-MACRO(wxST_NO_AUTORESIZE)
+MACRO_ENTRY(wxALIGN_LEFT)
+MACRO_ENTRY(wxALIGN_CENTRE)
+MACRO_ENTRY(wxALIGN_RIGHT)
+MACRO_ENTRY(wxST_NO_AUTORESIZE)
 
 // wxTextCtrl
-MACRO(wxTE_MULTILINE)
-MACRO(wxTE_READONLY)
-MACRO(wxTE_RICH)
-MACRO(wxTE_AUTO_URL)
-MACRO(wxTE_CAPITALIZE)
-MACRO(wxTE_CENTRE)
-MACRO(wxTE_CHARWRAP)
-MACRO(wxTE_DONTWRAP)
-MACRO(wxTE_LEFT)
-MACRO(wxTE_NOHIDESEL)
-MACRO(wxTE_PASSWORD)
-MACRO(wxTE_PROCESS_ENTER)
-MACRO(wxTE_PROCESS_TAB)
-MACRO(wxTE_RICH2)
-MACRO(wxTE_RIGHT)
-MACRO(wxTE_WORDWRAP)
+MACRO_ENTRY(wxTE_MULTILINE)
+MACRO_ENTRY(wxTE_READONLY)
+MACRO_ENTRY(wxTE_RICH)
+MACRO_ENTRY(wxTE_AUTO_URL)
+MACRO_ENTRY(wxTE_CAPITALIZE)
+MACRO_ENTRY(wxTE_CENTRE)
+MACRO_ENTRY(wxTE_CHARWRAP)
+MACRO_ENTRY(wxTE_DONTWRAP)
+MACRO_ENTRY(wxTE_LEFT)
+MACRO_ENTRY(wxTE_NOHIDESEL)
+MACRO_ENTRY(wxTE_PASSWORD)
+MACRO_ENTRY(wxTE_PROCESS_ENTER)
+MACRO_ENTRY(wxTE_PROCESS_TAB)
+MACRO_ENTRY(wxTE_RICH2)
+MACRO_ENTRY(wxTE_RIGHT)
+MACRO_ENTRY(wxTE_WORDWRAP)
 
 // wxStaticLine
-MACRO(wxLI_HORIZONTAL)
-MACRO(wxLI_VERTICAL)
+MACRO_ENTRY(wxLI_HORIZONTAL)
+MACRO_ENTRY(wxLI_VERTICAL)
 
 // wxListCtrl
-MACRO(wxLC_LIST)
-MACRO(wxLC_REPORT)
-MACRO(wxLC_VIRTUAL)
-MACRO(wxLC_ICON)
-MACRO(wxLC_SMALL_ICON)
-MACRO(wxLC_ALIGN_TOP)
-MACRO(wxLC_ALIGN_LEFT)
-MACRO(wxLC_AUTOARRANGE)
-MACRO(wxLC_EDIT_LABELS)
-MACRO(wxLC_NO_SORT_HEADER)
-MACRO(wxLC_NO_HEADER)
-MACRO(wxLC_SINGLE_SEL)
-MACRO(wxLC_SORT_ASCENDING)
-MACRO(wxLC_SORT_DESCENDING)
-MACRO(wxLC_HRULES)
-MACRO(wxLC_VRULES)
+MACRO_ENTRY(wxLC_LIST)
+MACRO_ENTRY(wxLC_REPORT)
+MACRO_ENTRY(wxLC_VIRTUAL)
+MACRO_ENTRY(wxLC_ICON)
+MACRO_ENTRY(wxLC_SMALL_ICON)
+MACRO_ENTRY(wxLC_ALIGN_TOP)
+MACRO_ENTRY(wxLC_ALIGN_LEFT)
+MACRO_ENTRY(wxLC_AUTOARRANGE)
+MACRO_ENTRY(wxLC_EDIT_LABELS)
+MACRO_ENTRY(wxLC_NO_SORT_HEADER)
+MACRO_ENTRY(wxLC_NO_HEADER)
+MACRO_ENTRY(wxLC_SINGLE_SEL)
+MACRO_ENTRY(wxLC_SORT_ASCENDING)
+MACRO_ENTRY(wxLC_SORT_DESCENDING)
+MACRO_ENTRY(wxLC_HRULES)
+MACRO_ENTRY(wxLC_VRULES)
 
 // wxListBox
-MACRO(wxLB_SINGLE)
-MACRO(wxLB_MULTIPLE)
-MACRO(wxLB_EXTENDED)
-MACRO(wxLB_HSCROLL)
-MACRO(wxLB_ALWAYS_SB)
-MACRO(wxLB_NEEDED_SB)
-MACRO(wxLB_SORT)
+MACRO_ENTRY(wxLB_SINGLE)
+MACRO_ENTRY(wxLB_MULTIPLE)
+MACRO_ENTRY(wxLB_EXTENDED)
+MACRO_ENTRY(wxLB_HSCROLL)
+MACRO_ENTRY(wxLB_ALWAYS_SB)
+MACRO_ENTRY(wxLB_NEEDED_SB)
+MACRO_ENTRY(wxLB_SORT)
 
 // wxRadioBox
-MACRO(wxRA_SPECIFY_ROWS)
-MACRO(wxRA_SPECIFY_COLS)
+MACRO_ENTRY(wxRA_SPECIFY_ROWS)
+MACRO_ENTRY(wxRA_SPECIFY_COLS)
 #if wxVERSION_NUMBER < 2900
-MACRO(wxRA_USE_CHECKBOX)
+MACRO_ENTRY(wxRA_USE_CHECKBOX)
 #endif
 
 // wxRadioButton
-MACRO(wxRB_GROUP)
-MACRO(wxRB_SINGLE)
+MACRO_ENTRY(wxRB_GROUP)
+MACRO_ENTRY(wxRB_SINGLE)
 #if wxVERSION_NUMBER < 2900
-MACRO(wxRB_USE_CHECKBOX)
+MACRO_ENTRY(wxRB_USE_CHECKBOX)
 #endif
 
 // wxStatusBar
-MACRO(wxST_SIZEGRIP)
+MACRO_ENTRY(wxST_SIZEGRIP)
 
 // wxMenuBar
-MACRO(wxMB_DOCKABLE)
+MACRO_ENTRY(wxMB_DOCKABLE)
 
 // wxMenuItem & wxTool
-MACRO(wxITEM_NORMAL)
-MACRO(wxITEM_CHECK)
-MACRO(wxITEM_RADIO)
+MACRO_ENTRY(wxITEM_NORMAL)
+MACRO_ENTRY(wxITEM_CHECK)
+MACRO_ENTRY(wxITEM_RADIO)
 
 // wxToolBar
-MACRO(wxTB_FLAT)
-MACRO(wxTB_DOCKABLE)
-MACRO(wxTB_HORIZONTAL)
-MACRO(wxTB_VERTICAL)
-MACRO(wxTB_TEXT)
-MACRO(wxTB_NOICONS)
-MACRO(wxTB_NODIVIDER)
-MACRO(wxTB_NOALIGN)
-MACRO(wxTB_HORZ_LAYOUT)
-MACRO(wxTB_HORZ_TEXT)
+MACRO_ENTRY(wxTB_FLAT)
+MACRO_ENTRY(wxTB_DOCKABLE)
+MACRO_ENTRY(wxTB_HORIZONTAL)
+MACRO_ENTRY(wxTB_VERTICAL)
+MACRO_ENTRY(wxTB_TEXT)
+MACRO_ENTRY(wxTB_NOICONS)
+MACRO_ENTRY(wxTB_NODIVIDER)
+MACRO_ENTRY(wxTB_NOALIGN)
+MACRO_ENTRY(wxTB_HORZ_LAYOUT)
+MACRO_ENTRY(wxTB_HORZ_TEXT)
 
 // wxSlider
-MACRO(wxSL_AUTOTICKS)
-MACRO(wxSL_BOTTOM)
-MACRO(wxSL_HORIZONTAL)
-MACRO(wxSL_INVERSE)
-MACRO(wxSL_LABELS)
-MACRO(wxSL_LEFT)
-MACRO(wxSL_RIGHT)
-MACRO(wxSL_SELRANGE)
-MACRO(wxSL_TOP)
-MACRO(wxSL_VERTICAL)
-MACRO(wxSL_BOTH)
+MACRO_ENTRY(wxSL_AUTOTICKS)
+MACRO_ENTRY(wxSL_BOTTOM)
+MACRO_ENTRY(wxSL_HORIZONTAL)
+MACRO_ENTRY(wxSL_INVERSE)
+MACRO_ENTRY(wxSL_LABELS)
+MACRO_ENTRY(wxSL_LEFT)
+MACRO_ENTRY(wxSL_RIGHT)
+MACRO_ENTRY(wxSL_SELRANGE)
+MACRO_ENTRY(wxSL_TOP)
+MACRO_ENTRY(wxSL_VERTICAL)
+MACRO_ENTRY(wxSL_BOTH)
 
 // wxComboBox
-MACRO(wxCB_DROPDOWN)
-MACRO(wxCB_READONLY)
-MACRO(wxCB_SIMPLE)
-MACRO(wxCB_SORT)
+MACRO_ENTRY(wxCB_DROPDOWN)
+MACRO_ENTRY(wxCB_READONLY)
+MACRO_ENTRY(wxCB_SIMPLE)
+MACRO_ENTRY(wxCB_SORT)
 
 // wxCheckBox
-MACRO(wxCHK_2STATE)
-MACRO(wxCHK_3STATE)
-MACRO(wxCHK_ALLOW_3RD_STATE_FOR_USER)
+MACRO_ENTRY(wxCHK_2STATE)
+MACRO_ENTRY(wxCHK_3STATE)
+MACRO_ENTRY(wxCHK_ALLOW_3RD_STATE_FOR_USER)
 
 // wxGauge
-MACRO(wxGA_HORIZONTAL)
-MACRO(wxGA_SMOOTH)
-MACRO(wxGA_VERTICAL)
+MACRO_ENTRY(wxGA_HORIZONTAL)
+MACRO_ENTRY(wxGA_SMOOTH)
+MACRO_ENTRY(wxGA_VERTICAL)
 
 // wxAnimationCtrl
-MACRO(wxAC_DEFAULT_STYLE)
-MACRO(wxAC_NO_AUTORESIZE)
+MACRO_ENTRY(wxAC_DEFAULT_STYLE)
+MACRO_ENTRY(wxAC_NO_AUTORESIZE)
 
 // wxInfoBar
 #if wxVERSION_NUMBER >= 2904
-MACRO(wxSHOW_EFFECT_NONE)
-MACRO(wxSHOW_EFFECT_ROLL_TO_LEFT)
-MACRO(wxSHOW_EFFECT_ROLL_TO_RIGHT)
-MACRO(wxSHOW_EFFECT_ROLL_TO_TOP)
-MACRO(wxSHOW_EFFECT_ROLL_TO_BOTTOM)
-MACRO(wxSHOW_EFFECT_SLIDE_TO_LEFT)
-MACRO(wxSHOW_EFFECT_SLIDE_TO_RIGHT)
-MACRO(wxSHOW_EFFECT_SLIDE_TO_TOP)
-MACRO(wxSHOW_EFFECT_SLIDE_TO_BOTTOM)
-MACRO(wxSHOW_EFFECT_BLEND)
-MACRO(wxSHOW_EFFECT_EXPAND)
+MACRO_ENTRY(wxSHOW_EFFECT_NONE)
+MACRO_ENTRY(wxSHOW_EFFECT_ROLL_TO_LEFT)
+MACRO_ENTRY(wxSHOW_EFFECT_ROLL_TO_RIGHT)
+MACRO_ENTRY(wxSHOW_EFFECT_ROLL_TO_TOP)
+MACRO_ENTRY(wxSHOW_EFFECT_ROLL_TO_BOTTOM)
+MACRO_ENTRY(wxSHOW_EFFECT_SLIDE_TO_LEFT)
+MACRO_ENTRY(wxSHOW_EFFECT_SLIDE_TO_RIGHT)
+MACRO_ENTRY(wxSHOW_EFFECT_SLIDE_TO_TOP)
+MACRO_ENTRY(wxSHOW_EFFECT_SLIDE_TO_BOTTOM)
+MACRO_ENTRY(wxSHOW_EFFECT_BLEND)
+MACRO_ENTRY(wxSHOW_EFFECT_EXPAND)
+END_MACROS()
 #endif
 
 END_LIBRARY()
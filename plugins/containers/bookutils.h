@@ -33,6 +33,12 @@
 #include <wx/choicebk.h>
 #include <wx/aui/auibook.h>
 
+// Properties read by the components
+PROPERTY_HANDLE( bitmap )
+PROPERTY_HANDLE( bitmapsize )
+PROPERTY_HANDLE( label )
+PROPERTY_HANDLE( select )
+
 class SuppressEventHandlers
 {
 private:
@@ -65,9 +71,9 @@ namespace BookUtils
 	template < class T >
 		void AddImageList( IObject* obj, T* book )
 	{
-		if ( !obj->GetPropertyAsString( _("bitmapsize") ).empty() )
+		if ( !obj->GetPropertyAsStringByHandle( PROP_bitmapsize ).empty() )
 		{
-			wxSize imageSize = obj->GetPropertyAsSize(_("bitmapsize"));
+			wxSize imageSize = obj->GetPropertyAsSizeByHandle(PROP_bitmapsize);
 			wxImageList* images = new wxImageList( imageSize.GetWidth(), imageSize.GetHeight() );
 			wxImage image = wxBitmap( default_xpm ).ConvertToImage();
 			images->Add( image.Scale( imageSize.GetWidth(), imageSize.GetHeight() ) );
@@ -106,7 +112,7 @@ namespace BookUtils
 
 		// Save selection
 		int selection = book->GetSelection();
-		book->AddPage( page, obj->GetPropertyAsString( _("label") ) );
+		book->AddPage( page, obj->GetPropertyAsStringByHandle( PROP_label ) );
 
 		// Apply image to page
 		IObject* parentObj = manager->GetIObject( wxparent );
@@ -116,11 +122,11 @@ namespace BookUtils
 			return;
 		}
 
-		if ( !parentObj->GetPropertyAsString( _("bitmapsize") ).empty() )
+		if ( !parentObj->GetPropertyAsStringByHandle( PROP_bitmapsize ).empty() )
 		{
-			if ( !obj->GetPropertyAsString( _("bitmap") ).empty() )
+			if ( !obj->GetPropertyAsStringByHandle( PROP_bitmap ).empty() )
 			{
-				wxSize imageSize = parentObj->GetPropertyAsSize( _("bitmapsize") );
+				wxSize imageSize = parentObj->GetPropertyAsSizeByHandle( PROP_bitmapsize );
 				int width = imageSize.GetWidth();
 				int height = imageSize.GetHeight();
 				if ( width > 0 && height > 0 )
@@ -128,7 +134,7 @@ namespace BookUtils
 					wxImageList* imageList = book->GetImageList();
 					if ( imageList != NULL )
 					{
-						wxImage image = obj->GetPropertyAsBitmap( _("bitmap") ).ConvertToImage();
+						wxImage image = obj->GetPropertyAsBitmapByHandle( PROP_bitmap ).ConvertToImage();
 						imageList->Add( image.Scale( width, height ) );
 						book->SetPageImage( book->GetPageCount() - 1, imageList->GetImageCount() - 1 );
 					}
@@ -136,7 +142,7 @@ namespace BookUtils
 			}
 		}
 
-		if ( obj->GetPropertyAsString( _("select") ) == wxT("0") && selection >= 0 )
+		if ( obj->GetPropertyAsStringByHandle( PROP_select ) == wxT("0") && selection >= 0 )
 		{
 			book->SetSelection(selection);
 		}
@@ -36,9 +36,26 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Properties read by the components
+PROPERTY_HANDLE( min_pane_size )
+PROPERTY_HANDLE( name )
+PROPERTY_HANDLE( pos )
+PROPERTY_HANDLE( sashgravity )
+PROPERTY_HANDLE( sashpos )
+PROPERTY_HANDLE( sashsize )
+PROPERTY_HANDLE( scroll_rate_x )
+PROPERTY_HANDLE( scroll_rate_y )
+PROPERTY_HANDLE( size )
+PROPERTY_HANDLE( splitmode )
+PROPERTY_HANDLE( style )
+PROPERTY_HANDLE( tab_ctrl_height )
+PROPERTY_HANDLE( uniform_bitmap_size )
+PROPERTY_HANDLE( window_style )
+
 /**
 Event handler for events generated by controls in this plugin
 */
+
 class ComponentEvtHandler : public wxEvtHandler
 {
 private:
@@ -82,11 +99,11 @@ protected:
 			IObject*  iChild = m_manager->GetIObject( wxChild );
 			if ( iChild )
 			{
-				if ( (int)i == selPage && !iChild->GetPropertyAsInteger( _("select") ) )
+				if ( (int)i == selPage && !iChild->GetPropertyAsIntegerByHandle( PROP_select ) )
 				{
 					m_manager->ModifyProperty( wxChild, _("select"), wxT("1"), false );
 				}
-				else if ( (int)i != selPage && iChild->GetPropertyAsInteger( _("select") ) )
+				else if ( (int)i != selPage && iChild->GetPropertyAsIntegerByHandle( PROP_select ) )
 				{
 					m_manager->ModifyProperty( wxChild, _("select"), wxT("0"), false );
 				}
@@ -211,15 +228,15 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxPanel* panel = new wxPanel((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 		return panel;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxPanel"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxPanel"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -239,13 +256,13 @@ class SplitterWindowComponent : public ComponentBase
 	{
 		wxCustomSplitterWindow *splitter =
 			new wxCustomSplitterWindow((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			(obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style"))) & ~wxSP_PERMIT_UNSPLIT );
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			(obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style)) & ~wxSP_PERMIT_UNSPLIT );
 
-		if ( !obj->IsNull( _("sashgravity") ) )
+		if ( !obj->IsNullByHandle( PROP_sashgravity ) )
 		{
-			float gravity = obj->GetPropertyAsFloat( _("sashgravity") );
+			float gravity = obj->GetPropertyAsFloatByHandle( PROP_sashgravity );
 			gravity = ( gravity < 0.0 ? 0.0 : gravity );
 			gravity = ( gravity > 1.0 ? 1.0 : gravity );
 			splitter->SetSashGravity( gravity );
@@ -253,14 +270,14 @@ class SplitterWindowComponent : public ComponentBase
 #if wxVERSION_NUMBER < 2900
 // From 2.9 docs: The sash size is platform-dependent because
 // it conforms to the current platform look-and-feel and cannot be changed. 
-		if ( !obj->IsNull( _("sashsize") ) )
+		if ( !obj->IsNullByHandle( PROP_sashsize ) )
 		{
-			splitter->SetSashSize( obj->GetPropertyAsInteger( _("sashsize") ) );
+			splitter->SetSashSize( obj->GetPropertyAsIntegerByHandle( PROP_sashsize ) );
 		}
 #endif
-		if ( !obj->IsNull( _("min_pane_size") ) )
+		if ( !obj->IsNullByHandle( PROP_min_pane_size ) )
 		{
-			int minPaneSize = obj->GetPropertyAsInteger( _("min_pane_size") );
+			int minPaneSize = obj->GetPropertyAsIntegerByHandle( PROP_min_pane_size );
 			splitter->m_customMinPaneSize = minPaneSize;
 			minPaneSize = ( minPaneSize < 1 ? 1 : minPaneSize );
 			splitter->SetMinimumPaneSize( minPaneSize );
@@ -270,7 +287,7 @@ class SplitterWindowComponent : public ComponentBase
 		splitter->Initialize( new wxPanel( splitter ) );
 
 		// Used to ensure sash position is correct
-		splitter->m_initialSashPos = obj->GetPropertyAsInteger( _("sashpos") );
+		splitter->m_initialSashPos = obj->GetPropertyAsIntegerByHandle( PROP_sashpos );
 		splitter->Connect( wxEVT_IDLE, wxIdleEventHandler( wxCustomSplitterWindow::OnIdle ) );
 
 		return splitter;
@@ -278,12 +295,12 @@ class SplitterWindowComponent : public ComponentBase
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxSplitterWindow"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxSplitterWindow"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(_("sashpos"),_("sashpos"),XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("sashgravity"),_("gravity"),XRC_TYPE_FLOAT);
 		xrc.AddProperty(_("min_pane_size"),_("minsize"),XRC_TYPE_INTEGER);
-		if (obj->GetPropertyAsString(_("splitmode")) == wxT("wxSPLIT_VERTICAL"))
+		if (obj->GetPropertyAsStringByHandle(PROP_splitmode) == wxT("wxSPLIT_VERTICAL"))
 			xrc.AddPropertyValue(_("orientation"),wxT("vertical"));
 		else
 			xrc.AddPropertyValue(_("orientation"),wxT("horizontal"));
@@ -300,12 +317,15 @@ class SplitterWindowComponent : public ComponentBase
 		filter.AddProperty(_("minsize"),_("min_pane_size"),XRC_TYPE_INTEGER);
 		try
 		{
-			ticpp::Element *splitmode = xrcObj->FirstChildElement("orientation");
-			std::string value = splitmode->GetText();
-			if (value == "vertical")
-				filter.AddPropertyValue(wxT("splitmode"),wxT("wxSPLIT_VERTICAL"));
-			else
-				filter.AddPropertyValue(wxT("splitmode"),wxT("wxSPLIT_HORIZONTAL"));
+			ticpp::Element *splitmode = filter.GetXrcProperty("orientation");
+			if ( splitmode )
+			{
+				std::string value = splitmode->GetText();
+				if (value == "vertical")
+					filter.AddPropertyValue(wxT("splitmode"),wxT("wxSPLIT_VERTICAL"));
+				else
+					filter.AddPropertyValue(wxT("splitmode"),wxT("wxSPLIT_HORIZONTAL"));
+			}
 		}
 		catch( ticpp::Exception& )
 		{
@@ -377,8 +397,8 @@ class SplitterWindowComponent : public ComponentBase
 					return;
 				}
 
-				int sashPos = obj->GetPropertyAsInteger(_("sashpos"));
-				int splitmode = obj->GetPropertyAsInteger(_("splitmode"));
+				int sashPos = obj->GetPropertyAsIntegerByHandle(PROP_sashpos);
+				int splitmode = obj->GetPropertyAsIntegerByHandle(PROP_splitmode);
 
 				if ( firstChild )
 				{
@@ -433,23 +453,23 @@ public:
     wxObject* Create(IObject *obj, wxObject *parent)
     {
         wxScrolledWindow *sw = new wxScrolledWindow((wxWindow *)parent, -1,
-            obj->GetPropertyAsPoint(_("pos")),
-            obj->GetPropertyAsSize(_("size")),
-            obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+            obj->GetPropertyAsPointByHandle(PROP_pos),
+            obj->GetPropertyAsSizeByHandle(PROP_size),
+            obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
         sw->SetScrollRate(
-            obj->GetPropertyAsInteger(_("scroll_rate_x")),
-            obj->GetPropertyAsInteger(_("scroll_rate_y")));
+            obj->GetPropertyAsIntegerByHandle(PROP_scroll_rate_x),
+            obj->GetPropertyAsIntegerByHandle(PROP_scroll_rate_y));
         return sw;
     }
 
     ticpp::Element* ExportToXrc(IObject *obj)
     {
-        ObjectToXrcFilter xrc(obj, _("wxScrolledWindow"), obj->GetPropertyAsString(_("name")));
+        ObjectToXrcFilter xrc(obj, _("wxScrolledWindow"), obj->GetPropertyAsStringByHandle(PROP_name));
         xrc.AddWindowProperties();
 		xrc.AddPropertyValue( _("scrollrate"), wxString::Format( wxT("%d,%d"),
-				obj->GetPropertyAsInteger(_("scroll_rate_x")),
-				obj->GetPropertyAsInteger(_("scroll_rate_y")) ) );
+				obj->GetPropertyAsIntegerByHandle(PROP_scroll_rate_x),
+				obj->GetPropertyAsIntegerByHandle(PROP_scroll_rate_y) ) );
         return xrc.GetXrcObject();
     }
 
@@ -458,7 +478,7 @@ public:
         XrcToXfbFilter filter(xrcObj, _("wxScrolledWindow"));
         filter.AddWindowProperties();
 		
-		ticpp::Element *scrollrate = xrcObj->FirstChildElement("scrollrate");
+		ticpp::Element *scrollrate = filter.GetXrcProperty("scrollrate");
 		if( scrollrate ) {
 			wxString value( wxString( scrollrate->GetText().c_str(), wxConvUTF8 ) );
 			filter.AddPropertyValue( _("scroll_rate_x"), value.BeforeFirst( wxT(',') ) );
@@ -475,9 +495,9 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxNotebook* book = new wxCustomNotebook((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -488,7 +508,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxNotebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxNotebook"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -525,7 +545,7 @@ public:
 		ObjectToXrcFilter xrc(obj, _("notebookpage"));
 		xrc.AddProperty(_("label"),_("label"),XRC_TYPE_TEXT);
 		xrc.AddProperty(_("select"),_("selected"),XRC_TYPE_BOOL);
-		if ( !obj->IsNull( _("bitmap") ) )
+		if ( !obj->IsNullByHandle( PROP_bitmap ) )
 		{
 			xrc.AddProperty(_("bitmap"),_("bitmap"),XRC_TYPE_BITMAP);
 		}
@@ -549,9 +569,9 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxListbook* book = new wxListbook((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		BookUtils::AddImageList( obj, book );
 
@@ -569,7 +589,7 @@ public:
 		{
 			// Small icon style if bitmapsize is not set
 			IObject* obj = GetManager()->GetIObject( wxobject );
-			if ( obj->GetPropertyAsString( _("bitmapsize") ).empty() )
+			if ( obj->GetPropertyAsStringByHandle( PROP_bitmapsize ).empty() )
 			{
 				wxListView* tmpListView = book->GetListView();
 				long flags = tmpListView->GetWindowStyleFlag();
@@ -582,7 +602,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxListbook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxListbook"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -638,9 +658,9 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxChoicebook* book = new wxChoicebook((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -649,7 +669,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxChoicebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxChoicebook"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -705,12 +725,12 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxAuiNotebook* book = new wxAuiNotebook((wxWindow *)parent,-1,
-			obj->GetPropertyAsPoint(_("pos")),
-			obj->GetPropertyAsSize(_("size")),
-			obj->GetPropertyAsInteger(_("style")) | obj->GetPropertyAsInteger(_("window_style")));
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 
-		book->SetTabCtrlHeight( obj->GetPropertyAsInteger( _("tab_ctrl_height") ) );
-		book->SetUniformBitmapSize( obj->GetPropertyAsSize( _("uniform_bitmap_size") ) );
+		book->SetTabCtrlHeight( obj->GetPropertyAsIntegerByHandle( PROP_tab_ctrl_height ) );
+		book->SetUniformBitmapSize( obj->GetPropertyAsSizeByHandle( PROP_uniform_bitmap_size ) );
 
 		book->PushEventHandler( new ComponentEvtHandler( book, GetManager() ) );
 
@@ -720,7 +740,7 @@ public:
 #if wxVERSION_NUMBER >= 2905
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxAuiNotebook"), obj->GetPropertyAsString(_("name")));
+		ObjectToXrcFilter xrc(obj, _("wxAuiNotebook"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -773,10 +793,10 @@ public:
 
 		// Save selection
 		int selection = book->GetSelection();
-		const wxBitmap& bitmap = obj->IsNull( _("bitmap") ) ? wxNullBitmap : obj->GetPropertyAsBitmap( _("bitmap") );
-		book->AddPage( page, obj->GetPropertyAsString( _("label") ), false, bitmap );
+		const wxBitmap& bitmap = obj->IsNullByHandle( PROP_bitmap ) ? wxNullBitmap : obj->GetPropertyAsBitmapByHandle( PROP_bitmap );
+		book->AddPage( page, obj->GetPropertyAsStringByHandle( PROP_label ), false, bitmap );
 
-		if ( obj->GetPropertyAsString( _("select") ) == wxT("0") && selection >= 0 )
+		if ( obj->GetPropertyAsStringByHandle( PROP_select ) == wxT("0") && selection >= 0 )
 		{
 			book->SetSelection(selection);
 		}
@@ -837,59 +857,62 @@ ABSTRACT_COMPONENT("choicebookpage", ChoicebookPageComponent)
 WINDOW_COMPONENT("wxAuiNotebook", AuiNotebookComponent)
 ABSTRACT_COMPONENT("auinotebookpage", AuiNotebookPageComponent)
 
+BEGIN_MACROS()
+
 // wxSplitterWindow
-MACRO(wxSP_3D)
-MACRO(wxSP_3DSASH)
-MACRO(wxSP_3DBORDER)
-MACRO(wxSP_BORDER)
-MACRO(wxSP_NOBORDER)
-MACRO(wxSP_NO_XP_THEME)
-MACRO(wxSP_PERMIT_UNSPLIT)
-MACRO(wxSP_LIVE_UPDATE)
-
-MACRO(wxSPLIT_VERTICAL)
-MACRO(wxSPLIT_HORIZONTAL)
+MACRO_ENTRY(wxSP_3D)
+MACRO_ENTRY(wxSP_3DSASH)
+MACRO_ENTRY(wxSP_3DBORDER)
+MACRO_ENTRY(wxSP_BORDER)
+MACRO_ENTRY(wxSP_NOBORDER)
+MACRO_ENTRY(wxSP_NO_XP_THEME)
+MACRO_ENTRY(wxSP_PERMIT_UNSPLIT)
+MACRO_ENTRY(wxSP_LIVE_UPDATE)
+
+MACRO_ENTRY(wxSPLIT_VERTICAL)
+MACRO_ENTRY(wxSPLIT_HORIZONTAL)
 
 // wxScrolledWindow
-MACRO(wxHSCROLL);
-MACRO(wxVSCROLL);
+MACRO_ENTRY(wxHSCROLL);
+MACRO_ENTRY(wxVSCROLL);
 
 // wxNotebook
-MACRO(wxNB_TOP)
-MACRO(wxNB_LEFT)
-MACRO(wxNB_RIGHT)
-MACRO(wxNB_BOTTOM)
-MACRO(wxNB_FIXEDWIDTH)
-MACRO(wxNB_MULTILINE)
-MACRO(wxNB_NOPAGETHEME)
-MACRO(wxNB_FLAT)
+MACRO_ENTRY(wxNB_TOP)
+MACRO_ENTRY(wxNB_LEFT)
+MACRO_ENTRY(wxNB_RIGHT)
+MACRO_ENTRY(wxNB_BOTTOM)
+MACRO_ENTRY(wxNB_FIXEDWIDTH)
+MACRO_ENTRY(wxNB_MULTILINE)
+MACRO_ENTRY(wxNB_NOPAGETHEME)
+MACRO_ENTRY(wxNB_FLAT)
 
 // wxListbook
-MACRO(wxLB_TOP)
-MACRO(wxLB_LEFT)
-MACRO(wxLB_RIGHT)
-MACRO(wxLB_BOTTOM)
-MACRO(wxLB_DEFAULT)
+MACRO_ENTRY(wxLB_TOP)
+MACRO_ENTRY(wxLB_LEFT)
+MACRO_ENTRY(wxLB_RIGHT)
+MACRO_ENTRY(wxLB_BOTTOM)
+MACRO_ENTRY(wxLB_DEFAULT)
 
 // wxChoicebook
-MACRO(wxCHB_TOP)
-MACRO(wxCHB_LEFT)
-MACRO(wxCHB_RIGHT)
-MACRO(wxCHB_BOTTOM)
-MACRO(wxCHB_DEFAULT)
+MACRO_ENTRY(wxCHB_TOP)
+MACRO_ENTRY(wxCHB_LEFT)
+MACRO_ENTRY(wxCHB_RIGHT)
+MACRO_ENTRY(wxCHB_BOTTOM)
+MACRO_ENTRY(wxCHB_DEFAULT)
 
 // wxAuiNotebook
-MACRO(wxAUI_NB_DEFAULT_STYLE)
-MACRO(wxAUI_NB_TAB_SPLIT)
-MACRO(wxAUI_NB_TAB_MOVE)
-MACRO(wxAUI_NB_TAB_EXTERNAL_MOVE)
-MACRO(wxAUI_NB_TAB_FIXED_WIDTH)
-MACRO(wxAUI_NB_SCROLL_BUTTONS)
-MACRO(wxAUI_NB_WINDOWLIST_BUTTON)
-MACRO(wxAUI_NB_CLOSE_BUTTON)
-MACRO(wxAUI_NB_CLOSE_ON_ACTIVE_TAB)
-MACRO(wxAUI_NB_CLOSE_ON_ALL_TABS)
-MACRO(wxAUI_NB_TOP)
-MACRO(wxAUI_NB_BOTTOM)
+MACRO_ENTRY(wxAUI_NB_DEFAULT_STYLE)
+MACRO_ENTRY(wxAUI_NB_TAB_SPLIT)
+MACRO_ENTRY(wxAUI_NB_TAB_MOVE)
+MACRO_ENTRY(wxAUI_NB_TAB_EXTERNAL_MOVE)
+MACRO_ENTRY(wxAUI_NB_TAB_FIXED_WIDTH)
+MACRO_ENTRY(wxAUI_NB_SCROLL_BUTTONS)
+MACRO_ENTRY(wxAUI_NB_WINDOWLIST_BUTTON)
+MACRO_ENTRY(wxAUI_NB_CLOSE_BUTTON)
+MACRO_ENTRY(wxAUI_NB_CLOSE_ON_ACTIVE_TAB)
+MACRO_ENTRY(wxAUI_NB_CLOSE_ON_ALL_TABS)
+MACRO_ENTRY(wxAUI_NB_TOP)
+MACRO_ENTRY(wxAUI_NB_BOTTOM)
+END_MACROS()
 
 END_LIBRARY()
@@ -33,6 +33,22 @@
 #include <forms/wizard.h>
 #include <wx/aui/aui.h>
 
+// Properties read by the components
+PROPERTY_HANDLE( bitmap )
+PROPERTY_HANDLE( bitmapsize )
+PROPERTY_HANDLE( center )
+PROPERTY_HANDLE( help )
+PROPERTY_HANDLE( kind )
+PROPERTY_HANDLE( label )
+PROPERTY_HANDLE( margins )
+PROPERTY_HANDLE( name )
+PROPERTY_HANDLE( packing )
+PROPERTY_HANDLE( pos )
+PROPERTY_HANDLE( separation )
+PROPERTY_HANDLE( size )
+PROPERTY_HANDLE( style )
+PROPERTY_HANDLE( window_style )
+
 // Event handler for events generated by controls in this plugin
 class ComponentEvtHandler : public wxEvtHandler
 {
@@ -72,10 +88,10 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, wxT("wxFrame"), obj->GetPropertyAsString(wxT("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxFrame"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByHandle( PROP_center ) )
 		{
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 		}
@@ -105,7 +121,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, wxT("wxPanel"), obj->GetPropertyAsString(wxT("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxPanel"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		return xrc.GetXrcObject();
 	}
@@ -129,10 +145,10 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, wxT("wxDialog"), obj->GetPropertyAsString(wxT("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxDialog"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT);
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByHandle( PROP_center ) )
 		{
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 		}
@@ -155,14 +171,14 @@ public:
 
 	wxObject* Create(IObject *obj, wxObject* /*parent*/)
 	{
-		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsInteger(wxT("style")) |
-			obj->GetPropertyAsInteger(wxT("window_style")));
+		wxMenuBar *mb = new wxMenuBar(obj->GetPropertyAsIntegerByHandle(PROP_style) |
+			obj->GetPropertyAsIntegerByHandle(PROP_window_style));
 		return mb;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, wxT("wxMenuBar"), obj->GetPropertyAsString(wxT("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxMenuBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddProperty(wxT("label"),wxT("label"),XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
 	}
@@ -181,21 +197,21 @@ public:
 	wxObject* Create(IObject *obj, wxObject *parent)
 	{
 		wxToolBar *tb = new wxToolBar((wxWindow*)parent, -1,
-			obj->GetPropertyAsPoint(wxT("pos")),
-			obj->GetPropertyAsSize(wxT("size")),
-			obj->GetPropertyAsInteger(wxT("style")) | obj->GetPropertyAsInteger(wxT("window_style")) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
+			obj->GetPropertyAsPointByHandle(PROP_pos),
+			obj->GetPropertyAsSizeByHandle(PROP_size),
+			obj->GetPropertyAsIntegerByHandle(PROP_style) | obj->GetPropertyAsIntegerByHandle(PROP_window_style) | wxTB_NOALIGN | wxTB_NODIVIDER | wxNO_BORDER);
 
-		if (!obj->IsNull(wxT("bitmapsize")))
-			tb->SetToolBitmapSize(obj->GetPropertyAsSize(wxT("bitmapsize")));
-		if (!obj->IsNull(wxT("margins")))
+		if (!obj->IsNullByHandle(PROP_bitmapsize))
+			tb->SetToolBitmapSize(obj->GetPropertyAsSizeByHandle(PROP_bitmapsize));
+		if (!obj->IsNullByHandle(PROP_margins))
 		{
-			wxSize margins(obj->GetPropertyAsSize(wxT("margins")));
+			wxSize margins(obj->GetPropertyAsSizeByHandle(PROP_margins));
 			tb->SetMargins(margins.GetWidth(), margins.GetHeight());
 		}
-		if (!obj->IsNull(wxT("packing")))
-			tb->SetToolPacking(obj->GetPropertyAsInteger(wxT("packing")));
-		if (!obj->IsNull(wxT("separation")))
-			tb->SetToolSeparation(obj->GetPropertyAsInteger(wxT("separation")));
+		if (!obj->IsNullByHandle(PROP_packing))
+			tb->SetToolPacking(obj->GetPropertyAsIntegerByHandle(PROP_packing));
+		if (!obj->IsNullByHandle(PROP_separation))
+			tb->SetToolSeparation(obj->GetPropertyAsIntegerByHandle(PROP_separation));
 
 		tb->PushEventHandler( new ComponentEvtHandler( tb, GetManager() ) );
 
@@ -219,11 +235,11 @@ public:
 			if ( wxT("tool") == childObj->GetClassName() )
 			{
 				tb->AddTool( 	wxID_ANY,
-								childObj->GetPropertyAsString( wxT("label") ),
-								childObj->GetPropertyAsBitmap( wxT("bitmap") ),
+								childObj->GetPropertyAsStringByHandle( PROP_label ),
+								childObj->GetPropertyAsBitmapByHandle( PROP_bitmap ),
 								wxNullBitmap,
-								(wxItemKind)childObj->GetPropertyAsInteger( wxT("kind") ),
-								childObj->GetPropertyAsString( wxT("help") ),
+								(wxItemKind)childObj->GetPropertyAsIntegerByHandle( PROP_kind ),
+								childObj->GetPropertyAsStringByHandle( PROP_help ),
 								wxEmptyString,
 								child
 							);
@@ -247,7 +263,7 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, wxT("wxToolBar"), obj->GetPropertyAsString(wxT("name")));
+		ObjectToXrcFilter xrc(obj, wxT("wxToolBar"), obj->GetPropertyAsStringByHandle(PROP_name));
 		xrc.AddWindowProperties();
 		xrc.AddProperty(wxT("bitmapsize"), wxT("bitmapsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(wxT("margins"), wxT("margins"), XRC_TYPE_SIZE);
@@ -302,13 +318,13 @@ public:
 
 	ticpp::Element* ExportToXrc( IObject *obj )
 	{
-		ObjectToXrcFilter xrc( obj, wxT("wxWizard"), obj->GetPropertyAsString( wxT("name") ) );
+		ObjectToXrcFilter xrc( obj, wxT("wxWizard"), obj->GetPropertyAsStringByHandle( PROP_name ) );
 		xrc.AddWindowProperties();
 		xrc.AddProperty( wxT("title"), wxT("title"), XRC_TYPE_TEXT );
-		if ( !obj->IsNull( wxT("center") ) )
+		if ( !obj->IsNullByHandle( PROP_center ) )
 			xrc.AddPropertyValue( wxT("centered"), wxT("1") );
 
-		if ( !obj->IsNull( wxT("bitmap") ) )
+		if ( !obj->IsNullByHandle( PROP_bitmap ) )
 			xrc.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
 
 		return xrc.GetXrcObject();
@@ -368,9 +384,9 @@ public:
 */
 	ticpp::Element* ExportToXrc( IObject *obj )
 	{
-        ObjectToXrcFilter xrc( obj, wxT("wxWizardPageSimple"), obj->GetPropertyAsString( wxT("name") ) );
+        ObjectToXrcFilter xrc( obj, wxT("wxWizardPageSimple"), obj->GetPropertyAsStringByHandle( PROP_name ) );
         xrc.AddWindowProperties();
-		if ( !obj->IsNull( wxT("bitmap") ) )
+		if ( !obj->IsNullByHandle( PROP_bitmap ) )
 			xrc.AddProperty( wxT("bitmap"), wxT("bitmap"), XRC_TYPE_BITMAP );
 		return xrc.GetXrcObject();
 	}
@@ -399,86 +415,90 @@ WINDOW_COMPONENT( "WizardPageSimple", WizardPageComponent )
 ABSTRACT_COMPONENT("MenuBar",MenuBarFormComponent)
 WINDOW_COMPONENT("ToolBar",ToolBarFormComponent)
 
+BEGIN_MACROS()
+
 // wxWindow style macros
-MACRO(wxSIMPLE_BORDER)
-MACRO(wxDOUBLE_BORDER)
-MACRO(wxSUNKEN_BORDER)
-MACRO(wxRAISED_BORDER)
-MACRO(wxSTATIC_BORDER)
-MACRO(wxNO_BORDER)
-MACRO(wxTRANSPARENT_WINDOW)
-MACRO(wxTAB_TRAVERSAL)
-MACRO(wxWANTS_CHARS)
-MACRO(wxVSCROLL)
-MACRO(wxHSCROLL)
-MACRO(wxALWAYS_SHOW_SB)
-MACRO(wxCLIP_CHILDREN)
-MACRO(wxFULL_REPAINT_ON_RESIZE)
-MACRO(wxWS_EX_VALIDATE_RECURSIVELY)
-MACRO(wxWS_EX_BLOCK_EVENTS)
-MACRO(wxWS_EX_TRANSIENT)
-MACRO(wxWS_EX_PROCESS_IDLE)
-MACRO(wxWS_EX_PROCESS_UI_UPDATES)
+MACRO_ENTRY(wxSIMPLE_BORDER)
+MACRO_ENTRY(wxDOUBLE_BORDER)
+MACRO_ENTRY(wxSUNKEN_BORDER)
+MACRO_ENTRY(wxRAISED_BORDER)
+MACRO_ENTRY(wxSTATIC_BORDER)
+MACRO_ENTRY(wxNO_BORDER)
+MACRO_ENTRY(wxTRANSPARENT_WINDOW)
+MACRO_ENTRY(wxTAB_TRAVERSAL)
+MACRO_ENTRY(wxWANTS_CHARS)
+MACRO_ENTRY(wxVSCROLL)
+MACRO_ENTRY(wxHSCROLL)
+MACRO_ENTRY(wxALWAYS_SHOW_SB)
+MACRO_ENTRY(wxCLIP_CHILDREN)
+MACRO_ENTRY(wxFULL_REPAINT_ON_RESIZE)
+MACRO_ENTRY(wxWS_EX_VALIDATE_RECURSIVELY)
+MACRO_ENTRY(wxWS_EX_BLOCK_EVENTS)
+MACRO_ENTRY(wxWS_EX_TRANSIENT)
+MACRO_ENTRY(wxWS_EX_PROCESS_IDLE)
+MACRO_ENTRY(wxWS_EX_PROCESS_UI_UPDATES)
 
 // wxFrame style macros
-MACRO(wxDEFAULT_FRAME_STYLE)
-MACRO(wxICONIZE)
-MACRO(wxCAPTION)
-MACRO(wxMINIMIZE)
-MACRO(wxMINIMIZE_BOX)
-MACRO(wxMAXIMIZE)
-MACRO(wxMAXIMIZE_BOX)
-MACRO(wxCLOSE_BOX)
-MACRO(wxSTAY_ON_TOP)
-MACRO(wxSYSTEM_MENU)
-MACRO(wxRESIZE_BORDER)
-MACRO(wxFRAME_TOOL_WINDOW)
-MACRO(wxFRAME_NO_TASKBAR)
-MACRO(wxFRAME_FLOAT_ON_PARENT)
-MACRO(wxFRAME_SHAPED)
-MACRO(wxFRAME_EX_CONTEXTHELP)
-MACRO(wxFRAME_EX_METAL)
+MACRO_ENTRY(wxDEFAULT_FRAME_STYLE)
+MACRO_ENTRY(wxICONIZE)
+MACRO_ENTRY(wxCAPTION)
+MACRO_ENTRY(wxMINIMIZE)
+MACRO_ENTRY(wxMINIMIZE_BOX)
+MACRO_ENTRY(wxMAXIMIZE)
+MACRO_ENTRY(wxMAXIMIZE_BOX)
+MACRO_ENTRY(wxCLOSE_BOX)
+MACRO_ENTRY(wxSTAY_ON_TOP)
+MACRO_ENTRY(wxSYSTEM_MENU)
+MACRO_ENTRY(wxRESIZE_BORDER)
+MACRO_ENTRY(wxFRAME_TOOL_WINDOW)
+MACRO_ENTRY(wxFRAME_NO_TASKBAR)
+MACRO_ENTRY(wxFRAME_FLOAT_ON_PARENT)
+MACRO_ENTRY(wxFRAME_SHAPED)
+MACRO_ENTRY(wxFRAME_EX_CONTEXTHELP)
+MACRO_ENTRY(wxFRAME_EX_METAL)
 
 // wxDialog style macros
-MACRO(wxCAPTION)
-MACRO(wxDEFAULT_DIALOG_STYLE)
-MACRO(wxRESIZE_BORDER)
-MACRO(wxSYSTEM_MENU)
-MACRO(wxCLOSE_BOX)
-MACRO(wxMAXIMIZE_BOX)
-MACRO(wxMINIMIZE_BOX)
-MACRO(wxSTAY_ON_TOP)
-MACRO(wxDIALOG_NO_PARENT)
+MACRO_ENTRY(wxCAPTION)
+MACRO_ENTRY(wxDEFAULT_DIALOG_STYLE)
+MACRO_ENTRY(wxRESIZE_BORDER)
+MACRO_ENTRY(wxSYSTEM_MENU)
+MACRO_ENTRY(wxCLOSE_BOX)
+MACRO_ENTRY(wxMAXIMIZE_BOX)
+MACRO_ENTRY(wxMINIMIZE_BOX)
+MACRO_ENTRY(wxSTAY_ON_TOP)
+MACRO_ENTRY(wxDIALOG_NO_PARENT)
 
 //wxDialog
-MACRO(wxBOTH)
-SYNONYMOUS(1,wxBOTH)
+MACRO_ENTRY(wxBOTH)
 
 // wxMenuBar
-MACRO(wxMB_DOCKABLE)
+MACRO_ENTRY(wxMB_DOCKABLE)
 
 // wxToolBar
-MACRO(wxTB_FLAT)
-MACRO(wxTB_DOCKABLE)
-MACRO(wxTB_HORIZONTAL)
-MACRO(wxTB_VERTICAL)
-MACRO(wxTB_TEXT)
-MACRO(wxTB_NOICONS)
-MACRO(wxTB_NODIVIDER)
-MACRO(wxTB_NOALIGN)
-MACRO(wxTB_HORZ_LAYOUT)
-MACRO(wxTB_HORZ_TEXT)
+MACRO_ENTRY(wxTB_FLAT)
+MACRO_ENTRY(wxTB_DOCKABLE)
+MACRO_ENTRY(wxTB_HORIZONTAL)
+MACRO_ENTRY(wxTB_VERTICAL)
+MACRO_ENTRY(wxTB_TEXT)
+MACRO_ENTRY(wxTB_NOICONS)
+MACRO_ENTRY(wxTB_NODIVIDER)
+MACRO_ENTRY(wxTB_NOALIGN)
+MACRO_ENTRY(wxTB_HORZ_LAYOUT)
+MACRO_ENTRY(wxTB_HORZ_TEXT)
 
 // wxAuiManager
-MACRO(wxAUI_MGR_ALLOW_FLOATING)
-MACRO(wxAUI_MGR_ALLOW_ACTIVE_PANE)
-MACRO(wxAUI_MGR_TRANSPARENT_DRAG)
-MACRO(wxAUI_MGR_TRANSPARENT_HINT)
-MACRO(wxAUI_MGR_VENETIAN_BLINDS_HINT)
-MACRO(wxAUI_MGR_RECTANGLE_HINT)
-MACRO(wxAUI_MGR_HINT_FADE)
-MACRO(wxAUI_MGR_NO_VENETIAN_BLINDS_FADE)
-MACRO(wxAUI_MGR_LIVE_RESIZE)
-MACRO(wxAUI_MGR_DEFAULT)
+MACRO_ENTRY(wxAUI_MGR_ALLOW_FLOATING)
+MACRO_ENTRY(wxAUI_MGR_ALLOW_ACTIVE_PANE)
+MACRO_ENTRY(wxAUI_MGR_TRANSPARENT_DRAG)
+MACRO_ENTRY(wxAUI_MGR_TRANSPARENT_HINT)
+MACRO_ENTRY(wxAUI_MGR_VENETIAN_BLINDS_HINT)
+MACRO_ENTRY(wxAUI_MGR_RECTANGLE_HINT)
+MACRO_ENTRY(wxAUI_MGR_HINT_FADE)
+MACRO_ENTRY(wxAUI_MGR_NO_VENETIAN_BLINDS_FADE)
+MACRO_ENTRY(wxAUI_MGR_LIVE_RESIZE)
+MACRO_ENTRY(wxAUI_MGR_DEFAULT)
+END_MACROS()
+
+SYNONYMOUS(1,wxBOTH)
 
 END_LIBRARY()
@@ -35,6 +35,37 @@
 	#define wxFIXED_MINSIZE wxADJUST_MINSIZE
 #endif
 
+// Properties read by the components
+PROPERTY_HANDLE( Apply )
+PROPERTY_HANDLE( border )
+PROPERTY_HANDLE( Cancel )
+PROPERTY_HANDLE( cols )
+PROPERTY_HANDLE( colspan )
+PROPERTY_HANDLE( column )
+PROPERTY_HANDLE( ContextHelp )
+PROPERTY_HANDLE( empty_cell_size )
+PROPERTY_HANDLE( flag )
+PROPERTY_HANDLE( flexible_direction )
+PROPERTY_HANDLE( growablecols )
+PROPERTY_HANDLE( growablerows )
+PROPERTY_HANDLE( height )
+PROPERTY_HANDLE( Help )
+PROPERTY_HANDLE( hgap )
+PROPERTY_HANDLE( label )
+PROPERTY_HANDLE( minimum_size )
+PROPERTY_HANDLE( No )
+PROPERTY_HANDLE( non_flexible_grow_mode )
+PROPERTY_HANDLE( OK )
+PROPERTY_HANDLE( orient )
+PROPERTY_HANDLE( proportion )
+PROPERTY_HANDLE( row )
+PROPERTY_HANDLE( rows )
+PROPERTY_HANDLE( rowspan )
+PROPERTY_HANDLE( Save )
+PROPERTY_HANDLE( vgap )
+PROPERTY_HANDLE( width )
+PROPERTY_HANDLE( Yes )
+
 class SpacerComponent : public ComponentBase
 {
 public:
@@ -70,10 +101,11 @@ public:
 		filter.AddPropertyPair( "cellspan", _("rowspan"), _("colspan") );
 		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
 		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		ticpp::Element* sizeritem = filter.GetXfbObject();
 
 		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
-		if ( xrcObj->FirstChildElement( "size", false ) && !xrcObj->FirstChildElement( "object", false ) )
+		bool isSpacer = ( !xrcObj->FirstChildElement( "object", false ) && filter.GetXrcProperty( "size" ) );
+		ticpp::Element* sizeritem = filter.GetXfbObject();
+		if ( isSpacer )
 		{
 			// it is a spacer
 			XrcToXfbFilter spacer( xrcObj, _("spacer") );
@@ -85,9 +117,27 @@ public:
 	}
 };
 
-class SizerItemComponent : public ComponentBase
+class SizerItemComponent : public ComponentBase, public IXrcBatchComponent
 {
+private:
+	ObjectToXrcBatchFilter m_xrc;
+	XrcToXfbBatchFilter m_xfb;
+
 public:
+	SizerItemComponent()
+	:
+	m_xrc( wxT("sizeritem") ),
+	m_xfb( wxT("sizeritem") )
+	{
+		m_xrc.AddProperty( PROP_proportion, wxT("option"), XRC_TYPE_INTEGER );
+		m_xrc.AddProperty( PROP_flag, wxT("flag"), XRC_TYPE_BITLIST );
+		m_xrc.AddProperty( PROP_border, wxT("border"), XRC_TYPE_INTEGER );
+
+		m_xfb.AddProperty( wxT("option"), wxT("proportion"), XRC_TYPE_INTEGER );
+		m_xfb.AddProperty( wxT("flag"), wxT("flag"), XRC_TYPE_BITLIST );
+		m_xfb.AddProperty( wxT("border"), wxT("border"), XRC_TYPE_INTEGER );
+	}
+
 	void OnCreated( wxObject* wxobject, wxWindow* /*wxparent*/ )
 	{
 		// Get parent sizer
@@ -115,11 +165,11 @@ public:
 		// Add the spacer
 		if ( _("spacer") == childObj->GetClassName() )
 		{
-			sizer->Add(	childObj->GetPropertyAsInteger( _("width") ),
-						childObj->GetPropertyAsInteger( _("height") ),
-						obj->GetPropertyAsInteger(_("proportion")),
-						obj->GetPropertyAsInteger(_("flag")),
-						obj->GetPropertyAsInteger(_("border"))
+			sizer->Add(	childObj->GetPropertyAsIntegerByHandle( PROP_width ),
+						childObj->GetPropertyAsIntegerByHandle( PROP_height ),
+						obj->GetPropertyAsIntegerByHandle(PROP_proportion),
+						obj->GetPropertyAsIntegerByHandle(PROP_flag),
+						obj->GetPropertyAsIntegerByHandle(PROP_border)
 						);
 			return;
 		}
@@ -131,16 +181,16 @@ public:
 		if ( windowChild != NULL )
 		{
 			sizer->Add( windowChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				obj->GetPropertyAsIntegerByHandle(PROP_proportion),
+				obj->GetPropertyAsIntegerByHandle(PROP_flag),
+				obj->GetPropertyAsIntegerByHandle(PROP_border));
 		}
 		else if ( sizerChild != NULL )
 		{
 			sizer->Add( sizerChild,
-				obj->GetPropertyAsInteger(_("proportion")),
-				obj->GetPropertyAsInteger(_("flag")),
-				obj->GetPropertyAsInteger(_("border")));
+				obj->GetPropertyAsIntegerByHandle(PROP_proportion),
+				obj->GetPropertyAsIntegerByHandle(PROP_flag),
+				obj->GetPropertyAsIntegerByHandle(PROP_border));
 		}
 		else
 		{
@@ -150,57 +200,105 @@ public:
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("sizeritem"));
-		xrc.AddProperty(_("proportion"), _("option"), XRC_TYPE_INTEGER);
-		xrc.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		xrc.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		return xrc.GetXrcObject();
+		ticpp::Element* element;
+		ExportBatchToXrc( &obj, 1, &element );
+		return element;
 	}
 
 	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
 	{
-		XrcToXfbFilter filter(xrcObj, _("sizeritem"));
-		filter.AddProperty(_("option"), _("proportion"), XRC_TYPE_INTEGER);
-		filter.AddProperty(_("flag"),   _("flag"),   XRC_TYPE_BITLIST);
-		filter.AddProperty(_("border"), _("border"), XRC_TYPE_INTEGER);
-		ticpp::Element* sizeritem = filter.GetXfbObject();
+		ticpp::Element* element;
+		ImportBatchFromXrc( &xrcObj, 1, &element );
+		return element;
+	}
 
-		// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
-		if ( xrcObj->FirstChildElement("size", false ) && !xrcObj->FirstChildElement("object", false ) )
+	void ExportBatchToXrc( IObject* const* objects, size_t count, ticpp::Element** elements )
+	{
+		m_xrc.Export( objects, count, elements );
+	}
+
+	void ImportBatchFromXrc( ticpp::Element* const* xrcObjs, size_t count, ticpp::Element** elements )
+	{
+		for ( size_t i = 0; i < count; i++ )
 		{
-			// it is a spacer
-			XrcToXfbFilter spacer( xrcObj, _("spacer") );
-			spacer.AddPropertyPair( "size", _("width"), _("height") );
-			sizeritem->LinkEndChild( spacer.GetXfbObject() );
+			ticpp::Element* xrcObj = xrcObjs[i];
+
+			// XrcLoader::GetObject imports spacers as sizeritems, so check for a spacer
+			bool isSpacer = ( !xrcObj->FirstChildElement( "object", false ) && xrcObj->FirstChildElement( "size", false ) );
+			ticpp::Element* sizeritem = m_xfb.Import( xrcObj, isSpacer ? "size" : NULL );
+			if ( isSpacer )
+			{
+				// it is a spacer
+				XrcToXfbFilter spacer( xrcObj, _("spacer") );
+				spacer.AddPropertyPair( "size", _("width"), _("height") );
+				sizeritem->LinkEndChild( spacer.GetXfbObject() );
+			}
+			elements[i] = sizeritem;
 		}
-		return sizeritem;
 	}
 };
 
-class BoxSizerComponent : public ComponentBase
+class BoxSizerComponent : public ComponentBase, public IXrcBatchComponent
 {
+private:
+	ObjectToXrcBatchFilter m_xrc;
+	XrcToXfbBatchFilter m_xfb;
+
 public:
+	BoxSizerComponent()
+	:
+	m_xrc( wxT("wxBoxSizer") ),
+	m_xfb( wxT("wxBoxSizer") )
+	{
+		// The minimum size is only exported when it is set, see ExportBatchToXrc
+		m_xrc.AddProperty( PROP_orient, wxT("orient"), XRC_TYPE_TEXT );
+
+		m_xfb.AddProperty( wxT("minsize"), wxT("minsize"), XRC_TYPE_SIZE );
+		m_xfb.AddProperty( wxT("orient"), wxT("orient"), XRC_TYPE_TEXT );
+	}
+
 	wxObject* Create(IObject *obj, wxObject * /*parent*/)
 	{
-		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsInteger(_("orient")));
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		wxBoxSizer *sizer = new wxBoxSizer(obj->GetPropertyAsIntegerByHandle(PROP_orient));
+		sizer->SetMinSize( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) );
 		return sizer;
 	}
 
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
-		ObjectToXrcFilter xrc(obj, _("wxBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
-		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
-		return xrc.GetXrcObject();
+		ticpp::Element* element;
+		ExportBatchToXrc( &obj, 1, &element );
+		return element;
 	}
 
 	ticpp::Element* ImportFromXrc( ticpp::Element* xrcObj )
 	{
-		XrcToXfbFilter filter(xrcObj, _("wxBoxSizer"));
-		filter.AddProperty(_("minsize"), _("minsize"), XRC_TYPE_SIZE);
-		filter.AddProperty(_("orient"),_("orient"),XRC_TYPE_TEXT);
-		return filter.GetXfbObject();
+		ticpp::Element* element;
+		ImportBatchFromXrc( &xrcObj, 1, &element );
+		return element;
+	}
+
+	void ExportBatchToXrc( IObject* const* objects, size_t count, ticpp::Element** elements )
+	{
+		for ( size_t i = 0; i < count; i++ )
+		{
+			IObject* obj = objects[i];
+			ticpp::Element* xrcObj = new ticpp::Element( "object" );
+			xrcObj->SetAttribute( "class", "wxBoxSizer" );
+			if( obj->GetPropertyAsSizeByHandle( PROP_minimum_size ) != wxDefaultSize )
+			{
+				ticpp::Element minsize( "minsize" );
+				minsize.SetText( obj->GetPropertyAsStringByHandle( PROP_minimum_size ).mb_str( wxConvUTF8 ) );
+				xrcObj->LinkEndChild( &minsize );
+			}
+			m_xrc.AddProperties( obj, xrcObj );
+			elements[i] = xrcObj;
+		}
+	}
+
+	void ImportBatchFromXrc( ticpp::Element* const* xrcObjs, size_t count, ticpp::Element** elements )
+	{
+		m_xfb.Import( xrcObjs, count, elements );
 	}
 };
 
@@ -216,12 +314,12 @@ public:
 	{
 		m_count++;
 		wxStaticBox* box = new wxStaticBox((wxWindow *)parent, -1,
-			obj->GetPropertyAsString(_("label")));
+			obj->GetPropertyAsStringByHandle(PROP_label));
 
 		wxStaticBoxSizer* sizer = new wxStaticBoxSizer(box,
-			obj->GetPropertyAsInteger(_("orient")));
+			obj->GetPropertyAsIntegerByHandle(PROP_orient));
 
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) );
 		
 		return sizer;
 	}
@@ -229,7 +327,7 @@ public:
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
 		ObjectToXrcFilter xrc(obj, _("wxStaticBoxSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+		if( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("orient"), _("orient"), XRC_TYPE_TEXT);
 		xrc.AddProperty(_("label"), _("label"), XRC_TYPE_TEXT);
 		return xrc.GetXrcObject();
@@ -251,12 +349,12 @@ public:
 	wxObject* Create(IObject *obj, wxObject * /*parent*/)
 	{
 		wxGridSizer *sizer = new wxGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByHandle(PROP_rows),
+			obj->GetPropertyAsIntegerByHandle(PROP_cols),
+			obj->GetPropertyAsIntegerByHandle(PROP_vgap),
+			obj->GetPropertyAsIntegerByHandle(PROP_hgap));
 		
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) );
 		
 		return sizer;
 	}
@@ -264,7 +362,7 @@ public:
 	ticpp::Element* ExportToXrc(IObject *obj)
 	{
 		ObjectToXrcFilter xrc(obj, _("wxGridSizer"));
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+		if( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) != wxDefaultSize ) xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc.AddProperty(_("rows"), _("rows"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("cols"), _("cols"), XRC_TYPE_INTEGER);
 		xrc.AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
@@ -290,8 +388,8 @@ public:
 	void AddProperties( IObject* obj, wxFlexGridSizer* sizer )
 	{
 		wxArrayInt gcols, grows;
-		gcols = obj->GetPropertyAsArrayInt(_("growablecols"));
-		grows = obj->GetPropertyAsArrayInt(_("growablerows"));
+		gcols = obj->GetPropertyAsArrayIntByHandle(PROP_growablecols);
+		grows = obj->GetPropertyAsArrayIntByHandle(PROP_growablerows);
 
 		unsigned int i;
 		for (i=0; i < gcols.GetCount() ; i++)
@@ -300,18 +398,18 @@ public:
 		for (i=0; i < grows.GetCount() ; i++)
 			sizer->AddGrowableRow(grows[i]);
 			
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
-		sizer->SetFlexibleDirection( obj->GetPropertyAsInteger(_("flexible_direction")) );
-		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsInteger(_("non_flexible_grow_mode")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) );
+		sizer->SetFlexibleDirection( obj->GetPropertyAsIntegerByHandle(PROP_flexible_direction) );
+		sizer->SetNonFlexibleGrowMode( (wxFlexSizerGrowMode )obj->GetPropertyAsIntegerByHandle(PROP_non_flexible_grow_mode) );
 	}
 
 	void ExportXRCProperties( ObjectToXrcFilter* xrc, IObject* obj )
 	{
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize ) xrc->AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
+		if( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) != wxDefaultSize ) xrc->AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		xrc->AddProperty(_("vgap"), _("vgap"), XRC_TYPE_INTEGER);
 		xrc->AddProperty(_("hgap"), _("hgap"), XRC_TYPE_INTEGER);
-		xrc->AddPropertyValue(_("growablecols"), obj->GetPropertyAsString(_("growablecols")));
-		xrc->AddPropertyValue(_("growablerows"), obj->GetPropertyAsString(_("growablerows")));
+		xrc->AddPropertyValue(_("growablecols"), obj->GetPropertyAsStringByHandle(PROP_growablecols));
+		xrc->AddPropertyValue(_("growablerows"), obj->GetPropertyAsStringByHandle(PROP_growablerows));
 	}
 
 	void ImportXRCProperties( XrcToXfbFilter* filter )
@@ -330,10 +428,10 @@ public:
 	wxObject* Create(IObject *obj, wxObject * /*parent*/)
 	{
 		wxFlexGridSizer *sizer = new wxFlexGridSizer(
-			obj->GetPropertyAsInteger(_("rows")),
-			obj->GetPropertyAsInteger(_("cols")),
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByHandle(PROP_rows),
+			obj->GetPropertyAsIntegerByHandle(PROP_cols),
+			obj->GetPropertyAsIntegerByHandle(PROP_vgap),
+			obj->GetPropertyAsIntegerByHandle(PROP_hgap));
 
 		AddProperties( obj, sizer );
 
@@ -368,12 +466,12 @@ private:
 
 		if ( _("spacer") == childObj->GetClassName() )
 		{
-			return new wxGBSizerItem(	childObj->GetPropertyAsInteger( _("width") ),
-										childObj->GetPropertyAsInteger( _("height") ),
+			return new wxGBSizerItem(	childObj->GetPropertyAsIntegerByHandle( PROP_width ),
+										childObj->GetPropertyAsIntegerByHandle( PROP_height ),
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_flag),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_border),
 										NULL
 										);
 		}
@@ -387,8 +485,8 @@ private:
 			return new wxGBSizerItem( 	windowChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_flag),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_border),
 										NULL
 										);
 		}
@@ -397,8 +495,8 @@ private:
 			return new wxGBSizerItem( 	sizerChild,
 										position,
 										span,
-										sizeritem->GetPropertyAsInteger(_("flag")),
-										sizeritem->GetPropertyAsInteger(_("border")),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_flag),
+										sizeritem->GetPropertyAsIntegerByHandle(PROP_border),
 										NULL
 										);
 		}
@@ -413,14 +511,14 @@ public:
 	wxObject* Create(IObject *obj, wxObject * /*parent*/)
 	{
 		wxGridBagSizer* sizer = new wxGridBagSizer(
-			obj->GetPropertyAsInteger(_("vgap")),
-			obj->GetPropertyAsInteger(_("hgap")));
+			obj->GetPropertyAsIntegerByHandle(PROP_vgap),
+			obj->GetPropertyAsIntegerByHandle(PROP_hgap));
 
 		AddProperties( obj, sizer );
 
-		if ( !obj->IsNull( _("empty_cell_size") ) )
+		if ( !obj->IsNullByHandle( PROP_empty_cell_size ) )
 		{
-			sizer->SetEmptyCellSize( obj->GetPropertyAsSize( _("empty_cell_size") ) );
+			sizer->SetEmptyCellSize( obj->GetPropertyAsSizeByHandle( PROP_empty_cell_size ) );
 		}
 
 		return sizer;
@@ -456,9 +554,9 @@ public:
 			IObject* isizerItem = manager->GetIObject( wxsizerItem );
 
 			// Get the location of the item
-			wxGBSpan span( isizerItem->GetPropertyAsInteger( _("rowspan") ), isizerItem->GetPropertyAsInteger( _("colspan") ) );
+			wxGBSpan span( isizerItem->GetPropertyAsIntegerByHandle( PROP_rowspan ), isizerItem->GetPropertyAsIntegerByHandle( PROP_colspan ) );
 
-			int column = isizerItem->GetPropertyAsInteger( _("column") );
+			int column = isizerItem->GetPropertyAsIntegerByHandle( PROP_column );
 			if ( column < 0 )
 			{
 				// Needs to be auto positioned after the other children are added
@@ -470,7 +568,7 @@ public:
 				continue;
 			}
 
-			wxGBPosition position( isizerItem->GetPropertyAsInteger( _("row") ), column );
+			wxGBPosition position( isizerItem->GetPropertyAsIntegerByHandle( PROP_row ), column );
 
 			// Check for intersection
 			if ( sizer->CheckForIntersection( position, span ) )
@@ -562,37 +660,37 @@ public:
 	{
 		wxStdDialogButtonSizer* sizer =  new wxStdDialogButtonSizer();
 		
-		sizer->SetMinSize( obj->GetPropertyAsSize(_("minimum_size")) );
+		sizer->SetMinSize( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) );
 		
-		if ( obj->GetPropertyAsInteger( _("OK") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_OK ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_OK ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("Yes") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Yes ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_YES ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("Save") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Save ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_SAVE ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("Apply") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Apply ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_APPLY ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("No") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_No ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_NO ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("Cancel") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Cancel ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_CANCEL ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("Help") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Help ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_HELP ) );
 		}
-		if ( obj->GetPropertyAsInteger( _("ContextHelp") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_ContextHelp ) )
 		{
 			sizer->AddButton( new wxButton( (wxWindow*)parent, wxID_CONTEXT_HELP ) );
 		}
@@ -606,39 +704,39 @@ public:
 		ObjectToXrcFilter xrc(obj, _("wxStdDialogButtonSizer"));
 		ticpp::Element* sizer = xrc.GetXrcObject();
 		
-		if( obj->GetPropertyAsSize(_("minimum_size")) != wxDefaultSize )
+		if( obj->GetPropertyAsSizeByHandle(PROP_minimum_size) != wxDefaultSize )
 		{
 			xrc.AddProperty(_("minimum_size"), _("minsize"), XRC_TYPE_SIZE);
 		}
-		if ( obj->GetPropertyAsInteger( _("OK") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_OK ) )
 		{
 			AddXRCButton( sizer, "wxID_OK", "&OK" );
 		}
-		if ( obj->GetPropertyAsInteger( _("Yes") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Yes ) )
 		{
 			AddXRCButton( sizer, "wxID_YES", "&Yes" );
 		}
-		if ( obj->GetPropertyAsInteger( _("Save") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Save ) )
 		{
 			AddXRCButton( sizer, "wxID_SAVE", "&Save" );
 		}
-		if ( obj->GetPropertyAsInteger( _("Apply") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Apply ) )
 		{
 			AddXRCButton( sizer, "wxID_APPLY", "&Apply" );
 		}
-		if ( obj->GetPropertyAsInteger( _("No") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_No ) )
 		{
 			AddXRCButton( sizer, "wxID_NO", "&No" );
 		}
-		if ( obj->GetPropertyAsInteger( _("Cancel") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Cancel ) )
 		{
 			AddXRCButton( sizer, "wxID_CANCEL", "&Cancel" );
 		}
-		if ( obj->GetPropertyAsInteger( _("Help") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_Help ) )
 		{
 			AddXRCButton( sizer, "wxID_HELP", "&Help" );
 		}
-		if ( obj->GetPropertyAsInteger( _("ContextHelp") ) )
+		if ( obj->GetPropertyAsIntegerByHandle( PROP_ContextHelp ) )
 		{
 			AddXRCButton( sizer, "wxID_CONTEXT_HELP", "" );
 		}
@@ -749,30 +847,33 @@ SIZER_COMPONENT("wxFlexGridSizer",FlexGridSizerComponent)
 SIZER_COMPONENT("wxGridBagSizer",GridBagSizerComponent)
 SIZER_COMPONENT("wxStdDialogButtonSizer",StdDialogButtonSizerComponent)
 
+BEGIN_MACROS()
+
 // wxBoxSizer
-MACRO(wxHORIZONTAL)
-MACRO(wxVERTICAL)
+MACRO_ENTRY(wxHORIZONTAL)
+MACRO_ENTRY(wxVERTICAL)
 
 // wxFlexGridSizer
-MACRO(wxBOTH)
-MACRO(wxFLEX_GROWMODE_NONE)
-MACRO(wxFLEX_GROWMODE_SPECIFIED)
-MACRO(wxFLEX_GROWMODE_ALL)
+MACRO_ENTRY(wxBOTH)
+MACRO_ENTRY(wxFLEX_GROWMODE_NONE)
+MACRO_ENTRY(wxFLEX_GROWMODE_SPECIFIED)
+MACRO_ENTRY(wxFLEX_GROWMODE_ALL)
 
 
 // Add
-MACRO(wxALL)
-MACRO(wxLEFT)
-MACRO(wxRIGHT)
-MACRO(wxTOP)
-MACRO(wxBOTTOM)
-MACRO(wxEXPAND)
-MACRO(wxALIGN_BOTTOM)
-MACRO(wxALIGN_CENTER)
-MACRO(wxALIGN_CENTER_HORIZONTAL)
-MACRO(wxALIGN_CENTER_VERTICAL)
-MACRO(wxSHAPED)
-MACRO(wxFIXED_MINSIZE)
+MACRO_ENTRY(wxALL)
+MACRO_ENTRY(wxLEFT)
+MACRO_ENTRY(wxRIGHT)
+MACRO_ENTRY(wxTOP)
+MACRO_ENTRY(wxBOTTOM)
+MACRO_ENTRY(wxEXPAND)
+MACRO_ENTRY(wxALIGN_BOTTOM)
+MACRO_ENTRY(wxALIGN_CENTER)
+MACRO_ENTRY(wxALIGN_CENTER_HORIZONTAL)
+MACRO_ENTRY(wxALIGN_CENTER_VERTICAL)
+MACRO_ENTRY(wxSHAPED)
+MACRO_ENTRY(wxFIXED_MINSIZE)
+END_MACROS()
 
 SYNONYMOUS(wxGROW, wxEXPAND)
 SYNONYMOUS(wxALIGN_CENTRE, wxALIGN_CENTER)
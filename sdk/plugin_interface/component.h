@@ -31,6 +31,7 @@
 #include <wx/dynarray.h>
 #include <wx/string.h>
 #include "fontcontainer.h"
+#include <vector>
 
 #define COMPONENT_TYPE_ABSTRACT 0
 #define COMPONENT_TYPE_WINDOW   1
@@ -59,6 +60,27 @@ enum
 };
 
 
+/**
+ * Name of a property resolved once by IManager::GetPropertyHandle, the same
+ * for the objects of every class. Reading a property through its handle does
+ * not search the name. See PROPERTY_HANDLE.
+ */
+class PropertyHandle
+{
+ public:
+  PropertyHandle() : m_id( -1 ) {}
+  explicit PropertyHandle( int id ) : m_id( id ) {}
+
+  int GetId() const { return m_id; }
+  bool IsOk() const { return m_id >= 0; }
+
+  bool operator==( const PropertyHandle& other ) const { return m_id == other.m_id; }
+  bool operator!=( const PropertyHandle& other ) const { return m_id != other.m_id; }
+
+ protected:
+  int m_id;
+};
+
 // Plugins interface
 // The point is to provide an interface for accessing the object's properties
 // from the plugin itself, in a safe way.
@@ -82,6 +104,27 @@ class IObject
   virtual wxString GetObjectTypeName() = 0;
   virtual IObject* GetChildPtr (unsigned int idx) = 0;
   virtual ~IObject(){}
+
+  // The same, through the handle of the property. They have names of their
+  // own, and come last, so the methods above keep their place in the vtable.
+  virtual bool     IsNullByHandle (const PropertyHandle& handle) = 0;
+  virtual int      GetPropertyAsIntegerByHandle (const PropertyHandle& handle) = 0;
+  virtual wxFontContainer   GetPropertyAsFontByHandle    (const PropertyHandle& handle) = 0;
+  virtual wxColour GetPropertyAsColourByHandle  (const PropertyHandle& handle) = 0;
+  virtual wxString GetPropertyAsStringByHandle  (const PropertyHandle& handle) = 0;
+  virtual wxPoint  GetPropertyAsPointByHandle   (const PropertyHandle& handle) = 0;
+  virtual wxSize   GetPropertyAsSizeByHandle    (const PropertyHandle& handle) = 0;
+  virtual wxBitmap GetPropertyAsBitmapByHandle  (const PropertyHandle& handle) = 0;
+  virtual wxArrayInt GetPropertyAsArrayIntByHandle(const PropertyHandle& handle) = 0;
+  virtual wxArrayString GetPropertyAsArrayStringByHandle(const PropertyHandle& handle) = 0;
+  virtual double GetPropertyAsFloatByHandle(const PropertyHandle& handle) = 0;
+};
+
+// Entry of a macro table, see BEGIN_MACROS
+struct MacroEntry
+{
+  const wxChar* name;
+  int value;
 };
 
 // Interface which intends to contain all the components for a plugin
@@ -110,6 +153,21 @@ class IComponentLibrary
   virtual ~IComponentLibrary(){}
 };
 
+/**
+ * Optional interface of the component libraries which return all their
+ * macros in one call, implemented besides IComponentLibrary. wxFormBuilder
+ * finds it with dynamic_cast, and reads the macros one by one with
+ * IComponentLibrary::GetMacroName and IComponentLibrary::GetMacroValue from
+ * the libraries without it.
+ */
+class IMacroListLibrary
+{
+ public:
+  virtual void GetMacros(wxArrayString* names, wxArrayInt* values) = 0;
+
+  virtual ~IMacroListLibrary(){}
+};
+
 /**
  * Component Interface
  */
@@ -157,6 +215,62 @@ class IComponent
   virtual ~IComponent(){}
 };
 
+/**
+ * Optional interface of the components which convert many objects to and
+ * from XRC in one call, implemented besides IComponent. wxFormBuilder finds
+ * it with dynamic_cast, and calls IComponent::ExportToXrc and
+ * IComponent::ImportFromXrc for the components without it.
+ *
+ * All the objects of a call are of the class of the component, so the
+ * properties converted can be set up once, see ObjectToXrcBatchFilter and
+ * XrcToXfbBatchFilter.
+ */
+class IXrcBatchComponent
+{
+ public:
+  /**
+   * Exports each object, as IComponent::ExportToXrc.
+   *
+   * @param elements Receives an element for each object, in the same order,
+   *                 which the caller must delete. NULL if the object is not
+   *                 exported.
+   */
+  virtual void ExportBatchToXrc( IObject* const* objects, size_t count, ticpp::Element** elements ) = 0;
+
+  /**
+   * Converts each XRC object, as IComponent::ImportFromXrc.
+   *
+   * @param elements Receives an element for each XRC object, in the same
+   *                 order, which the caller must delete.
+   */
+  virtual void ImportBatchFromXrc( ticpp::Element* const* xrcObjs, size_t count, ticpp::Element** elements ) = 0;
+
+  virtual ~IXrcBatchComponent(){}
+};
+
+/**
+ * Optional interface of the components which apply a modified property to
+ * the object already created, implemented besides IComponent. wxFormBuilder
+ * finds it with dynamic_cast. For the components without it, only the
+ * properties common to all the windows are applied, and the whole form is
+ * created again for the rest.
+ */
+class IPropertyUpdateComponent
+{
+ public:
+  /**
+   * Applies a modified property to the object already created, instead of
+   * creating the whole form again.
+   *
+   * @param wxobject The object created by IComponent::Create for @a obj.
+   * @param property The property modified.
+   * @return false if the object must be created again to show the change.
+   */
+  virtual bool UpdateProperty( wxObject* wxobject, IObject* obj, const PropertyHandle& property ) = 0;
+
+  virtual ~IPropertyUpdateComponent(){}
+};
+
 // Used to identify wxObject* that must be manually deleted
 class wxNoObject : public wxObject
 {
@@ -214,6 +328,55 @@ public:
 	virtual bool SelectObject( wxObject* wxobject ) = 0;
 
 	virtual ~IManager(){}
+
+	/**
+	Get the handle of a property, for reading it from any object with the
+	IObject methods which take a handle.
+	*/
+	virtual PropertyHandle GetPropertyHandle( const wxString& name ) = 0;
+};
+
+/**
+Handle of a property read by the components of a library, resolved when the
+library is loaded. Declare them with PROPERTY_HANDLE.
+*/
+class LibraryPropertyHandle : public PropertyHandle
+{
+private:
+	const wxChar* m_name;
+
+	static std::vector< LibraryPropertyHandle* >& GetHandles()
+	{
+		static std::vector< LibraryPropertyHandle* > handles;
+		return handles;
+	}
+
+public:
+	LibraryPropertyHandle( const wxChar* name )
+	:
+	m_name( name )
+	{
+		GetHandles().push_back( this );
+	}
+
+	/**
+	Resolves the handles of the library, called by BEGIN_LIBRARY. The library
+	is also created without a manager, only for its synonyms (see
+	ReplaceSynonymous in xrcconv.cpp), which keeps the handles as they are.
+	*/
+	static void ResolveAll( IManager* manager )
+	{
+		if ( NULL == manager )
+		{
+			return;
+		}
+
+		std::vector< LibraryPropertyHandle* >& handles = GetHandles();
+		for ( std::vector< LibraryPropertyHandle* >::iterator handle = handles.begin(); handle != handles.end(); ++handle )
+		{
+			( *handle )->m_id = manager->GetPropertyHandle( ( *handle )->m_name ).GetId();
+		}
+	}
 };
 
 #ifdef BUILD_DLL
@@ -232,7 +395,8 @@ DLL_FUNC void FreeComponentLibrary( IComponentLibrary* lib );
 \
 extern "C" WXEXPORT IComponentLibrary* GetComponentLibrary( IManager* manager ) 	\
 { 																					\
-  IComponentLibrary* lib = new ComponentLibrary();
+  LibraryPropertyHandle::ResolveAll( manager );										\
+  ComponentLibrary* lib = new ComponentLibrary();
 
 #define END_LIBRARY()                                                                   \
         return lib;                                                                     \
@@ -245,9 +409,35 @@ extern "C" WXEXPORT IComponentLibrary* GetComponentLibrary( IManager* manager )
 #define MACRO( name ) \
   lib->RegisterMacro( wxT(#name), name );
 
+// Macro tables are registered with a single call, use them instead of
+// MACRO when a library exports many macros:
+//   BEGIN_MACROS()
+//   MACRO_ENTRY(wxALL)
+//   MACRO_ENTRY(wxEXPAND)
+//   END_MACROS()
+#define BEGIN_MACROS() \
+  { \
+    static const MacroEntry macroTable[] = {
+
+#define MACRO_ENTRY( name ) \
+      { wxT(#name), (int)( name ) },
+
+#define END_MACROS() \
+    }; \
+    lib->RegisterMacros( macroTable, sizeof( macroTable ) / sizeof( MacroEntry ) ); \
+  }
+
 #define SYNONYMOUS( syn, name ) \
   lib->RegisterMacroSynonymous( wxT(#syn), wxT(#name) );
 
+// Declares the handle PROP_name of a property, at file scope, for reading it
+// without searching the name:
+//   PROPERTY_HANDLE( style )
+//   ...
+//   obj->GetPropertyAsIntegerByHandle( PROP_style );
+#define PROPERTY_HANDLE( name ) \
+  static LibraryPropertyHandle PROP_##name( wxT(#name) );
+
 #define _REGISTER_COMPONENT( name, class, type )\
   {                                     		\
     ComponentBase* c = new class();     		\
@@ -36,7 +36,7 @@
 // We will make a template so that the preprocessor implements the library inside
 // the module itself.
 
-class ComponentLibrary : public IComponentLibrary
+class ComponentLibrary : public IComponentLibrary, public IMacroListLibrary
 {
  private:
   typedef struct
@@ -89,6 +89,19 @@ class ComponentLibrary : public IComponentLibrary
     m_macros.push_back(macro);
   }
 
+  void RegisterMacros(const MacroEntry* macros, unsigned int count)
+  {
+    m_macros.reserve(m_macros.size() + count);
+    for (unsigned int i = 0; i < count; i++)
+    {
+      AMacro macro;
+      macro.name = macros[i].name;
+      macro.value = macros[i].value;
+
+      m_macros.push_back(macro);
+    }
+  }
+
   void RegisterMacroSynonymous(const wxString &syn, const wxString &name)
   {
     /*ASynonymous asyn;
@@ -130,6 +143,17 @@ class ComponentLibrary : public IComponentLibrary
     return 0;
   }
 
+  void GetMacros(wxArrayString* names, wxArrayInt* values)
+  {
+    names->Alloc(names->GetCount() + m_macros.size());
+    values->Alloc(values->GetCount() + m_macros.size());
+    for (std::vector<AMacro>::iterator it = m_macros.begin(); it != m_macros.end(); ++it)
+    {
+      names->Add(it->name);
+      values->Add(it->value);
+    }
+  }
+
   /*wxString GetMacroSynonymous(unsigned int idx)
   {
     if (idx < m_synonymous.size())
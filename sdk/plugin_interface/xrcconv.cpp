@@ -29,6 +29,9 @@
 
 #include <string>
 #include <set>
+#include <map>
+#include <vector>
+#include <memory>
 
 #include <ticpp.h>
 
@@ -42,26 +45,26 @@ static wxString StringToXrcText( const wxString &str )
 
 		switch ( c )
 		{
-			case wxChar( '\n' ): result = result + wxT( "\\n" );
+			case wxChar( '\n' ): result += wxT( "\\n" );
 				break;
 
-			case wxChar( '\t' ): result = result + wxT( "\\t" );
+			case wxChar( '\t' ): result += wxT( "\\t" );
 				break;
 
-			case wxChar( '\r' ): result = result + wxT( "\\r" );
+			case wxChar( '\r' ): result += wxT( "\\r" );
 				break;
 
-			case wxChar( '\\' ): result = result + wxT( "\\\\" );
+			case wxChar( '\\' ): result += wxT( "\\\\" );
 				break;
 
-			case wxChar( '_' ):  result = result + wxT( "__" );
+			case wxChar( '_' ):  result += wxT( "__" );
 				break;
 
-			case wxChar( '&' ):  result = result + wxT( "_" );
+			case wxChar( '&' ):  result += wxT( "_" );
 				break;
 
 			default:
-				result = result + c;
+				result += c;
 				break;
 		}
 	}
@@ -81,16 +84,16 @@ static wxString XrcTextToString( const wxString &str )
 
 			switch ( next )
 			{
-				case wxChar( 'n' ): result = result + wxChar( '\n' ); i++;
+				case wxChar( 'n' ): result += wxChar( '\n' ); i++;
 					break;
 
-				case wxChar( 't' ): result = result + wxChar( '\t' ); i++;
+				case wxChar( 't' ): result += wxChar( '\t' ); i++;
 					break;
 
-				case wxChar( 'r' ): result = result + wxChar( '\r' ); i++;
+				case wxChar( 'r' ): result += wxChar( '\r' ); i++;
 					break;
 
-				case wxChar( '\\' ): result = result + wxChar( '\\' ); i++;
+				case wxChar( '\\' ): result += wxChar( '\\' ); i++;
 					break;
 			}
 		}
@@ -98,14 +101,14 @@ static wxString XrcTextToString( const wxString &str )
 		{
 			if ( i < str.Length() - 1 && str[i+1] == wxChar( '_' ) )
 			{
-				result = result + wxChar( '_' );
+				result += wxChar( '_' );
 				i++;
 			}
 			else
-				result = result + wxChar( '&' );
+				result += wxChar( '&' );
 		}
 		else
-			result = result + c;
+			result += c;
 	}
 
 	return result;
@@ -113,7 +116,9 @@ static wxString XrcTextToString( const wxString &str )
 
 static wxString ReplaceSynonymous( const wxString &bitlist )
 {
-	IComponentLibrary* lib = GetComponentLibrary( NULL );
+	// Creating the library registers all the components of the plugin, so it is only done once
+	static std::auto_ptr< IComponentLibrary > lib( GetComponentLibrary( NULL ) );
+
 	wxString result, translation;
 	wxStringTokenizer tkz( bitlist, wxT( "|" ) );
 	while ( tkz.HasMoreTokens() )
@@ -124,7 +129,7 @@ static wxString ReplaceSynonymous( const wxString &bitlist )
 		token.Trim( false );
 
 		if ( result != wxT( "" ) )
-			result = result + wxChar( '|' );
+			result += wxChar( '|' );
 
 		if ( lib->FindSynonymous( token, translation ) )
 			result += translation;
@@ -132,11 +137,22 @@ static wxString ReplaceSynonymous( const wxString &bitlist )
 			result += token;
 
 	}
-	delete lib;
 
 	return result;
 }
 
+// The values of the properties, shared by the filters and the batch filters
+static void LinkText( const wxString &text, ticpp::Element *propElement, bool xrcFormat = false );
+static void LinkColour( const wxColour &colour, ticpp::Element *propElement );
+static void LinkFont( const wxFontContainer &font, ticpp::Element *propElement );
+static void LinkInteger( const int &integer, ticpp::Element *propElement );
+static void LinkFloat( const double& value, ticpp::Element* propElement );
+static void LinkStringList( const wxArrayString &array, ticpp::Element *propElement, bool xrcFormat = false );
+static void LinkBitmap( const wxString &bitmapProp, ticpp::Element *propElement );
+
+// Converts the property of an XRC object, NULL if the object does not have it
+static void ImportProperty( ticpp::Element *xrcProperty, const int &propType, ticpp::Element *property );
+
 ObjectToXrcFilter::ObjectToXrcFilter( 	IObject *obj,
 										const wxString &classname,
 										const wxString &objname,
@@ -204,36 +220,7 @@ void ObjectToXrcFilter::AddProperty( const wxString &objPropName,
 			break;
 
 		case XRC_TYPE_BITMAP:
-			{
-				wxString bitmapProp = m_obj->GetPropertyAsString( objPropName );
-				if ( bitmapProp.empty() )
-				{
-					break;
-				}
-
-				wxString filename = bitmapProp.AfterFirst( wxT(';') );
-				if ( filename.empty() )
-				{
-					break;
-				}
-
-				if ( bitmapProp.size() < ( filename.size() + 2 ) )
-				{
-					break;
-				}
-
-				if ( bitmapProp.StartsWith( _("Load From File") ) || bitmapProp.StartsWith( _("Load From Embedded File") ) )
-				{
-					LinkText( filename.Trim().Trim(false), &propElement );
-				}
-				else if( bitmapProp.StartsWith( _("Load From Art Provider") ) )
-				{
-					propElement.SetAttribute( "stock_id", filename.BeforeFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
-					propElement.SetAttribute( "stock_client", filename.AfterFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
-					
-					LinkText( wxT("undefined.png"), &propElement );
-				}
-			}
+			LinkBitmap( m_obj->GetPropertyAsString( objPropName ), &propElement );
 			break;
 	}
 	
@@ -264,29 +251,29 @@ ticpp::Element* ObjectToXrcFilter::GetXrcObject()
 	return new ticpp::Element( *m_xrcObj );
 }
 
-void ObjectToXrcFilter::LinkText( const wxString &text, ticpp::Element *propElement, bool xrcFormat )
+static void LinkText( const wxString &text, ticpp::Element *propElement, bool xrcFormat )
 {
 	wxString value = ( xrcFormat ? StringToXrcText( text ) : text );
 	propElement->SetText( value.mb_str( wxConvUTF8 ) );
 }
 
-void ObjectToXrcFilter::LinkInteger( const int &integer, ticpp::Element *propElement )
+static void LinkInteger( const int &integer, ticpp::Element *propElement )
 {
 	propElement->SetText( integer );
 }
 
-void ObjectToXrcFilter::LinkFloat( const double& value, ticpp::Element* propElement )
+static void LinkFloat( const double& value, ticpp::Element* propElement )
 {
 	propElement->SetText( value );
 }
 
-void ObjectToXrcFilter::LinkColour( const wxColour &colour, ticpp::Element *propElement )
+static void LinkColour( const wxColour &colour, ticpp::Element *propElement )
 {
 	wxString value = wxString::Format( wxT( "#%02x%02x%02x" ), colour.Red(), colour.Green(), colour.Blue() );
 	propElement->SetText( value.mb_str( wxConvUTF8 ) );
 }
 
-void ObjectToXrcFilter::LinkFont( const wxFontContainer &font, ticpp::Element *propElement )
+static void LinkFont( const wxFontContainer &font, ticpp::Element *propElement )
 {
 	if ( font.GetPointSize() > 0 )
 	{
@@ -373,7 +360,7 @@ void ObjectToXrcFilter::LinkFont( const wxFontContainer &font, ticpp::Element *p
 	}
 }
 
-void ObjectToXrcFilter::LinkStringList( const wxArrayString &array, ticpp::Element *propElement, bool xrcFormat )
+static void LinkStringList( const wxArrayString &array, ticpp::Element *propElement, bool xrcFormat )
 {
 	for ( size_t i = 0; i < array.GetCount(); i++ )
 	{
@@ -384,56 +371,87 @@ void ObjectToXrcFilter::LinkStringList( const wxArrayString &array, ticpp::Eleme
 	}
 }
 
+static void LinkBitmap( const wxString &bitmapProp, ticpp::Element *propElement )
+{
+	if ( bitmapProp.empty() )
+	{
+		return;
+	}
+
+	wxString filename = bitmapProp.AfterFirst( wxT(';') );
+	if ( filename.empty() )
+	{
+		return;
+	}
+
+	if ( bitmapProp.size() < ( filename.size() + 2 ) )
+	{
+		return;
+	}
+
+	if ( bitmapProp.StartsWith( _("Load From File") ) || bitmapProp.StartsWith( _("Load From Embedded File") ) )
+	{
+		LinkText( filename.Trim().Trim(false), propElement );
+	}
+	else if( bitmapProp.StartsWith( _("Load From Art Provider") ) )
+	{
+		propElement->SetAttribute( "stock_id", filename.BeforeFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
+		propElement->SetAttribute( "stock_client", filename.AfterFirst( wxT(';') ).Trim().Trim(false).mb_str( wxConvUTF8 ) );
+
+		LinkText( wxT("undefined.png"), propElement );
+	}
+}
+
 void ObjectToXrcFilter::AddWindowProperties()
 {
 	wxString style;
-	if ( !m_obj->IsNull( _( "style" ) ) )
+	if ( !m_obj->IsNull( wxT( "style" ) ) )
 		style = m_obj->GetPropertyAsString( _T( "style" ) );
-	if ( !m_obj->IsNull( _( "window_style" ) ) ){
+	if ( !m_obj->IsNull( wxT( "window_style" ) ) ){
 		if ( !style.IsEmpty() ) style += _T( '|' );
 		style += m_obj->GetPropertyAsString( _T( "window_style" ) );
 	}
 	if ( !style.IsEmpty() ) AddPropertyValue( _T( "style" ), style );
 
 	wxString extraStyle;
-	if ( !m_obj->IsNull( _( "extra_style" ) ) )
+	if ( !m_obj->IsNull( wxT( "extra_style" ) ) )
 		extraStyle = m_obj->GetPropertyAsString( _T( "extra_style" ) );
-	if ( !m_obj->IsNull( _( "window_extra_style" ) ) ){
+	if ( !m_obj->IsNull( wxT( "window_extra_style" ) ) ){
 		if ( !extraStyle.IsEmpty() ) extraStyle += _T( '|' );
 		extraStyle += m_obj->GetPropertyAsString( _T( "window_extra_style" ) );
 	}
 	if ( !extraStyle.IsEmpty() ) AddPropertyValue( _T( "exstyle" ), extraStyle );
 
-	if ( !m_obj->IsNull( _( "pos" ) ) )
-		AddProperty( _( "pos" ), _( "pos" ), XRC_TYPE_SIZE );
+	if ( !m_obj->IsNull( wxT( "pos" ) ) )
+		AddProperty( wxT( "pos" ), wxT( "pos" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "size" ) ) )
-		AddProperty( _( "size" ), _( "size" ), XRC_TYPE_SIZE );
+	if ( !m_obj->IsNull( wxT( "size" ) ) )
+		AddProperty( wxT( "size" ), wxT( "size" ), XRC_TYPE_SIZE );
 
-	if ( !m_obj->IsNull( _( "bg" ) ) )
-		AddProperty( _( "bg" ), _( "bg" ), XRC_TYPE_COLOUR );
+	if ( !m_obj->IsNull( wxT( "bg" ) ) )
+		AddProperty( wxT( "bg" ), wxT( "bg" ), XRC_TYPE_COLOUR );
 
-	if ( !m_obj->IsNull( _( "fg" ) ) )
-		AddProperty( _( "fg" ), _( "fg" ), XRC_TYPE_COLOUR );
+	if ( !m_obj->IsNull( wxT( "fg" ) ) )
+		AddProperty( wxT( "fg" ), wxT( "fg" ), XRC_TYPE_COLOUR );
 
-	if ( !m_obj->IsNull( _( "enabled" ) ) && !m_obj->GetPropertyAsInteger( _( "enabled" ) ) )
-		AddProperty( _( "enabled" ), _( "enabled" ), XRC_TYPE_BOOL );
+	if ( !m_obj->IsNull( wxT( "enabled" ) ) && !m_obj->GetPropertyAsInteger( wxT( "enabled" ) ) )
+		AddProperty( wxT( "enabled" ), wxT( "enabled" ), XRC_TYPE_BOOL );
 
-	if ( !m_obj->IsNull( _( "focused" ) ) )
-		AddPropertyValue( _( "focused" ), _( "0" ) );
+	if ( !m_obj->IsNull( wxT( "focused" ) ) )
+		AddPropertyValue( wxT( "focused" ), wxT( "0" ) );
 
-	if ( !m_obj->IsNull( _( "hidden" ) ) && m_obj->GetPropertyAsInteger( _( "hidden" ) ) )
-		AddProperty( _( "hidden" ), _( "hidden" ), XRC_TYPE_BOOL );
+	if ( !m_obj->IsNull( wxT( "hidden" ) ) && m_obj->GetPropertyAsInteger( wxT( "hidden" ) ) )
+		AddProperty( wxT( "hidden" ), wxT( "hidden" ), XRC_TYPE_BOOL );
 
-	if ( !m_obj->IsNull( _( "font" ) ) )
-		AddProperty( _( "font" ), _( "font" ), XRC_TYPE_FONT );
+	if ( !m_obj->IsNull( wxT( "font" ) ) )
+		AddProperty( wxT( "font" ), wxT( "font" ), XRC_TYPE_FONT );
 
-	if ( !m_obj->IsNull( _( "tooltip" ) ) )
-		AddProperty( _( "tooltip" ), wxT( "tooltip" ), XRC_TYPE_TEXT );
+	if ( !m_obj->IsNull( wxT( "tooltip" ) ) )
+		AddProperty( wxT( "tooltip" ), wxT( "tooltip" ), XRC_TYPE_TEXT );
 
-	if ( !m_obj->IsNull( _( "subclass" ) ) )
+	if ( !m_obj->IsNull( wxT( "subclass" ) ) )
 	{
-		wxString subclass = m_obj->GetChildFromParentProperty( _( "subclass" ), wxT( "name" ) );
+		wxString subclass = m_obj->GetChildFromParentProperty( wxT( "subclass" ), wxT( "name" ) );
 		if ( !subclass.empty() )
 		{
 			m_xrcObj->SetAttribute( "subclass", subclass.mb_str( wxConvUTF8 ) );
@@ -449,6 +467,7 @@ XrcToXfbFilter::XrcToXfbFilter( ticpp::Element *obj,
 {
 	m_xrcObj = obj;
 	m_xfbObj = new ticpp::Element( "object" );
+	IndexXrcProperties();
 
 	try
 	{
@@ -469,6 +488,7 @@ XrcToXfbFilter::XrcToXfbFilter( ticpp::Element *obj, const wxString &classname )
 {
 	m_xrcObj = obj;
 	m_xfbObj = new ticpp::Element( "object" );
+	IndexXrcProperties();
 
 	m_xfbObj->SetAttribute( "class", classname.mb_str( wxConvUTF8 ) );
 
@@ -491,9 +511,39 @@ XrcToXfbFilter::~XrcToXfbFilter()
 }
 
 
+void XrcToXfbFilter::IndexXrcProperties()
+{
+	ticpp::Element* element = m_xrcObj->FirstChildElement( false );
+	while ( element )
+	{
+		std::string name = element->Value();
+		if ( name != "object" && name != "object_ref" && m_xrcProperties.find( name ) == m_xrcProperties.end() )
+		{
+			// The line is kept, the component may remove the children of the object
+			XrcProperty& property = m_xrcProperties[ name ];
+			property.element = element;
+			property.line = element->Row();
+			property.imported = false;
+		}
+		element = element->NextSiblingElement( false );
+	}
+}
+
+ticpp::Element* XrcToXfbFilter::GetXrcProperty( const char* name )
+{
+	XrcPropertyMap::iterator property = m_xrcProperties.find( name );
+	if ( property == m_xrcProperties.end() )
+	{
+		return NULL;
+	}
+
+	property->second.imported = true;
+	return property->second.element;
+}
+
 ticpp::Element* XrcToXfbFilter::GetXrcProperty( const wxString &name )
 {
-	return m_xrcObj->FirstChildElement( name.mb_str( wxConvUTF8 ) );
+	return GetXrcProperty( (const char*)name.mb_str( wxConvUTF8 ) );
 }
 
 void XrcToXfbFilter::AddProperty( const wxString &xrcPropName,
@@ -502,49 +552,7 @@ void XrcToXfbFilter::AddProperty( const wxString &xrcPropName,
 {
 	ticpp::Element propElement( "property" );
 	propElement.SetAttribute( "name", xfbPropName.mb_str( wxConvUTF8 ) );
-
-	switch ( propType )
-	{
-		case XRC_TYPE_SIZE:
-		case XRC_TYPE_POINT:
-		case XRC_TYPE_BOOL:
-			ImportTextProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_TEXT:
-			ImportTextProperty( xrcPropName, &propElement, true );
-			break;
-
-		case XRC_TYPE_INTEGER:
-			ImportIntegerProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_FLOAT:
-			ImportFloatProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_BITLIST:
-			ImportBitlistProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_COLOUR:
-			ImportColourProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_FONT:
-			ImportFontProperty( xrcPropName, &propElement );
-			break;
-
-		case XRC_TYPE_STRINGLIST:
-			ImportStringListProperty( xrcPropName, &propElement, true );
-			break;
-
-		case XRC_TYPE_BITMAP:
-			ImportBitmapProperty( xrcPropName, &propElement );
-			break;
-
-	}
-
+	ImportProperty( GetXrcProperty( xrcPropName ), propType, &propElement );
 	m_xfbObj->LinkEndChild( &propElement );
 }
 
@@ -563,27 +571,34 @@ void XrcToXfbFilter::AddStyleProperty()
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( "style" );
+		ticpp::Element *xrcProperty = GetXrcProperty( "style" );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 
 		wxString bitlist = wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 		bitlist = ReplaceSynonymous( bitlist );
 
 		// FIXME: We should avoid hardcoding these things
-		std::set< wxString > windowStyles;
-		windowStyles.insert( wxT( "wxSIMPLE_BORDER" ) );
-		windowStyles.insert( wxT( "wxDOUBLE_BORDER" ) );
-		windowStyles.insert( wxT( "wxSUNKEN_BORDER" ) );
-		windowStyles.insert( wxT( "wxRAISED_BORDER" ) );
-		windowStyles.insert( wxT( "wxSTATIC_BORDER" ) );
-		windowStyles.insert( wxT( "wxNO_BORDER" ) );
-		windowStyles.insert( wxT( "wxTRANSPARENT_WINDOW" ) );
-		windowStyles.insert( wxT( "wxTAB_TRAVERSAL" ) );
-		windowStyles.insert( wxT( "wxWANTS_CHARS" ) );
-		windowStyles.insert( wxT( "wxVSCROLL" ) );
-		windowStyles.insert( wxT( "wxHSCROLL" ) );
-		windowStyles.insert( wxT( "wxALWAYS_SHOW_SB" ) );
-		windowStyles.insert( wxT( "wxCLIP_CHILDREN" ) );
-		windowStyles.insert( wxT( "wxFULL_REPAINT_ON_RESIZE" ) );
+		static std::set< wxString > windowStyles;
+		if ( windowStyles.empty() )
+		{
+			windowStyles.insert( wxT( "wxSIMPLE_BORDER" ) );
+			windowStyles.insert( wxT( "wxDOUBLE_BORDER" ) );
+			windowStyles.insert( wxT( "wxSUNKEN_BORDER" ) );
+			windowStyles.insert( wxT( "wxRAISED_BORDER" ) );
+			windowStyles.insert( wxT( "wxSTATIC_BORDER" ) );
+			windowStyles.insert( wxT( "wxNO_BORDER" ) );
+			windowStyles.insert( wxT( "wxTRANSPARENT_WINDOW" ) );
+			windowStyles.insert( wxT( "wxTAB_TRAVERSAL" ) );
+			windowStyles.insert( wxT( "wxWANTS_CHARS" ) );
+			windowStyles.insert( wxT( "wxVSCROLL" ) );
+			windowStyles.insert( wxT( "wxHSCROLL" ) );
+			windowStyles.insert( wxT( "wxALWAYS_SHOW_SB" ) );
+			windowStyles.insert( wxT( "wxCLIP_CHILDREN" ) );
+			windowStyles.insert( wxT( "wxFULL_REPAINT_ON_RESIZE" ) );
+		}
 
 		wxString style, windowStyle;
 		wxStringTokenizer tkz( bitlist, wxT( " |" ) );
@@ -624,18 +639,25 @@ void XrcToXfbFilter::AddExtraStyleProperty()
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( "exstyle" );
+		ticpp::Element *xrcProperty = GetXrcProperty( "exstyle" );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 
 		wxString bitlist = wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 		bitlist = ReplaceSynonymous( bitlist );
 
 		// FIXME: We should avoid hardcoding these things
-		std::set< wxString > windowStyles;
-		windowStyles.insert( wxT( "wxWS_EX_VALIDATE_RECURSIVELY" ) );
-		windowStyles.insert( wxT( "wxWS_EX_BLOCK_EVENTS" ) );
-		windowStyles.insert( wxT( "wxWS_EX_TRANSIENT" ) );
-		windowStyles.insert( wxT( "wxWS_EX_PROCESS_IDLE" ) );
-		windowStyles.insert( wxT( "wxWS_EX_PROCESS_UI_UPDATES" ) );
+		static std::set< wxString > windowStyles;
+		if ( windowStyles.empty() )
+		{
+			windowStyles.insert( wxT( "wxWS_EX_VALIDATE_RECURSIVELY" ) );
+			windowStyles.insert( wxT( "wxWS_EX_BLOCK_EVENTS" ) );
+			windowStyles.insert( wxT( "wxWS_EX_TRANSIENT" ) );
+			windowStyles.insert( wxT( "wxWS_EX_PROCESS_IDLE" ) );
+			windowStyles.insert( wxT( "wxWS_EX_PROCESS_UI_UPDATES" ) );
+		}
 
 		wxString style, windowStyle;
 		wxStringTokenizer tkz( bitlist, wxT( " |" ) );
@@ -675,7 +697,11 @@ void XrcToXfbFilter::AddPropertyPair( const char* xrcPropName, const wxString& x
 {
 	try
 	{
-		ticpp::Element* pairProp = m_xrcObj->FirstChildElement( xrcPropName );
+		ticpp::Element* pairProp = GetXrcProperty( xrcPropName );
+		if ( !pairProp )
+		{
+			return;
+		}
 
 		wxString width = wxEmptyString;
 		wxString height = wxEmptyString;
@@ -699,18 +725,33 @@ void XrcToXfbFilter::AddPropertyPair( const char* xrcPropName, const wxString& x
 
 ticpp::Element* XrcToXfbFilter::GetXfbObject()
 {
-	return m_xfbObj->Clone().release()->ToElement();
+	// The clone owns its copy, unlike the wrapper returned by ToElement
+	ticpp::Element* object = static_cast< ticpp::Element* >( m_xfbObj->Clone().release() );
+
+	for ( XrcPropertyMap::iterator property = m_xrcProperties.begin(); property != m_xrcProperties.end(); ++property )
+	{
+		if ( !property->second.imported )
+		{
+			ticpp::Element unsupported( XRC_UNSUPPORTED_TAG );
+			unsupported.SetAttribute( "name", property->first );
+			unsupported.SetAttribute( "line", property->second.line );
+			object->LinkEndChild( &unsupported );
+		}
+	}
+
+	return object;
 }
 
 //-----------------------------
 
-void XrcToXfbFilter::ImportTextProperty( 	const wxString &xrcPropName,
-											ticpp::Element *property,
-											bool parseXrcText )
+static void ImportTextProperty( ticpp::Element *xrcProperty, ticpp::Element *property, bool parseXrcText = false )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 
 		// Convert XRC text to normal text
 		wxString value( wxString( xrcProperty->GetText().c_str(), wxConvUTF8 ) );
@@ -726,11 +767,15 @@ void XrcToXfbFilter::ImportTextProperty( 	const wxString &xrcPropName,
 	}
 }
 
-void XrcToXfbFilter::ImportIntegerProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportIntegerProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			property->SetText( "0" );
+			return;
+		}
 		property->SetText( xrcProperty->GetText() );
 	}
 	catch( ticpp::Exception& )
@@ -739,11 +784,15 @@ void XrcToXfbFilter::ImportIntegerProperty( const wxString &xrcPropName, ticpp::
 	}
 }
 
-void XrcToXfbFilter::ImportFloatProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportFloatProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			property->SetText( "0.0" );
+			return;
+		}
 		property->SetText( xrcProperty->GetText() );
 	}
 	catch( ticpp::Exception& )
@@ -752,11 +801,14 @@ void XrcToXfbFilter::ImportFloatProperty( const wxString &xrcPropName, ticpp::El
 	}
 }
 
-void XrcToXfbFilter::ImportBitlistProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportBitlistProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 
 		wxString bitlist = wxString( xrcProperty->GetText().c_str(), wxConvUTF8 );
 		bitlist = ReplaceSynonymous( bitlist );
@@ -768,117 +820,72 @@ void XrcToXfbFilter::ImportBitlistProperty( const wxString &xrcPropName, ticpp::
 	}
 }
 
-void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportFontProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
-
-		ticpp::Element *element;
-		wxFontContainer font;
-
-		// the size
-		try
-		{
-			element = xrcProperty->FirstChildElement( "size" );
-			long size;
-			element->GetText( &size );
-			font.SetPointSize( size );
-		}
-		catch( ticpp::Exception& ex )
-		{
-			wxLogDebug( wxString( ex.m_details.c_str(), wxConvUTF8 ) );
-		}
-
-		// the family
-		try
-		{
-			element = xrcProperty->FirstChildElement( "family" );
-			wxString family_str( element->GetText().c_str(), wxConvUTF8 );
-
-			if ( family_str == _( "decorative" ) )
-				font.SetFamily( wxDECORATIVE );
-			else if ( family_str == _( "roman" ) )
-				font.SetFamily( wxROMAN );
-			else if ( family_str == _( "swiss" ) )
-				font.SetFamily( wxSWISS );
-			else if ( family_str == _( "script" ) )
-				font.SetFamily( wxSCRIPT );
-			else if ( family_str == _( "modern" ) )
-				font.SetFamily( wxMODERN );
-			else if ( family_str == _( "teletype" ) )
-				font.SetFamily( wxTELETYPE );
-			else
-				font.SetFamily( wxDEFAULT );
-		}
-		catch( ticpp::Exception& )
-		{
-			font.SetFamily( wxDEFAULT );
-		}
-
-		// the style
-		try
-		{
-			element = xrcProperty->FirstChildElement( "style" );
-			wxString style_str( element->GetText().c_str(), wxConvUTF8 );
-
-			if ( style_str == _( "slant" ) )
-				font.SetStyle( wxSLANT );
-			else if ( style_str == _( "italic" ) )
-				font.SetStyle( wxITALIC );
-			else
-				font.SetStyle( wxNORMAL );
-		}
-		catch( ticpp::Exception& )
+		if ( !xrcProperty )
 		{
-			font.SetStyle( wxNORMAL );
+			return;
 		}
 
-
-		// weight
-		try
-		{
-			element = xrcProperty->FirstChildElement( "weight" );
-			wxString weight_str( element->GetText().c_str(), wxConvUTF8 );
-
-			if ( weight_str == _( "light" ) )
-				font.SetWeight( wxLIGHT );
-			else if ( weight_str == _( "bold" ) )
-				font.SetWeight( wxBOLD );
-			else
-				font.SetWeight( wxNORMAL );
-		}
-		catch( ticpp::Exception& )
-		{
-			font.SetWeight( wxNORMAL );
-		}
-
-		// underlined
-		try
-		{
-			element = xrcProperty->FirstChildElement( "underlined" );
-			wxString underlined_str( element->GetText().c_str(), wxConvUTF8 );
-
-			if ( underlined_str == wxT( "1" ) )
-				font.SetUnderlined( true );
-			else
-				font.SetUnderlined( false );
-		}
-		catch( ticpp::Exception& )
+		wxFontContainer font;
+		font.SetFamily( wxDEFAULT );
+		font.SetStyle( wxNORMAL );
+		font.SetWeight( wxNORMAL );
+		font.SetUnderlined( false );
+		font.SetFaceName( wxEmptyString );
+
+		// A single pass over the values of the font, the missing ones keep their default
+		ticpp::Element *element = xrcProperty->FirstChildElement( false );
+		for ( ; element; element = element->NextSiblingElement( false ) )
 		{
-			font.SetUnderlined( false );
-		}
+			std::string name = element->Value();
+			wxString value( element->GetText( false ).c_str(), wxConvUTF8 );
 
-		// face
-		try
-		{
-			element = xrcProperty->FirstChildElement( "face" );
-			wxString face( element->GetText().c_str(), wxConvUTF8 );
-			font.SetFaceName( face );
-		}
-		catch( ticpp::Exception& )
-		{
-			font.SetFaceName( wxEmptyString );
+			if ( name == "size" )
+			{
+				long size;
+				if ( value.ToLong( &size ) )
+					font.SetPointSize( size );
+			}
+			else if ( name == "family" )
+			{
+				if ( value == _( "decorative" ) )
+					font.SetFamily( wxDECORATIVE );
+				else if ( value == _( "roman" ) )
+					font.SetFamily( wxROMAN );
+				else if ( value == _( "swiss" ) )
+					font.SetFamily( wxSWISS );
+				else if ( value == _( "script" ) )
+					font.SetFamily( wxSCRIPT );
+				else if ( value == _( "modern" ) )
+					font.SetFamily( wxMODERN );
+				else if ( value == _( "teletype" ) )
+					font.SetFamily( wxTELETYPE );
+			}
+			else if ( name == "style" )
+			{
+				if ( value == _( "slant" ) )
+					font.SetStyle( wxSLANT );
+				else if ( value == _( "italic" ) )
+					font.SetStyle( wxITALIC );
+			}
+			else if ( name == "weight" )
+			{
+				if ( value == _( "light" ) )
+					font.SetWeight( wxLIGHT );
+				else if ( value == _( "bold" ) )
+					font.SetWeight( wxBOLD );
+			}
+			else if ( name == "underlined" )
+			{
+				font.SetUnderlined( value == wxT( "1" ) );
+			}
+			else if ( name == "face" )
+			{
+				font.SetFaceName( value );
+			}
 		}
 
 		// We already have the font type. So we must now use the wxFB format
@@ -894,11 +901,14 @@ void XrcToXfbFilter::ImportFontProperty( const wxString &xrcPropName, ticpp::Ele
 	}
 }
 
-void XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportBitmapProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 		
 		if( (xrcProperty->GetAttribute( "stock_id" ) != "") && (xrcProperty->GetAttribute( "stock_client" ) != "") )
 		{
@@ -925,11 +935,14 @@ void XrcToXfbFilter::ImportBitmapProperty( const wxString &xrcPropName, ticpp::E
 	}
 }
 
-void XrcToXfbFilter::ImportColourProperty( const wxString &xrcPropName, ticpp::Element *property )
+static void ImportColourProperty( ticpp::Element *xrcProperty, ticpp::Element *property )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 		std::string value = xrcProperty->GetText();
 
 		// Changing "#rrggbb" format to "rrr,ggg,bbb"
@@ -958,11 +971,14 @@ void XrcToXfbFilter::ImportColourProperty( const wxString &xrcPropName, ticpp::E
 	}
 }
 
-void XrcToXfbFilter::ImportStringListProperty( const wxString &xrcPropName, ticpp::Element *property , bool parseXrcText )
+static void ImportStringListProperty( ticpp::Element *xrcProperty, ticpp::Element *property, bool parseXrcText )
 {
 	try
 	{
-		ticpp::Element *xrcProperty = m_xrcObj->FirstChildElement( xrcPropName.mb_str( wxConvUTF8 ) );
+		if ( !xrcProperty )
+		{
+			return;
+		}
 
 		wxString res;
 
@@ -994,6 +1010,51 @@ void XrcToXfbFilter::ImportStringListProperty( const wxString &xrcPropName, ticp
 	}
 }
 
+static void ImportProperty( ticpp::Element *xrcProperty, const int &propType, ticpp::Element *property )
+{
+	switch ( propType )
+	{
+		case XRC_TYPE_SIZE:
+		case XRC_TYPE_POINT:
+		case XRC_TYPE_BOOL:
+			ImportTextProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_TEXT:
+			ImportTextProperty( xrcProperty, property, true );
+			break;
+
+		case XRC_TYPE_INTEGER:
+			ImportIntegerProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_FLOAT:
+			ImportFloatProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_BITLIST:
+			ImportBitlistProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_COLOUR:
+			ImportColourProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_FONT:
+			ImportFontProperty( xrcProperty, property );
+			break;
+
+		case XRC_TYPE_STRINGLIST:
+			ImportStringListProperty( xrcProperty, property, true );
+			break;
+
+		case XRC_TYPE_BITMAP:
+			ImportBitmapProperty( xrcProperty, property );
+			break;
+
+	}
+}
+
 void XrcToXfbFilter::AddWindowProperties()
 {
 	AddProperty( _( "pos" ), _( "pos" ), XRC_TYPE_POINT );
@@ -1001,7 +1062,7 @@ void XrcToXfbFilter::AddWindowProperties()
 	AddProperty( _( "bg" ), _( "bg" ), XRC_TYPE_COLOUR );
 	AddProperty( _( "fg" ), _( "fg" ), XRC_TYPE_COLOUR );
 	AddProperty( _( "font" ), _( "font" ), XRC_TYPE_FONT );
-	if ( m_xrcObj->FirstChildElement( "enabled", false ) )
+	if ( m_xrcProperties.find( "enabled" ) != m_xrcProperties.end() )
 	{
 		AddProperty( _( "enabled"), _("enabled"), XRC_TYPE_BOOL );
 	}
@@ -1021,3 +1082,200 @@ void XrcToXfbFilter::AddWindowProperties()
 		m_xfbObj->LinkEndChild( &propElement );
 	}
 };
+
+///////////////////////////////////////////////////////////////////////////////
+
+// The name of the objects exported by the named batch filters
+PROPERTY_HANDLE( name )
+
+ObjectToXrcBatchFilter::ObjectToXrcBatchFilter( const wxString &classname, bool named )
+:
+m_classname( classname ),
+m_xrcClassname( classname.mb_str( wxConvUTF8 ) ),
+m_named( named )
+{
+}
+
+void ObjectToXrcBatchFilter::AddProperty( const PropertyHandle &objProperty,
+                                          const wxString &xrcPropName,
+                                          const int &propType )
+{
+	Binding binding;
+	binding.objProperty = &objProperty;
+	binding.xrcPropName = xrcPropName.mb_str( wxConvUTF8 );
+	binding.propType = propType;
+	m_bindings.push_back( binding );
+}
+
+const wxString& ObjectToXrcBatchFilter::GetClassName() const
+{
+	return m_classname;
+}
+
+void ObjectToXrcBatchFilter::AddProperties( IObject* obj, ticpp::Element* xrcObj ) const
+{
+	for ( std::vector< Binding >::const_iterator binding = m_bindings.begin(); binding != m_bindings.end(); ++binding )
+	{
+		const PropertyHandle& handle = *binding->objProperty;
+		ticpp::Element propElement( binding->xrcPropName );
+
+		switch ( binding->propType )
+		{
+			case XRC_TYPE_SIZE:
+			case XRC_TYPE_POINT:
+			case XRC_TYPE_BITLIST:
+				LinkText( obj->GetPropertyAsStringByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_TEXT:
+				LinkText( obj->GetPropertyAsStringByHandle( handle ), &propElement, true );
+				break;
+
+			case XRC_TYPE_BOOL:
+			case XRC_TYPE_INTEGER:
+				LinkInteger( obj->GetPropertyAsIntegerByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_FLOAT:
+				LinkFloat( obj->GetPropertyAsFloatByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_COLOUR:
+				LinkColour( obj->GetPropertyAsColourByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_FONT:
+				LinkFont( obj->GetPropertyAsFontByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_STRINGLIST:
+				LinkStringList( obj->GetPropertyAsArrayStringByHandle( handle ), &propElement );
+				break;
+
+			case XRC_TYPE_BITMAP:
+				LinkBitmap( obj->GetPropertyAsStringByHandle( handle ), &propElement );
+				break;
+		}
+
+		xrcObj->LinkEndChild( &propElement );
+	}
+}
+
+ticpp::Element* ObjectToXrcBatchFilter::Export( IObject* obj ) const
+{
+	ticpp::Element* xrcObj = new ticpp::Element( "object" );
+	xrcObj->SetAttribute( "class", m_xrcClassname );
+
+	if ( m_named )
+	{
+		wxString name = obj->GetPropertyAsStringByHandle( PROP_name );
+		if ( !name.empty() )
+			xrcObj->SetAttribute( "name", name.mb_str( wxConvUTF8 ) );
+	}
+
+	AddProperties( obj, xrcObj );
+	return xrcObj;
+}
+
+void ObjectToXrcBatchFilter::Export( IObject* const* objects, size_t count, ticpp::Element** elements ) const
+{
+	for ( size_t i = 0; i < count; i++ )
+	{
+		elements[i] = Export( objects[i] );
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+XrcToXfbBatchFilter::XrcToXfbBatchFilter( const wxString &classname )
+:
+m_classname( classname ),
+m_xfbClassname( classname.mb_str( wxConvUTF8 ) )
+{
+}
+
+void XrcToXfbBatchFilter::AddProperty( const wxString &xrcPropName,
+                                       const wxString &xfbPropName,
+                                       const int &propType )
+{
+	Binding binding;
+	binding.xrcPropName = xrcPropName.mb_str( wxConvUTF8 );
+	binding.xfbPropName = xfbPropName.mb_str( wxConvUTF8 );
+	binding.propType = propType;
+	m_bindings.push_back( binding );
+}
+
+const wxString& XrcToXfbBatchFilter::GetClassName() const
+{
+	return m_classname;
+}
+
+ticpp::Element* XrcToXfbBatchFilter::Import( ticpp::Element* xrcObj, const char* imported ) const
+{
+	// First child of the XRC object bound to each property, and the line of
+	// the first child with each of the other names, as XrcToXfbFilter does
+	std::vector< ticpp::Element* > xrcProperties( m_bindings.size(), (ticpp::Element*)NULL );
+	std::map< std::string, int > unsupported;
+
+	for ( ticpp::Element* element = xrcObj->FirstChildElement( false ); element; element = element->NextSiblingElement( false ) )
+	{
+		std::string name = element->Value();
+		if ( name == "object" || name == "object_ref" )
+		{
+			continue;
+		}
+
+		size_t i = 0;
+		while ( i < m_bindings.size() && m_bindings[i].xrcPropName != name )
+		{
+			i++;
+		}
+
+		if ( i < m_bindings.size() )
+		{
+			if ( !xrcProperties[i] )
+				xrcProperties[i] = element;
+		}
+		else if ( ( !imported || name != imported ) && unsupported.find( name ) == unsupported.end() )
+		{
+			unsupported[ name ] = element->Row();
+		}
+	}
+
+	ticpp::Element* xfbObj = new ticpp::Element( "object" );
+	xfbObj->SetAttribute( "class", m_xfbClassname );
+
+	if ( xrcObj->HasAttribute( "name" ) )
+	{
+		ticpp::Element propElement( "property" );
+		propElement.SetAttribute( "name", "name" );
+		propElement.SetText( xrcObj->GetAttribute( "name" ) );
+		xfbObj->LinkEndChild( &propElement );
+	}
+
+	for ( size_t i = 0; i < m_bindings.size(); i++ )
+	{
+		ticpp::Element propElement( "property" );
+		propElement.SetAttribute( "name", m_bindings[i].xfbPropName );
+		ImportProperty( xrcProperties[i], m_bindings[i].propType, &propElement );
+		xfbObj->LinkEndChild( &propElement );
+	}
+
+	for ( std::map< std::string, int >::iterator property = unsupported.begin(); property != unsupported.end(); ++property )
+	{
+		ticpp::Element unsupportedElement( XRC_UNSUPPORTED_TAG );
+		unsupportedElement.SetAttribute( "name", property->first );
+		unsupportedElement.SetAttribute( "line", property->second );
+		xfbObj->LinkEndChild( &unsupportedElement );
+	}
+
+	return xfbObj;
+}
+
+void XrcToXfbBatchFilter::Import( ticpp::Element* const* xrcObjs, size_t count, ticpp::Element** elements ) const
+{
+	for ( size_t i = 0; i < count; i++ )
+	{
+		elements[i] = Import( xrcObjs[i] );
+	}
+}
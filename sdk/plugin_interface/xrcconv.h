@@ -26,6 +26,10 @@
 #include "wx/wx.h"
 #include "component.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 #define XRC_TYPE_TEXT    0
 #define XRC_TYPE_INTEGER 1
 #define XRC_TYPE_BOOL    2
@@ -38,6 +42,12 @@
 #define XRC_TYPE_BITMAP  9
 #define XRC_TYPE_FLOAT 10
 
+/**
+ * Element added by XrcToXfbFilter::GetXfbObject for each property of the XRC
+ * object which was not imported, with the attributes "name" and "line".
+ */
+#define XRC_UNSUPPORTED_TAG "unsupported"
+
 namespace ticpp
 {
 	class Element;
@@ -88,13 +98,6 @@ class ObjectToXrcFilter
  private:
   ticpp::Element* m_xrcObj;
   IObject *m_obj;
-
-  void LinkText(const wxString &text, ticpp::Element *propElement, bool xrcFormat = false);
-  void LinkColour(const wxColour &colour, ticpp::Element *propElement);
-  void LinkFont(const wxFontContainer &font, ticpp::Element *propElement);
-  void LinkInteger(const int &integer, ticpp::Element *propElement);
-  void LinkFloat( const double& value, ticpp::Element* propElement );
-  void LinkStringList(const wxArrayString &array, ticpp::Element *propElement,  bool xrcFormat = false);
 };
 
 /**
@@ -103,6 +106,10 @@ class ObjectToXrcFilter
  * The usage is similar to the ObjectToXrcFilter filter. It's only
  * needed to add the properties with their related types.
  *
+ * The properties of the XRC object are indexed by name when the filter is
+ * created, so adding a property does not search the XRC object. The
+ * properties never added are reported in the object returned by
+ * GetXfbObject, see XRC_UNSUPPORTED_TAG.
  */
 class XrcToXfbFilter
 {
@@ -127,25 +134,149 @@ class XrcToXfbFilter
 
   void AddPropertyPair( const char* xrcPropName, const wxString& xfbPropName1, const wxString& xfbPropName2 );
 
+  /**
+   * Gets a property of the XRC object, for the components which convert it
+   * themselves. The property is then considered imported.
+   *
+   * @return NULL if the XRC object does not have the property.
+   */
+  ticpp::Element* GetXrcProperty( const char* name );
+  ticpp::Element* GetXrcProperty( const wxString &name );
+
+  /**
+   * Returns a new object, which the caller must delete.
+   */
   ticpp::Element* GetXfbObject();
 
  private:
+  struct XrcProperty
+  {
+    ticpp::Element* element;
+    int line;
+    bool imported;
+  };
+  typedef std::map< std::string, XrcProperty > XrcPropertyMap;
+
   ticpp::Element *m_xfbObj;
   ticpp::Element *m_xrcObj;
 
-  void ImportTextProperty(const wxString &xrcPropName, ticpp::Element *property, bool parseXrcText = false);
-  void ImportIntegerProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportFloatProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportBitlistProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportBitmapProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportColourProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportFontProperty(const wxString &xrcPropName, ticpp::Element *property);
-  void ImportStringListProperty(const wxString &xrcPropName, ticpp::Element *property, bool parseXrcText = false);
+  // First child of the XRC object with each name, except the objects
+  XrcPropertyMap m_xrcProperties;
+
+  void IndexXrcProperties();
 
   void AddStyleProperty();
   void AddExtraStyleProperty();
+};
+
+/**
+ * Properties exported in the same way for every object of a class, for the
+ * components which export many objects at once, see IXrcBatchComponent.
+ *
+ * The properties are bound once, when the component is created: they are
+ * read through their handles, and the elements are written with the XRC
+ * names already converted, without a filter for each object:
+ *
+ * @code
+ *  PROPERTY_HANDLE( proportion )
+ *  ...
+ *  ObjectToXrcBatchFilter m_xrc( wxT("sizeritem") );
+ *  m_xrc.AddProperty( PROP_proportion, wxT("option"), XRC_TYPE_INTEGER );
+ *  ...
+ *  m_xrc.Export( objects, count, elements );
+ * @endcode
+ */
+class ObjectToXrcBatchFilter
+{
+ public:
+  /**
+   * @param named Whether the objects are exported with the value of their
+   *              "name" property as name, as the windows are.
+   */
+  ObjectToXrcBatchFilter( const wxString &classname, bool named = false );
+
+  /**
+   * @param objProperty The handle of the property, declared with
+   *                    PROPERTY_HANDLE. It is kept, and read when the
+   *                    objects are exported.
+   */
+  void AddProperty( const PropertyHandle &objProperty,
+                    const wxString &xrcPropName,
+                    const int &propType );
+
+  const wxString& GetClassName() const;
+
+  /**
+   * Adds the bound properties of an object to its XRC element, for the
+   * components which also export other properties.
+   */
+  void AddProperties( IObject* obj, ticpp::Element* xrcObj ) const;
+
+  /**
+   * Returns a new element for the object, which the caller must delete.
+   */
+  ticpp::Element* Export( IObject* obj ) const;
+
+  /**
+   * Returns a new element for each object, which the caller must delete.
+   */
+  void Export( IObject* const* objects, size_t count, ticpp::Element** elements ) const;
+
+ private:
+  struct Binding
+  {
+    const PropertyHandle* objProperty;
+    std::string xrcPropName; // UTF-8
+    int propType;
+  };
+
+  wxString m_classname;
+  std::string m_xrcClassname; // UTF-8
+  bool m_named;
+  std::vector< Binding > m_bindings;
+};
+
+/**
+ * Properties imported in the same way for every XRC object of a class, the
+ * counterpart of ObjectToXrcBatchFilter. The properties of each XRC object
+ * are found in a single pass over its children, and converted as
+ * XrcToXfbFilter::AddProperty does.
+ */
+class XrcToXfbBatchFilter
+{
+ public:
+  XrcToXfbBatchFilter( const wxString &classname );
+
+  void AddProperty( const wxString &xrcPropName,
+                    const wxString &xfbPropName,
+                    const int &propType );
+
+  const wxString& GetClassName() const;
+
+  /**
+   * Returns a new object for the XRC object, which the caller must delete.
+   *
+   * @param imported A property which the component converts itself, so it
+   *                 is not reported as unsupported, or NULL.
+   */
+  ticpp::Element* Import( ticpp::Element* xrcObj, const char* imported = NULL ) const;
+
+  /**
+   * Returns a new object for each XRC object, which the caller must delete.
+   */
+  void Import( ticpp::Element* const* xrcObjs, size_t count, ticpp::Element** elements ) const;
+
+ private:
+  struct Binding
+  {
+    std::string xrcPropName; // UTF-8
+    std::string xfbPropName; // UTF-8
+    int propType;
+  };
 
-  ticpp::Element *GetXrcProperty(const wxString &name);
+  wxString m_classname;
+  std::string m_xfbClassname; // UTF-8
+  std::vector< Binding > m_bindings;
 };
 
 
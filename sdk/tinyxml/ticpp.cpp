@@ -851,6 +851,20 @@ void Document::Parse( const std::string& xml, bool throwIfParseError, TiXmlEncod
 	}
 }
 
+void Document::Parse( const char* xml, bool throwIfParseError, TiXmlEncoding encoding )
+{
+	m_tiXmlPointer->Parse( xml, 0, encoding );
+	if( throwIfParseError && m_tiXmlPointer->Error() )
+	{
+		TICPPTHROW( "Error parsing xml." );
+	}
+}
+
+void Document::UseArena()
+{
+	m_tiXmlPointer->UseArena();
+}
+
 //*****************************************************************************
 
 Element::Element()
@@ -1463,6 +1463,22 @@ namespace ticpp
 		@throws Exception
 		*/
 		void Parse( const std::string& xml, bool throwIfParseError = true, TiXmlEncoding encoding = TIXML_DEFAULT_ENCODING );
+
+		/**
+		Parse the given null terminated xml data, without copying it.
+
+		@param xml Xml to parse.
+		@param throwIfParseError [DEF] If true, throws when there is a parse error.
+		@param encoding Sets the documents encoding.
+		@throws Exception
+		*/
+		void Parse( const char* xml, bool throwIfParseError = true, TiXmlEncoding encoding = TIXML_DEFAULT_ENCODING );
+
+		/**
+		Allocates the nodes parsed from now on from an arena, released with the document.
+		@see TiXmlDocument::UseArena
+		*/
+		void UseArena();
 	};
 
 	/** Wrapper around TiXmlElement */
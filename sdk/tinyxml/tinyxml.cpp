@@ -24,6 +24,7 @@ distribution.
 #include "tinyxml.h"
 
 #include <ctype.h>
+#include <new>
 
 #ifdef TIXML_USE_STL
 #include <sstream>
@@ -33,6 +34,89 @@ distribution.
 
 bool TiXmlBase::condenseWhiteSpace = true;
 
+// Size of the blocks of an arena, bigger allocations get their own block
+const size_t TIXML_ARENA_BLOCK_SIZE = 64 * 1024;
+
+// Alignment of the allocations of an arena, enough for any node
+const size_t TIXML_ARENA_ALIGNMENT = 2 * sizeof( void* );
+
+// Each node and attribute is preceded by the arena it was allocated from, null for the heap
+const size_t TIXML_ALLOCATION_HEADER = TIXML_ARENA_ALIGNMENT;
+
+TiXmlArena::TiXmlArena() : blocks( 0 ), current( 0 ), end( 0 )
+{
+}
+
+TiXmlArena::~TiXmlArena()
+{
+	while ( blocks )
+	{
+		Block* next = blocks->next;
+		free( blocks );
+		blocks = next;
+	}
+}
+
+void* TiXmlArena::Allocate( size_t size )
+{
+	size = ( size + TIXML_ARENA_ALIGNMENT - 1 ) & ~( TIXML_ARENA_ALIGNMENT - 1 );
+	if ( size > (size_t)( end - current ) )
+	{
+		bool large = ( size > TIXML_ARENA_BLOCK_SIZE / 4 );
+		size_t blockSize = ( large ? size : TIXML_ARENA_BLOCK_SIZE );
+
+		Block* block = (Block*)malloc( TIXML_ARENA_ALIGNMENT + blockSize );
+		if ( !block )
+			return 0;
+		block->next = blocks;
+		blocks = block;
+
+		char* memory = (char*)block + TIXML_ARENA_ALIGNMENT;
+		if ( large )
+		{
+			// The rest of the current block can still be used
+			return memory;
+		}
+		current = memory;
+		end = memory + blockSize;
+	}
+
+	void* memory = current;
+	current += size;
+	return memory;
+}
+
+void* TiXmlBase::operator new( size_t size )
+{
+	return operator new( size, (TiXmlArena*)0 );
+}
+
+void* TiXmlBase::operator new( size_t size, TiXmlArena* arena )
+{
+	size += TIXML_ALLOCATION_HEADER;
+	void* memory = ( arena ? arena->Allocate( size ) : malloc( size ) );
+	if ( !memory )
+		throw std::bad_alloc();
+
+	*(TiXmlArena**)memory = arena;
+	return (char*)memory + TIXML_ALLOCATION_HEADER;
+}
+
+void TiXmlBase::operator delete( void* p )
+{
+	if ( !p )
+		return;
+
+	void* memory = (char*)p - TIXML_ALLOCATION_HEADER;
+	if ( !*(TiXmlArena**)memory )
+		free( memory );
+}
+
+void TiXmlBase::operator delete( void* p, TiXmlArena* )
+{
+	operator delete( p );
+}
+
 // Microsoft compiler security
 FILE* TiXmlFOpen( const char* filename, const char* mode )
 {
@@ -884,6 +968,7 @@ TiXmlDocument::TiXmlDocument() : TiXmlNode( TiXmlNode::DOCUMENT )
 {
 	tabsize = 4;
 	useMicrosoftBOM = false;
+	arena = 0;
 	ClearError();
 }
 
@@ -891,6 +976,7 @@ TiXmlDocument::TiXmlDocument( const char * documentName ) : TiXmlNode( TiXmlNode
 {
 	tabsize = 4;
 	useMicrosoftBOM = false;
+	arena = 0;
 	value = documentName;
 	ClearError();
 }
@@ -901,6 +987,7 @@ TiXmlDocument::TiXmlDocument( const std::string& documentName ) : TiXmlNode( TiX
 {
 	tabsize = 4;
 	useMicrosoftBOM = false;
+	arena = 0;
     value = documentName;
 	ClearError();
 }
@@ -909,10 +996,27 @@ TiXmlDocument::TiXmlDocument( const std::string& documentName ) : TiXmlNode( TiX
 
 TiXmlDocument::TiXmlDocument( const TiXmlDocument& copy ) : TiXmlNode( TiXmlNode::DOCUMENT )
 {
+	// The copies of the nodes are not allocated from the arena
+	arena = 0;
 	copy.CopyTo( this );
 }
 
 
+TiXmlDocument::~TiXmlDocument()
+{
+	// The nodes are destroyed before the arena they live in
+	Clear();
+	delete arena;
+}
+
+
+void TiXmlDocument::UseArena()
+{
+	if ( !arena )
+		arena = new TiXmlArena();
+}
+
+
 void TiXmlDocument::operator=( const TiXmlDocument& copy )
 {
 	Clear();
@@ -26,6 +26,7 @@ distribution.
  * THIS FILE WAS ALTERED BY Matt Janisz, 12. October 2012.
  *
  * - added ticppapi.h include and TICPP_API dll-interface to support building DLL using VS200X
+ * - added TiXmlArena, to allocate the nodes and attributes of a parsed document in one go
  */
 
 #ifndef TINYXML_INCLUDED
@@ -185,6 +186,35 @@ enum TiXmlEncoding
 
 const TiXmlEncoding TIXML_DEFAULT_ENCODING = TIXML_ENCODING_UNKNOWN;
 
+
+/**	A bump allocator, for the nodes and attributes a document parses when
+	TiXmlDocument::UseArena() was called. Memory is taken from large blocks,
+	and only released when the arena is destroyed, all the blocks at once.
+*/
+class TICPP_API TiXmlArena
+{
+public:
+	TiXmlArena();
+	~TiXmlArena();
+
+	/// Returns memory for @a size bytes, aligned for any node, or null if there is no memory left.
+	void* Allocate( size_t size );
+
+private:
+	TiXmlArena( const TiXmlArena& );		// not implemented.
+	void operator=( const TiXmlArena& );	// not implemented.
+
+	struct Block
+	{
+		Block* next;
+	};
+
+	Block* blocks;
+	char* current;
+	char* end;
+};
+
+
 /** TiXmlBase is a base class for every class in TinyXml.
 	It does little except to establish that TinyXml classes
 	can be printed and provide some utility functions.
@@ -222,6 +252,15 @@ public:
 	TiXmlBase()	:	userData(0)		{}
 	virtual ~TiXmlBase()			{}
 
+	/**	Nodes and attributes are allocated from the heap, or from the arena of
+		their document when it is given. Deleting one allocated from an arena
+		only destroys it: its memory is released with the arena.
+	*/
+	static void* operator new( size_t size );
+	static void* operator new( size_t size, TiXmlArena* arena );
+	static void operator delete( void* p );
+	static void operator delete( void* p, TiXmlArena* arena );
+
 	/**	All TinyXml classes can print themselves to a filestream
 		or the string class (TiXmlString in non-STL mode, std::string
 		in STL mode.) Either or both cfile and str can be null.
@@ -1485,7 +1524,7 @@ public:
 	TiXmlDocument( const TiXmlDocument& copy );
 	void operator=( const TiXmlDocument& copy );
 
-	virtual ~TiXmlDocument() {}
+	virtual ~TiXmlDocument();
 
 	/** Load a file using the current document value.
 		Returns true if successful. Will delete any existing
@@ -1588,6 +1627,19 @@ public:
 
 	int TabSize() const	{ return tabsize; }
 
+	/**	Allocates the nodes and attributes parsed from now on from an arena
+		owned by the document, instead of one by one from the heap. They are
+		all released at once when the document is destroyed, which makes
+		loading and destroying large documents much faster.
+
+		Nodes added to the document by the program are not affected. Nodes
+		removed from the document keep their memory until it is destroyed.
+	*/
+	void UseArena();
+
+	/// The arena of the document, null if UseArena() was not called.
+	TiXmlArena* Arena() const	{ return arena; }
+
 	/** If you have handled the error, it can be reset with this call. The error
 		state is automatically cleared if you Parse a new XML block.
 	*/
@@ -1635,6 +1687,7 @@ private:
 	int tabsize;
 	TiXmlCursor errorLocation;
 	bool useMicrosoftBOM;		// the UTF-8 BOM were found when read. Note this, and try to write.
+	TiXmlArena* arena;
 };
 
 
@@ -434,15 +434,15 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	wxString userCode;
 
 	// Start header file
-	wxString code = GetCode( userClasses, wxT("guard_macro_open") );
+	wxString code = GetCode( userClasses, TEMPLATE_GUARD_MACRO_OPEN );
 	m_header->WriteLn( code );
 	m_header->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("header_comment") );
+	code = GetCode( userClasses, TEMPLATE_HEADER_COMMENT );
 	m_header->WriteLn( code );
 	m_header->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("header_include") );
+	code = GetCode( userClasses, TEMPLATE_HEADER_INCLUDE );
 	m_header->WriteLn( code );
 	m_header->WriteLn( wxEmptyString );
 	m_header->WriteLn( wxT("//// end generated include") );
@@ -453,13 +453,13 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 		m_header->WriteLn( userCode );
 	}
 
-	code = GetCode( userClasses, wxT("class_decl") );
+	code = GetCode( userClasses, TEMPLATE_CLASS_DECL );
 	m_header->WriteLn( code );
 	m_header->WriteLn( wxT("{") );
 	m_header->Indent();
 
 	// Start source file
-	code = GetCode( userClasses, wxT("source_include") );
+	code = GetCode( userClasses, TEMPLATE_SOURCE_INCLUDE );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
@@ -486,7 +486,7 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	{
 		m_header->WriteLn( wxT("protected:") );
 		m_header->Indent();
-		code = GetCode( userClasses, wxT("event_handler_comment") );
+		code = GetCode( userClasses, TEMPLATE_EVENT_HANDLER_COMMENT );
 		m_header->WriteLn( code );
 
 		wxString className = userClasses->GetPropertyAsString( _( "name") );
@@ -553,7 +553,7 @@ void CppCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 
 	m_header->WriteLn( wxT("};") );
 	m_header->WriteLn( wxEmptyString );
-	code = GetCode( userClasses, wxT( "guard_macro_close" ) );
+	code = GetCode( userClasses, TEMPLATE_GUARD_MACRO_CLOSE );
 	m_header->WriteLn( code );
 
 	userCode = m_inheritedCodeParser.GetRemainingFunctions();
@@ -624,7 +624,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	m_header->WriteLn( wxT( "#define __" ) + guardMacro + wxT( "_H__" ) );
 	m_header->WriteLn( wxT( "" ) );
 
-	code = GetCode( project, wxT( "header_preamble" ) );
+	code = GetCode( project, TEMPLATE_HEADER_PREAMBLE );
 	if ( !code.empty() )
 	{
 		m_header->WriteLn( code );
@@ -704,13 +704,13 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 		}
 	}
 
-	code = GetCode( project, wxT( "header_epilogue" ) );
+	code = GetCode( project, TEMPLATE_HEADER_EPILOGUE );
 	m_header->WriteLn( code );
 	m_header->WriteLn( wxEmptyString );
 
 	// Inserting in the .cpp source file the include corresponding to the
 	// generated .h header file and the related xpm includes
-	code = GetCode( project, wxT( "cpp_preamble" ) );
+	code = GetCode( project, TEMPLATE_CPP_PREAMBLE );
 	if ( !code.empty() )
 	{
 		m_source->WriteLn( code );
@@ -733,7 +733,7 @@ bool CppCodeGenerator::GenerateCode( PObjectBase project )
 	m_source->WriteLn( wxEmptyString );
 	GenEmbeddedBitmapIncludes( project );
 
-	code = GetCode( project, wxT( "cpp_epilogue" ) );
+	code = GetCode( project, TEMPLATE_CPP_EPILOGUE );
 	m_source->WriteLn( code );
 
 	// namespace
@@ -882,7 +882,7 @@ void CppCodeGenerator::GenEvents( PObjectBase class_obj, const EventVector &even
 bool CppCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName, bool disconnect )
 {
 	wxString _template;
-	PCodeInfo code_info = obj_info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = obj_info->GetCodeInfo( LANGUAGE_CPP );
 	if ( code_info )
 	{
 		_template = code_info->GetTemplate( wxString::Format( wxT( "evt_%s%s" ), disconnect ? wxT( "dis" ) : wxT( "" ), templateName.c_str() ) );
@@ -981,7 +981,7 @@ void CppCodeGenerator::GenAttributeDeclaration( PObjectBase obj, Permission perm
 		        ( perm == P_PRIVATE && perm_str == wxT( "private" ) ) )
 		{
 			// Generate the declaration
-			wxString code = GetCode( obj, wxT( "declaration" ) );
+			wxString code = GetCode( obj, TEMPLATE_DECLARATION );
 			if ( !code.empty() )
 				m_header->WriteLn( code );
 		}
@@ -1010,14 +1010,14 @@ void CppCodeGenerator::GenValidatorVariables( PObjectBase obj )
 void CppCodeGenerator::GenValVarsBase( PObjectInfo info, PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_CPP );
 
 	if ( !code_info )
 	{
 		return;
 	}
 
-	_template = code_info->GetTemplate( wxT( "valvar_declaration" ) );
+	_template = code_info->GetTemplate( TEMPLATE_VALVAR_DECLARATION );
 
 	if ( !_template.empty() )
 	{
@@ -1051,10 +1051,10 @@ void CppCodeGenerator::GetGenEventHandlers( PObjectBase obj )
 
 void CppCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj )
 {
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_CPP );
 	if ( code_info )
 	{
-		wxString _template = code_info->GetTemplate( wxT( "generated_event_handlers" ) );
+		wxString _template = code_info->GetTemplate( TEMPLATE_GENERATED_EVENT_HANDLERS );
 		if ( !_template.empty() )
 		{
 			CppTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
@@ -1078,7 +1078,7 @@ void CppCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 wxString CppCodeGenerator::GetCode( PObjectBase obj, wxString name )
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_CPP );
 
 	if ( !code_info )
 	{
@@ -1096,6 +1096,19 @@ wxString CppCodeGenerator::GetCode( PObjectBase obj, wxString name )
 	return code;
 }
 
+wxString CppCodeGenerator::GetCode( PObjectBase obj, CodeTemplate slot )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_CPP );
+	if ( !code_info )
+	{
+		// Reports the missing template
+		return GetCode( obj, CodeInfo::GetTemplateName( slot ) );
+	}
+
+	CppTemplateParser parser( obj, code_info->GetTemplate( slot ), m_i18n, m_useRelativePath, m_basePath );
+	return parser.ParseTemplate();
+}
+
 void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events )
 {
 	PProperty propName = class_obj->GetProperty( wxT( "name" ) );
@@ -1117,7 +1130,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	m_header->WriteLn( wxT( "/// Class " ) + class_name );
 	m_header->WriteLn( wxT( "///////////////////////////////////////////////////////////////////////////////" ) );
 
-	m_header->WriteLn( wxT( "class " ) + classDecoration + class_name + wxT( " : " ) + GetCode( class_obj, wxT( "base" ) ) );
+	m_header->WriteLn( wxT( "class " ) + classDecoration + class_name + wxT( " : " ) + GetCode( class_obj, TEMPLATE_BASE ) );
 	m_header->WriteLn( wxT( "{" ) );
 	m_header->Indent();
 
@@ -1190,7 +1203,7 @@ void CppCodeGenerator::GenClassDeclaration( PObjectBase class_obj, bool use_enum
 	m_header->WriteLn( wxT( "" ) );
 
 	// The constructor is also included within public
-	m_header->WriteLn( GetCode( class_obj, wxT( "cons_decl" ) ) );
+	m_header->WriteLn( GetCode( class_obj, TEMPLATE_CONS_DECL ) );
 
 	// Destructor
 	m_header->WriteLn( wxString::Format( wxT( "~%s();" ), class_name.c_str() ) );
@@ -1385,10 +1398,10 @@ void CppCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxSt
 	}
 
 	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( LANGUAGE_CPP );
 	if ( code_info )
 	{
-		CppTemplateParser parser( project, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( project, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1417,10 +1430,10 @@ void CppCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 		GenBaseIncludes( base_info, obj, includes, templates );
 	}
 
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_CPP );
 	if ( code_info )
 	{
-		CppTemplateParser parser( obj, code_info->GetTemplate( wxT( "include" ) ), m_i18n, m_useRelativePath, m_basePath );
+		CppTemplateParser parser( obj, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1496,11 +1509,11 @@ void CppCodeGenerator::FindDependencies( PObjectBase obj, std::set< PObjectInfo
 void CppCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector &events )
 {
 	m_source->WriteLn();
-	m_source->WriteLn( GetCode( class_obj, wxT( "cons_def" ) ) );
+	m_source->WriteLn( GetCode( class_obj, TEMPLATE_CONS_DEF ) );
 	m_source->WriteLn( wxT( "{" ) );
 	m_source->Indent();
 
-	wxString settings = GetCode( class_obj, wxT( "settings" ) );
+	wxString settings = GetCode( class_obj, TEMPLATE_SETTINGS );
 	if ( !settings.empty() )
 	{
 		m_source->WriteLn( settings );
@@ -1511,7 +1524,7 @@ void CppCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		GenConstruction( class_obj->GetChild( i ), true );
 	}
 
-	wxString afterAddChild = GetCode( class_obj, wxT( "after_addchild" ) );
+	wxString afterAddChild = GetCode( class_obj, TEMPLATE_AFTER_ADDCHILD );
 	if ( !afterAddChild.empty() )
 	{
 		m_source->WriteLn( afterAddChild );
@@ -1573,14 +1586,14 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 		wxString perm_str = obj->GetProperty( wxT( "permission" ) )->GetValue();
 		if ( perm_str == wxT( "none" ) )
 		{
-			const wxString& decl = GetCode( obj, wxT( "declaration" ) );
+			const wxString& decl = GetCode( obj, TEMPLATE_DECLARATION );
 			if ( !decl.empty() )
 			{
 				m_source->WriteLn( decl );
 			}
 		}
 
-		m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 
 		bool isWidget = !info->IsSubclassOf( wxT( "sizer" ) );
@@ -1598,7 +1611,7 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 
 		if ( !isWidget ) // sizers
 		{
-			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1677,7 +1690,7 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 		           type == wxT( "flatnotebook" )
 		        )
 		{
-			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1692,18 +1705,18 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 		GenConstruction( obj->GetChild( 0 ), false );
 
 		PObjectInfo childInfo = obj->GetChild( 0 )->GetObjectInfo();
-		wxString temp_name;
+		CodeTemplate temp_name;
 		if ( childInfo->IsSubclassOf( wxT( "wxWindow" ) ) || wxT( "CustomControl" ) == childInfo->GetClassName() )
 		{
-			temp_name = wxT( "window_add" );
+			temp_name = TEMPLATE_WINDOW_ADD;
 		}
 		else if ( childInfo->IsSubclassOf( wxT( "sizer" ) ) )
 		{
-			temp_name = wxT( "sizer_add" );
+			temp_name = TEMPLATE_SIZER_ADD;
 		}
 		else if ( childInfo->GetClassName() == wxT( "spacer" ) )
 		{
-			temp_name = wxT( "spacer_add" );
+			temp_name = TEMPLATE_SPACER_ADD;
 		}
 		else
 		{
@@ -1722,12 +1735,12 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 	        )
 	{
 		GenConstruction( obj->GetChild( 0 ), false );
-		m_source->WriteLn( GetCode( obj, wxT( "page_add" ) ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_PAGE_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT( "treelistctrlcolumn" ) )
 	{
-		m_source->WriteLn( GetCode( obj, wxT( "column_add" ) ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_COLUMN_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT( "tool" ) )
@@ -1747,13 +1760,13 @@ void CppCodeGenerator::GenConstruction( PObjectBase obj, bool is_widget )
 				if ( _("Load From Icon Resource") == source && wxDefaultSize == toolsize )
 				{
 					prop->SetValue( wxString::Format( wxT( "%s; %s [%i; %i]" ), path.c_str(), source.c_str(), toolbarsize.GetWidth(), toolbarsize.GetHeight() ) );
-					m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+					m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 					prop->SetValue( oldVal );
 					return;
 				}
 			}
 		}
-		m_source->WriteLn( GetCode( obj, wxT( "construction" ) ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 	}
 	else
 	{
@@ -1845,14 +1858,14 @@ void CppCodeGenerator::GenDefines( PObjectBase project )
 void CppCodeGenerator::GenSettings( PObjectInfo info, PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_CPP );
 
 	if ( !code_info )
 	{
 		return;
 	}
 
-	_template = code_info->GetTemplate( wxT( "settings" ) );
+	_template = code_info->GetTemplate( TEMPLATE_SETTINGS );
 
 	if ( !_template.empty() )
 	{
@@ -1875,11 +1888,11 @@ void CppCodeGenerator::GenSettings( PObjectInfo info, PObjectBase obj )
 void CppCodeGenerator::GenDestruction( PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_CPP );
 
 	if ( code_info )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		_template = code_info->GetTemplate( TEMPLATE_DESTRUCTION );
 
 		if ( !_template.empty() )
 		{
@@ -1912,12 +1925,12 @@ void CppCodeGenerator::GenAddToolbar( PObjectInfo info, PObjectBase obj )
 void CppCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxArrayString& codelines )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "C++" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_CPP );
 
 	if ( !code_info )
 		return;
 
-	_template = code_info->GetTemplate( wxT( "toolbar_add" ) );
+	_template = code_info->GetTemplate( TEMPLATE_TOOLBAR_ADD );
 
 	if ( !_template.empty() )
 	{
@@ -97,6 +97,7 @@ private:
 	* Given an object and the name for a template, obtains the code.
 	*/
 	wxString GetCode( PObjectBase obj, wxString name);
+	wxString GetCode( PObjectBase obj, CodeTemplate slot );
 
 	/**
 	* Stores the project's objects classes set, for generating the includes.
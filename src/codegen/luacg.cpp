@@ -447,7 +447,7 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	}
 
 	// Start file
-	wxString code = GetCode( userClasses, wxT("file_comment") );
+	wxString code = GetCode( userClasses, TEMPLATE_FILE_COMMENT );
 	m_source->WriteLn( code );
 
 	wxString fullGenPath = genFileFullPath;
@@ -456,7 +456,7 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	code = wxT("package.path = \"") + fullGenPath + wxT(".lua\"");
 	m_source->WriteLn( code );
 
-	code = GetCode( userClasses, wxT("source_include") );
+	code = GetCode( userClasses, TEMPLATE_SOURCE_INCLUDE );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
@@ -467,7 +467,7 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 
 			if ( events.size() > 0 )
 			{
-				code = GetCode( userClasses, wxT("event_handler_comment") );
+				code = GetCode( userClasses, TEMPLATE_EVENT_HANDLER_COMMENT );
 				m_source->WriteLn( code );
 				m_source->WriteLn( wxEmptyString );
 
@@ -516,7 +516,7 @@ void LuaCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 wxString LuaCodeGenerator::GenEventEntryForInheritedClass( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName, wxString &strClassName )
 {
 	wxString code;
-	PCodeInfo code_info = obj_info->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = obj_info->GetCodeInfo( LANGUAGE_LUA );
 	if ( code_info )
 	{
 		wxString _template;
@@ -562,7 +562,7 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 
 	// Insert Lua preamble
 
-	wxString code = GetCode( project, wxT("lua_preamble") );
+	wxString code = GetCode( project, TEMPLATE_LUA_PREAMBLE );
 	if ( !code.empty() )
 	{
 		m_source->WriteLn( code );
@@ -649,7 +649,7 @@ bool LuaCodeGenerator::GenerateCode( PObjectBase project )
 		GenClassDeclaration( child, false, wxT(""), events, m_strEventHandlerPostfix );
 	}
 
-	code = GetCode( project, wxT("lua_epilogue") );
+	code = GetCode( project, TEMPLATE_LUA_EPILOGUE );
 	if( !code.empty() )
 		m_source->WriteLn( code );
 
@@ -729,7 +729,7 @@ void LuaCodeGenerator::GenEvents( PObjectBase class_obj, const EventVector &even
 bool LuaCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName,  wxString &strClassName, bool disconnect )
 {
 	wxString _template;
-	PCodeInfo code_info = obj_info->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = obj_info->GetCodeInfo( LANGUAGE_LUA );
 	if ( code_info )
 	{
 		_template = code_info->GetTemplate( wxString::Format( wxT("evt_%s%s"), disconnect ? wxT("dis") : wxT(""), templateName.c_str() ) );
@@ -820,10 +820,10 @@ void LuaCodeGenerator::GetGenEventHandlers( PObjectBase obj )
 
 void LuaCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj )
 {
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "Lua" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_LUA );
 	if ( code_info )
 	{
-		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
+		wxString _template = code_info->GetTemplate( TEMPLATE_GENERATED_EVENT_HANDLERS );
 		if ( !_template.empty() )
 		{
 			LuaTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
@@ -845,23 +845,23 @@ void LuaCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 }
 
 
-wxString LuaCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent/*= false*/, wxString strSelf /*= wxT("")*/)
+wxString LuaCodeGenerator::GetCode(PObjectBase obj, CodeTemplate slot, bool silent/*= false*/, wxString strSelf /*= wxT("")*/)
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_LUA );
 
 	if (!code_info)
 	{
 		if( !silent )
 		{
 			wxString msg( wxString::Format( wxT("Missing \"%s\" template for \"%s\" class. Review your XML object description"),
-				name.c_str(), obj->GetClassName().c_str() ) );
+				CodeInfo::GetTemplateName( slot ).c_str(), obj->GetClassName().c_str() ) );
 			wxLogError(msg);
 		}
 		return wxT("");
 	}
 
-	_template = code_info->GetTemplate(name);
+	_template = code_info->GetTemplate( slot );
 	_template.Replace(wxT("#parentname"), strSelf);
 
 
@@ -998,10 +998,10 @@ void LuaCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>*
 void LuaCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
 {
 	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( LANGUAGE_LUA );
 	if (code_info)
 	{
-		LuaTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( project, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1036,10 +1036,10 @@ void LuaCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 		GenBaseIncludes( base_info, obj, includes, templates );
 	}
 
-	PCodeInfo code_info = info->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_LUA );
 	if ( code_info )
 	{
-		LuaTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
+		LuaTemplateParser parser( obj, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath, m_strUserIDsVec );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -1109,10 +1109,10 @@ void LuaCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 	m_source->WriteLn();
 	m_source->WriteLn( wxT("-- create ") + strClassName );
 
-	m_source->WriteLn(strName + wxT(" = ") + GetCode( class_obj, wxT("cons_call") ));
+	m_source->WriteLn(strName + wxT(" = ") + GetCode( class_obj, TEMPLATE_CONS_CALL ));
 
 	m_source->Indent();
-	wxString settings = GetCode( class_obj, wxT("settings") );
+	wxString settings = GetCode( class_obj, TEMPLATE_SETTINGS );
 	if ( !settings.IsEmpty() )
 	{
 		m_source->WriteLn( settings );
@@ -1139,7 +1139,7 @@ void LuaCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		GenConstruction( class_obj->GetChild( i ), true , strClassName);
 	}
 
-	wxString afterAddChild = GetCode( class_obj, wxT("after_addchild") );
+	wxString afterAddChild = GetCode( class_obj, TEMPLATE_AFTER_ADDCHILD );
     if ( !afterAddChild.IsEmpty() )
     {
         m_source->WriteLn( afterAddChild );
@@ -1203,7 +1203,7 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 			return;
 		}
 
-		m_source->WriteLn( GetCode( obj, wxT("construction"), false, strClassName ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION, false, strClassName ) );
 
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 
@@ -1222,7 +1222,7 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 
 		if ( !isWidget ) // sizers
 		{
-			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1308,7 +1308,7 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
                 type == wxT("wizard")
 			)
 		{
-			wxString afterAddChild = GetCode( obj, wxT("after_addchild") );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1324,18 +1324,18 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 		GenConstruction( obj->GetChild(0), false,  strClassName);
 
 		PObjectInfo childInfo = obj->GetChild(0)->GetObjectInfo();
-		wxString temp_name;
+		CodeTemplate temp_name;
 		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
 		{
-			temp_name = wxT("window_add");
+			temp_name = TEMPLATE_WINDOW_ADD;
 		}
 		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
 		{
-			temp_name = wxT("sizer_add");
+			temp_name = TEMPLATE_SIZER_ADD;
 		}
 		else if ( childInfo->GetClassName() == wxT("spacer") )
 		{
-			temp_name = wxT("spacer_add");
+			temp_name = TEMPLATE_SPACER_ADD;
 		}
 		else
 		{
@@ -1355,12 +1355,12 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 			)
 	{
 		GenConstruction( obj->GetChild( 0 ), false, strClassName);
-		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_PAGE_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 	}
 	else if ( type == wxT("treelistctrlcolumn") )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_COLUMN_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj, strClassName );
 	}
 	else if ( type == wxT("tool") )
@@ -1380,13 +1380,13 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 				if ( _("Load From Icon Resource") == source && wxDefaultSize == toolsize )
 				{
 					prop->SetValue( wxString::Format( wxT("%s; %s [%i; %i]"), path.c_str(), source.c_str(), toolbarsize.GetWidth(), toolbarsize.GetHeight() ) );
-					m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+					m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 					prop->SetValue( oldVal );
 					return;
 				}
 			}
 		}
-		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 	}
 	else
 	{
@@ -1401,11 +1401,11 @@ void LuaCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget, wxString
 void LuaCodeGenerator::GenDestruction( PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "Lua" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_LUA );
 
 	if ( code_info )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		_template = code_info->GetTemplate( TEMPLATE_DESTRUCTION );
 
 		if ( !_template.empty() )
 		{
@@ -1510,14 +1510,14 @@ void LuaCodeGenerator::GenDefines( PObjectBase project)
 void LuaCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj, wxString &strClassName  )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT("Lua") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_LUA );
 
 	if ( !code_info )
 	{
 		return;
 	}
 
-	_template = code_info->GetTemplate( wxT("settings") );
+	_template = code_info->GetTemplate( TEMPLATE_SETTINGS );
 
 	if ( !_template.empty() )
 	{
@@ -1555,12 +1555,12 @@ void LuaCodeGenerator::GenAddToolbar( PObjectInfo info, PObjectBase obj )
 void LuaCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxArrayString& codelines )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "Lua" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_LUA );
 
 	if ( !code_info )
 		return;
 
-	_template = code_info->GetTemplate( wxT( "toolbar_add" ) );
+	_template = code_info->GetTemplate( TEMPLATE_TOOLBAR_ADD );
 
 	if ( !_template.empty() )
 	{
@@ -100,9 +100,9 @@ private:
 	void SetupPredefinedMacros();
 
 	/**
-	* Given an object and the name for a template, obtains the code.
+	* Given an object and the slot of a template, obtains the code.
 	*/
-	wxString GetCode( PObjectBase obj, wxString name, bool silent = false, wxString strSelf = wxT(""));
+	wxString GetCode( PObjectBase obj, CodeTemplate slot, bool silent = false, wxString strSelf = wxT(""));
 
 	/**
 	* Stores the project's objects classes set, for generating the includes.
@@ -410,15 +410,15 @@ void PHPCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 	wxString type = userClasses->GetPropertyAsString( wxT("type") );
 
 	// Start file
-	wxString code = GetCode( userClasses, wxT("file_comment") );
+	wxString code = GetCode( userClasses, TEMPLATE_FILE_COMMENT );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("source_include") );
+	code = GetCode( userClasses, TEMPLATE_SOURCE_INCLUDE );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("class_decl") );
+	code = GetCode( userClasses, TEMPLATE_CLASS_DECL );
 	m_source->WriteLn( code );
 	m_source->Indent();
 
@@ -431,7 +431,7 @@ void PHPCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObjectB
 
 	if ( events.size() > 0 )
 	{
-		code = GetCode( userClasses, wxT("event_handler_comment") );
+		code = GetCode( userClasses, TEMPLATE_EVENT_HANDLER_COMMENT );
 		m_source->WriteLn( code );
 
 		std::set<wxString> generatedHandlers;
@@ -474,7 +474,7 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 
 	// Insert php preamble
 
-	wxString code = GetCode( project, wxT("php_preamble") );
+	wxString code = GetCode( project, TEMPLATE_PHP_PREAMBLE );
 	if ( !code.empty() )
 	{
 		m_source->WriteLn( code );
@@ -559,7 +559,7 @@ bool PHPCodeGenerator::GenerateCode( PObjectBase project )
 		GenClassDeclaration( child, false, wxT(""), events, eventHandlerPostfix );
 	}
 
-	code = GetCode( project, wxT("php_epilogue") );
+	code = GetCode( project, TEMPLATE_PHP_EPILOGUE );
 	if( !code.empty() ) m_source->WriteLn( code );
 
 	return true;
@@ -636,7 +636,7 @@ void PHPCodeGenerator::GenEvents( PObjectBase class_obj, const EventVector &even
 bool PHPCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName, bool disconnect )
 {
 	wxString _template;
-	PCodeInfo code_info = obj_info->GetCodeInfo( wxT("PHP") );
+	PCodeInfo code_info = obj_info->GetCodeInfo( LANGUAGE_PHP );
 	if ( code_info )
 	{
 		_template = code_info->GetTemplate( wxString::Format( wxT("evt_%s%s"), disconnect ? wxT("dis") : wxT(""), templateName.c_str() ) );
@@ -720,10 +720,10 @@ void PHPCodeGenerator::GetGenEventHandlers( PObjectBase obj )
 
 void PHPCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj )
 {
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "PHP" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PHP );
 	if ( code_info )
 	{
-		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
+		wxString _template = code_info->GetTemplate( TEMPLATE_GENERATED_EVENT_HANDLERS );
 		if ( !_template.empty() )
 		{
 			PHPTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
@@ -748,7 +748,7 @@ void PHPCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase ob
 wxString PHPCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PHP );
 
 	if (!code_info)
 	{
@@ -769,6 +769,19 @@ wxString PHPCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 	return code;
 }
 
+wxString PHPCodeGenerator::GetCode( PObjectBase obj, CodeTemplate slot, bool silent )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PHP );
+	if ( !code_info )
+	{
+		// Reports the missing template
+		return GetCode( obj, CodeInfo::GetTemplateName( slot ), silent );
+	}
+
+	PHPTemplateParser parser( obj, code_info->GetTemplate( slot ), m_i18n, m_useRelativePath, m_basePath );
+	return parser.ParseTemplate();
+}
+
 void PHPCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, const wxString& eventHandlerPostfix)
 {
 	PProperty propName = class_obj->GetProperty( wxT("name") );
@@ -791,7 +804,7 @@ void PHPCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum,
 	m_source->WriteLn( wxT(" */") );
 	m_source->WriteLn( );
 
-	m_source->WriteLn( wxT("class ") + classDecoration + class_name + wxT(" extends ") + GetCode( class_obj, wxT("base") ).Trim() + wxT(" {") );
+	m_source->WriteLn( wxT("class ") + classDecoration + class_name + wxT(" extends ") + GetCode( class_obj, TEMPLATE_BASE ).Trim() + wxT(" {") );
 	m_source->Indent();
 
 	// The constructor is also included within public
@@ -887,10 +900,10 @@ void PHPCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString>*
 void PHPCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
 {
 	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("PHP") );
+	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( LANGUAGE_PHP );
 	if (code_info)
 	{
-		PHPTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( project, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -925,10 +938,10 @@ void PHPCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, std::
 		GenBaseIncludes( base_info, obj, includes, templates );
 	}
 
-	PCodeInfo code_info = info->GetCodeInfo( wxT("PHP") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PHP );
 	if ( code_info )
 	{
-		PHPTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PHPTemplateParser parser( obj, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -987,13 +1000,13 @@ void PHPCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 {
 	m_source->WriteLn();
 	// generate function definition
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_def") ) );
+	m_source->WriteLn( GetCode( class_obj, TEMPLATE_CONS_DEF ) );
 	m_source->Indent();
 
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_call") ) );
+	m_source->WriteLn( GetCode( class_obj, TEMPLATE_CONS_CALL ) );
 	m_source->WriteLn();
 
-	wxString settings = GetCode( class_obj, wxT("settings") );
+	wxString settings = GetCode( class_obj, TEMPLATE_SETTINGS );
 	if ( !settings.IsEmpty() )
 	{
 		m_source->WriteLn( settings );
@@ -1004,7 +1017,7 @@ void PHPCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVector
 		GenConstruction( class_obj->GetChild( i ), true );
 	}
 
-	wxString afterAddChild = GetCode( class_obj, wxT("after_addchild") );
+	wxString afterAddChild = GetCode( class_obj, TEMPLATE_AFTER_ADDCHILD );
     if ( !afterAddChild.IsEmpty() )
     {
         m_source->WriteLn( afterAddChild );
@@ -1059,7 +1072,7 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 
 	if ( ObjectDatabase::HasCppProperties( type ) )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 
 		GenSettings( obj->GetObjectInfo(), obj );
 
@@ -1078,7 +1091,7 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 
 		if ( !isWidget ) // sizers
 		{
-			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1158,7 +1171,7 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
                 type == wxT("wizard")
 			)
 		{
-			wxString afterAddChild = GetCode( obj, wxT("after_addchild") );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1173,18 +1186,18 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 		GenConstruction( obj->GetChild(0), false );
 
 		PObjectInfo childInfo = obj->GetChild(0)->GetObjectInfo();
-		wxString temp_name;
+		CodeTemplate temp_name;
 		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
 		{
-			temp_name = wxT("window_add");
+			temp_name = TEMPLATE_WINDOW_ADD;
 		}
 		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
 		{
-			temp_name = wxT("sizer_add");
+			temp_name = TEMPLATE_SIZER_ADD;
 		}
 		else if ( childInfo->GetClassName() == wxT("spacer") )
 		{
-			temp_name = wxT("spacer_add");
+			temp_name = TEMPLATE_SPACER_ADD;
 		}
 		else
 		{
@@ -1202,12 +1215,12 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 			)
 	{
 		GenConstruction( obj->GetChild( 0 ), false );
-		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_PAGE_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("treelistctrlcolumn") )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_COLUMN_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("tool") )
@@ -1227,13 +1240,13 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 				if ( wxT("Load From Icon Resource") == source && wxDefaultSize == toolsize )
 				{
 					prop->SetValue( wxString::Format( wxT("%s; %s [%i; %i]"), path.c_str(), source.c_str(), toolbarsize.GetWidth(), toolbarsize.GetHeight() ) );
-					m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+					m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 					prop->SetValue( oldVal );
 					return;
 				}
 			}
 		}
-		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 	}
 	else
 	{
@@ -1248,11 +1261,11 @@ void PHPCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 void PHPCodeGenerator::GenDestruction( PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "PHP" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PHP );
 
 	if ( code_info )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		_template = code_info->GetTemplate( TEMPLATE_DESTRUCTION );
 
 		if ( !_template.empty() )
 		{
@@ -1354,14 +1367,14 @@ void PHPCodeGenerator::GenDefines( PObjectBase project)
 void PHPCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj)
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT("PHP") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PHP );
 
 	if ( !code_info )
 	{
 		return;
 	}
 
-	_template = code_info->GetTemplate( wxT("settings") );
+	_template = code_info->GetTemplate( TEMPLATE_SETTINGS );
 
 	if ( !_template.empty() )
 	{
@@ -1393,12 +1406,12 @@ void PHPCodeGenerator::GenAddToolbar( PObjectInfo info, PObjectBase obj )
 void PHPCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxArrayString& codelines )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "PHP" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PHP );
 
 	if ( !code_info )
 		return;
 
-	_template = code_info->GetTemplate( wxT( "toolbar_add" ) );
+	_template = code_info->GetTemplate( TEMPLATE_TOOLBAR_ADD );
 
 	if ( !_template.empty() )
 	{
@@ -424,15 +424,15 @@ void PythonCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObje
 	wxString type = userClasses->GetPropertyAsString( wxT("type") );
 
 	// Start file
-	wxString code = GetCode( userClasses, wxT("file_comment") );
+	wxString code = GetCode( userClasses, TEMPLATE_FILE_COMMENT );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("source_include") );
+	code = GetCode( userClasses, TEMPLATE_SOURCE_INCLUDE );
 	m_source->WriteLn( code );
 	m_source->WriteLn( wxEmptyString );
 
-	code = GetCode( userClasses, wxT("class_decl") );
+	code = GetCode( userClasses, TEMPLATE_CLASS_DECL );
 	m_source->WriteLn( code );
 	m_source->Indent();
 
@@ -445,7 +445,7 @@ void PythonCodeGenerator::GenerateInheritedClass( PObjectBase userClasses, PObje
 
 	if ( events.size() > 0 )
 	{
-		code = GetCode( userClasses, wxT("event_handler_comment") );
+		code = GetCode( userClasses, TEMPLATE_EVENT_HANDLER_COMMENT );
 		m_source->WriteLn( code );
 
 		std::set<wxString> generatedHandlers;
@@ -488,7 +488,7 @@ bool PythonCodeGenerator::GenerateCode( PObjectBase project )
 
 	// Insert python preamble
 
-	wxString code = GetCode( project, wxT("python_preamble") );
+	wxString code = GetCode( project, TEMPLATE_PYTHON_PREAMBLE );
 	if ( !code.empty() )
 	{
 		m_source->WriteLn( code );
@@ -573,7 +573,7 @@ bool PythonCodeGenerator::GenerateCode( PObjectBase project )
 		GenClassDeclaration( child, false, wxT(""), events, eventHandlerPostfix );
 	}
 
-	code = GetCode( project, wxT("python_epilogue") );
+	code = GetCode( project, TEMPLATE_PYTHON_EPILOGUE );
 	if( !code.empty() ) m_source->WriteLn( code );
 
 	return true;
@@ -650,7 +650,7 @@ void PythonCodeGenerator::GenEvents( PObjectBase class_obj, const EventVector &e
 bool PythonCodeGenerator::GenEventEntry( PObjectBase obj, PObjectInfo obj_info, const wxString& templateName, const wxString& handlerName, bool disconnect )
 {
 	wxString _template;
-	PCodeInfo code_info = obj_info->GetCodeInfo( wxT("Python") );
+	PCodeInfo code_info = obj_info->GetCodeInfo( LANGUAGE_PYTHON );
 	if ( code_info )
 	{
 		_template = code_info->GetTemplate( wxString::Format( wxT("evt_%s%s"), disconnect ? wxT("dis") : wxT(""), templateName.c_str() ) );
@@ -733,10 +733,10 @@ void PythonCodeGenerator::GetGenEventHandlers( PObjectBase obj )
 
 void PythonCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase obj )
 {
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "Python" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PYTHON );
 	if ( code_info )
 	{
-		wxString _template = code_info->GetTemplate( wxT("generated_event_handlers") );
+		wxString _template = code_info->GetTemplate( TEMPLATE_GENERATED_EVENT_HANDLERS );
 		if ( !_template.empty() )
 		{
 			PythonTemplateParser parser( obj, _template, m_i18n, m_useRelativePath, m_basePath );
@@ -761,7 +761,7 @@ void PythonCodeGenerator::GenDefinedEventHandlers( PObjectInfo info, PObjectBase
 wxString PythonCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silent)
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("Python") );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PYTHON );
 
 	if (!code_info)
 	{
@@ -782,6 +782,19 @@ wxString PythonCodeGenerator::GetCode(PObjectBase obj, wxString name, bool silen
 	return code;
 }
 
+wxString PythonCodeGenerator::GetCode( PObjectBase obj, CodeTemplate slot, bool silent )
+{
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PYTHON );
+	if ( !code_info )
+	{
+		// Reports the missing template
+		return GetCode( obj, CodeInfo::GetTemplateName( slot ), silent );
+	}
+
+	PythonTemplateParser parser( obj, code_info->GetTemplate( slot ), m_i18n, m_useRelativePath, m_basePath );
+	return parser.ParseTemplate();
+}
+
 void PythonCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_enum, const wxString& classDecoration, const EventVector &events, const wxString& eventHandlerPostfix)
 {
 	PProperty propName = class_obj->GetProperty( wxT("name") );
@@ -804,7 +817,7 @@ void PythonCodeGenerator::GenClassDeclaration(PObjectBase class_obj, bool use_en
 	m_source->WriteLn( wxT("###########################################################################") );
 	m_source->WriteLn( );
 
-	m_source->WriteLn( wxT("class ") + classDecoration + class_name + wxT(" ( ") + GetCode( class_obj, wxT("base") ).Trim() + wxT(" ):") );
+	m_source->WriteLn( wxT("class ") + classDecoration + class_name + wxT(" ( ") + GetCode( class_obj, TEMPLATE_BASE ).Trim() + wxT(" ):") );
 	m_source->Indent();
 
 	// The constructor is also included within public
@@ -899,10 +912,10 @@ void PythonCodeGenerator::GenIncludes( PObjectBase project, std::vector<wxString
 void PythonCodeGenerator::GenObjectIncludes( PObjectBase project, std::vector< wxString >* includes, std::set< wxString >* templates )
 {
 	// Fill the set
-	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( wxT("Python") );
+	PCodeInfo code_info = project->GetObjectInfo()->GetCodeInfo( LANGUAGE_PYTHON );
 	if (code_info)
 	{
-		PythonTemplateParser parser( project, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PythonTemplateParser parser( project, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -937,10 +950,10 @@ void PythonCodeGenerator::GenBaseIncludes( PObjectInfo info, PObjectBase obj, st
 		GenBaseIncludes( base_info, obj, includes, templates );
 	}
 
-	PCodeInfo code_info = info->GetCodeInfo( wxT("Python") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PYTHON );
 	if ( code_info )
 	{
-		PythonTemplateParser parser( obj, code_info->GetTemplate( wxT("include") ), m_i18n, m_useRelativePath, m_basePath );
+		PythonTemplateParser parser( obj, code_info->GetTemplate( TEMPLATE_INCLUDE ), m_i18n, m_useRelativePath, m_basePath );
 		wxString include = parser.ParseTemplate();
 		if ( !include.empty() )
 		{
@@ -999,13 +1012,13 @@ void PythonCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVect
 {
 	m_source->WriteLn();
 	// generate function definition
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_def") ) );
+	m_source->WriteLn( GetCode( class_obj, TEMPLATE_CONS_DEF ) );
 	m_source->Indent();
 
-	m_source->WriteLn( GetCode( class_obj, wxT("cons_call") ) );
+	m_source->WriteLn( GetCode( class_obj, TEMPLATE_CONS_CALL ) );
 	m_source->WriteLn();
 
-	wxString settings = GetCode( class_obj, wxT("settings") );
+	wxString settings = GetCode( class_obj, TEMPLATE_SETTINGS );
 	if ( !settings.IsEmpty() )
 	{
 		m_source->WriteLn( settings );
@@ -1016,7 +1029,7 @@ void PythonCodeGenerator::GenConstructor( PObjectBase class_obj, const EventVect
 		GenConstruction( class_obj->GetChild( i ), true );
 	}
 
-	wxString afterAddChild = GetCode( class_obj, wxT("after_addchild") );
+	wxString afterAddChild = GetCode( class_obj, TEMPLATE_AFTER_ADDCHILD );
     if ( !afterAddChild.IsEmpty() )
     {
         m_source->WriteLn( afterAddChild );
@@ -1068,7 +1081,7 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 
 	if ( ObjectDatabase::HasCppProperties( type ) )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 
 		GenSettings( obj->GetObjectInfo(), obj );
 
@@ -1087,7 +1100,7 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 
 		if ( !isWidget ) // sizers
 		{
-			wxString afterAddChild = GetCode( obj, wxT( "after_addchild" ) );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1167,7 +1180,7 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
                 type == wxT("wizard")
 			)
 		{
-			wxString afterAddChild = GetCode( obj, wxT("after_addchild") );
+			wxString afterAddChild = GetCode( obj, TEMPLATE_AFTER_ADDCHILD );
 			if ( !afterAddChild.empty() )
 			{
 				m_source->WriteLn( afterAddChild );
@@ -1182,18 +1195,18 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 		GenConstruction( obj->GetChild(0), false );
 
 		PObjectInfo childInfo = obj->GetChild(0)->GetObjectInfo();
-		wxString temp_name;
+		CodeTemplate temp_name;
 		if ( childInfo->IsSubclassOf( wxT("wxWindow") ) || wxT("CustomControl") == childInfo->GetClassName() )
 		{
-			temp_name = wxT("window_add");
+			temp_name = TEMPLATE_WINDOW_ADD;
 		}
 		else if ( childInfo->IsSubclassOf( wxT("sizer") ) )
 		{
-			temp_name = wxT("sizer_add");
+			temp_name = TEMPLATE_SIZER_ADD;
 		}
 		else if ( childInfo->GetClassName() == wxT("spacer") )
 		{
-			temp_name = wxT("spacer_add");
+			temp_name = TEMPLATE_SPACER_ADD;
 		}
 		else
 		{
@@ -1211,12 +1224,12 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 			)
 	{
 		GenConstruction( obj->GetChild( 0 ), false );
-		m_source->WriteLn( GetCode( obj, wxT("page_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_PAGE_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("treelistctrlcolumn") )
 	{
-		m_source->WriteLn( GetCode( obj, wxT("column_add") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_COLUMN_ADD ) );
 		GenSettings( obj->GetObjectInfo(), obj );
 	}
 	else if ( type == wxT("tool") )
@@ -1236,13 +1249,13 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 				if ( _("Load From Icon Resource") == source && wxDefaultSize == toolsize )
 				{
 					prop->SetValue( wxString::Format( wxT("%s; %s [%i; %i]"), path.c_str(), source.c_str(), toolbarsize.GetWidth(), toolbarsize.GetHeight() ) );
-					m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+					m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 					prop->SetValue( oldVal );
 					return;
 				}
 			}
 		}
-		m_source->WriteLn( GetCode( obj, wxT("construction") ) );
+		m_source->WriteLn( GetCode( obj, TEMPLATE_CONSTRUCTION ) );
 	}
 	else
 	{
@@ -1257,11 +1270,11 @@ void PythonCodeGenerator::GenConstruction(PObjectBase obj, bool is_widget )
 void PythonCodeGenerator::GenDestruction( PObjectBase obj )
 {
 	wxString _template;
-	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT( "Python" ) );
+	PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_PYTHON );
 
 	if ( code_info )
 	{
-		_template = code_info->GetTemplate( wxT( "destruction" ) );
+		_template = code_info->GetTemplate( TEMPLATE_DESTRUCTION );
 
 		if ( !_template.empty() )
 		{
@@ -1366,14 +1379,14 @@ void PythonCodeGenerator::GenDefines( PObjectBase project)
 void PythonCodeGenerator::GenSettings(PObjectInfo info, PObjectBase obj)
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT("Python") );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PYTHON );
 
 	if ( !code_info )
 	{
 		return;
 	}
 
-	_template = code_info->GetTemplate( wxT("settings") );
+	_template = code_info->GetTemplate( TEMPLATE_SETTINGS );
 
 	if ( !_template.empty() )
 	{
@@ -1405,12 +1418,12 @@ void PythonCodeGenerator::GenAddToolbar( PObjectInfo info, PObjectBase obj )
 void PythonCodeGenerator::GetAddToolbarCode( PObjectInfo info, PObjectBase obj, wxArrayString& codelines )
 {
 	wxString _template;
-	PCodeInfo code_info = info->GetCodeInfo( wxT( "Python" ) );
+	PCodeInfo code_info = info->GetCodeInfo( LANGUAGE_PYTHON );
 
 	if ( !code_info )
 		return;
 
-	_template = code_info->GetTemplate( wxT( "toolbar_add" ) );
+	_template = code_info->GetTemplate( TEMPLATE_TOOLBAR_ADD );
 
 	if ( !_template.empty() )
 	{
@@ -96,6 +96,7 @@ private:
 	* Given an object and the name for a template, obtains the code.
 	*/
 	wxString GetCode( PObjectBase obj, wxString name, bool silent = false);
+	wxString GetCode( PObjectBase obj, CodeTemplate slot, bool silent = false );
 
 	/**
 	* Stores the project's objects classes set, for generating the includes.
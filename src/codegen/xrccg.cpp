@@ -41,6 +41,7 @@ bool XrcCodeGenerator::GenerateCode( PObjectBase project )
 {
 	m_cw->Clear();
 	m_contextMenus.clear();
+	ExportBatches( project );
 
 	ticpp::Document doc;
 	ticpp::Declaration decl( "1.0", "UTF-8", "yes" );
@@ -80,6 +81,9 @@ bool XrcCodeGenerator::GenerateCode( PObjectBase project )
 		delete *it;
 	}
 
+	// The objects skipped by GetElement, such as the sizers under a wxFrame
+	ClearExported();
+
 	doc.LinkEndChild( &element );
 
     TiXmlPrinter printer;
@@ -110,7 +114,18 @@ ticpp::Element* XrcCodeGenerator::GetElement( PObjectBase obj, ticpp::Element* p
 	IComponent *comp = obj->GetObjectInfo()->GetComponent();
 
 	if ( comp )
-		element = comp->ExportToXrc( obj.get() );
+	{
+		ElementMap::iterator exported = m_exported.find( obj.get() );
+		if ( exported != m_exported.end() )
+		{
+			element = exported->second;
+			m_exported.erase( exported );
+		}
+		else
+		{
+			element = comp->ExportToXrc( obj.get() );
+		}
+	}
 
 	if ( element )
 	{
@@ -224,4 +239,56 @@ ticpp::Element* XrcCodeGenerator::GetElement( PObjectBase obj, ticpp::Element* p
 	return element;
 }
 
+void XrcCodeGenerator::CollectBatches( PObjectBase obj, BatchComponentMap* components, BatchMap* batches )
+{
+	IComponent* comp = obj->GetObjectInfo()->GetComponent();
+	if ( comp )
+	{
+		// The cast is only done once for each component
+		BatchComponentMap::iterator found = components->find( comp );
+		if ( found == components->end() )
+		{
+			found = components->insert( BatchComponentMap::value_type( comp, dynamic_cast< IXrcBatchComponent* >( comp ) ) ).first;
+		}
+
+		if ( found->second )
+		{
+			( *batches )[ found->second ].push_back( obj.get() );
+		}
+	}
+
+	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
+	{
+		CollectBatches( obj->GetChild( i ), components, batches );
+	}
+}
+
+void XrcCodeGenerator::ExportBatches( PObjectBase root )
+{
+	BatchComponentMap components;
+	BatchMap batches;
+	CollectBatches( root, &components, &batches );
+
+	for ( BatchMap::iterator batch = batches.begin(); batch != batches.end(); ++batch )
+	{
+		std::vector< IObject* >& objects = batch->second;
+		std::vector< ticpp::Element* > elements( objects.size(), static_cast< ticpp::Element* >( NULL ) );
+		batch->first->ExportBatchToXrc( &objects[0], objects.size(), &elements[0] );
+
+		for ( size_t i = 0; i < objects.size(); i++ )
+		{
+			m_exported[ objects[i] ] = elements[i];
+		}
+	}
+}
+
+void XrcCodeGenerator::ClearExported()
+{
+	for ( ElementMap::iterator it = m_exported.begin(); it != m_exported.end(); ++it )
+	{
+		delete it->second;
+	}
+	m_exported.clear();
+}
+
 
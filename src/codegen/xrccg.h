@@ -29,12 +29,17 @@
 #include "codegen.h"
 #include "utils/wxfbdefs.h"
 #include <vector>
+#include <map>
 
 namespace ticpp
 {
 	class Element;
 }
 
+class IObject;
+class IComponent;
+class IXrcBatchComponent;
+
 /// XRC code generator.
 
 class XrcCodeGenerator : public CodeGenerator
@@ -43,8 +48,23 @@ private:
 	PCodeWriter m_cw;
 	std::vector<ticpp::Element*> m_contextMenus;
 
+	// Elements of the objects exported by the batch components, taken by GetElement
+	typedef std::map< IObject*, ticpp::Element* > ElementMap;
+	ElementMap m_exported;
+
+	typedef std::map< IComponent*, IXrcBatchComponent* > BatchComponentMap;
+	typedef std::map< IXrcBatchComponent*, std::vector< IObject* > > BatchMap;
+
 	ticpp::Element* GetElement( PObjectBase obj, ticpp::Element* parent = NULL );
 
+	void CollectBatches( PObjectBase obj, BatchComponentMap* components, BatchMap* batches );
+
+	/// Exports the objects of each component implementing IXrcBatchComponent in a single call.
+	void ExportBatches( PObjectBase root );
+
+	/// Deletes the elements exported in batches but not used.
+	void ClearExported();
+
 public:
 	/// Configures the code writer for the XML file.
 	void SetWriter( PCodeWriter cw );
@@ -25,6 +25,7 @@
 #include "splashscreen.h"
 #include "rad/mainframe.h"
 #include "rad/appdata.h"
+#include "rad/bitmaps.h"
 #include <wx/filename.h>
 #include <wx/image.h>
 #include <wx/sysopt.h>
@@ -38,6 +39,7 @@
 #include <wx/wxFlatNotebook/wxFlatNotebook.h>
 #endif
 #include "utils/wxfbexception.h"
+#include "utils/startupprofile.h"
 #include <memory>
 #include "maingui.h"
 
@@ -78,11 +80,21 @@ static const wxCmdLineEntryDesc s_cmdLineDesc[] =
 #if wxVERSION_NUMBER < 2900
 	{ wxCMD_LINE_SWITCH, wxT("g"), wxT("generate"),	wxT("Generate code from passed file.") },
 	{ wxCMD_LINE_OPTION, wxT("l"), wxT("language"),	wxT("Override the code_generation property from the passed file and generate the passed languages. Separate multiple languages with commas.") },
+	{ wxCMD_LINE_SWITCH, wxT("u"), wxT("upgrade"),	wxT("Convert the passed project file, or all the project files in the passed directory, to the current version.") },
+	{ wxCMD_LINE_SWITCH, wxT("x"), wxT("import-xrc"),	wxT("Import the passed XRC file, or all the XRC files in the passed directory, each one into a project file next to it.") },
+	{ wxCMD_LINE_OPTION, wxT("r"), wxT("report"),	wxT("File where --import-xrc writes a JSON summary of what could not be imported.") },
+	{ wxCMD_LINE_OPTION, wxT("j"), wxT("jobs"),		wxT("Number of files to process at the same time with --upgrade or --import-xrc, one per CPU by default."), wxCMD_LINE_VAL_NUMBER },
+	{ wxCMD_LINE_OPTION, NULL, wxT("startup-profile"),	wxT("File where the time taken by each phase of the startup is written as JSON.") },
 	{ wxCMD_LINE_SWITCH, wxT("h"), wxT("help"),		wxT("Show this help message."), wxCMD_LINE_VAL_STRING, wxCMD_LINE_OPTION_HELP  },
 	{ wxCMD_LINE_PARAM, NULL, NULL,	wxT("File to open."), wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
 #else
     { wxCMD_LINE_SWITCH, "g", "generate", "Generate code from passed file." },
     { wxCMD_LINE_OPTION, "l", "language", "Override the code_generation property from the passed file and generate the passed languages. Separate multiple languages with commas." },
+    { wxCMD_LINE_SWITCH, "u", "upgrade",  "Convert the passed project file, or all the project files in the passed directory, to the current version." },
+    { wxCMD_LINE_SWITCH, "x", "import-xrc", "Import the passed XRC file, or all the XRC files in the passed directory, each one into a project file next to it." },
+    { wxCMD_LINE_OPTION, "r", "report",   "File where --import-xrc writes a JSON summary of what could not be imported." },
+    { wxCMD_LINE_OPTION, "j", "jobs",     "Number of files to process at the same time with --upgrade or --import-xrc, one per CPU by default.", wxCMD_LINE_VAL_NUMBER },
+    { wxCMD_LINE_OPTION, NULL, "startup-profile", "File where the time taken by each phase of the startup is written as JSON." },
     { wxCMD_LINE_SWITCH, "h", "help",     "Show this help message.", wxCMD_LINE_VAL_STRING, wxCMD_LINE_OPTION_HELP  },
     { wxCMD_LINE_PARAM, NULL, NULL,	      "File to open.", wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
 #endif
@@ -130,6 +142,13 @@ int MyApp::OnRun()
 		return 1;
 	}
 
+	// Written when the main loop starts, or on exit without the GUI
+	wxString profilePath;
+	if ( parser.Found( wxT("startup-profile"), &profilePath ) )
+	{
+		StartupProfile::Enable( profilePath );
+	}
+
 	// Get project to load
 	wxString projectToLoad = wxEmptyString;
 	if ( parser.GetParamCount() > 0 )
@@ -138,6 +157,10 @@ int MyApp::OnRun()
 	}
 
 	bool justGenerate = false;
+	bool justUpgrade = false;
+	bool justImport = false;
+	unsigned int jobCount = 0;
+	wxString importReport;
 	wxString language;
 	bool hasLanguage = parser.Found( wxT("l"), &language );
 	if ( parser.Found( wxT("g") ) )
@@ -161,6 +184,51 @@ int MyApp::OnRun()
 		// generate code
 		justGenerate = true;
 	}
+	else if ( parser.Found( wxT("u") ) )
+	{
+		if ( projectToLoad.empty() )
+		{
+			wxLogError( _("You must pass a project file or a directory. Nothing to upgrade.") );
+			return 2;
+		}
+
+		long jobs;
+		if ( parser.Found( wxT("j"), &jobs ) )
+		{
+			if ( jobs < 1 )
+			{
+				wxLogError( _("The number of jobs must be at least 1. Nothing upgraded.") );
+				return 3;
+			}
+			jobCount = (unsigned int)jobs;
+		}
+
+		// convert files
+		justUpgrade = true;
+	}
+	else if ( parser.Found( wxT("x") ) )
+	{
+		if ( projectToLoad.empty() )
+		{
+			wxLogError( _("You must pass an XRC file or a directory. Nothing to import.") );
+			return 2;
+		}
+
+		long jobs;
+		if ( parser.Found( wxT("j"), &jobs ) )
+		{
+			if ( jobs < 1 )
+			{
+				wxLogError( _("The number of jobs must be at least 1. Nothing imported.") );
+				return 3;
+			}
+			jobCount = (unsigned int)jobs;
+		}
+		parser.Found( wxT("r"), &importReport );
+
+		// import files
+		justImport = true;
+	}
 	else
 	{
 		delete wxLog::SetActiveTarget( new wxLogGui );
@@ -196,8 +264,14 @@ int MyApp::OnRun()
 		wxLogError( ex.what() );
 	}
 
+	// Converting files does not need the plugins, nor the GUI
+	if ( justUpgrade )
+	{
+		return ( AppData()->UpgradeProjects( projectToLoad, jobCount ) ? 0 : 7 );
+	}
+
 	// If the project is already loaded in another instance, switch to that instance and quit
-	if ( !projectToLoad.empty() && !justGenerate )
+	if ( !projectToLoad.empty() && !justGenerate && !justImport )
 	{
 		if ( ::wxFileExists( projectToLoad ) )
 		{
@@ -209,15 +283,19 @@ int MyApp::OnRun()
 	}
 
 	// Init handlers
-	wxInitAllImageHandlers();
-	wxXmlResource::Get()->InitAllHandlers();
-	#if wxVERSION_NUMBER >= 2905
-	wxXmlResource::Get()->AddHandler(new wxAuiNotebookXmlHandler);
-	#endif
+	{
+		StartupProfile::Timer timer( "InitHandlers" );
+		wxInitAllImageHandlers();
+		wxXmlResource::Get()->InitAllHandlers();
+		#if wxVERSION_NUMBER >= 2905
+		wxXmlResource::Get()->AddHandler(new wxAuiNotebookXmlHandler);
+		#endif
+	}
 
 	// Init AppData
 	try
 	{
+		StartupProfile::Timer timer( "AppDataInit" );
 		AppDataInit();
 	}
 	catch( wxFBException& ex )
@@ -227,6 +305,12 @@ int MyApp::OnRun()
 		return 5;
 	}
 
+	// Importing files needs the plugins, but not the GUI
+	if ( justImport )
+	{
+		return ( AppData()->ImportXrcFiles( projectToLoad, jobCount, importReport ) ? 0 : 8 );
+	}
+
 	wxSystemOptions::SetOption( wxT( "msw.remap" ), 0 );
 	wxSystemOptions::SetOption( wxT( "msw.staticbox.optimized-paint" ), 0 );
 
@@ -264,9 +348,13 @@ int MyApp::OnRun()
 
 	config->SetPath( wxT("/") );
 
-	m_frame = new MainFrame( NULL ,-1, (int)style, wxPoint( x, y ), wxSize( w, h ) );
+	{
+		StartupProfile::Timer timer( "MainFrame::MainFrame" );
+		m_frame = new MainFrame( NULL ,-1, (int)style, wxPoint( x, y ), wxSize( w, h ) );
+	}
 	if ( !justGenerate )
 	{
+		StartupProfile::Timer timer( "MainFrame::Show" );
 		m_frame->Show( TRUE );
 		SetTopWindow( m_frame );
 
@@ -307,12 +395,16 @@ int MyApp::OnRun()
 						codeGen->SetValue( language );
 					}
 				}
-				AppData()->GenerateCode( false );
+				{
+					StartupProfile::Timer timer( "ApplicationData::GenerateCode" );
+					AppData()->GenerateCode( false );
+				}
 				return 0;
 			}
 			else
 			{
 				m_frame->InsertRecentProject( projectToLoad );
+				StartupProfile::Finish();
 				return wxApp::OnRun();
 			}
 		}
@@ -327,7 +419,10 @@ int MyApp::OnRun()
 		return 6;
 	}
 
-	AppData()->NewProject();
+	{
+		StartupProfile::Timer timer( "ApplicationData::NewProject" );
+		AppData()->NewProject();
+	}
 
 #ifdef __WXMAC__
     // document to open on startup
@@ -338,6 +433,7 @@ int MyApp::OnRun()
     }
 #endif
 
+	StartupProfile::Finish();
 	return wxApp::OnRun();
 }
 
@@ -349,7 +445,11 @@ bool MyApp::OnInit()
 
 int MyApp::OnExit()
 {
+	// Without the GUI, the startup lasts until the command line work is done
+	StartupProfile::Finish();
+
 	MacroDictionary::Destroy();
+	AppBitmaps::Destroy();
 #ifdef USE_FLATNOTEBOOK
 	wxFlatNotebook::CleanUp();
 #endif
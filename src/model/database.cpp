@@ -25,11 +25,13 @@
 
 #include "objectbase.h"
 #include "database.h"
+#include "databasecache.h"
 #include "rad/bitmaps.h"
 #include "utils/stringutils.h"
 #include "utils/typeconv.h"
 #include "utils/debug.h"
 #include "utils/wxfbexception.h"
+#include "utils/startupprofile.h"
 #include "rad/appdata.h"
 #include <wx/filename.h>
 #include <wx/image.h>
@@ -39,6 +41,8 @@
 #include <wx/tokenzr.h>
 #include <wx/stdpaths.h>
 #include <wx/app.h>
+#include <wx/thread.h>
+#include <algorithm>
 
 //#define DEBUG_PRINT(x) cout << x
 
@@ -62,17 +66,50 @@
 #define SMALL_ICON_TAG "smallIcon"
 #define EXPANDED_TAG "expanded"
 #define WXVERSION_TAG "wxversion"
+#define DEFAULTS_TAG "Defaults"
+#define DEFAULTS_VERSION_TAG "defaults_version"
+#define DEFAULT_CHANGE_TAG "default_change"
+#define VERSION_TAG "version"
+#define MACRO_TAG "macro"
 
 
 #ifdef __WXMAC__
 #include <dlfcn.h>
 #endif
 
+/**
+Loads the component libraries of the plugins when a class or a macro needs them.
+*/
+class PluginLibraryLoader : public ComponentLoader, public MacroDictionary::Loader
+{
+private:
+	ObjectDatabase* m_objDb;
+
+public:
+	PluginLibraryLoader( ObjectDatabase* objDb )
+	:
+	m_objDb( objDb )
+	{
+	}
+
+	void LoadComponent( ObjectInfo* info )
+	{
+		m_objDb->LoadComponent( info );
+	}
+
+	bool LoadMacro( const wxString& name )
+	{
+		std::map< wxString, size_t >::iterator library = m_objDb->m_macroLibraries.find( name );
+		return ( library != m_objDb->m_macroLibraries.end() && m_objDb->LoadPluginLibrary( library->second ) );
+	}
+};
+
 ObjectPackage::ObjectPackage(wxString name, wxString desc, wxBitmap icon)
 {
 	m_name = name;
 	m_desc = desc;
 	m_icon = icon;
+	m_defaultsVersion = 0;
 }
 
 PObjectInfo ObjectPackage::GetObjectInfo(unsigned int idx)
@@ -84,11 +121,40 @@ PObjectInfo ObjectPackage::GetObjectInfo(unsigned int idx)
 void ObjectPackage::AppendPackage( PObjectPackage package )
 {
 	m_objs.insert( m_objs.end(), package->m_objs.begin(), package->m_objs.end() );
+	m_defaultChanges.insert( package->m_defaultChanges.begin(), package->m_defaultChanges.end() );
+	m_defaultsVersion = std::max( m_defaultsVersion, package->m_defaultsVersion );
+}
+
+void ObjectPackage::AddDefaultChange( int version, const wxString& className, const wxString& property, const wxString& previous )
+{
+	DefaultChange change;
+	change.className = className;
+	change.property = property;
+	change.previous = previous;
+	m_defaultChanges.insert( std::multimap< int, DefaultChange >::value_type( version, change ) );
+}
+
+void ObjectPackage::GetPreviousDefaults( PObjectInfo info, int version, std::map< wxString, wxString >* values )
+{
+	// From the newest change, so the oldest change after the version wins
+	std::multimap< int, DefaultChange >::reverse_iterator change;
+	for ( change = m_defaultChanges.rbegin(); change != m_defaultChanges.rend() && change->first > version; ++change )
+	{
+		if ( info->IsSubclassOf( change->second.className ) )
+		{
+			( *values )[ change->second.property ] = change->second.previous;
+		}
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 ObjectDatabase::ObjectDatabase()
+:
+m_signature( 0 ),
+m_loadErrors( false ),
+m_droppedCount( 0 ),
+m_countObjects( true )
 {
 	//InitObjectTypes();
 	//  InitWidgetTypes();
@@ -97,6 +163,8 @@ ObjectDatabase::ObjectDatabase()
 
 ObjectDatabase::~ObjectDatabase()
 {
+	MacroDictionary::RemoveLoader( m_libraryLoader.get() );
+
     for ( ComponentLibraryMap::iterator lib = m_componentLibs.begin(); lib != m_componentLibs.end(); ++lib )
     {
         (*(lib->first))( lib->second );
@@ -204,10 +272,26 @@ PObjectBase ObjectDatabase::NewObject(PObjectInfo obj_info)
 			obj_info->GetBaseClass(base++) : PObjectInfo());
 	}
 
+	// Sparse project files only have the values which differ from these. The defaults of
+	// sizer items depend on their child, see SetDefaultLayoutProperties, so they are always written
+	if ( obj_info->GetUtf8DefaultValues().empty() && !obj_info->IsSubclassOf( wxT("sizeritembase") ) )
+	{
+		std::vector< std::string > defaults;
+		PropertyMap& properties = object->GetProperties();
+		for ( PropertyMap::iterator it = properties.begin(); it != properties.end(); ++it )
+		{
+			defaults.push_back( it->second->GetUtf8Value() );
+		}
+		obj_info->SetUtf8DefaultValues( defaults );
+	}
+
 	// si el objeto tiene la propiedad name (reservada para el nombre del
 	// objeto) le añadimos el contador para no repetir nombres.
 
-	obj_info->IncrementInstanceCount();
+	if ( m_countObjects )
+	{
+		obj_info->IncrementInstanceCount();
+	}
 
 	unsigned int ins = obj_info->GetInstanceCount();
 	PProperty pname = object->GetProperty( wxT(NAME_TAG) );
@@ -385,33 +469,31 @@ PObjectBase ObjectDatabase::CopyObject(PObjectBase obj)
 	PObjectBase copyObj = NewObject(objInfo); // creamos la copia
 	assert(copyObj);
 
-	// copiamos las propiedades
-	unsigned int i;
-	unsigned int count = obj->GetPropertyCount();
-	for (i = 0; i < count; i++)
-	{
-		PProperty objProp = obj->GetProperty(i);
-		assert(objProp);
-
-		PProperty copyProp = copyObj->GetProperty(objProp->GetName());
-		assert(copyProp);
+	// copiamos las propiedades, both objects have the same maps, walked together
+	PropertyMap& objProps = obj->GetProperties();
+	PropertyMap& copyProps = copyObj->GetProperties();
+	assert( objProps.size() == copyProps.size() );
 
-		wxString propValue = objProp->GetValue();
-		copyProp->SetValue(propValue);
+	PropertyMap::iterator copyProp = copyProps.begin();
+	for ( PropertyMap::iterator objProp = objProps.begin(); objProp != objProps.end(); ++objProp, ++copyProp )
+	{
+		copyProp->second->CopyValue( *objProp->second );
 	}
 
 	// ...and the event handlers
-	count = obj->GetEventCount();
-	for (i = 0; i < count; i++)
+	EventMap& objEvents = obj->GetEvents();
+	EventMap& copyEvents = copyObj->GetEvents();
+	assert( objEvents.size() == copyEvents.size() );
+
+	EventMap::iterator copyEvent = copyEvents.begin();
+	for ( EventMap::iterator objEvent = objEvents.begin(); objEvent != objEvents.end(); ++objEvent, ++copyEvent )
 	{
-	  PEvent event = obj->GetEvent(i);
-	  PEvent copyEvent = copyObj->GetEvent(event->GetName());
-	  copyEvent->SetValue(event->GetValue());
+		copyEvent->second->SetValue( objEvent->second->GetValue() );
 	}
 
 	// creamos recursivamente los hijos
-	count = obj->GetChildCount();
-	for (i = 0; i<count; i++)
+	unsigned int count = obj->GetChildCount();
+	for (unsigned int i = 0; i<count; i++)
 	{
 		PObjectBase childCopy = CopyObject(obj->GetChild(i));
 		copyObj->AddChild(childCopy);
@@ -477,6 +559,11 @@ void ObjectDatabase::SetDefaultLayoutProperties(PObjectBase sizeritem)
 	}
 }
 
+void ObjectDatabase::CountObject( PObjectInfo info )
+{
+	info->IncrementInstanceCount();
+}
+
 void ObjectDatabase::ResetObjectCounters()
 {
 	ObjectInfoMap::iterator it;
@@ -486,9 +573,107 @@ void ObjectDatabase::ResetObjectCounters()
 	}
 }
 
+wxUint64 ObjectDatabase::GetSignature()
+{
+	// The plugins are not reloaded, so it only needs to be computed once
+	if ( m_signature != 0 )
+	{
+		return m_signature;
+	}
+
+	wxUint64 hash = StringUtils::Hash( NULL, 0 );
+	ObjectInfoMap::iterator it;
+	for ( it = m_objs.begin(); it != m_objs.end(); ++it )
+	{
+		PObjectInfo info = it->second;
+
+		const std::string* name = &info->GetUtf8ClassName();
+		hash = StringUtils::Hash( name->c_str(), name->length() + 1, hash );
+
+		unsigned int i;
+		for ( i = 0; i < info->GetPropertyCount(); i++ )
+		{
+			name = &info->GetPropertyInfo( i )->GetUtf8Name();
+			hash = StringUtils::Hash( name->c_str(), name->length() + 1, hash );
+		}
+
+		for ( i = 0; i < info->GetEventCount(); i++ )
+		{
+			name = &info->GetEventInfo( i )->GetUtf8Name();
+			hash = StringUtils::Hash( name->c_str(), name->length() + 1, hash );
+		}
+
+		for ( i = 0; i < info->GetBaseClassCount( false ); i++ )
+		{
+			name = &info->GetBaseClass( i, false )->GetUtf8ClassName();
+			hash = StringUtils::Hash( name->c_str(), name->length() + 1, hash );
+		}
+	}
+
+	m_signature = hash;
+	return m_signature;
+}
+
+ObjectDatabase::DefaultsVersionMap ObjectDatabase::GetDefaultsVersions()
+{
+	DefaultsVersionMap versions;
+	VersionedPackageMap::iterator package;
+	for ( package = m_versionedPackages.begin(); package != m_versionedPackages.end(); ++package )
+	{
+		versions[ package->first ] = package->second->GetDefaultsVersion();
+	}
+	return versions;
+}
+
+bool ObjectDatabase::ReadDefaultsVersions( ticpp::Element* root, DefaultsVersionMap* versions )
+{
+	ticpp::Element* defaults = root->FirstChildElement( DEFAULTS_TAG, false );
+	if ( !defaults )
+	{
+		return false;
+	}
+
+	ticpp::Element* package = defaults->FirstChildElement( PACKAGE_TAG, false );
+	while ( package )
+	{
+		std::string name;
+		int version;
+		package->GetAttribute( NAME_TAG, &name );
+		package->GetAttribute( VERSION_TAG, &version );
+		( *versions )[ name ] = version;
+
+		package = package->NextSiblingElement( PACKAGE_TAG, false );
+	}
+	return true;
+}
+
+void ObjectDatabase::RestoreDefaults( PObjectBase object, const DefaultsVersionMap& versions )
+{
+	std::map< wxString, wxString > values;
+	PObjectInfo info = object->GetObjectInfo();
+
+	VersionedPackageMap::iterator package;
+	for ( package = m_versionedPackages.begin(); package != m_versionedPackages.end(); ++package )
+	{
+		// Files without the package were written before its defaults had a version
+		DefaultsVersionMap::const_iterator version = versions.find( package->first );
+		package->second->GetPreviousDefaults( info, version != versions.end() ? version->second : 0, &values );
+	}
+
+	std::map< wxString, wxString >::iterator value;
+	for ( value = values.begin(); value != values.end(); ++value )
+	{
+		PProperty prop = object->GetProperty( value->first );
+		if ( prop )
+		{
+			prop->SetValue( value->second );
+		}
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////
 
-PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase parent )
+PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase parent, const DefaultsVersionMap* defaults )
 {
 	try
 	{
@@ -512,6 +697,11 @@ PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase p
 			xml_obj->GetAttributeOrDefault( EXPANDED_TAG, &expanded, true );
 			object->SetExpanded( expanded );
 
+			if ( defaults )
+			{
+				RestoreDefaults( object, *defaults );
+			}
+
 			// Load the properties
 			ticpp::Element* xml_prop = xml_obj->FirstChildElement( PROPERTY_TAG, false );
 			while ( xml_prop )
@@ -523,13 +713,14 @@ PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase p
 				if ( prop ) // does the property exist
 				{
 					// load the value
-					prop->SetValue( _WXSTR( xml_prop->GetText( false ) ) );
+					prop->SetUtf8Value( xml_prop->GetText( false ) );
 				}
 				else
 				{
 					std::string value = xml_prop->GetText( false );
 					if ( !value.empty() )
 					{
+						CountDropped();
 						wxLogError( wxT("The property named \"%s\" of class \"%s\" is not supported by this version of wxFormBuilder.\n")
 									wxT("If your project file was just converted from an older version, then the conversion was not complete.\n")
 									wxT("Otherwise, this project is from a newer version of wxFormBuilder.\n\n")
@@ -568,15 +759,21 @@ PObjectBase ObjectDatabase::CreateObject( ticpp::Element* xml_obj, PObjectBase p
 			ticpp::Element* child = xml_obj->FirstChildElement( OBJECT_TAG, false );
 			while ( child )
 			{
-				CreateObject( child, object );
+				CreateObject( child, object, defaults );
 				child = child->NextSiblingElement( OBJECT_TAG, false );
 			}
 		}
+		else
+		{
+			// The whole subtree is ignored
+			CountDropped();
+		}
 
 		return newobject;
 	}
 	catch( ticpp::Exception& )
 	{
+		CountDropped();
 		return PObjectBase();
 	}
 }
@@ -588,133 +785,319 @@ bool IncludeInPalette(wxString type)
 	return true;
 }
 
-void ObjectDatabase::LoadPlugins( PwxFBManager manager )
+/**
+Parses the files of the plugins in several threads, see ObjectDatabase::LoadPlugins.
+*/
+class PluginParseQueue
 {
-	// Load some default templates
-	LoadCodeGen( m_xmlPath + wxT("properties.cppcode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.pythoncode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.luacode") );
-	LoadCodeGen( m_xmlPath + wxT("properties.phpcode") );
-	LoadPackage( m_xmlPath + wxT("default.xml"), m_iconPath );
-	LoadCodeGen( m_xmlPath + wxT("default.cppcode") );
-	LoadCodeGen( m_xmlPath + wxT("default.pythoncode") );
-	LoadCodeGen( m_xmlPath + wxT("default.luacode") );
-	LoadCodeGen( m_xmlPath + wxT("default.phpcode") );
+private:
+	wxMutex m_mutex;
+	const std::vector< wxString >& m_files;
+	std::vector< boost::shared_ptr< ticpp::Document > >* m_documents;
+	size_t m_next;
 
-	// Map to temporarily hold plugins.
-	// Used to both set page order and to prevent two plugins with the same name.
-	typedef std::map< wxString, PObjectPackage > PackageMap;
-	PackageMap packages;
+	bool Next( size_t* index )
+	{
+		wxMutexLocker lock( m_mutex );
+		if ( m_next >= m_files.size() )
+		{
+			return false;
+		}
+		*index = m_next++;
+		return true;
+	}
 
-	// Open plugins directory for iteration
-	if ( !wxDir::Exists( m_pluginPath ) )
+public:
+	PluginParseQueue( const std::vector< wxString >& files, std::vector< boost::shared_ptr< ticpp::Document > >* documents )
+	:
+	m_files( files ),
+	m_documents( documents ),
+	m_next( 0 )
 	{
-		return;
 	}
 
-	wxDir pluginsDir( m_pluginPath );
-	if ( !pluginsDir.IsOpened() )
+	/**
+	Parses files until there are no more left, can be called from several threads.
+	*/
+	void Run()
 	{
-		return;
+		size_t index;
+		while ( Next( &index ) )
+		{
+			// The files which can not be parsed without asking are left to the main thread
+			boost::shared_ptr< ticpp::Document > doc( new ticpp::Document );
+			if ( XMLUtils::TryLoadXMLFile( *doc, m_files[index] ) )
+			{
+				( *m_documents )[index] = doc;
+			}
+		}
 	}
+};
 
-	// Iterate through plugin directories and load the package from the xml subdirectory
-	wxString pluginDirName;
-	bool moreDirectories = pluginsDir.GetFirst( &pluginDirName, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN );
-    while ( moreDirectories )
-    {
-    	// Iterate through .xml files in the xml directory
-    	wxString nextPluginPath = m_pluginPath + pluginDirName;
-    	wxString nextPluginXmlPath = nextPluginPath + wxFILE_SEP_PATH + wxT("xml");
-    	wxString nextPluginIconPath = nextPluginPath + wxFILE_SEP_PATH + wxT("icons");
-    	if ( wxDir::Exists( nextPluginPath ) )
-    	{
-    		if ( wxDir::Exists( nextPluginXmlPath ) )
-    		{
+class PluginParseThread : public wxThread
+{
+private:
+	PluginParseQueue* m_queue;
+
+public:
+	PluginParseThread( PluginParseQueue* queue )
+	:
+	wxThread( wxTHREAD_JOINABLE ),
+	m_queue( queue )
+	{
+	}
+
+	ExitCode Entry()
+	{
+		m_queue->Run();
+		return 0;
+	}
+};
+
+/**
+Directory of a plugin, with the xml files of its packages.
+*/
+struct PluginDirectory
+{
+	wxString path;
+	wxString iconPath;
+	std::vector< wxString > packageFiles;
+};
+
+static const wxChar* s_codeGenExtensions[] = { wxT("cppcode"), wxT("pythoncode"), wxT("phpcode"), wxT("luacode") };
+
+static wxString GetCodeGenFile( const wxString& packageFile, const wxChar* extension )
+{
+	wxFileName file( packageFile );
+	file.SetExt( extension );
+	return file.GetFullPath();
+}
+
+void ObjectDatabase::ParseFiles( const std::vector< wxString >& files )
+{
+	StartupProfile::Timer timer( "ObjectDatabase::ParseFiles" );
+
+	// Same as XMLUtils::LoadXMLFile, it can not be changed from the threads
+	TiXmlBase::SetCondenseWhiteSpace( true );
+
+	std::vector< boost::shared_ptr< ticpp::Document > > documents( files.size() );
+	PluginParseQueue queue( files, &documents );
+
+	int cpus = wxThread::GetCPUCount();
+	size_t jobs = std::min( files.size(), (size_t)( cpus > 0 ? cpus : 1 ) );
+
+	std::vector< PluginParseThread* > threads;
+	for ( size_t i = 1; i < jobs; ++i )
+	{
+		PluginParseThread* thread = new PluginParseThread( &queue );
+		if ( thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR )
+		{
+			delete thread;
+			break;
+		}
+		threads.push_back( thread );
+	}
+
+	// This thread parses files too, and any left if the others could not be started
+	queue.Run();
+
+	std::vector< PluginParseThread* >::iterator thread;
+	for ( thread = threads.begin(); thread != threads.end(); ++thread )
+	{
+		( *thread )->Wait();
+		delete *thread;
+	}
+
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		if ( documents[i] )
+		{
+			m_parsedFiles[ files[i] ] = documents[i];
+		}
+	}
+}
+
+boost::shared_ptr< ticpp::Document > ObjectDatabase::GetXMLFile( const wxString& file )
+{
+	std::map< wxString, boost::shared_ptr< ticpp::Document > >::iterator parsed = m_parsedFiles.find( file );
+	if ( parsed != m_parsedFiles.end() )
+	{
+		return parsed->second;
+	}
+
+	// Not parsed by ParseFiles, maybe the user has to be asked about it
+	boost::shared_ptr< ticpp::Document > doc( new ticpp::Document );
+	XMLUtils::LoadXMLFile( *doc, true, file );
+	return doc;
+}
+
+void ObjectDatabase::LoadPlugins( PwxFBManager manager )
+{
+	StartupProfile::Timer timer( "ObjectDatabase::LoadPlugins" );
+
+	// Needed to load the libraries, later
+	m_manager = manager;
+
+	// Files of the default objects
+	std::vector< wxString > files;
+	size_t ext;
+	for ( ext = 0; ext < WXSIZEOF( s_codeGenExtensions ); ext++ )
+	{
+		files.push_back( m_xmlPath + wxT("properties.") + s_codeGenExtensions[ext] );
+	}
+	files.push_back( m_xmlPath + wxT("default.xml") );
+	for ( ext = 0; ext < WXSIZEOF( s_codeGenExtensions ); ext++ )
+	{
+		files.push_back( m_xmlPath + wxT("default.") + s_codeGenExtensions[ext] );
+	}
+
+	// Iterate through plugin directories and find the packages in the xml subdirectory
+	std::vector< PluginDirectory > plugins;
+	wxDir pluginsDir;
+	if ( wxDir::Exists( m_pluginPath ) && pluginsDir.Open( m_pluginPath ) )
+	{
+		wxString pluginDirName;
+		bool moreDirectories = pluginsDir.GetFirst( &pluginDirName, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN );
+		while ( moreDirectories )
+		{
+			// Iterate through .xml files in the xml directory
+			wxString nextPluginPath = m_pluginPath + pluginDirName;
+			wxString nextPluginXmlPath = nextPluginPath + wxFILE_SEP_PATH + wxT("xml");
+			if ( wxDir::Exists( nextPluginPath ) && wxDir::Exists( nextPluginXmlPath ) )
+			{
 				wxDir pluginXmlDir( nextPluginXmlPath );
 				if ( pluginXmlDir.IsOpened() )
 				{
-					std::map< wxString, PObjectPackage > packagesToSetup;
+					plugins.push_back( PluginDirectory() );
+					PluginDirectory& plugin = plugins.back();
+					plugin.path = nextPluginPath;
+					plugin.iconPath = nextPluginPath + wxFILE_SEP_PATH + wxT("icons");
+
 					wxString packageXmlFile;
 					bool moreXmlFiles = pluginXmlDir.GetFirst( &packageXmlFile, wxT("*.xml"), wxDIR_FILES | wxDIR_HIDDEN );
 					while ( moreXmlFiles )
 					{
-						try
+						wxFileName nextXmlFile( nextPluginXmlPath + wxFILE_SEP_PATH + packageXmlFile );
+						if ( !nextXmlFile.IsAbsolute() )
 						{
-							wxFileName nextXmlFile( nextPluginXmlPath + wxFILE_SEP_PATH + packageXmlFile );
-							if ( !nextXmlFile.IsAbsolute() )
-							{
-								nextXmlFile.MakeAbsolute();
-							}
-
-							PObjectPackage package = LoadPackage( nextXmlFile.GetFullPath(), nextPluginIconPath );
-							if ( package )
-							{
-								// Load all packages, then setup all packages
-								// this allows multiple packages sharing one library
-								packagesToSetup[ nextXmlFile.GetFullPath() ] = package;
-							}
+							nextXmlFile.MakeAbsolute();
 						}
-						catch ( wxFBException& ex )
+						plugin.packageFiles.push_back( nextXmlFile.GetFullPath() );
+
+						files.push_back( nextXmlFile.GetFullPath() );
+						for ( ext = 0; ext < WXSIZEOF( s_codeGenExtensions ); ext++ )
 						{
-							wxLogError( ex.what() );
+							files.push_back( GetCodeGenFile( nextXmlFile.GetFullPath(), s_codeGenExtensions[ext] ) );
 						}
+
 						moreXmlFiles = pluginXmlDir.GetNext( &packageXmlFile );
 					}
+				}
+			}
 
-					std::map< wxString, PObjectPackage >::iterator packageIt;
-					for ( packageIt = packagesToSetup.begin(); packageIt != packagesToSetup.end(); ++packageIt )
-					{
-						// Setup the inheritance for base classes
-						wxFileName fullNextPluginPath( nextPluginPath );
-						if ( !fullNextPluginPath.IsAbsolute() )
-						{
-							fullNextPluginPath.MakeAbsolute();
-						}
-						wxFileName xmlFileName( packageIt->first );
-						try
-						{
-							SetupPackage( xmlFileName.GetFullPath(), fullNextPluginPath.GetFullPath(), manager );
+			moreDirectories = pluginsDir.GetNext( &pluginDirName );
+		}
+	}
 
-							// Load the C++ code tempates
-							xmlFileName.SetExt( wxT("cppcode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	// Nothing has to be parsed while the files are the same as last time
+	DatabaseCache cache( this );
+	bool cached;
+	{
+		StartupProfile::Timer cacheTimer( "DatabaseCache::Load" );
+		cached = cache.Load( files );
+	}
+	if ( cached )
+	{
+		BuildPropertySlots();
+		SetupLibraryLoader();
+		return;
+	}
 
-							// Load the Python code tempates
-							xmlFileName.SetExt( wxT("pythoncode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	// The files are independent, they are all parsed at the same time.
+	// The database is then built from them in order, in this thread.
+	ParseFiles( files );
 
-							// Load the PHP code tempates
-							xmlFileName.SetExt( wxT("phpcode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	// Load some default templates
+	LoadCodeGen( m_xmlPath + wxT("properties.cppcode") );
+	LoadCodeGen( m_xmlPath + wxT("properties.pythoncode") );
+	LoadCodeGen( m_xmlPath + wxT("properties.luacode") );
+	LoadCodeGen( m_xmlPath + wxT("properties.phpcode") );
+	PObjectPackage defaultPackage = LoadPackage( m_xmlPath + wxT("default.xml"), m_iconPath );
+	LoadCodeGen( m_xmlPath + wxT("default.cppcode") );
+	LoadCodeGen( m_xmlPath + wxT("default.pythoncode") );
+	LoadCodeGen( m_xmlPath + wxT("default.luacode") );
+	LoadCodeGen( m_xmlPath + wxT("default.phpcode") );
 
-							// Load the Lua code tempates
-							xmlFileName.SetExt( wxT("luacode") );
-							LoadCodeGen( xmlFileName.GetFullPath() );
+	// Map to temporarily hold plugins.
+	// Used to both set page order and to prevent two plugins with the same name.
+	typedef std::map< wxString, PObjectPackage > PackageMap;
+	PackageMap packages;
+
+	for ( std::vector< PluginDirectory >::iterator plugin = plugins.begin(); plugin != plugins.end(); ++plugin )
+	{
+		StartupProfile::Timer pluginTimer( "plugin", plugin->path );
+
+		std::map< wxString, PObjectPackage > packagesToSetup;
+		std::vector< wxString >::iterator packageFile;
+		for ( packageFile = plugin->packageFiles.begin(); packageFile != plugin->packageFiles.end(); ++packageFile )
+		{
+			try
+			{
+				PObjectPackage package = LoadPackage( *packageFile, plugin->iconPath );
+				if ( package )
+				{
+					// Load all packages, then setup all packages
+					// this allows multiple packages sharing one library
+					packagesToSetup[ *packageFile ] = package;
+				}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogError( ex.what() );
+				m_loadErrors = true;
+			}
+		}
 
-							std::pair< PackageMap::iterator, bool > addedPackage = packages.insert( PackageMap::value_type( packageIt->second->GetPackageName(), packageIt->second ) );
-							if ( !addedPackage.second )
-							{
-								addedPackage.first->second->AppendPackage( packageIt->second );
+		std::map< wxString, PObjectPackage >::iterator packageIt;
+		for ( packageIt = packagesToSetup.begin(); packageIt != packagesToSetup.end(); ++packageIt )
+		{
+			// Setup the inheritance for base classes
+			wxFileName fullNextPluginPath( plugin->path );
+			if ( !fullNextPluginPath.IsAbsolute() )
+			{
+				fullNextPluginPath.MakeAbsolute();
+			}
+			try
+			{
+				SetupPackage( packageIt->first, fullNextPluginPath.GetFullPath() );
+
+				// Load the code tempates
+				for ( ext = 0; ext < WXSIZEOF( s_codeGenExtensions ); ext++ )
+				{
+					LoadCodeGen( GetCodeGenFile( packageIt->first, s_codeGenExtensions[ext] ) );
+				}
+
+				std::pair< PackageMap::iterator, bool > addedPackage = packages.insert( PackageMap::value_type( packageIt->second->GetPackageName(), packageIt->second ) );
+				if ( !addedPackage.second )
+				{
+					addedPackage.first->second->AppendPackage( packageIt->second );
 #if wxVERSION_NUMBER < 2900
-								LogDebug( _("Merged plugins named \"%s\""), packageIt->second->GetPackageName().c_str() );
+					LogDebug( _("Merged plugins named \"%s\""), packageIt->second->GetPackageName().c_str() );
 #else
-                                LogDebug( "Merged plugins named \"" + packageIt->second->GetPackageName() + "\"" );
+					LogDebug( "Merged plugins named \"" + packageIt->second->GetPackageName() + "\"" );
 #endif
-							}
-
-						}
-						catch ( wxFBException& ex )
-						{
-							wxLogError( ex.what() );
-						}
-					}
 				}
-    		}
-    	}
+			}
+			catch ( wxFBException& ex )
+			{
+				wxLogError( ex.what() );
+				m_loadErrors = true;
+			}
+		}
+	}
 
-        moreDirectories = pluginsDir.GetNext( &pluginDirName );
-    }
+	// Not needed anymore
+	m_parsedFiles.clear();
 
     // Get previous plugin order
 	wxConfigBase* config = wxConfigBase::Get();
@@ -740,9 +1123,32 @@ void ObjectDatabase::LoadPlugins( PwxFBManager manager )
     {
     	m_pkgs.push_back( packageIt->second );
     }
+
+	// Packages whose default values changed, see RestoreDefaults
+	if ( defaultPackage && defaultPackage->GetDefaultsVersion() > 0 )
+	{
+		m_versionedPackages[ _STDSTR( defaultPackage->GetPackageName() ) ] = defaultPackage;
+	}
+	for ( PackageVector::iterator package = m_pkgs.begin(); package != m_pkgs.end(); ++package )
+	{
+		if ( ( *package )->GetDefaultsVersion() > 0 )
+		{
+			m_versionedPackages[ _STDSTR( ( *package )->GetPackageName() ) ] = *package;
+		}
+	}
+
+	// The errors have to be reported again next time
+	if ( !m_loadErrors )
+	{
+		StartupProfile::Timer cacheTimer( "DatabaseCache::Save" );
+		cache.Save( files );
+	}
+
+	BuildPropertySlots();
+	SetupLibraryLoader();
 }
 
-void ObjectDatabase::SetupPackage( const wxString& file, const wxString& path, PwxFBManager manager )
+void ObjectDatabase::SetupPackage( const wxString& file, const wxString& path )
 {
 	#ifdef __WXMSW__
 		wxString libPath = path;
@@ -768,36 +1174,46 @@ void ObjectDatabase::SetupPackage( const wxString& file, const wxString& path, P
 
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		boost::shared_ptr< ticpp::Document > doc = GetXMLFile( file );
 
-		ticpp::Element* root = doc.FirstChildElement( PACKAGE_TAG );
+		ticpp::Element* root = doc->FirstChildElement( PACKAGE_TAG );
 
 		// get the library to import
 		std::string lib;
 		root->GetAttributeOrDefault( "lib", &lib, "" );
+
+		// The library is loaded when it is needed
+		size_t libIndex = 0;
 		if ( !lib.empty() )
 		{
-			// Allows plugin dependency dlls to be next to plugin dll in windows
-			wxString workingDir = ::wxGetCwd();
-			wxFileName::SetCwd( libPath );
-			try
+			libIndex = AddPluginLibrary( libPath, libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver );
+		}
+
+		// Macros of the library of the package, so reading one loads only this
+		// library. Those with a value can be read without loading it.
+		ticpp::Element* elem_macro = root->FirstChildElement( MACRO_TAG, false );
+		while ( elem_macro )
+		{
+			std::string macro_name, macro_value;
+			elem_macro->GetAttribute( NAME_TAG, &macro_name );
+			elem_macro->GetAttributeOrDefault( "value", &macro_value, "" );
+
+			if ( !lib.empty() )
 			{
-				wxString fullLibPath = libPath + wxFILE_SEP_PATH + _WXSTR(lib) + wxver;
-				if ( m_importedLibraries.insert( fullLibPath ).second )
-				{
-					ImportComponentLibrary( fullLibPath, manager );
-				}
+				DeclareMacroLibrary( _WXSTR(macro_name), libIndex );
 			}
-			catch ( ... )
+
+			if ( !macro_value.empty() )
 			{
-				// Put Cwd back
-				wxFileName::SetCwd( workingDir );
-				throw;
+				long value;
+				if ( !_WXSTR(macro_value).ToLong( &value, 0 ) )
+				{
+					THROW_WXFBEX( wxT("Invalid value of macro ") << _WXSTR(macro_name) << wxT(": ") << _WXSTR(macro_value) )
+				}
+				DeclareMacro( _WXSTR(macro_name), (int)value );
 			}
 
-			// Put Cwd back
-			wxFileName::SetCwd( workingDir );
+			elem_macro = elem_macro->NextSiblingElement( MACRO_TAG, false );
 		}
 
 		ticpp::Element* elem_obj = root->FirstChildElement( OBJINFO_TAG, false );
@@ -820,6 +1236,10 @@ void ObjectDatabase::SetupPackage( const wxString& file, const wxString& path, P
 			elem_obj->GetAttribute( CLASS_TAG, &class_name );
 
 			PObjectInfo class_info = GetObjectInfo( _WXSTR(class_name) );
+			if ( class_info && !lib.empty() )
+			{
+				m_classLibraries[ class_info->GetClassName() ] = libIndex;
+			}
 
 			ticpp::Element* elem_base = elem_obj->FirstChildElement( "inherits", false );
 			while ( elem_base )
@@ -925,13 +1345,14 @@ bool ObjectDatabase::HasCppProperties(wxString type)
 
 void ObjectDatabase::LoadCodeGen( const wxString& file )
 {
+	StartupProfile::Timer timer( "ObjectDatabase::LoadCodeGen", file );
+
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		boost::shared_ptr< ticpp::Document > doc = GetXMLFile( file );
 
 		// read the codegen element
-		ticpp::Element* elem_codegen = doc.FirstChildElement("codegen");
+		ticpp::Element* elem_codegen = doc->FirstChildElement("codegen");
 		std::string language;
 		elem_codegen->GetAttribute( "language", &language );
 		wxString lang = _WXSTR(language);
@@ -969,6 +1390,7 @@ void ObjectDatabase::LoadCodeGen( const wxString& file )
 				if ( !m_propertyTypeTemplates[ ParsePropertyType( _WXSTR(prop_name) ) ].insert( LangTemplateMap::value_type( lang, code_info ) ).second )
 				{
 					wxLogError( _("Found second template definition for property \"%s\" for language \"%s\""), _WXSTR(prop_name).c_str(), lang.c_str() );
+					m_loadErrors = true;
 				}
 			}
 			else
@@ -987,23 +1409,26 @@ void ObjectDatabase::LoadCodeGen( const wxString& file )
 	catch( ticpp::Exception& ex )
 	{
 		wxLogError( _WXSTR(ex.m_details) );
+		m_loadErrors = true;
 	}
 	catch( wxFBException& ex )
 	{
 		wxLogError( ex.what() );
+		m_loadErrors = true;
 	}
 }
 
 PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString& iconPath )
 {
+	StartupProfile::Timer timer( "ObjectDatabase::LoadPackage", file );
+
 	PObjectPackage package;
 
 	try
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, true, file );
+		boost::shared_ptr< ticpp::Document > doc = GetXMLFile( file );
 
-		ticpp::Element* root = doc.FirstChildElement( PACKAGE_TAG );
+		ticpp::Element* root = doc->FirstChildElement( PACKAGE_TAG );
 
 		// Name Attribute
 		std::string pkg_name;
@@ -1017,20 +1442,42 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 		std::string pkgIconName;
 		root->GetAttributeOrDefault( ICON_TAG, &pkgIconName, "" );
 		wxString pkgIconPath = iconPath + wxFILE_SEP_PATH +  _WXSTR(pkgIconName);
+		if ( !pkgIconName.empty() )
+		{
+			m_sourceFiles.insert( pkgIconPath );
+		}
 
+		// Each file is only decoded once, many classes share their icons
 		wxBitmap pkg_icon;
-		if ( !pkgIconName.empty() && wxFileName::FileExists( pkgIconPath ) )
+		if ( !pkgIconName.empty() )
 		{
-			wxImage image( pkgIconPath, wxBITMAP_TYPE_ANY );
-			pkg_icon = wxBitmap( image.Scale( 16, 16 ) );
+			pkg_icon = AppBitmaps::GetFileBitmap( pkgIconPath, 16 );
 		}
-		else
+		if ( !pkg_icon.IsOk() )
 		{
 			pkg_icon = AppBitmaps::GetBitmap( wxT("unknown"), 16 );
 		}
 
 		package = PObjectPackage ( new ObjectPackage( _WXSTR(pkg_name), _WXSTR(pkg_desc), pkg_icon ) );
 
+		// Versions of the default values, for sparse project files
+		int defaultsVersion;
+		root->GetAttributeOrDefault( DEFAULTS_VERSION_TAG, &defaultsVersion, 0 );
+		package->SetDefaultsVersion( defaultsVersion );
+
+		ticpp::Element* elem_change = root->FirstChildElement( DEFAULT_CHANGE_TAG, false );
+		while ( elem_change )
+		{
+			int version;
+			std::string class_name, prop_name, previous;
+			elem_change->GetAttribute( VERSION_TAG, &version );
+			elem_change->GetAttribute( CLASS_TAG, &class_name );
+			elem_change->GetAttribute( PROPERTY_TAG, &prop_name );
+			elem_change->GetAttributeOrDefault( "previous", &previous, "" );
+			package->AddDefaultChange( version, _WXSTR(class_name), _WXSTR(prop_name), _WXSTR(previous) );
+
+			elem_change = elem_change->NextSiblingElement( DEFAULT_CHANGE_TAG, false );
+		}
 
 		ticpp::Element* elem_obj = root->FirstChildElement( OBJINFO_TAG, false );
 
@@ -1063,31 +1510,39 @@ PObjectPackage ObjectDatabase::LoadPackage( const wxString& file, const wxString
 				}
 			}
 
+			// The icons are cached with the database
+			if ( !icon.empty() )
+			{
+				m_sourceFiles.insert( iconFullPath );
+			}
+			if ( !smallIcon.empty() )
+			{
+				m_sourceFiles.insert( smallIconFullPath );
+			}
+
 			bool startGroup;
 			elem_obj->GetAttributeOrDefault( "startgroup", &startGroup, false );
 
 			PObjectInfo obj_info( new ObjectInfo( _WXSTR(class_name), GetObjectType( _WXSTR(type) ), package, startGroup ) );
 
-			if ( !icon.empty() && wxFileName::FileExists( iconFullPath ) )
+			wxBitmap iconBitmap;
+			if ( !icon.empty() )
 			{
-				wxImage img( iconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetIconFile( wxBitmap( img.Scale( ICON_SIZE, ICON_SIZE ) ) );
-			}
-			else
-			{
-				obj_info->SetIconFile( AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE ) );
+				iconBitmap = AppBitmaps::GetFileBitmap( iconFullPath, ICON_SIZE );
 			}
+			obj_info->SetIconFile( iconBitmap.IsOk() ? iconBitmap : AppBitmaps::GetBitmap( wxT("unknown"), ICON_SIZE ) );
 
-			if ( !smallIcon.empty() && wxFileName::FileExists( smallIconFullPath ) )
+			// Without a small icon, the icon is used
+			wxBitmap smallIconBitmap;
+			if ( !smallIcon.empty() )
 			{
-				wxImage img( smallIconFullPath, wxBITMAP_TYPE_ANY );
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				smallIconBitmap = AppBitmaps::GetFileBitmap( smallIconFullPath, SMALL_ICON_SIZE );
 			}
-			else
+			if ( !smallIconBitmap.IsOk() && iconBitmap.IsOk() )
 			{
-				wxImage img = obj_info->GetIconFile().ConvertToImage();
-				obj_info->SetSmallIconFile( wxBitmap( img.Scale( SMALL_ICON_SIZE, SMALL_ICON_SIZE ) ) );
+				smallIconBitmap = AppBitmaps::GetFileBitmap( iconFullPath, SMALL_ICON_SIZE );
 			}
+			obj_info->SetSmallIconFile( smallIconBitmap.IsOk() ? smallIconBitmap : AppBitmaps::GetBitmap( wxT("unknown"), SMALL_ICON_SIZE ) );
 
 			// Parse the Properties
 			std::set< PropertyType > types;
@@ -1157,6 +1612,7 @@ void ObjectDatabase::ParseProperties( ticpp::Element* elem_obj, PObjectInfo obj_
 		catch( wxFBException& ex )
 		{
 			wxLogError( wxT("Error: %s\nWhile parsing property \"%s\" of class \"%s\""), ex.what(), _WXSTR(pname).c_str(), obj_info->GetClassName().c_str() );
+			m_loadErrors = true;
 			elem_prop = elem_prop->NextSiblingElement( PROPERTY_TAG, false );
 			continue;
 		}
@@ -1371,6 +1827,8 @@ bool ObjectDatabase::ShowInPalette(wxString type)
 
 void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager manager )
 {
+	StartupProfile::Timer timer( "ObjectDatabase::ImportComponentLibrary", libfile );
+
 	wxString path = libfile;
 
 #if wxVERSION_NUMBER < 2900
@@ -1475,16 +1933,140 @@ void ObjectDatabase::ImportComponentLibrary( wxString libfile, PwxFBManager mana
 	}
 
 	// Add all of the macros in the library to the macro dictionary
-	PMacroDictionary dic = MacroDictionary::GetInstance();
-	for ( unsigned int i = 0; i < comp_lib->GetMacroCount(); i++ )
+	wxArrayString macroNames;
+	wxArrayInt macroValues;
+	IMacroListLibrary* macroList = dynamic_cast< IMacroListLibrary* >( comp_lib );
+	if ( macroList )
+	{
+		macroList->GetMacros( &macroNames, &macroValues );
+	}
+	else
+	{
+		unsigned int macroCount = comp_lib->GetMacroCount();
+		for ( unsigned int i = 0; i < macroCount; i++ )
+		{
+			macroNames.Add( comp_lib->GetMacroName( i ) );
+			macroValues.Add( comp_lib->GetMacroValue( i ) );
+		}
+	}
+
+	// The values declared by the packages were used until now, the library has the right ones
+	PMacroDictionary dictionary = MacroDictionary::GetInstance();
+	for ( size_t i = 0; i < macroNames.GetCount(); i++ )
+	{
+		std::map< wxString, int >::iterator declared = m_declaredMacros.find( macroNames[i] );
+		if ( declared != m_declaredMacros.end() && declared->second != macroValues[i] )
+		{
+			wxLogWarning( wxT("Macro %s is declared as %i by its package, but its value in %s is %i"),
+						  macroNames[i].c_str(), declared->second, path.c_str(), macroValues[i] );
+			declared->second = macroValues[i];
+			dictionary->SetMacro( macroNames[i], macroValues[i] );
+		}
+	}
+
+	dictionary->AddMacros( macroNames, macroValues );
+	for ( size_t i = 0; i < macroNames.GetCount(); i++ )
+	{
+		m_macroSet.erase( macroNames[i] );
+	}
+}
+
+size_t ObjectDatabase::AddPluginLibrary( const wxString& libPath, const wxString& fullLibPath )
+{
+	std::pair< std::map< wxString, size_t >::iterator, bool > added =
+		m_importedLibraries.insert( std::map< wxString, size_t >::value_type( fullLibPath, m_pluginLibraries.size() ) );
+	if ( added.second )
+	{
+		PluginLibrary library;
+		library.path = libPath;
+		library.fullPath = fullLibPath;
+		library.loaded = false;
+		m_pluginLibraries.push_back( library );
+	}
+	return added.first->second;
+}
+
+bool ObjectDatabase::LoadPluginLibrary( size_t index )
+{
+	PluginLibrary& library = m_pluginLibraries[ index ];
+	if ( library.loaded )
+	{
+		return false;
+	}
+	library.loaded = true;
+
+	// Allows plugin dependency dlls to be next to plugin dll in windows
+	wxString workingDir = ::wxGetCwd();
+	wxFileName::SetCwd( library.path );
+	try
+	{
+		ImportComponentLibrary( library.fullPath, m_manager );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+	}
+	catch ( ... )
+	{
+		// Put Cwd back
+		wxFileName::SetCwd( workingDir );
+		throw;
+	}
+
+	// Put Cwd back
+	wxFileName::SetCwd( workingDir );
+	return true;
+}
+
+void ObjectDatabase::LoadComponent( ObjectInfo* info )
+{
+	// Only the library of the package of the class, the others are not tried
+	std::map< wxString, size_t >::iterator library = m_classLibraries.find( info->GetClassName() );
+	if ( library != m_classLibraries.end() )
+	{
+		LoadPluginLibrary( library->second );
+	}
+}
+
+void ObjectDatabase::DeclareMacro( const wxString& name, int value )
+{
+	m_declaredMacros.insert( std::map< wxString, int >::value_type( name, value ) );
+	MacroDictionary::GetInstance()->AddMacro( name, value );
+}
+
+void ObjectDatabase::DeclareMacroLibrary( const wxString& name, size_t library )
+{
+	// The first package which declares it
+	m_macroLibraries.insert( std::map< wxString, size_t >::value_type( name, library ) );
+}
+
+void ObjectDatabase::BuildPropertySlots()
+{
+	for ( ObjectInfoMap::iterator info = m_objs.begin(); info != m_objs.end(); ++info )
 	{
-		wxString name = comp_lib->GetMacroName( i );
-		int value = comp_lib->GetMacroValue( i );
-		dic->AddMacro( name, value );
-		m_macroSet.erase( name );
+		info->second->BuildPropertySlots();
 	}
 }
 
+void ObjectDatabase::SetupLibraryLoader()
+{
+	if ( m_pluginLibraries.empty() )
+	{
+		return;
+	}
+
+	m_libraryLoader.reset( new PluginLibraryLoader( this ) );
+	for ( std::map< wxString, size_t >::iterator library = m_classLibraries.begin(); library != m_classLibraries.end(); ++library )
+	{
+		ObjectInfoMap::iterator info = m_objs.find( library->first );
+		if ( info != m_objs.end() )
+		{
+			info->second->SetComponentLoader( m_libraryLoader.get() );
+		}
+	}
+	MacroDictionary::GetInstance()->SetLoader( m_libraryLoader.get() );
+}
+
 PropertyType ObjectDatabase::ParsePropertyType( wxString str )
 {
 	PropertyType result;
@@ -1534,8 +2116,11 @@ void ObjectDatabase::InitPropertyTypes()
 
 bool ObjectDatabase::LoadObjectTypes()
 {
+	StartupProfile::Timer timer( "ObjectDatabase::LoadObjectTypes" );
+
 	ticpp::Document doc;
 	wxString xmlPath = m_xmlPath + wxT("objtypes.xml");
+	m_sourceFiles.insert( xmlPath );
 	XMLUtils::LoadXMLFile( doc, true, xmlPath );
 
 	// First load the object types, then the children
@@ -41,6 +41,7 @@ typedef boost::shared_ptr<ObjectDatabase> PObjectDatabase;
 namespace ticpp
 {
 	class Element;
+	class Document;
 }
 
 /**
@@ -49,6 +50,8 @@ namespace ticpp
  */
 class ObjectPackage
 {
+  friend class DatabaseCache;
+
  private:
   wxString m_name;    // nombre del paquete
   wxString m_desc;  // breve descripción del paquete
@@ -57,6 +60,17 @@ class ObjectPackage
   // Vector con los objetos que están contenidos en el paquete
   std::vector< PObjectInfo > m_objs;
 
+  struct DefaultChange
+  {
+    wxString className;
+    wxString property;
+    wxString previous;
+  };
+
+  // Version of the default values, and the values changed in each version
+  int m_defaultsVersion;
+  std::multimap< int, DefaultChange > m_defaultChanges;
+
  public:
   /**
    * Constructor.
@@ -93,6 +107,26 @@ class ObjectPackage
    */
   PObjectInfo GetObjectInfo(unsigned int idx);
 
+  /**
+   * Version of the default values of the properties of the objects of the
+   * package, written in sparse project files. It must be increased each time
+   * a default value changes, see AddDefaultChange.
+   */
+  int GetDefaultsVersion() { return m_defaultsVersion; }
+  void SetDefaultsVersion( int version ) { m_defaultsVersion = version; }
+
+  /**
+   * Records that the default value of @a property of @a className, and its
+   * subclasses, changed in @a version. It was @a previous before.
+   */
+  void AddDefaultChange( int version, const wxString& className, const wxString& property, const wxString& previous );
+
+  /**
+   * Gets the default values of the properties of @a info which changed after
+   * @a version, as they were in that version.
+   */
+  void GetPreviousDefaults( PObjectInfo info, int version, std::map< wxString, wxString >* values );
+
   /**
   If two xml files specify the same package name, then they merged to one package with this.
   This allows one package to be split across multiple xml files.
@@ -102,6 +136,7 @@ class ObjectPackage
 };
 
 class IComponentLibrary;
+class PluginLibraryLoader;
 
 /**
  * Base de datos de objetos.
@@ -110,8 +145,17 @@ class IComponentLibrary;
  */
 class ObjectDatabase
 {
+  friend class DatabaseCache;
+  friend class PluginLibraryLoader;
+
  public:
   static bool HasCppProperties(wxString type);
+
+  /**
+   * Version of the default values of each package, by name, as written in
+   * sparse project files.
+   */
+  typedef std::map< std::string, int > DefaultsVersionMap;
  private:
   typedef std::vector<PObjectPackage> PackageVector;
 
@@ -146,11 +190,57 @@ class ObjectDatabase
   // por registrar en la librería.
   MacroSet m_macroSet;
 
-  // used so libraries are only imported once, even if multiple libraries use them
-  std::set< wxString > m_importedLibraries;
+  // used so libraries are only imported once, even if multiple libraries use them,
+  // index in m_pluginLibraries by path
+  std::map< wxString, size_t > m_importedLibraries;
+
+  wxUint64 m_signature;
+
+  // Packages with a version of their default values, by name
+  typedef std::map< std::string, PObjectPackage > VersionedPackageMap;
+  VersionedPackageMap m_versionedPackages;
 
   PTLangTemplateMap m_propertyTypeTemplates;
 
+  // Plugin files parsed in advance by LoadPlugins, by path
+  std::map< wxString, boost::shared_ptr< ticpp::Document > > m_parsedFiles;
+
+  // Other files the database is built from, checked by DatabaseCache
+  std::set< wxString > m_sourceFiles;
+
+  struct PluginLibrary
+  {
+    wxString path;      // directory of the libraries, the working directory while loading
+    wxString fullPath;
+    bool loaded;
+  };
+
+  // Libraries of the plugins, in the order they were found, loaded on demand
+  std::vector< PluginLibrary > m_pluginLibraries;
+
+  // Index in m_pluginLibraries of the library of each class, by name
+  std::map< wxString, size_t > m_classLibraries;
+
+  // Values of the macros declared in the packages, they do not need the
+  // libraries. Checked when the libraries are loaded.
+  std::map< wxString, int > m_declaredMacros;
+
+  // Index in m_pluginLibraries of the library of each macro declared in the
+  // packages, loaded when the macro is first needed
+  std::map< wxString, size_t > m_macroLibraries;
+
+  PwxFBManager m_manager;
+  boost::shared_ptr< PluginLibraryLoader > m_libraryLoader;
+
+  // Set when an error was reported while loading the plugins
+  bool m_loadErrors;
+
+  // Objects and values of the projects loaded which were not kept
+  unsigned int m_droppedCount;
+
+  // Cleared while building objects which were counted already
+  bool m_countObjects;
+
   /**
    * Initialize the property type map.
    */
@@ -177,11 +267,61 @@ class ObjectDatabase
    */
   void ImportComponentLibrary( wxString libfile, PwxFBManager manager );
 
+  /**
+   * Adds the library of a plugin, loaded when one of its components or
+   * macros is first needed.
+   * @param libPath The directory the libraries of the plugins are in.
+   * @return The index of the library in m_pluginLibraries.
+   */
+  size_t AddPluginLibrary( const wxString& libPath, const wxString& fullLibPath );
+
+  /**
+   * Loads a library added by AddPluginLibrary, errors are reported.
+   * @return false if it was loaded already.
+   */
+  bool LoadPluginLibrary( size_t index );
+
+  /**
+   * Loads the library of the package of a class.
+   */
+  void LoadComponent( ObjectInfo* info );
+
+  /**
+   * Registers the value of a macro declared in a package.
+   */
+  void DeclareMacro( const wxString& name, int value );
+
+  /**
+   * Records the library which registers a macro declared in a package.
+   */
+  void DeclareMacroLibrary( const wxString& name, size_t library );
+
+  /**
+   * Makes the classes and the macro dictionary load the libraries when needed.
+   */
+  void SetupLibraryLoader();
+
+  /**
+   * Builds the property slots of every class, once they are all loaded, see
+   * ObjectInfo::GetPropertySlot. Objects are created in other threads later.
+   */
+  void BuildPropertySlots();
+
+  /**
+   * Parses files in several threads, GetXMLFile returns them afterwards.
+   */
+  void ParseFiles( const std::vector< wxString >& files );
+
+  /**
+   * Gets a file parsed by ParseFiles, or loads it if it was not.
+   */
+  boost::shared_ptr< ticpp::Document > GetXMLFile( const wxString& file );
+
   /**
    * Incluye la información heredada de los objetos de un paquete.
    * En la segunda pasada configura cada paquete con sus objetos base.
    */
-  void SetupPackage( const wxString& file, const wxString& path, PwxFBManager manager );
+  void SetupPackage( const wxString& file, const wxString& path );
 
   /**
    * Determina si el tipo de objeto hay que incluirlo en la paleta de
@@ -250,7 +390,21 @@ class ObjectDatabase
    * Fábrica de objetos a partir de un objeto XML.
    * Este método se usará para cargar un proyecto almacenado.
    */
-  PObjectBase CreateObject( ticpp::Element* obj, PObjectBase parent = PObjectBase());
+  PObjectBase CreateObject( ticpp::Element* obj, PObjectBase parent = PObjectBase(), const DefaultsVersionMap* defaults = NULL );
+
+  /**
+   * Reads the versions of the default values of a sparse project file.
+   * @param root The root element of the file.
+   * @return false if the file is not sparse.
+   */
+  static bool ReadDefaultsVersions( ticpp::Element* root, DefaultsVersionMap* versions );
+
+  /**
+   * Restores the default values a new object had in the versions of a
+   * sparse project file, for the defaults which changed since. Must be
+   * called before loading the values of the object from the file.
+   */
+  void RestoreDefaults( PObjectBase object, const DefaultsVersionMap& versions );
 
   /**
    * Crea un objeto como copia de otro.
@@ -276,6 +430,56 @@ class ObjectDatabase
    * (p.e. m_button1, m_button2 ...)
    */
   void ResetObjectCounters();
+
+  /**
+   * Gets a hash of the classes, with the names of their properties, events
+   * and base classes. Objects built with two databases with the same
+   * signature have the same properties in the same order.
+   */
+  wxUint64 GetSignature();
+
+  /**
+   * Gets the version of the default values of each package which has one,
+   * written in sparse project files.
+   */
+  DefaultsVersionMap GetDefaultsVersions();
+
+  /**
+   * Counts an object of a form which is not built yet, as if it was built,
+   * so the default names of new objects are not used in that form.
+   */
+  void CountObject( PObjectInfo info );
+
+  /**
+   * Builds the objects counted with CountObject, without counting them again,
+   * while it exists.
+   */
+  class CountedObjects
+  {
+  private:
+    ObjectDatabase* m_objDb;
+    bool m_countObjects;
+
+  public:
+    CountedObjects( ObjectDatabase* objDb ) : m_objDb( objDb ), m_countObjects( objDb->m_countObjects )
+    {
+      objDb->m_countObjects = false;
+    }
+    ~CountedObjects() { m_objDb->m_countObjects = m_countObjects; }
+  };
+
+  /**
+   * Counts an object of a project which could not be created, or a value
+   * of a property which does not exist, while loading the project.
+   */
+  void CountDropped() { m_droppedCount++; }
+
+  /**
+   * Gets the number of objects and values dropped while loading projects,
+   * compare it before and after loading a project to know if it was
+   * loaded completely.
+   */
+  unsigned int GetDroppedCount() { return m_droppedCount; }
 };
 
 
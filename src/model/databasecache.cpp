@@ -0,0 +1,1075 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "databasecache.h"
+#include "model/objectbase.h"
+#include "model/projectcache.h"
+#include "utils/mappedfile.h"
+#include "utils/typeconv.h"
+
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
+#include <wx/config.h>
+#include <wx/image.h>
+#include <cstring>
+
+// Change the last character when the format changes
+#define CACHE_MAGIC "wxFBDC3"
+#define CACHE_MAGIC_SIZE 8
+#define CACHE_MAX_DEPTH 100
+#define CACHE_MAX_ICON_SIZE 1024
+
+// Length of the files which did not exist
+#define CACHE_MISSING_FILE wxULL(0xFFFFFFFFFFFFFFFF)
+
+/*
+Format, all numbers are unsigned, stored as LEB128 unless noted:
+
+	magic		CACHE_MAGIC, null terminated
+	build		wxVERSION_NUMBER and sizeof(wxChar)
+	sources		count of the plugin files, count of all the files, then the
+				length and UTF-8 bytes of the path of each file, and its
+				length, modification time and hash, 8 bytes little endian
+	strings		count, then length and UTF-8 bytes of each string
+	pages		index of the palette page order
+	packages	count, count in the palette, then each package
+	objects		count, then each class
+	bases		for each class, the count and indexes of its base classes,
+				then the default values of their properties
+	palette		for each package, the count and indexes of its classes
+	libraries	count, then the directory and path of each library, the
+				count of classes with a library, then the class index
+				and library index of each one
+	macros		count, then the name and library index of each declared
+				macro, then the count, name and value of each declared value
+
+Strings are stored as indexes in the string table, icons as their size,
+RGB data, alpha channel and mask colour, packages as their index + 1, or
+0 for none.
+*/
+
+DatabaseCache::DatabaseCache( ObjectDatabase* objDb )
+:
+m_objDb( objDb ),
+m_cur( NULL ),
+m_end( NULL )
+{
+}
+
+wxString DatabaseCache::GetCachePath()
+{
+	return wxStandardPaths::Get().GetUserLocalDataDir() + wxFILE_SEP_PATH + wxT("database.cache");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Writing
+
+void DatabaseCache::WriteNumber( std::string* buffer, unsigned int value )
+{
+	while ( value >= 0x80 )
+	{
+		*buffer += (char)( ( value & 0x7F ) | 0x80 );
+		value >>= 7;
+	}
+	*buffer += (char)value;
+}
+
+void DatabaseCache::WriteHeaderValue( std::string* buffer, wxUint64 value )
+{
+	for ( int i = 0; i < 8; ++i )
+	{
+		*buffer += (char)( value & 0xFF );
+		value >>= 8;
+	}
+}
+
+void DatabaseCache::WriteSource( std::string* buffer, const wxString& path )
+{
+	std::string name = _STDSTR( path );
+	WriteNumber( buffer, (unsigned int)name.length() );
+	*buffer += name;
+
+	wxUint64 hash, length;
+	if ( ProjectCache::HashFile( path, &hash, &length ) )
+	{
+		WriteHeaderValue( buffer, length );
+		WriteHeaderValue( buffer, (wxUint64)::wxFileModificationTime( path ) );
+		WriteHeaderValue( buffer, hash );
+	}
+	else
+	{
+		// The cache is out of date when the file appears
+		WriteHeaderValue( buffer, CACHE_MISSING_FILE );
+		WriteHeaderValue( buffer, 0 );
+		WriteHeaderValue( buffer, 0 );
+	}
+}
+
+unsigned int DatabaseCache::AddString( const wxString& str )
+{
+	StringIndexMap::iterator it = m_stringIndex.find( str );
+	if ( it != m_stringIndex.end() )
+	{
+		return it->second;
+	}
+
+	unsigned int index = (unsigned int)m_strings.size();
+	m_strings.push_back( str );
+	m_stringIndex.insert( StringIndexMap::value_type( str, index ) );
+	return index;
+}
+
+void DatabaseCache::WriteString( const wxString& str )
+{
+	WriteNumber( &m_body, AddString( str ) );
+}
+
+void DatabaseCache::WriteImage( const wxBitmap& bitmap )
+{
+	if ( !bitmap.IsOk() )
+	{
+		WriteNumber( &m_body, 0 );
+		WriteNumber( &m_body, 0 );
+		return;
+	}
+
+	wxImage image = bitmap.ConvertToImage();
+	unsigned int width = (unsigned int)image.GetWidth();
+	unsigned int height = (unsigned int)image.GetHeight();
+	WriteNumber( &m_body, width );
+	WriteNumber( &m_body, height );
+	m_body.append( reinterpret_cast< const char* >( image.GetData() ), width * height * 3 );
+
+	m_body += (char)( image.HasAlpha() ? 1 : 0 );
+	if ( image.HasAlpha() )
+	{
+		m_body.append( reinterpret_cast< const char* >( image.GetAlpha() ), width * height );
+	}
+
+	m_body += (char)( image.HasMask() ? 1 : 0 );
+	if ( image.HasMask() )
+	{
+		m_body += (char)image.GetMaskRed();
+		m_body += (char)image.GetMaskGreen();
+		m_body += (char)image.GetMaskBlue();
+	}
+}
+
+void DatabaseCache::WriteCategory( PPropertyCategory category )
+{
+	size_t i;
+	WriteNumber( &m_body, (unsigned int)category->GetPropertyCount() );
+	for ( i = 0; i < category->GetPropertyCount(); i++ )
+	{
+		WriteString( category->GetPropertyName( i ) );
+	}
+
+	WriteNumber( &m_body, (unsigned int)category->GetEventCount() );
+	for ( i = 0; i < category->GetEventCount(); i++ )
+	{
+		WriteString( category->GetEventName( i ) );
+	}
+
+	WriteNumber( &m_body, (unsigned int)category->GetCategoryCount() );
+	for ( i = 0; i < category->GetCategoryCount(); i++ )
+	{
+		PPropertyCategory child = category->GetCategory( i );
+		WriteString( child->GetName() );
+		WriteCategory( child );
+	}
+}
+
+void DatabaseCache::WriteObject( PObjectInfo info, const PackageIndexMap& packages )
+{
+	WriteString( info->GetClassName() );
+	WriteString( info->m_type ? info->m_type->GetName() : wxString() );
+
+	// The packages merged into others are not kept
+	PObjectPackage package = info->GetPackage();
+	PackageIndexMap::const_iterator index = ( package ? packages.find( package.get() ) : packages.end() );
+	WriteNumber( &m_body, index != packages.end() ? index->second + 1 : 0 );
+
+	m_body += (char)( info->IsStartOfGroup() ? 1 : 0 );
+	WriteImage( info->GetIconFile() );
+	WriteImage( info->GetSmallIconFile() );
+
+	WriteNumber( &m_body, (unsigned int)info->m_properties.size() );
+	for ( PropertyInfoMap::iterator it = info->m_properties.begin(); it != info->m_properties.end(); ++it )
+	{
+		PPropertyInfo prop = it->second;
+		WriteString( prop->GetName() );
+		WriteNumber( &m_body, (unsigned int)prop->GetType() );
+		WriteString( prop->GetDefaultValue() );
+		WriteString( prop->GetDescription() );
+		WriteString( prop->GetCustomEditor() );
+
+		POptionList options = prop->GetOptionList();
+		m_body += (char)( options ? 1 : 0 );
+		if ( options )
+		{
+			const std::map< wxString, wxString >& values = options->GetOptions();
+			WriteNumber( &m_body, (unsigned int)values.size() );
+			for ( std::map< wxString, wxString >::const_iterator option = values.begin(); option != values.end(); ++option )
+			{
+				WriteString( option->first );
+				WriteString( option->second );
+			}
+		}
+
+		std::list< PropertyChild >* children = prop->GetChildren();
+		WriteNumber( &m_body, (unsigned int)children->size() );
+		for ( std::list< PropertyChild >::iterator child = children->begin(); child != children->end(); ++child )
+		{
+			WriteString( child->m_name );
+			WriteString( child->m_defaultValue );
+			WriteString( child->m_description );
+		}
+	}
+
+	WriteNumber( &m_body, (unsigned int)info->m_events.size() );
+	for ( EventInfoMap::iterator it = info->m_events.begin(); it != info->m_events.end(); ++it )
+	{
+		PEventInfo event = it->second;
+		WriteString( event->GetName() );
+		WriteString( event->GetEventClassName() );
+		WriteString( event->GetDefaultValue() );
+		WriteString( event->GetDescription() );
+	}
+
+	WriteCategory( info->GetCategory() );
+
+	WriteNumber( &m_body, (unsigned int)info->m_codeTemp.size() );
+	std::map< wxString, PCodeInfo >::iterator code;
+	for ( code = info->m_codeTemp.begin(); code != info->m_codeTemp.end(); ++code )
+	{
+		WriteString( code->first );
+
+		// The templates are written by name, empty slots are the same as missing templates
+		const CodeInfo::TemplateMap& templates = code->second->m_templates;
+		unsigned int count = (unsigned int)templates.size();
+		int slot;
+		for ( slot = 0; slot < TEMPLATE_COUNT; ++slot )
+		{
+			if ( !code->second->m_slots[ slot ].empty() )
+			{
+				++count;
+			}
+		}
+
+		WriteNumber( &m_body, count );
+		for ( slot = 0; slot < TEMPLATE_COUNT; ++slot )
+		{
+			if ( !code->second->m_slots[ slot ].empty() )
+			{
+				WriteString( CodeInfo::GetTemplateName( (CodeTemplate)slot ) );
+				WriteString( code->second->m_slots[ slot ] );
+			}
+		}
+		for ( CodeInfo::TemplateMap::const_iterator it = templates.begin(); it != templates.end(); ++it )
+		{
+			WriteString( it->first );
+			WriteString( it->second );
+		}
+	}
+}
+
+bool DatabaseCache::Save( const std::vector< wxString >& files )
+{
+	m_stringIndex.clear();
+	m_strings.clear();
+	m_body.clear();
+
+	// The packages of the palette, then the others whose defaults are versioned
+	std::vector< PObjectPackage > packages( m_objDb->m_pkgs.begin(), m_objDb->m_pkgs.end() );
+	PackageIndexMap packageIndex;
+	size_t i;
+	for ( i = 0; i < packages.size(); ++i )
+	{
+		packageIndex[ packages[i].get() ] = (unsigned int)i;
+	}
+	ObjectDatabase::VersionedPackageMap::iterator versioned;
+	for ( versioned = m_objDb->m_versionedPackages.begin(); versioned != m_objDb->m_versionedPackages.end(); ++versioned )
+	{
+		if ( packageIndex.insert( PackageIndexMap::value_type( versioned->second.get(), (unsigned int)packages.size() ) ).second )
+		{
+			packages.push_back( versioned->second );
+		}
+	}
+
+	wxString pages = wxConfigBase::Get()->Read( wxT("/palette/pageOrder"), wxEmptyString );
+	WriteString( pages );
+
+	WriteNumber( &m_body, (unsigned int)packages.size() );
+	WriteNumber( &m_body, (unsigned int)m_objDb->m_pkgs.size() );
+	for ( std::vector< PObjectPackage >::iterator package = packages.begin(); package != packages.end(); ++package )
+	{
+		WriteString( ( *package )->m_name );
+		WriteString( ( *package )->m_desc );
+		WriteImage( ( *package )->m_icon );
+		WriteNumber( &m_body, (unsigned int)( *package )->m_defaultsVersion );
+
+		WriteNumber( &m_body, (unsigned int)( *package )->m_defaultChanges.size() );
+		std::multimap< int, ObjectPackage::DefaultChange >::iterator change;
+		for ( change = ( *package )->m_defaultChanges.begin(); change != ( *package )->m_defaultChanges.end(); ++change )
+		{
+			WriteNumber( &m_body, (unsigned int)change->first );
+			WriteString( change->second.className );
+			WriteString( change->second.property );
+			WriteString( change->second.previous );
+		}
+	}
+
+	ObjectIndexMap objectIndex;
+	WriteNumber( &m_body, (unsigned int)m_objDb->m_objs.size() );
+	ObjectInfoMap::iterator object;
+	for ( object = m_objDb->m_objs.begin(); object != m_objDb->m_objs.end(); ++object )
+	{
+		objectIndex.insert( ObjectIndexMap::value_type( object->second.get(), (unsigned int)objectIndex.size() ) );
+		WriteObject( object->second, packageIndex );
+	}
+
+	// The base classes refer to the classes by index, all of them are read first
+	for ( object = m_objDb->m_objs.begin(); object != m_objDb->m_objs.end(); ++object )
+	{
+		ObjectInfo* info = object->second.get();
+		WriteNumber( &m_body, (unsigned int)info->m_base.size() );
+		for ( std::vector< PObjectInfo >::iterator base = info->m_base.begin(); base != info->m_base.end(); ++base )
+		{
+			ObjectIndexMap::iterator index = objectIndex.find( base->get() );
+			if ( index == objectIndex.end() )
+			{
+				return false;
+			}
+			WriteNumber( &m_body, index->second );
+		}
+
+		WriteNumber( &m_body, (unsigned int)info->m_baseClassDefaultPropertyValues.size() );
+		std::map< size_t, std::map< wxString, wxString > >::iterator values;
+		for ( values = info->m_baseClassDefaultPropertyValues.begin(); values != info->m_baseClassDefaultPropertyValues.end(); ++values )
+		{
+			WriteNumber( &m_body, (unsigned int)values->first );
+			WriteNumber( &m_body, (unsigned int)values->second.size() );
+			for ( std::map< wxString, wxString >::iterator value = values->second.begin(); value != values->second.end(); ++value )
+			{
+				WriteString( value->first );
+				WriteString( value->second );
+			}
+		}
+	}
+
+	for ( std::vector< PObjectPackage >::iterator package = packages.begin(); package != packages.end(); ++package )
+	{
+		WriteNumber( &m_body, ( *package )->GetObjectCount() );
+		for ( unsigned int idx = 0; idx < ( *package )->GetObjectCount(); ++idx )
+		{
+			ObjectIndexMap::iterator index = objectIndex.find( ( *package )->GetObjectInfo( idx ).get() );
+			if ( index == objectIndex.end() )
+			{
+				return false;
+			}
+			WriteNumber( &m_body, index->second );
+		}
+	}
+
+	const std::vector< ObjectDatabase::PluginLibrary >& libraries = m_objDb->m_pluginLibraries;
+	WriteNumber( &m_body, (unsigned int)libraries.size() );
+	for ( i = 0; i < libraries.size(); ++i )
+	{
+		WriteString( libraries[i].path );
+		WriteString( libraries[i].fullPath );
+	}
+
+	WriteNumber( &m_body, (unsigned int)m_objDb->m_classLibraries.size() );
+	std::map< wxString, size_t >::iterator library;
+	for ( library = m_objDb->m_classLibraries.begin(); library != m_objDb->m_classLibraries.end(); ++library )
+	{
+		ObjectInfoMap::iterator info = m_objDb->m_objs.find( library->first );
+		if ( info == m_objDb->m_objs.end() )
+		{
+			return false;
+		}
+		WriteNumber( &m_body, objectIndex[ info->second.get() ] );
+		WriteNumber( &m_body, (unsigned int)library->second );
+	}
+
+	WriteNumber( &m_body, (unsigned int)m_objDb->m_macroLibraries.size() );
+	for ( std::map< wxString, size_t >::iterator macro = m_objDb->m_macroLibraries.begin(); macro != m_objDb->m_macroLibraries.end(); ++macro )
+	{
+		WriteString( macro->first );
+		WriteNumber( &m_body, (unsigned int)macro->second );
+	}
+
+	WriteNumber( &m_body, (unsigned int)m_objDb->m_declaredMacros.size() );
+	for ( std::map< wxString, int >::iterator macro = m_objDb->m_declaredMacros.begin(); macro != m_objDb->m_declaredMacros.end(); ++macro )
+	{
+		WriteString( macro->first );
+		WriteNumber( &m_body, (unsigned int)macro->second );
+	}
+
+	// Header
+	std::string header( CACHE_MAGIC, CACHE_MAGIC_SIZE );
+	WriteNumber( &header, wxVERSION_NUMBER );
+	WriteNumber( &header, (unsigned int)sizeof( wxChar ) );
+
+	WriteNumber( &header, (unsigned int)files.size() );
+	WriteNumber( &header, (unsigned int)( files.size() + m_objDb->m_sourceFiles.size() ) );
+	for ( std::vector< wxString >::const_iterator file = files.begin(); file != files.end(); ++file )
+	{
+		WriteSource( &header, *file );
+	}
+	for ( std::set< wxString >::iterator file = m_objDb->m_sourceFiles.begin(); file != m_objDb->m_sourceFiles.end(); ++file )
+	{
+		WriteSource( &header, *file );
+	}
+
+	WriteNumber( &header, (unsigned int)m_strings.size() );
+	for ( std::vector< wxString >::iterator str = m_strings.begin(); str != m_strings.end(); ++str )
+	{
+		std::string value = _STDSTR( *str );
+		WriteNumber( &header, (unsigned int)value.length() );
+		header += value;
+	}
+
+	// A partially written cache must never replace a good one
+	wxString cachePath = GetCachePath();
+	wxString dir = ::wxPathOnly( cachePath );
+	if ( !::wxDirExists( dir ) && !wxFileName::Mkdir( dir, 0777, wxPATH_MKDIR_FULL ) )
+	{
+		return false;
+	}
+
+	wxString tempPath = cachePath + wxT(".tmp");
+	bool written;
+	{
+		wxFFile file( tempPath, wxT("wb") );
+		if ( !file.IsOpened() )
+		{
+			return false;
+		}
+		written = file.Write( header.data(), header.size() ) == header.size() &&
+				  file.Write( m_body.data(), m_body.size() ) == m_body.size();
+		written = file.Close() && written;
+	}
+
+	m_stringIndex.clear();
+	m_strings.clear();
+	m_body.clear();
+
+	if ( !written || !::wxRenameFile( tempPath, cachePath, true ) )
+	{
+		::wxRemoveFile( tempPath );
+		return false;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reading
+
+bool DatabaseCache::ReadNumber( unsigned int* value )
+{
+	*value = 0;
+	for ( unsigned int shift = 0; shift < 32; shift += 7 )
+	{
+		if ( m_cur == m_end )
+		{
+			return false;
+		}
+
+		unsigned char byte = *m_cur++;
+		*value |= (unsigned int)( byte & 0x7F ) << shift;
+		if ( 0 == ( byte & 0x80 ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool DatabaseCache::ReadCount( unsigned int* count )
+{
+	// Each item takes at least a byte, a damaged count must not allocate more
+	return ReadNumber( count ) && *count <= (unsigned int)( m_end - m_cur );
+}
+
+bool DatabaseCache::ReadHeaderValue( wxUint64* value )
+{
+	if ( m_end - m_cur < 8 )
+	{
+		return false;
+	}
+
+	*value = 0;
+	for ( int i = 7; i >= 0; --i )
+	{
+		*value = ( *value << 8 ) | m_cur[i];
+	}
+	m_cur += 8;
+	return true;
+}
+
+bool DatabaseCache::ReadString( wxString* str )
+{
+	unsigned int index;
+	if ( !ReadNumber( &index ) || index >= m_table.size() )
+	{
+		return false;
+	}
+
+	*str = m_table[ index ];
+	return true;
+}
+
+bool DatabaseCache::ReadSource( const wxString* expected )
+{
+	unsigned int length;
+	if ( !ReadCount( &length ) )
+	{
+		return false;
+	}
+
+	wxString path = _WXSTR( std::string( reinterpret_cast< const char* >( m_cur ), length ) );
+	m_cur += length;
+	if ( expected && *expected != path )
+	{
+		return false;
+	}
+
+	wxUint64 cachedLength, cachedTime, cachedHash;
+	if ( !ReadHeaderValue( &cachedLength ) || !ReadHeaderValue( &cachedTime ) || !ReadHeaderValue( &cachedHash ) )
+	{
+		return false;
+	}
+
+	if ( CACHE_MISSING_FILE == cachedLength )
+	{
+		return !::wxFileExists( path );
+	}
+
+	// The time is only a quick check, the contents are what matter
+	wxUint64 hash, fileLength;
+	return (wxUint64)::wxFileModificationTime( path ) == cachedTime &&
+		   ProjectCache::HashFile( path, &hash, &fileLength ) &&
+		   fileLength == cachedLength && hash == cachedHash;
+}
+
+bool DatabaseCache::ReadImage( wxBitmap* bitmap )
+{
+	unsigned int width, height;
+	if ( !ReadNumber( &width ) || !ReadNumber( &height ) )
+	{
+		return false;
+	}
+
+	if ( 0 == width || 0 == height )
+	{
+		*bitmap = wxBitmap();
+		return 0 == width && 0 == height;
+	}
+
+	size_t pixels = width * height;
+	if ( width > CACHE_MAX_ICON_SIZE || height > CACHE_MAX_ICON_SIZE || (size_t)( m_end - m_cur ) < pixels * 3 + 1 )
+	{
+		return false;
+	}
+
+	wxImage image( (int)width, (int)height, false );
+	memcpy( image.GetData(), m_cur, pixels * 3 );
+	m_cur += pixels * 3;
+
+	if ( *m_cur++ != 0 )
+	{
+		if ( (size_t)( m_end - m_cur ) < pixels )
+		{
+			return false;
+		}
+		image.SetAlpha();
+		memcpy( image.GetAlpha(), m_cur, pixels );
+		m_cur += pixels;
+	}
+
+	if ( m_cur == m_end )
+	{
+		return false;
+	}
+	if ( *m_cur++ != 0 )
+	{
+		if ( m_end - m_cur < 3 )
+		{
+			return false;
+		}
+		image.SetMaskColour( m_cur[0], m_cur[1], m_cur[2] );
+		m_cur += 3;
+	}
+
+	*bitmap = wxBitmap( image );
+	return true;
+}
+
+bool DatabaseCache::ReadCategory( PPropertyCategory category, unsigned int depth )
+{
+	if ( depth > CACHE_MAX_DEPTH )
+	{
+		return false;
+	}
+
+	unsigned int count, i;
+	wxString name;
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		if ( !ReadString( &name ) )
+		{
+			return false;
+		}
+		category->AddProperty( name );
+	}
+
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		if ( !ReadString( &name ) )
+		{
+			return false;
+		}
+		category->AddEvent( name );
+	}
+
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		if ( !ReadString( &name ) )
+		{
+			return false;
+		}
+		PPropertyCategory child( new PropertyCategory( name ) );
+		category->AddCategory( child );
+		if ( !ReadCategory( child, depth + 1 ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+PObjectInfo DatabaseCache::ReadObject( const std::vector< PObjectPackage >& packages )
+{
+	PObjectInfo none;
+
+	wxString className, typeName;
+	unsigned int packageIndex;
+	if ( !ReadString( &className ) || !ReadString( &typeName ) || !ReadNumber( &packageIndex ) ||
+		 packageIndex > packages.size() || m_cur == m_end )
+	{
+		return none;
+	}
+
+	WPObjectPackage package;
+	if ( packageIndex > 0 )
+	{
+		package = packages[ packageIndex - 1 ];
+	}
+
+	bool startGroup = ( *m_cur++ != 0 );
+	PObjectInfo info( new ObjectInfo( className, m_objDb->GetObjectType( typeName ), package, startGroup ) );
+
+	wxBitmap icon;
+	if ( !ReadImage( &icon ) )
+	{
+		return none;
+	}
+	info->SetIconFile( icon );
+	if ( !ReadImage( &icon ) )
+	{
+		return none;
+	}
+	info->SetSmallIconFile( icon );
+
+	unsigned int count, i, j;
+	if ( !ReadCount( &count ) )
+	{
+		return none;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		wxString name, defaultValue, description, customEditor;
+		unsigned int type;
+		if ( !ReadString( &name ) || !ReadNumber( &type ) || !ReadString( &defaultValue ) ||
+			 !ReadString( &description ) || !ReadString( &customEditor ) || m_cur == m_end )
+		{
+			return none;
+		}
+
+		POptionList options;
+		if ( *m_cur++ != 0 )
+		{
+			unsigned int optionCount;
+			if ( !ReadCount( &optionCount ) )
+			{
+				return none;
+			}
+			options = POptionList( new OptionList() );
+			for ( j = 0; j < optionCount; j++ )
+			{
+				wxString option, optionDescription;
+				if ( !ReadString( &option ) || !ReadString( &optionDescription ) )
+				{
+					return none;
+				}
+				options->AddOption( option, optionDescription );
+			}
+		}
+
+		unsigned int childCount;
+		if ( !ReadCount( &childCount ) )
+		{
+			return none;
+		}
+		std::list< PropertyChild > children;
+		for ( j = 0; j < childCount; j++ )
+		{
+			PropertyChild child;
+			if ( !ReadString( &child.m_name ) || !ReadString( &child.m_defaultValue ) || !ReadString( &child.m_description ) )
+			{
+				return none;
+			}
+			children.push_back( child );
+		}
+
+		info->AddPropertyInfo( PPropertyInfo( new PropertyInfo( name, (PropertyType)type, defaultValue, description, customEditor, options, children ) ) );
+	}
+
+	if ( !ReadCount( &count ) )
+	{
+		return none;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		wxString name, eventClass, defaultValue, description;
+		if ( !ReadString( &name ) || !ReadString( &eventClass ) || !ReadString( &defaultValue ) || !ReadString( &description ) )
+		{
+			return none;
+		}
+		info->AddEventInfo( PEventInfo( new EventInfo( name, eventClass, defaultValue, description ) ) );
+	}
+
+	if ( !ReadCategory( info->GetCategory(), 0 ) || !ReadCount( &count ) )
+	{
+		return none;
+	}
+
+	for ( i = 0; i < count; i++ )
+	{
+		wxString lang;
+		unsigned int templateCount;
+		if ( !ReadString( &lang ) || !ReadCount( &templateCount ) )
+		{
+			return none;
+		}
+
+		PCodeInfo code( new CodeInfo() );
+		for ( j = 0; j < templateCount; j++ )
+		{
+			wxString name, code_template;
+			if ( !ReadString( &name ) || !ReadString( &code_template ) )
+			{
+				return none;
+			}
+			code->AddTemplate( name, code_template );
+		}
+		info->AddCodeInfo( lang, code );
+	}
+
+	return info;
+}
+
+bool DatabaseCache::Load( const std::vector< wxString >& files )
+{
+	MappedFile file;
+	if ( !file.Load( GetCachePath() ) )
+	{
+		return false;
+	}
+
+	m_cur = reinterpret_cast< const unsigned char* >( file.GetData() );
+	m_end = m_cur + file.GetLength();
+	if ( m_end - m_cur < CACHE_MAGIC_SIZE || memcmp( m_cur, CACHE_MAGIC, CACHE_MAGIC_SIZE ) != 0 )
+	{
+		return false;
+	}
+	m_cur += CACHE_MAGIC_SIZE;
+
+	// The icons and strings depend on the build
+	unsigned int version, charSize;
+	if ( !ReadNumber( &version ) || version != wxVERSION_NUMBER || !ReadNumber( &charSize ) || charSize != sizeof( wxChar ) )
+	{
+		return false;
+	}
+
+	unsigned int listed, count, i;
+	if ( !ReadNumber( &listed ) || listed != files.size() || !ReadCount( &count ) || count < listed )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		if ( !ReadSource( i < listed ? &files[i] : NULL ) )
+		{
+			return false;
+		}
+	}
+
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	m_table.reserve( count );
+	for ( i = 0; i < count; i++ )
+	{
+		unsigned int length;
+		if ( !ReadCount( &length ) )
+		{
+			return false;
+		}
+		m_table.push_back( _WXSTR( std::string( reinterpret_cast< const char* >( m_cur ), length ) ) );
+		m_cur += length;
+	}
+
+	// The pages are ordered as they were when the cache was written
+	wxString pages;
+	if ( !ReadString( &pages ) || pages != wxConfigBase::Get()->Read( wxT("/palette/pageOrder"), wxEmptyString ) )
+	{
+		return false;
+	}
+
+	// Everything is read before the database is changed
+	unsigned int paletteCount;
+	if ( !ReadCount( &count ) || !ReadNumber( &paletteCount ) || paletteCount > count )
+	{
+		return false;
+	}
+
+	std::vector< PObjectPackage > packages;
+	for ( i = 0; i < count; i++ )
+	{
+		wxString name, desc;
+		wxBitmap icon;
+		unsigned int defaultsVersion, changes;
+		if ( !ReadString( &name ) || !ReadString( &desc ) || !ReadImage( &icon ) ||
+			 !ReadNumber( &defaultsVersion ) || !ReadCount( &changes ) )
+		{
+			return false;
+		}
+
+		PObjectPackage package( new ObjectPackage( name, desc, icon ) );
+		package->SetDefaultsVersion( (int)defaultsVersion );
+		for ( unsigned int j = 0; j < changes; j++ )
+		{
+			unsigned int changeVersion;
+			wxString className, property, previous;
+			if ( !ReadNumber( &changeVersion ) || !ReadString( &className ) || !ReadString( &property ) || !ReadString( &previous ) )
+			{
+				return false;
+			}
+			package->AddDefaultChange( (int)changeVersion, className, property, previous );
+		}
+		packages.push_back( package );
+	}
+
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+
+	std::vector< PObjectInfo > objects;
+	ObjectInfoMap objs;
+	for ( i = 0; i < count; i++ )
+	{
+		PObjectInfo info = ReadObject( packages );
+		if ( !info )
+		{
+			return false;
+		}
+		objects.push_back( info );
+		objs.insert( ObjectInfoMap::value_type( info->GetClassName(), info ) );
+	}
+
+	for ( std::vector< PObjectInfo >::iterator info = objects.begin(); info != objects.end(); ++info )
+	{
+		unsigned int index, j;
+		if ( !ReadCount( &count ) )
+		{
+			return false;
+		}
+		for ( j = 0; j < count; j++ )
+		{
+			if ( !ReadNumber( &index ) || index >= objects.size() )
+			{
+				return false;
+			}
+			( *info )->AddBaseClass( objects[ index ] );
+		}
+
+		if ( !ReadCount( &count ) )
+		{
+			return false;
+		}
+		for ( j = 0; j < count; j++ )
+		{
+			unsigned int values;
+			if ( !ReadNumber( &index ) || !ReadCount( &values ) )
+			{
+				return false;
+			}
+			for ( unsigned int k = 0; k < values; k++ )
+			{
+				wxString property, value;
+				if ( !ReadString( &property ) || !ReadString( &value ) )
+				{
+					return false;
+				}
+				( *info )->AddBaseClassDefaultPropertyValue( index, property, value );
+			}
+		}
+	}
+
+	for ( std::vector< PObjectPackage >::iterator package = packages.begin(); package != packages.end(); ++package )
+	{
+		unsigned int index;
+		if ( !ReadCount( &count ) )
+		{
+			return false;
+		}
+		for ( i = 0; i < count; i++ )
+		{
+			if ( !ReadNumber( &index ) || index >= objects.size() )
+			{
+				return false;
+			}
+			( *package )->Add( objects[ index ] );
+		}
+	}
+
+	std::vector< std::pair< wxString, wxString > > libraries;
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		wxString libPath, fullLibPath;
+		if ( !ReadString( &libPath ) || !ReadString( &fullLibPath ) )
+		{
+			return false;
+		}
+		libraries.push_back( std::make_pair( libPath, fullLibPath ) );
+	}
+
+	std::map< wxString, size_t > classLibraries;
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		unsigned int index, library;
+		if ( !ReadNumber( &index ) || index >= objects.size() || !ReadNumber( &library ) || library >= libraries.size() )
+		{
+			return false;
+		}
+		classLibraries[ objects[ index ]->GetClassName() ] = library;
+	}
+
+	std::map< wxString, size_t > macroLibraries;
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		wxString name;
+		unsigned int library;
+		if ( !ReadString( &name ) || !ReadNumber( &library ) || library >= libraries.size() )
+		{
+			return false;
+		}
+		macroLibraries[ name ] = library;
+	}
+
+	std::vector< std::pair< wxString, int > > macros;
+	if ( !ReadCount( &count ) )
+	{
+		return false;
+	}
+	for ( i = 0; i < count; i++ )
+	{
+		wxString name;
+		unsigned int value;
+		if ( !ReadString( &name ) || !ReadNumber( &value ) )
+		{
+			return false;
+		}
+		macros.push_back( std::make_pair( name, (int)value ) );
+	}
+
+	if ( m_cur != m_end )
+	{
+		return false;
+	}
+	m_table.clear();
+
+	m_objDb->m_objs.swap( objs );
+	m_objDb->m_pkgs.assign( packages.begin(), packages.begin() + paletteCount );
+	for ( std::vector< PObjectPackage >::iterator package = packages.begin(); package != packages.end(); ++package )
+	{
+		if ( ( *package )->GetDefaultsVersion() > 0 )
+		{
+			m_objDb->m_versionedPackages[ _STDSTR( ( *package )->GetPackageName() ) ] = *package;
+		}
+	}
+
+	// In the same order as when the plugin files are read
+	for ( std::vector< std::pair< wxString, wxString > >::iterator library = libraries.begin(); library != libraries.end(); ++library )
+	{
+		m_objDb->AddPluginLibrary( library->first, library->second );
+	}
+	m_objDb->m_classLibraries.swap( classLibraries );
+	m_objDb->m_macroLibraries.swap( macroLibraries );
+
+	for ( std::vector< std::pair< wxString, int > >::iterator macro = macros.begin(); macro != macros.end(); ++macro )
+	{
+		m_objDb->DeclareMacro( macro->first, macro->second );
+	}
+
+	return true;
+}
@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __DATABASE_CACHE__
+#define __DATABASE_CACHE__
+
+#include "utils/wxfbdefs.h"
+#include "model/database.h"
+#include <string>
+#include <vector>
+#include <map>
+
+/**
+Binary copy of the object database, stored in the user data directory.
+
+The cache holds the classes as they were built from the plugin files: their
+properties, events, categories, code templates, base classes and icons, and
+the packages of the palette. It is only used while every file the database
+was built from has the same length, modification time and hash, and the
+same plugin files are found, so it can be deleted at any time.
+
+The object types are still read from objtypes.xml. The component libraries
+of the plugins are loaded on demand, as when the files are read.
+*/
+class DatabaseCache
+{
+private:
+	ObjectDatabase* m_objDb;
+
+	// Writing
+	typedef std::map< wxString, unsigned int > StringIndexMap;
+	typedef std::map< ObjectInfo*, unsigned int > ObjectIndexMap;
+	typedef std::map< ObjectPackage*, unsigned int > PackageIndexMap;
+	StringIndexMap m_stringIndex;
+	std::vector< wxString > m_strings;
+	std::string m_body;
+
+	// Reading
+	const unsigned char* m_cur;
+	const unsigned char* m_end;
+	std::vector< wxString > m_table;
+
+	unsigned int AddString( const wxString& str );
+	void WriteString( const wxString& str );
+	void WriteImage( const wxBitmap& bitmap );
+	void WriteCategory( PPropertyCategory category );
+	void WriteObject( PObjectInfo info, const PackageIndexMap& packages );
+	static void WriteSource( std::string* buffer, const wxString& path );
+	static void WriteNumber( std::string* buffer, unsigned int value );
+	static void WriteHeaderValue( std::string* buffer, wxUint64 value );
+
+	bool ReadNumber( unsigned int* value );
+	bool ReadCount( unsigned int* count );
+	bool ReadHeaderValue( wxUint64* value );
+	bool ReadString( wxString* str );
+	bool ReadImage( wxBitmap* bitmap );
+	bool ReadCategory( PPropertyCategory category, unsigned int depth );
+	PObjectInfo ReadObject( const std::vector< PObjectPackage >& packages );
+	bool ReadSource( const wxString* expected );
+
+public:
+	DatabaseCache( ObjectDatabase* objDb );
+
+	static wxString GetCachePath();
+
+	/**
+	Builds the classes and packages of the database from the cache, and
+	adds the component libraries. The object types must be loaded.
+	@param files The plugin files found, in the order ObjectDatabase::LoadPlugins loads them.
+	@return false if there is no cache or it is out of date, the database is
+	        not modified then.
+	*/
+	bool Load( const std::vector< wxString >& files );
+
+	/**
+	Writes the cache of the database, just built from @a files.
+	@return false if the cache could not be written.
+	*/
+	bool Save( const std::vector< wxString >& files );
+};
+
+#endif //__DATABASE_CACHE__
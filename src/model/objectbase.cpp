@@ -28,20 +28,52 @@
 #include "utils/debug.h"
 #include "utils/typeconv.h"
 #include "utils/stringutils.h"
+#include "utils/xmlwriter.h"
+#include "utils/wxfbexception.h"
 #include "rad/appdata.h"
 #include <ticpp.h>
 #include <wx/tokenzr.h>
+#include <wx/thread.h>
 
 PropertyInfo::PropertyInfo(wxString name, PropertyType type, wxString def_value, wxString description, wxString customEditor,
 						   POptionList opt_list, const std::list< PropertyChild >& children )
 {
 	m_name = name;
+	m_utf8Name = _STDSTR( name );
 	m_type = type;
 	m_def_value = def_value;
 	m_opt_list = opt_list;
 	m_description = description;
 	m_children = children;
 	m_customEditor = customEditor;
+	m_nameId = RegisterName( name );
+}
+
+// The property names by their number. The component libraries loaded on demand
+// may register names from the XRC import threads.
+static wxMutex s_nameMutex;
+static std::map< wxString, int > s_nameIds;
+static std::vector< wxString > s_names;
+
+int PropertyInfo::RegisterName( const wxString& name )
+{
+	wxMutexLocker lock( s_nameMutex );
+	std::map< wxString, int >::iterator it = s_nameIds.find( name );
+	if ( it != s_nameIds.end() )
+	{
+		return it->second;
+	}
+
+	int id = (int)s_names.size();
+	s_names.push_back( name );
+	s_nameIds.insert( std::map< wxString, int >::value_type( name, id ) );
+	return id;
+}
+
+wxString PropertyInfo::GetRegisteredName( int id )
+{
+	wxMutexLocker lock( s_nameMutex );
+	return ( id >= 0 && id < (int)s_names.size() ? s_names[id] : wxString() );
 }
 
 PropertyInfo::~PropertyInfo()
@@ -50,14 +82,42 @@ PropertyInfo::~PropertyInfo()
 
 EventInfo::EventInfo(const wxString &name, const wxString &eventClass,
   const wxString &defValue,  const wxString &description)
-  : m_name(name), m_eventClass(eventClass), m_defaultValue(defValue),
+  : m_name(name), m_utf8Name(_STDSTR(name)), m_eventClass(eventClass), m_defaultValue(defValue),
     m_description(description)
 {
 }
 
+const wxString& Property::Value()
+{
+	if ( !m_hasValue )
+	{
+		m_value = _WXSTR( m_utf8Value );
+		m_hasValue = true;
+	}
+	return m_value;
+}
+
+const std::string& Property::GetUtf8Value()
+{
+	if ( !m_hasUtf8Value )
+	{
+		m_utf8Value = _STDSTR( m_value );
+		m_hasUtf8Value = true;
+	}
+	return m_utf8Value;
+}
+
+void Property::SetUtf8Value( const std::string& value )
+{
+	m_utf8Value = value;
+	m_hasUtf8Value = true;
+	m_value.clear();
+	m_hasValue = false;
+}
+
 bool Property::IsDefaultValue()
 {
-	return (m_info->GetDefaultValue() == m_value);
+	return (m_info->GetDefaultValue() == Value());
 }
 
 bool Property::IsNull()
@@ -66,89 +126,90 @@ bool Property::IsNull()
 	{
 		case PT_BITMAP:
 		{
+			const wxString& value = Value();
 			wxString path;
-			size_t semicolonIndex = m_value.find_first_of( wxT(";") );
-			if ( semicolonIndex != m_value.npos )
+			size_t semicolonIndex = value.find_first_of( wxT(";") );
+			if ( semicolonIndex != value.npos )
 			{
-				path = m_value.substr( 0, semicolonIndex );
+				path = value.substr( 0, semicolonIndex );
 			}
 			else
 			{
-				path = m_value;
+				path = value;
 			}
 
 			return path.empty();
 		}
 		case PT_WXSIZE:
 		{
-			return ( wxDefaultSize == TypeConv::StringToSize( m_value ) );
+			return ( wxDefaultSize == TypeConv::StringToSize( Value() ) );
 		}
 		default:
 		{
-			return m_value.empty();
+			return Value().empty();
 		}
 	}
 }
 
 void Property::SetDefaultValue()
 {
-	m_value = m_info->GetDefaultValue();
+	Assign( m_info->GetDefaultValue() );
 }
 
 void Property::SetValue(const wxFontContainer &font)
 {
-	m_value = TypeConv::FontToString( font );
+	Assign( TypeConv::FontToString( font ) );
 }
 void Property::SetValue(const wxColour &colour)
 {
-	m_value = TypeConv::ColourToString( colour );
+	Assign( TypeConv::ColourToString( colour ) );
 }
 void Property::SetValue(const wxString &str, bool format)
 {
-	m_value = (format ? TypeConv::TextToString(str) : str );
+	Assign( (format ? TypeConv::TextToString(str) : str ) );
 }
 
 void Property::SetValue(const wxPoint &point)
 {
-	m_value = TypeConv::PointToString(point);
+	Assign( TypeConv::PointToString(point) );
 }
 
 void Property::SetValue(const wxSize &size)
 {
-	m_value = TypeConv::SizeToString(size);
+	Assign( TypeConv::SizeToString(size) );
 }
 
 void Property::SetValue(const int integer)
 {
-	m_value = StringUtils::IntToStr(integer);
+	Assign( StringUtils::IntToStr(integer) );
 }
 
 void Property::SetValue(const double val )
 {
-	m_value = TypeConv::FloatToString( val );
+	Assign( TypeConv::FloatToString( val ) );
 }
 
 wxFontContainer Property::GetValueAsFont()
 {
-	return TypeConv::StringToFont( m_value );
+	return TypeConv::StringToFont( Value() );
 }
 
 wxColour Property::GetValueAsColour()
 {
-	return TypeConv::StringToColour(m_value);
+	return TypeConv::StringToColour(Value());
 }
 wxPoint Property::GetValueAsPoint()
 {
-	return TypeConv::StringToPoint(m_value);
+	return TypeConv::StringToPoint(Value());
 }
 wxSize Property::GetValueAsSize()
 {
-	return TypeConv::StringToSize(m_value);
+	return TypeConv::StringToSize(Value());
 }
 
 wxBitmap Property::GetValueAsBitmap()
 {
-	return TypeConv::StringToBitmap( m_value );
+	return TypeConv::StringToBitmap( Value() );
 }
 
 int Property::GetValueAsInteger()
@@ -159,13 +220,13 @@ int Property::GetValueAsInteger()
 	{
 	case PT_OPTION:
 	case PT_MACRO:
-		result = TypeConv::GetMacroValue(m_value);
+		result = TypeConv::GetMacroValue(Value());
 		break;
 	case PT_BITLIST:
-		result = TypeConv::BitlistToInt(m_value);
+		result = TypeConv::BitlistToInt(Value());
 		break;
 	default:
-		result = TypeConv::StringToInt(m_value);
+		result = TypeConv::StringToInt(Value());
 		break;
 	}
 	return result;
@@ -173,22 +234,22 @@ int Property::GetValueAsInteger()
 
 wxString Property::GetValueAsString()
 {
-	return m_value;
+	return Value();
 }
 
 wxString Property::GetValueAsText()
 {
-	return TypeConv::StringToText(m_value);
+	return TypeConv::StringToText(Value());
 }
 
 wxArrayString Property::GetValueAsArrayString()
 {
-	return TypeConv::StringToArrayString(m_value);
+	return TypeConv::StringToArrayString(Value());
 }
 
 double Property::GetValueAsFloat()
 {
-	return TypeConv::StringToFloat(m_value);
+	return TypeConv::StringToFloat(Value());
 }
 
 void Property::SplitParentProperty( std::map< wxString, wxString >* children )
@@ -202,7 +263,7 @@ void Property::SplitParentProperty( std::map< wxString, wxString >* children )
 	std::list< PropertyChild >* myChildren = m_info->GetChildren();
 	std::list< PropertyChild >::iterator it = myChildren->begin();
 
-	wxStringTokenizer tkz( m_value, wxT(";"), wxTOKEN_RET_EMPTY_ALL );
+	wxStringTokenizer tkz( Value(), wxT(";"), wxTOKEN_RET_EMPTY_ALL );
 	while ( tkz.HasMoreTokens() )
 	{
 		if ( myChildren->end() == it )
@@ -240,13 +301,19 @@ const int ObjectBase::INDENT = 2;
 
 ObjectBase::ObjectBase (wxString class_name)
 :
-m_expanded( true )
+m_expanded( true ),
+m_incomplete( false )
 {
 	m_class = class_name;
 
 	LogDebug(wxT("new ObjectBase"));
 }
 
+const std::string& ObjectBase::GetUtf8ClassName()
+{
+	return m_info->GetUtf8ClassName();
+}
+
 ObjectBase::~ObjectBase()
 {
 	// remove the reference in the parent
@@ -338,6 +405,38 @@ PEvent ObjectBase::GetEvent (unsigned int idx)
 void ObjectBase::AddProperty (PProperty prop)
 {
 	m_properties.insert( PropertyMap::value_type( prop->GetName(), prop ) );
+	m_propertySlots.clear();
+}
+
+Property* ObjectBase::FindProperty( const PropertyHandle& handle )
+{
+	if ( !handle.IsOk() )
+	{
+		return NULL;
+	}
+
+	if ( m_propertySlots.size() != m_properties.size() )
+	{
+		m_propertySlots.clear();
+		m_propertySlots.reserve( m_properties.size() );
+		for ( PropertyMap::iterator it = m_properties.begin(); it != m_properties.end(); ++it )
+		{
+			m_propertySlots.push_back( it->second.get() );
+		}
+	}
+
+	if ( m_info )
+	{
+		// All the objects of a class are created with the same properties, see ObjectDatabase::NewObject
+		int slot = m_info->GetPropertySlot( handle.GetId() );
+		if ( slot >= 0 && slot < (int)m_propertySlots.size() && m_propertySlots[ slot ]->GetNameId() == handle.GetId() )
+		{
+			return m_propertySlots[ slot ];
+		}
+	}
+
+	// The properties added after the object was created are not in the slots of its class
+	return GetProperty( PropertyInfo::GetRegisteredName( handle.GetId() ) ).get();
 }
 
 void ObjectBase::AddEvent(PEvent event)
@@ -385,8 +484,34 @@ PObjectBase ObjectBase::FindParentForm()
 	return retObj;
 }
 
+void ObjectBase::LoadChildren()
+{
+	// The loader adds the children through AddChild, so it must be removed first
+	PChildrenLoader loader = m_childrenLoader;
+	m_childrenLoader.reset();
+
+	try
+	{
+		loader->LoadChildren( GetThis() );
+	}
+	catch ( wxFBException& ex )
+	{
+		wxLogError( ex.what() );
+
+		// The object is left without children, the tree must not be saved
+		PObjectBase root = GetThis();
+		while ( root->GetParent() )
+		{
+			root = root->GetParent();
+		}
+		root->m_incomplete = true;
+	}
+}
+
 bool ObjectBase::AddChild (PObjectBase obj)
 {
+	CheckChildren();
+
 	bool result = false;
 	if (ChildTypeOk(obj->GetObjectInfo()->GetObjectType()))
 		//if (ChildTypeOk(obj->GetObjectTypeName()))
@@ -400,6 +525,8 @@ bool ObjectBase::AddChild (PObjectBase obj)
 
 bool ObjectBase::AddChild (unsigned int idx, PObjectBase obj)
 {
+	CheckChildren();
+
 	bool result = false;
 	if (ChildTypeOk(obj->GetObjectInfo()->GetObjectType()) && idx <= m_children.size())
 		//if (ChildTypeOk(obj->GetObjectTypeName()) && idx <= m_children.size())
@@ -459,6 +586,8 @@ PObjectBase ObjectBase::GetLayout()
 
 void ObjectBase::RemoveChild (PObjectBase obj)
 {
+	CheckChildren();
+
 	std::vector< PObjectBase >::iterator it = m_children.begin();
 	while (it != m_children.end() && *it != obj)
 		it++;
@@ -469,6 +598,8 @@ void ObjectBase::RemoveChild (PObjectBase obj)
 
 void ObjectBase::RemoveChild (unsigned int idx)
 {
+	CheckChildren();
+
 	assert (idx < m_children.size());
 
 	std::vector< PObjectBase >::iterator it =  m_children.begin() + idx;
@@ -477,6 +608,8 @@ void ObjectBase::RemoveChild (unsigned int idx)
 
 PObjectBase ObjectBase::GetChild (unsigned int idx)
 {
+	CheckChildren();
+
 	assert (idx < m_children.size());
 
 	return m_children[idx];
@@ -484,6 +617,8 @@ PObjectBase ObjectBase::GetChild (unsigned int idx)
 
 PObjectBase ObjectBase::GetChild (unsigned int idx, const wxString& type)
 {
+	CheckChildren();
+
 	assert (idx < m_children.size());
 
 	unsigned int cnt = 0;
@@ -539,15 +674,15 @@ int ObjectBase::Deep()
 void ObjectBase::SerializeObject( ticpp::Element* serializedElement )
 {
 	ticpp::Element element( "object" );
-	element.SetAttribute( "class", _STDSTR( GetClassName() ) );
+	element.SetAttribute( "class", GetUtf8ClassName() );
 	element.SetAttribute( "expanded", GetExpanded() );
 
 	for ( unsigned int i = 0; i < GetPropertyCount(); i++ )
 	{
 		PProperty prop = GetProperty( i );
 		ticpp::Element prop_element( "property" );
-		prop_element.SetAttribute( "name", _STDSTR( prop->GetName() ) );
-		prop_element.SetText( _STDSTR( prop->GetValue() ) );
+		prop_element.SetAttribute( "name", prop->GetPropertyInfo()->GetUtf8Name() );
+		prop_element.SetText( prop->GetUtf8Value() );
 		element.LinkEndChild( &prop_element );
 	}
 
@@ -555,7 +690,7 @@ void ObjectBase::SerializeObject( ticpp::Element* serializedElement )
 	{
 		PEvent event = GetEvent( i );
 		ticpp::Element event_element( "event" );
-		event_element.SetAttribute( "name", _STDSTR( event->GetName() ) );
+		event_element.SetAttribute( "name", event->GetEventInfo()->GetUtf8Name() );
 		event_element.SetText( _STDSTR( event->GetValue() ) );
 		element.LinkEndChild( &event_element );
 	}
@@ -599,6 +734,52 @@ void ObjectBase::Serialize( ticpp::Document* serializedDocument )
 	*serializedDocument = document;
 }
 
+void ObjectBase::SerializeObject( XMLWriter* writer )
+{
+	writer->StartElement( "object" );
+	writer->WriteAttribute( "class", GetUtf8ClassName() );
+	writer->WriteAttribute( "expanded", GetExpanded() ? 1 : 0 );
+
+	for ( unsigned int i = 0; i < GetPropertyCount(); i++ )
+	{
+		PProperty prop = GetProperty( i );
+		writer->WriteTextElement( "property", "name", prop->GetPropertyInfo()->GetUtf8Name(), prop->GetUtf8Value() );
+	}
+
+	for ( unsigned int i = 0; i < GetEventCount(); i++ )
+	{
+		PEvent event = GetEvent( i );
+		writer->WriteTextElement( "event", "name", event->GetEventInfo()->GetUtf8Name(), _STDSTR( event->GetValue() ) );
+	}
+
+	for ( unsigned int i = 0 ; i < GetChildCount(); i++ )
+	{
+		GetChild( i )->SerializeObject( writer );
+	}
+
+	writer->EndElement();
+}
+
+void ObjectBase::Serialize( XMLWriter* writer )
+{
+  #if wxUSE_UNICODE
+	writer->WriteDeclaration( "1.0", "UTF-8", "yes" );
+	#else
+	writer->WriteDeclaration( "1.0", "ISO-8859-13", "yes" );
+	#endif
+
+	writer->StartElement( "wxFormBuilder_Project" );
+
+	writer->StartElement( "FileVersion" );
+	writer->WriteAttribute( "major", AppData()->m_fbpVerMajor );
+	writer->WriteAttribute( "minor", AppData()->m_fbpVerMinor );
+	writer->EndElement();
+
+	SerializeObject( writer );
+
+	writer->EndElement();
+}
+
 unsigned int ObjectBase::GetChildPosition(PObjectBase obj)
 {
 	unsigned int pos = 0;
@@ -737,14 +918,120 @@ wxString ObjectBase::GetChildFromParentProperty( const wxString& parentName, con
 		return wxEmptyString;
 }
 
+bool ObjectBase::IsNullByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->IsNull();
+	else
+		return true;
+}
+
+int ObjectBase::GetPropertyAsIntegerByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsInteger();
+	else
+		return 0;
+}
+
+wxFontContainer ObjectBase::GetPropertyAsFontByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsFont();
+	else
+		return wxFontContainer();
+}
+
+wxColour ObjectBase::GetPropertyAsColourByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsColour();
+	else
+		return wxColour();
+}
+
+wxString ObjectBase::GetPropertyAsStringByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsString();
+	else
+		return wxString();
+}
+
+wxPoint ObjectBase::GetPropertyAsPointByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsPoint();
+	else
+		return wxPoint();
+}
+
+wxSize ObjectBase::GetPropertyAsSizeByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsSize();
+	else
+		return wxDefaultSize;
+}
+
+wxBitmap ObjectBase::GetPropertyAsBitmapByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsBitmap();
+	else
+		return wxBitmap();
+}
+
+double ObjectBase::GetPropertyAsFloatByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsFloat();
+	else
+		return 0;
+}
+
+wxArrayInt ObjectBase::GetPropertyAsArrayIntByHandle( const PropertyHandle& handle )
+{
+	wxArrayInt array;
+	Property* property = FindProperty( handle );
+	if (property)
+	{
+		IntList il( property->GetValue(), property->GetType() == PT_UINTLIST );
+		for (unsigned int i=0; i < il.GetSize() ; i++)
+			array.Add(il.GetValue(i));
+	}
+
+	return array;
+}
+
+wxArrayString ObjectBase::GetPropertyAsArrayStringByHandle( const PropertyHandle& handle )
+{
+	Property* property = FindProperty( handle );
+	if (property)
+		return property->GetValueAsArrayString();
+	else
+		return wxArrayString();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 ObjectInfo::ObjectInfo(wxString class_name, PObjectType type, WPObjectPackage package, bool startGroup )
 {
 	m_class = class_name;
+	m_utf8Class = _STDSTR( class_name );
 	m_type = type;
 	m_numIns = 0;
 	m_component = NULL;
+	m_componentLoader = NULL;
 	m_package = package;
 	m_category = PPropertyCategory( new PropertyCategory( m_class ) );
 	m_startGroup = startGroup;
@@ -755,6 +1042,18 @@ PObjectPackage ObjectInfo::GetPackage()
 	return m_package.lock();
 }
 
+IComponent* ObjectInfo::GetComponent()
+{
+	// Only tried once, the library may not have a component for the class
+	if ( NULL == m_component && m_componentLoader != NULL )
+	{
+		ComponentLoader* loader = m_componentLoader;
+		m_componentLoader = NULL;
+		loader->LoadComponent( this );
+	}
+	return m_component;
+}
+
 PPropertyInfo ObjectInfo::GetPropertyInfo(wxString name)
 {
 	PPropertyInfo result;
@@ -786,6 +1085,41 @@ PPropertyInfo ObjectInfo::GetPropertyInfo(unsigned int idx)
 	return result;
 }
 
+int ObjectInfo::GetPropertySlot( int nameId ) const
+{
+	return ( nameId >= 0 && nameId < (int)m_propertySlots.size() ? m_propertySlots[ nameId ] : -1 );
+}
+
+void ObjectInfo::BuildPropertySlots()
+{
+	// The same names as the properties of the objects, sorted the same way. As in
+	// ObjectDatabase::NewObject, a property of this class hides those of its bases.
+	std::vector< PObjectInfo > classes;
+	GetBaseClasses( classes );
+
+	std::map< wxString, int > names;
+	for ( size_t base = 0; base <= classes.size(); base++ )
+	{
+		ObjectInfo* classInfo = ( 0 == base ? this : classes[ base - 1 ].get() );
+		for ( unsigned int i = 0; i < classInfo->GetPropertyCount(); i++ )
+		{
+			PPropertyInfo info = classInfo->GetPropertyInfo( i );
+			names.insert( std::map< wxString, int >::value_type( info->GetName(), info->GetNameId() ) );
+		}
+	}
+
+	m_propertySlots.clear();
+	int slot = 0;
+	for ( std::map< wxString, int >::iterator it = names.begin(); it != names.end(); ++it, ++slot )
+	{
+		if ( it->second >= (int)m_propertySlots.size() )
+		{
+			m_propertySlots.resize( it->second + 1, -1 );
+		}
+		m_propertySlots[ it->second ] = slot;
+	}
+}
+
 PEventInfo ObjectInfo::GetEventInfo(wxString name)
 {
 	PEventInfo result;
@@ -933,17 +1267,33 @@ bool ObjectInfo::IsSubclassOf(wxString classname)
 
 void ObjectInfo::AddCodeInfo(wxString lang, PCodeInfo codeinfo)
 {
+	// Not counted as another user of the code info of the language below
+	int language = CodeInfo::FindLanguage( lang );
+	if ( language != wxNOT_FOUND )
+	{
+		m_languageCode[ language ].reset();
+	}
+
 	std::map< wxString, PCodeInfo >::iterator templates = m_codeTemp.find( lang );
 	if ( templates == m_codeTemp.end() )
 	{
-		// First code info is a clean copy
-		m_codeTemp[ lang ] = PCodeInfo( new CodeInfo( *codeinfo ) );
+		// Shared until something is merged into it, the templates of a property type are added to many classes
+		templates = m_codeTemp.insert( std::map< wxString, PCodeInfo >::value_type( lang, codeinfo ) ).first;
 	}
 	else
 	{
 		// If code info already existed for the language, merge code info
+		if ( !templates->second.unique() )
+		{
+			templates->second = PCodeInfo( new CodeInfo( *templates->second ) );
+		}
 		templates->second->Merge( codeinfo );
 	}
+
+	if ( language != wxNOT_FOUND )
+	{
+		m_languageCode[ language ] = templates->second;
+	}
 }
 
 PCodeInfo ObjectInfo::GetCodeInfo(wxString lang)
@@ -963,8 +1313,107 @@ PCodeInfo ObjectInfo::GetCodeInfo(wxString lang)
 //}
 
 ///////////////////////////////////////////////////////////////////////////////
+// In the order of CodeTemplate
+static const char* s_templateNames[] =
+{
+	"construction",
+	"declaration",
+	"settings",
+	"include",
+	"after_addchild",
+	"destruction",
+	"base",
+	"cons_call",
+	"cons_decl",
+	"cons_def",
+	"class_decl",
+	"page_add",
+	"window_add",
+	"sizer_add",
+	"spacer_add",
+	"toolbar_add",
+	"column_add",
+	"valvar_declaration",
+	"generated_event_handlers",
+	"event_handler_comment",
+	"file_comment",
+	"header_comment",
+	"header_include",
+	"source_include",
+	"header_preamble",
+	"header_epilogue",
+	"guard_macro_open",
+	"guard_macro_close",
+	"cpp_preamble",
+	"cpp_epilogue",
+	"python_preamble",
+	"python_epilogue",
+	"lua_preamble",
+	"lua_epilogue",
+	"php_preamble",
+	"php_epilogue",
+};
+
+// In the order of CodeLanguage
+static const char* s_languageNames[] =
+{
+	"C++",
+	"Python",
+	"Lua",
+	"PHP",
+};
+
+wxCOMPILE_TIME_ASSERT( WXSIZEOF( s_templateNames ) == TEMPLATE_COUNT, TemplateNamesMismatch );
+wxCOMPILE_TIME_ASSERT( WXSIZEOF( s_languageNames ) == LANGUAGE_COUNT, LanguageNamesMismatch );
+
+int CodeInfo::FindTemplate( const wxString& name )
+{
+	static std::map< wxString, int > slots;
+	if ( slots.empty() )
+	{
+		for ( int i = 0; i < TEMPLATE_COUNT; ++i )
+		{
+			slots[ wxString::FromAscii( s_templateNames[i] ) ] = i;
+		}
+	}
+
+	std::map< wxString, int >::iterator slot = slots.find( name );
+	return ( slot != slots.end() ? slot->second : wxNOT_FOUND );
+}
+
+const wxString& CodeInfo::GetTemplateName( CodeTemplate slot )
+{
+	static std::vector< wxString > names;
+	if ( names.empty() )
+	{
+		for ( int i = 0; i < TEMPLATE_COUNT; ++i )
+		{
+			names.push_back( wxString::FromAscii( s_templateNames[i] ) );
+		}
+	}
+	return names[ slot ];
+}
+
+int CodeInfo::FindLanguage( const wxString& lang )
+{
+	for ( int i = 0; i < LANGUAGE_COUNT; ++i )
+	{
+		if ( lang == wxString::FromAscii( s_languageNames[i] ) )
+		{
+			return i;
+		}
+	}
+	return wxNOT_FOUND;
+}
+
 wxString CodeInfo::GetTemplate(wxString name)
 {
+	int slot = FindTemplate( name );
+	if ( slot != wxNOT_FOUND )
+	{
+		return m_slots[ slot ];
+	}
+
 	wxString result;
 
 	TemplateMap::iterator it = m_templates.find(name);
@@ -976,11 +1425,27 @@ wxString CodeInfo::GetTemplate(wxString name)
 
 void CodeInfo::AddTemplate(wxString name, wxString _template)
 {
+	// The first definition is kept
+	int slot = FindTemplate( name );
+	if ( slot != wxNOT_FOUND )
+	{
+		if ( m_slots[ slot ].empty() )
+		{
+			m_slots[ slot ] = _template;
+		}
+		return;
+	}
+
 	m_templates.insert(TemplateMap::value_type(name,_template));
 }
 
 void CodeInfo::Merge( PCodeInfo merger )
 {
+	for ( int slot = 0; slot < TEMPLATE_COUNT; ++slot )
+	{
+		m_slots[ slot ] += merger->m_slots[ slot ];
+	}
+
 	TemplateMap::iterator mergerTemplate;
 	for ( mergerTemplate = merger->m_templates.begin(); mergerTemplate != merger->m_templates.end(); ++mergerTemplate )
 	{
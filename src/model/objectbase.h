@@ -45,6 +45,8 @@
 
 #include "utils/wxfbdefs.h"
 
+class XMLWriter;
+
 ///////////////////////////////////////////////////////////////////////////////
 
 class OptionList
@@ -91,6 +93,7 @@ class PropertyInfo
 
 private:
 	wxString       m_name;
+	std::string    m_utf8Name;
 	PropertyType m_type;
 	wxString       m_def_value;
 	POptionList  m_opt_list;
@@ -98,6 +101,7 @@ private:
 	bool m_hidden; // Juan. Determina si la propiedad aparece o no en XRC
 	wxString		m_description;
 	wxString		m_customEditor; // an optional custom editor for the property grid
+	int m_nameId;
 
 public:
 
@@ -109,16 +113,30 @@ public:
 	wxString       GetDefaultValue()        { return m_def_value;  }
 	PropertyType GetType()                { return m_type;       }
 	wxString       GetName()                { return m_name;       }
+	const std::string& GetUtf8Name()      { return m_utf8Name;   }
 	POptionList  GetOptionList ()         { return m_opt_list;   }
 	std::list< PropertyChild >* GetChildren(){ return &m_children; }
 	wxString		 GetDescription	()		  { return m_description;}
 	wxString	GetCustomEditor()			{ return m_customEditor; }
+
+	/**
+	Number of the name of the property, the same in every class. It is the id
+	of the handles of IManager::GetPropertyHandle.
+	*/
+	int GetNameId() { return m_nameId; }
+
+	/**
+	Gives each property name a number, the first time it is registered.
+	*/
+	static int RegisterName( const wxString& name );
+	static wxString GetRegisteredName( int id );
 };
 
 class EventInfo
 {
 private:
 	wxString m_name;
+	std::string m_utf8Name;
 	wxString m_eventClass;
   wxString m_defaultValue;
   wxString m_description;
@@ -130,6 +148,7 @@ public:
             const wxString &description);
 
   wxString GetName()           { return m_name; }
+  const std::string& GetUtf8Name() { return m_utf8Name; }
   wxString GetEventClassName() { return m_eventClass; }
   wxString GetDefaultValue()   { return m_defaultValue; }
   wxString GetDescription()    { return m_description; }
@@ -143,10 +162,27 @@ private:
 	PPropertyInfo m_info;   // pointer to its descriptor
 	WPObjectBase  m_object; // pointer to the owner object
 
+	// The value is kept as it was set: UTF-8 when it comes from a file, as it
+	// is written back. The other form is only converted when it is needed.
 	wxString m_value;
+	std::string m_utf8Value;
+	bool m_hasValue;
+	bool m_hasUtf8Value;
+
+	const wxString& Value();
+	void Assign( const wxString& value )
+	{
+		m_value = value;
+		m_hasValue = true;
+		m_utf8Value.clear();
+		m_hasUtf8Value = false;
+	}
 
 public:
 	Property(PPropertyInfo info, PObjectBase obj = PObjectBase())
+	:
+	m_hasValue( true ),
+	m_hasUtf8Value( false )
 	{
 		m_object = obj;
 		m_info = info;
@@ -154,12 +190,30 @@ public:
 
 	PObjectBase GetObject() { return m_object.lock(); }
 	wxString GetName()                 { return m_info->GetName(); }
-	wxString GetValue()                { return m_value; }
-	void SetValue( wxString& val )     { m_value = val; }
-	void SetValue( const wxChar* val )       { m_value = val;	}
+	wxString GetValue()                { return Value(); }
+	void SetValue( wxString& val )     { Assign( val ); }
+	void SetValue( const wxChar* val )       { Assign( val );	}
+
+	/**
+	The value in UTF-8, the encoding of the project files.
+	*/
+	const std::string& GetUtf8Value();
+	void SetUtf8Value( const std::string& value );
+
+	/**
+	Sets the value of another property of the same kind, in whatever form it is kept.
+	*/
+	void CopyValue( const Property& property )
+	{
+		m_value = property.m_value;
+		m_hasValue = property.m_hasValue;
+		m_utf8Value = property.m_utf8Value;
+		m_hasUtf8Value = property.m_hasUtf8Value;
+	}
 
 	PPropertyInfo GetPropertyInfo() { return m_info; }
 	PropertyType  GetType()         { return m_info->GetType();  }
+	int           GetNameId()       { return m_info->m_nameId; }
 
 	bool IsDefaultValue();
 	bool IsNull();
@@ -275,9 +329,30 @@ namespace ticpp
 	class Element;
 }
 
+/**
+Builds the children of an object the first time they are needed.
+
+Used to open big projects without building the tree of every form, see
+ObjectBase::SetChildrenLoader.
+*/
+class ChildrenLoader
+{
+public:
+	virtual ~ChildrenLoader() {}
+
+	/**
+	Adds the children to @a object, through ObjectBase::AddChild.
+	@throw wxFBException If the children can not be built.
+	*/
+	virtual void LoadChildren( PObjectBase object ) = 0;
+};
+
 class ObjectBase : public IObject, public boost::enable_shared_from_this<ObjectBase>
 {
 	friend class wxFBDataObject;
+	friend class ProjectCache;
+	friend class ProjectSnapshot;
+	friend class ObjectDatabase;
 private:
 	wxString     m_class;  // class name
 	wxString     m_type;   // type of object
@@ -287,19 +362,38 @@ private:
 	PropertyMap      m_properties;
 	EventMap         m_events;
 	PObjectInfo      m_info;
+
+	// The properties in the order of the map, built by FindProperty
+	std::vector< Property* > m_propertySlots;
 	bool m_expanded; // is expanded in the object tree, allows for saving to file
 
+	// Builds the children on first access, if they were not loaded yet
+	PChildrenLoader  m_childrenLoader;
+
+	// Set on the root when the children of an object of the tree could not be loaded
+	bool m_incomplete;
+
+	void LoadChildren();
+	void CheckChildren() { if ( m_childrenLoader ) LoadChildren(); }
+
+	// NULL if the object does not have the property
+	Property* FindProperty( const PropertyHandle& handle );
+
 protected:
 	// utilites for implementing the tree
 	static const int INDENT;  // size of indent
 	wxString GetIndentString(int indent); // obtiene la cadena con el indentado
 
-	ObjectBaseVector& GetChildren()     { return m_children; };
+	ObjectBaseVector& GetChildren()     { CheckChildren(); return m_children; };
 	PropertyMap&      GetProperties()   { return m_properties; };
+	EventMap&         GetEvents()       { return m_events; };
 
 	// Crea un elemento del objeto
 	void SerializeObject( ticpp::Element* serializedElement );
 
+	// Writes the object element straight to the output
+	void SerializeObject( XMLWriter* writer );
+
 	// devuelve el puntero "this"
 	PObjectBase GetThis() { return shared_from_this(); }
 
@@ -321,6 +415,12 @@ public:
 	*/
 	bool GetExpanded(){ return m_expanded; }
 
+	/**
+	Whether the children of an object of this tree could not be loaded, see
+	SetChildrenLoader. Saving the tree would lose them. Only set on the root.
+	*/
+	bool IsIncomplete(){ return m_incomplete; }
+
 	/**
 	* Obtiene el nombre del objeto.
 	*
@@ -330,6 +430,11 @@ public:
 	*/
 	wxString GetClassName () { return m_class;  }
 
+	/**
+	Gets the class name in UTF-8, from the descriptor of the object.
+	*/
+	const std::string& GetUtf8ClassName();
+
 	/// Gets the parent object
 	PObjectBase GetParent () { return m_parent.lock(); }
 
@@ -432,6 +537,12 @@ public:
 	*/
 	void Serialize( ticpp::Document* serializedDocument );
 
+	/**
+	* Writes the xml document of the tree to @a writer, without building it
+	* in memory. The output is the same as saving the document of Serialize.
+	*/
+	void Serialize( XMLWriter* writer );
+
 	/**
 	* Añade un hijo al objeto.
 	* Esta función es virtual, debido a que puede variar el comportamiento
@@ -460,7 +571,7 @@ public:
 	*/
 	void RemoveChild (PObjectBase obj);
 	void RemoveChild (unsigned int idx);
-	void RemoveAllChildren(){ m_children.clear(); }
+	void RemoveAllChildren(){ m_childrenLoader.reset(); m_children.clear(); }
 
 	/**
 	* Obtiene un hijo del objeto.
@@ -472,7 +583,19 @@ public:
 	/**
 	* Obtiene el número de hijos del objeto.
 	*/
-	unsigned int  GetChildCount()    { return (unsigned int)m_children.size(); }
+	unsigned int  GetChildCount()    { CheckChildren(); return (unsigned int)m_children.size(); }
+
+	/**
+	* Defers the creation of the children until they are accessed for the
+	* first time through any of the methods above.
+	*/
+	void SetChildrenLoader( PChildrenLoader loader ) { m_childrenLoader = loader; }
+
+	/**
+	* Returns true if the children have not been built yet. Unlike
+	* GetChildCount(), this does not build them.
+	*/
+	bool HasUnloadedChildren() { return m_childrenLoader.get() != NULL; }
 
 	/**
 	* Comprueba si el tipo de objeto pasado es válido como hijo del objeto.
@@ -532,6 +655,19 @@ public:
 	wxString GetChildFromParentProperty( const wxString& parentName, const wxString& childName );
 	
 	IObject* GetChildPtr (unsigned int idx) { return GetChild(idx).get(); }
+
+	bool     IsNullByHandle (const PropertyHandle& handle);
+	int      GetPropertyAsIntegerByHandle (const PropertyHandle& handle);
+	wxFontContainer   GetPropertyAsFontByHandle    (const PropertyHandle& handle);
+	wxColour GetPropertyAsColourByHandle  (const PropertyHandle& handle);
+	wxString GetPropertyAsStringByHandle  (const PropertyHandle& handle);
+	wxPoint  GetPropertyAsPointByHandle   (const PropertyHandle& handle);
+	wxSize   GetPropertyAsSizeByHandle    (const PropertyHandle& handle);
+	wxBitmap GetPropertyAsBitmapByHandle  (const PropertyHandle& handle);
+	double	 GetPropertyAsFloatByHandle	  (const PropertyHandle& handle);
+
+	wxArrayInt    GetPropertyAsArrayIntByHandle (const PropertyHandle& handle);
+	wxArrayString GetPropertyAsArrayStringByHandle  (const PropertyHandle& handle);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -541,22 +677,60 @@ public:
 */
 class CodeInfo
 {
+	friend class DatabaseCache;
+
 private:
 	typedef std::map<wxString,wxString> TemplateMap;
+
+	// Templates without a slot
 	TemplateMap m_templates;
+
+	wxString m_slots[ TEMPLATE_COUNT ];
 public:
+	/**
+	Slot of the template named @a name, wxNOT_FOUND if it has none.
+	*/
+	static int FindTemplate( const wxString& name );
+	static const wxString& GetTemplateName( CodeTemplate slot );
+
+	/**
+	Index of the language named @a lang, wxNOT_FOUND if it is not a CodeLanguage.
+	*/
+	static int FindLanguage( const wxString& lang );
+
 	wxString GetTemplate(wxString name);
+	const wxString& GetTemplate( CodeTemplate slot ) const { return m_slots[ slot ]; }
 	void AddTemplate(wxString name, wxString _template);
 	void Merge( PCodeInfo merger );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+Sets the component of a class the first time it is needed.
+
+Used to load the component libraries of the plugins on demand, see
+ObjectInfo::SetComponentLoader.
+*/
+class ComponentLoader
+{
+public:
+	virtual ~ComponentLoader() {}
+
+	/**
+	Sets the component of @a info, through ObjectInfo::SetComponent, if
+	some library has one for it.
+	*/
+	virtual void LoadComponent( ObjectInfo* info ) = 0;
+};
+
 /**
 * Información de objeto o MetaObjeto.
 */
 class ObjectInfo
 {
+	friend class DatabaseCache;
+
 public:
 	/**
 	* Constructor.
@@ -615,6 +789,28 @@ public:
 	PObjectType GetObjectType() { return m_type; }
 
 	wxString GetClassName () { return m_class;  }
+	const std::string& GetUtf8ClassName() { return m_utf8Class; }
+
+	/**
+	* Default values of the properties of the objects of this class, as written
+	* in the project files, in the order of ObjectBase::GetProperties.
+	* Empty until the first object is created, see ObjectDatabase::NewObject.
+	*/
+	const std::vector< std::string >& GetUtf8DefaultValues() { return m_utf8Defaults; }
+	void SetUtf8DefaultValues( const std::vector< std::string >& values ) { m_utf8Defaults = values; }
+
+	/**
+	* Index in ObjectBase::GetProperties of the property with the name id, the
+	* same for all the objects of this class. -1 if they do not have it.
+	*/
+	int GetPropertySlot( int nameId ) const;
+
+	/**
+	* Builds the table of GetPropertySlot from the properties of this class and
+	* of its base classes, which must all be loaded. It is not modified later,
+	* so it can be read from any thread.
+	*/
+	void BuildPropertySlots();
 
 	/**
 	* Imprime el descriptor en un stream.
@@ -658,6 +854,7 @@ public:
 
 	void AddCodeInfo(wxString lang, PCodeInfo codeinfo);
 	PCodeInfo GetCodeInfo(wxString lang);
+	PCodeInfo GetCodeInfo( CodeLanguage lang ) { return m_languageCode[ lang ]; }
 
 	PObjectPackage GetPackage();
 
@@ -667,10 +864,29 @@ public:
 	* Le asigna un componente a la clase.
 	*/
 	void SetComponent(IComponent *c) { m_component = c; };
-	IComponent* GetComponent() { return m_component; };
+
+	/**
+	* Gets the component of the class, loading its library if needed.
+	*/
+	IComponent* GetComponent();
+
+	/**
+	* Whether the class has a component, or a library which may have it
+	* which is not loaded yet.
+	*/
+	bool HasComponent() { return m_component != NULL || m_componentLoader != NULL; }
+
+	/**
+	* Sets the loader called by GetComponent while there is no component,
+	* it must outlive the class.
+	*/
+	void SetComponentLoader( ComponentLoader* loader ) { m_componentLoader = loader; }
 
 private:
 	wxString m_class;         // nombre de la clase (tipo de objeto)
+	std::string m_utf8Class;  // the same, as written in the project files
+	std::vector< std::string > m_utf8Defaults;
+	std::vector< int > m_propertySlots; // indexed by name id, see GetPropertySlot
 
 	PObjectType m_type;     // tipo del objeto
 	WPObjectPackage m_package; 	// Package that the object comes from
@@ -683,6 +899,9 @@ private:
 
 	std::map< wxString, PCodeInfo > m_codeTemp;  // plantillas de codigo K=language_name T=PCodeInfo
 
+	// The same, for each CodeLanguage
+	PCodeInfo m_languageCode[ LANGUAGE_COUNT ];
+
 	unsigned int m_numIns;  // número de instancias del objeto
 
 	std::map< wxString, PPropertyInfo > m_properties;
@@ -692,6 +911,7 @@ private:
 	std::map< size_t, std::map< wxString, wxString > > m_baseClassDefaultPropertyValues;
 	IComponent* m_component;  // componente asociado a la clase los objetos del
 	// designer
+	ComponentLoader* m_componentLoader;
 };
 
 #endif
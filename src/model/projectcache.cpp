@@ -0,0 +1,599 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectcache.h"
+#include "model/objectbase.h"
+#include "model/projectsnapshot.h"
+#include "utils/mappedfile.h"
+#include "utils/stringutils.h"
+#include "utils/typeconv.h"
+#include "utils/debug.h"
+#include "utils/wxfbexception.h"
+
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <cstring>
+
+// Change the last character when the format changes
+#define CACHE_MAGIC "wxFBPC2"
+#define CACHE_MAGIC_SIZE 8
+#define CACHE_MAX_DEPTH 1000
+
+/*
+Format, all numbers are unsigned, stored as LEB128 unless noted:
+
+	magic		CACHE_MAGIC, null terminated
+	hash		project file hash, 8 bytes little endian
+	length		project file length, 8 bytes little endian
+	signature	object database signature, 8 bytes little endian
+	defaults	hash of the defaults versions of the packages, 8 bytes little endian
+	strings		count, then length and UTF-8 bytes of each string
+	project		object tree
+
+Each object is stored as the index of its class name, a byte with the
+expanded state, the count and the value indexes of its properties, the
+same for its events, the count of children and the children themselves.
+*/
+
+/**
+Objects inside a form, kept as they are stored in the cache.
+*/
+class CachedChildren : public ChildrenLoader
+{
+private:
+	PObjectDatabase m_objDb;
+	boost::shared_ptr< std::vector< wxString > > m_table;
+	std::string m_data;
+	unsigned int m_count;
+
+public:
+	CachedChildren( PObjectDatabase objDb, boost::shared_ptr< std::vector< wxString > > table, const unsigned char* begin, const unsigned char* end, unsigned int count )
+	:
+	m_objDb( objDb ),
+	m_table( table ),
+	m_data( reinterpret_cast< const char* >( begin ), end - begin ),
+	m_count( count )
+	{
+	}
+
+	void LoadChildren( PObjectBase object )
+	{
+		// The objects were counted when the form was loaded
+		ObjectDatabase::CountedObjects counted( m_objDb.get() );
+
+		ProjectCache reader( m_objDb );
+		reader.m_table = m_table;
+		reader.m_cur = reinterpret_cast< const unsigned char* >( m_data.data() );
+		reader.m_end = reader.m_cur + m_data.size();
+
+		for ( unsigned int i = 0; i < m_count; i++ )
+		{
+			PObjectBase child = reader.ReadObject( 2 );
+			if ( !child )
+			{
+				THROW_WXFBEX( _("The project cache is not valid, please reopen the project.") )
+			}
+			object->AddChild( child );
+			child->SetParent( object );
+		}
+
+		m_table.reset();
+		std::string().swap( m_data );
+	}
+};
+
+ProjectCache::ProjectCache( PObjectDatabase objDb )
+:
+m_objDb( objDb ),
+m_signature( objDb->GetSignature() ),
+m_defaultsSignature( 0 ),
+m_cur( NULL ),
+m_end( NULL )
+{
+	m_defaultsSignature = GetDefaultsSignature();
+}
+
+wxString ProjectCache::GetCachePath( const wxString& projectFile )
+{
+	return projectFile + wxT(".cache");
+}
+
+bool ProjectCache::HashFile( const wxString& path, wxUint64* hash, wxUint64* length )
+{
+	MappedFile file;
+	if ( !file.Load( path ) )
+	{
+		return false;
+	}
+
+	*hash = StringUtils::Hash( file.GetData(), file.GetLength() );
+	*length = file.GetLength();
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Writing
+
+void ProjectCache::WriteNumber( std::string* buffer, unsigned int value )
+{
+	while ( value >= 0x80 )
+	{
+		*buffer += (char)( ( value & 0x7F ) | 0x80 );
+		value >>= 7;
+	}
+	*buffer += (char)value;
+}
+
+void ProjectCache::WriteHeaderValue( std::string* buffer, wxUint64 value )
+{
+	for ( int i = 0; i < 8; ++i )
+	{
+		*buffer += (char)( value & 0xFF );
+		value >>= 8;
+	}
+}
+
+wxUint64 ProjectCache::GetDefaultsSignature()
+{
+	// Sparse files are loaded with the defaults of these versions
+	ObjectDatabase::DefaultsVersionMap versions = m_objDb->GetDefaultsVersions();
+
+	wxUint64 hash = StringUtils::Hash( NULL, 0 );
+	ObjectDatabase::DefaultsVersionMap::iterator version;
+	for ( version = versions.begin(); version != versions.end(); ++version )
+	{
+		hash = StringUtils::Hash( version->first.c_str(), version->first.length() + 1, hash );
+		hash = StringUtils::Hash( &version->second, sizeof( version->second ), hash );
+	}
+	return hash;
+}
+
+bool ProjectCache::IsLoaded( PObjectBase object )
+{
+	if ( object->HasUnloadedChildren() )
+	{
+		return false;
+	}
+
+	for ( unsigned int i = 0; i < object->GetChildCount(); i++ )
+	{
+		if ( !IsLoaded( object->GetChild( i ) ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+unsigned int ProjectCache::AddString( const std::string& str )
+{
+	StringIndexMap::iterator it = m_stringIndex.find( str );
+	if ( it != m_stringIndex.end() )
+	{
+		return it->second;
+	}
+
+	unsigned int index = (unsigned int)m_strings.size();
+	m_strings.push_back( str );
+	m_stringIndex.insert( StringIndexMap::value_type( str, index ) );
+	return index;
+}
+
+void ProjectCache::WriteObject( PObjectBase object )
+{
+	WriteNumber( &m_objects, AddString( object->GetUtf8ClassName() ) );
+	m_objects += (char)( object->GetExpanded() ? 1 : 0 );
+
+	PropertyMap& properties = object->GetProperties();
+	WriteNumber( &m_objects, (unsigned int)properties.size() );
+	for ( PropertyMap::iterator prop = properties.begin(); prop != properties.end(); ++prop )
+	{
+		WriteNumber( &m_objects, AddString( prop->second->GetUtf8Value() ) );
+	}
+
+	EventMap& events = object->GetEvents();
+	WriteNumber( &m_objects, (unsigned int)events.size() );
+	for ( EventMap::iterator event = events.begin(); event != events.end(); ++event )
+	{
+		WriteNumber( &m_objects, AddString( _STDSTR( event->second->GetValue() ) ) );
+	}
+
+	unsigned int count = object->GetChildCount();
+	WriteNumber( &m_objects, count );
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		WriteObject( object->GetChild( i ) );
+	}
+}
+
+bool ProjectCache::Save( const wxString& projectFile, PObjectBase project )
+{
+	// Building the forms which were not loaded would defeat their purpose
+	if ( !project || !IsLoaded( project ) )
+	{
+		return false;
+	}
+
+	// Only the project file is checked when the cache is loaded, the files
+	// of the forms could have changed
+	if ( !project->GetPropertyAsString( wxT("form_files") ).empty() )
+	{
+		return false;
+	}
+
+	m_stringIndex.clear();
+	m_strings.clear();
+	m_objects.clear();
+	WriteObject( project );
+
+	return WriteCache( projectFile );
+}
+
+size_t ProjectCache::WriteNode( const ProjectSnapshot& snapshot, size_t index )
+{
+	const ProjectSnapshot::Node& node = snapshot.m_files.front().nodes[index];
+
+	WriteNumber( &m_objects, AddString( node.className ) );
+	m_objects += (char)( node.expanded ? 1 : 0 );
+
+	// The snapshot has all the values, even if the file is sparse
+	WriteNumber( &m_objects, (unsigned int)node.properties.size() );
+	for ( ProjectSnapshot::ValueVector::const_iterator prop = node.properties.begin(); prop != node.properties.end(); ++prop )
+	{
+		WriteNumber( &m_objects, AddString( prop->second ) );
+	}
+
+	WriteNumber( &m_objects, (unsigned int)node.events.size() );
+	for ( ProjectSnapshot::ValueVector::const_iterator event = node.events.begin(); event != node.events.end(); ++event )
+	{
+		WriteNumber( &m_objects, AddString( event->second ) );
+	}
+
+	WriteNumber( &m_objects, node.children );
+	size_t next = index + 1;
+	for ( unsigned int i = 0; i < node.children; i++ )
+	{
+		next = WriteNode( snapshot, next );
+	}
+	return next;
+}
+
+bool ProjectCache::Save( const wxString& projectFile, const ProjectSnapshot& snapshot )
+{
+	// Projects with a file per form are not cached, see above
+	if ( snapshot.m_files.size() != 1 || snapshot.m_files.front().form ||
+		 !snapshot.m_files.front().formFiles.empty() || snapshot.m_files.front().nodes.empty() )
+	{
+		return false;
+	}
+
+	m_stringIndex.clear();
+	m_strings.clear();
+	m_objects.clear();
+	WriteNode( snapshot, 0 );
+
+	return WriteCache( projectFile );
+}
+
+bool ProjectCache::WriteCache( const wxString& projectFile )
+{
+	wxUint64 hash, length;
+	if ( !HashFile( projectFile, &hash, &length ) )
+	{
+		return false;
+	}
+
+	std::string header( CACHE_MAGIC, CACHE_MAGIC_SIZE );
+	WriteHeaderValue( &header, hash );
+	WriteHeaderValue( &header, length );
+	WriteHeaderValue( &header, m_signature );
+	WriteHeaderValue( &header, m_defaultsSignature );
+
+	WriteNumber( &header, (unsigned int)m_strings.size() );
+	for ( std::vector< std::string >::iterator str = m_strings.begin(); str != m_strings.end(); ++str )
+	{
+		WriteNumber( &header, (unsigned int)str->length() );
+		header += *str;
+	}
+
+	// A partially written cache must never replace a good one
+	wxString cachePath = GetCachePath( projectFile );
+	wxString tempPath = cachePath + wxT(".tmp");
+	bool written;
+	{
+		wxFFile file( tempPath, wxT("wb") );
+		if ( !file.IsOpened() )
+		{
+			return false;
+		}
+		written = file.Write( header.data(), header.size() ) == header.size() &&
+				  file.Write( m_objects.data(), m_objects.size() ) == m_objects.size();
+		written = file.Close() && written;
+	}
+
+	m_stringIndex.clear();
+	m_strings.clear();
+	m_objects.clear();
+
+	if ( !written || !::wxRenameFile( tempPath, cachePath, true ) )
+	{
+		::wxRemoveFile( tempPath );
+		return false;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reading
+
+bool ProjectCache::ReadNumber( unsigned int* value )
+{
+	*value = 0;
+	for ( unsigned int shift = 0; shift < 32; shift += 7 )
+	{
+		if ( m_cur == m_end )
+		{
+			return false;
+		}
+
+		unsigned char byte = *m_cur++;
+		*value |= (unsigned int)( byte & 0x7F ) << shift;
+		if ( 0 == ( byte & 0x80 ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ProjectCache::ReadHeaderValue( wxUint64* value )
+{
+	if ( m_end - m_cur < 8 )
+	{
+		return false;
+	}
+
+	*value = 0;
+	for ( int i = 7; i >= 0; --i )
+	{
+		*value = ( *value << 8 ) | m_cur[i];
+	}
+	m_cur += 8;
+	return true;
+}
+
+bool ProjectCache::ReadString( const wxString** str )
+{
+	unsigned int index;
+	if ( !ReadNumber( &index ) || index >= m_table->size() )
+	{
+		return false;
+	}
+
+	*str = &(*m_table)[ index ];
+	return true;
+}
+
+PObjectBase ProjectCache::ReadObject( unsigned int depth )
+{
+	PObjectBase none;
+
+	const wxString* className;
+	if ( depth > CACHE_MAX_DEPTH || !ReadString( &className ) || m_cur == m_end )
+	{
+		return none;
+	}
+
+	PObjectInfo info = m_objDb->GetObjectInfo( *className );
+	if ( !info )
+	{
+		return none;
+	}
+
+	PObjectBase object = m_objDb->NewObject( info );
+	object->SetExpanded( *m_cur++ != 0 );
+
+	unsigned int count;
+	PropertyMap& properties = object->GetProperties();
+	if ( !ReadNumber( &count ) || count != properties.size() )
+	{
+		return none;
+	}
+
+	const wxString* value;
+	for ( PropertyMap::iterator prop = properties.begin(); prop != properties.end(); ++prop )
+	{
+		if ( !ReadString( &value ) )
+		{
+			return none;
+		}
+		prop->second->SetValue( *value );
+	}
+
+	EventMap& events = object->GetEvents();
+	if ( !ReadNumber( &count ) || count != events.size() )
+	{
+		return none;
+	}
+
+	for ( EventMap::iterator event = events.begin(); event != events.end(); ++event )
+	{
+		if ( !ReadString( &value ) )
+		{
+			return none;
+		}
+		event->second->SetValue( *value );
+	}
+
+	if ( !ReadNumber( &count ) )
+	{
+		return none;
+	}
+
+	// The objects of the forms are built when they are needed
+	if ( 1 == depth && count > 0 )
+	{
+		const unsigned char* begin = m_cur;
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			if ( !SkipObject( depth + 1 ) )
+			{
+				return none;
+			}
+		}
+
+		object->SetChildrenLoader( PChildrenLoader( new CachedChildren( m_objDb, m_table, begin, m_cur, count ) ) );
+		return object;
+	}
+
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		PObjectBase child = ReadObject( depth + 1 );
+		if ( !child )
+		{
+			return none;
+		}
+		object->AddChild( child );
+		child->SetParent( object );
+	}
+
+	return object;
+}
+
+bool ProjectCache::SkipObject( unsigned int depth )
+{
+	const wxString* str;
+	if ( depth > CACHE_MAX_DEPTH || !ReadString( &str ) || m_cur == m_end )
+	{
+		return false;
+	}
+
+	// Counted as if it was built, for the default names of new objects
+	PObjectInfo info = m_objDb->GetObjectInfo( *str );
+	if ( info )
+	{
+		m_objDb->CountObject( info );
+	}
+
+	// Expanded
+	++m_cur;
+
+	// Properties, then events
+	unsigned int count;
+	for ( int list = 0; list < 2; ++list )
+	{
+		if ( !ReadNumber( &count ) )
+		{
+			return false;
+		}
+
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			if ( !ReadString( &str ) )
+			{
+				return false;
+			}
+		}
+	}
+
+	if ( !ReadNumber( &count ) )
+	{
+		return false;
+	}
+
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		if ( !SkipObject( depth + 1 ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+PObjectBase ProjectCache::Load( const wxString& projectFile )
+{
+	PObjectBase project;
+
+	wxString cachePath = GetCachePath( projectFile );
+	if ( !::wxFileExists( cachePath ) )
+	{
+		return project;
+	}
+
+	MappedFile cache;
+	if ( !cache.Load( cachePath ) || cache.GetLength() < CACHE_MAGIC_SIZE ||
+		memcmp( cache.GetData(), CACHE_MAGIC, CACHE_MAGIC_SIZE ) != 0 )
+	{
+		return project;
+	}
+
+	m_cur = reinterpret_cast< const unsigned char* >( cache.GetData() ) + CACHE_MAGIC_SIZE;
+	m_end = reinterpret_cast< const unsigned char* >( cache.GetData() ) + cache.GetLength();
+
+	wxUint64 cacheHash, cacheLength, cacheSignature, cacheDefaults;
+	if ( !ReadHeaderValue( &cacheHash ) || !ReadHeaderValue( &cacheLength ) || !ReadHeaderValue( &cacheSignature ) ||
+		 !ReadHeaderValue( &cacheDefaults ) )
+	{
+		return project;
+	}
+
+	wxUint64 hash, length;
+	if ( cacheSignature != m_signature || cacheDefaults != m_defaultsSignature ||
+		 !HashFile( projectFile, &hash, &length ) ||
+		 hash != cacheHash || length != cacheLength )
+	{
+		LogDebug( wxT("[ProjectCache::Load] %s is out of date"), cachePath.c_str() );
+		return project;
+	}
+
+	unsigned int count;
+	if ( !ReadNumber( &count ) || count > (unsigned int)( m_end - m_cur ) )
+	{
+		return project;
+	}
+
+	m_table.reset( new std::vector< wxString > );
+	m_table->reserve( count );
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		unsigned int size;
+		if ( !ReadNumber( &size ) || size > (unsigned int)( m_end - m_cur ) )
+		{
+			m_table.reset();
+			return project;
+		}
+		m_table->push_back( _WXSTR( std::string( reinterpret_cast< const char* >( m_cur ), size ) ) );
+		m_cur += size;
+	}
+
+	project = ReadObject( 0 );
+	if ( m_cur != m_end || ( project && project->GetObjectTypeName() != wxT("project") ) )
+	{
+		project.reset();
+	}
+
+	// The forms keep their own reference
+	m_table.reset();
+	m_cur = m_end = NULL;
+	return project;
+}
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_CACHE__
+#define __PROJECT_CACHE__
+
+#include "utils/wxfbdefs.h"
+#include "model/database.h"
+#include <string>
+#include <vector>
+#include <map>
+
+class ProjectSnapshot;
+
+/**
+Binary copy of a loaded project, stored next to the .fbp file.
+
+The cache holds the object tree exactly as it was built from the project
+file: the class of each object and the values of all its properties and
+events, in the order the objects store them. It is only used while the
+project file, the object database and the versions of the default values
+of its packages are the same ones it was made with, so the .fbp file is still the only source of truth, and the cache can be
+deleted at any time.
+
+Like ProjectLoader, only the project and its forms are built on load, the
+objects inside the forms are built when they are first accessed.
+*/
+class ProjectCache
+{
+	friend class CachedChildren;
+
+private:
+	PObjectDatabase m_objDb;
+
+	// Read from the database when the cache is created, so a snapshot can be
+	// written in another thread
+	wxUint64 m_signature;
+	wxUint64 m_defaultsSignature;
+
+	// Writing, the strings are UTF-8
+	typedef std::map< std::string, unsigned int > StringIndexMap;
+	StringIndexMap m_stringIndex;
+	std::vector< std::string > m_strings;
+	std::string m_objects;
+
+	// Reading
+	const unsigned char* m_cur;
+	const unsigned char* m_end;
+	boost::shared_ptr< std::vector< wxString > > m_table;
+
+	unsigned int AddString( const std::string& str );
+	static bool IsLoaded( PObjectBase object );
+	void WriteObject( PObjectBase object );
+	size_t WriteNode( const ProjectSnapshot& snapshot, size_t index );
+	bool WriteCache( const wxString& projectFile );
+	static void WriteNumber( std::string* buffer, unsigned int value );
+	static void WriteHeaderValue( std::string* buffer, wxUint64 value );
+	wxUint64 GetDefaultsSignature();
+
+	bool ReadNumber( unsigned int* value );
+	bool ReadString( const wxString** str );
+	bool ReadHeaderValue( wxUint64* value );
+	PObjectBase ReadObject( unsigned int depth );
+	bool SkipObject( unsigned int depth );
+
+public:
+	ProjectCache( PObjectDatabase objDb );
+
+	/**
+	Gets the hash and length of the project file.
+	*/
+	static bool HashFile( const wxString& path, wxUint64* hash, wxUint64* length );
+
+	static wxString GetCachePath( const wxString& projectFile );
+
+	/**
+	Builds the project from its cache.
+	@return The project, or an empty pointer if there is no cache or it is
+	        out of date, in which case the project file has to be loaded.
+	*/
+	PObjectBase Load( const wxString& projectFile );
+
+	/**
+	Writes the cache of a project, the project must be the current contents
+	of @a projectFile.
+	@return false if the cache could not be written, or some form has not
+	        been loaded yet (its children would have to be built).
+	*/
+	bool Save( const wxString& projectFile, PObjectBase project );
+
+	/**
+	Writes the cache of a project from the snapshot it was just saved from.
+	Only uses the snapshot, so it can be called from the thread which saved
+	it, see ProjectSaver.
+	@return false if the cache could not be written, or the snapshot is not
+	        of a project saved in a single file.
+	*/
+	bool Save( const wxString& projectFile, const ProjectSnapshot& snapshot );
+};
+
+#endif //__PROJECT_CACHE__
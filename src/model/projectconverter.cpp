@@ -0,0 +1,886 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectconverter.h"
+#include "utils/mappedfile.h"
+#include "utils/typeconv.h"
+
+#include <ticpp.h>
+#include <wx/thread.h>
+#include <wx/filefn.h>
+#include <memory>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+enum ConversionRuleKind
+{
+	RULE_RENAME_CLASS,		// The class of the object becomes 'target'
+	RULE_RENAME_ADDITIONS,	// Same, for classes from wxAdditions, which the user is warned about
+	RULE_RENAME_PROPERTY,	// The property becomes 'target'
+	RULE_TRANSFER_OPTIONS,	// The 'options' found in the properties are moved to 'target'
+	RULE_REPLACE_FLAG,		// The flag in 'options' is replaced by 'target', or just removed
+	RULE_STRINGLIST,		// The properties are string lists in the format used before 1.9
+	RULE_BITMAP_SOURCE,		// The properties are bitmaps in the format 'data; source'
+	RULE_REMOVE_PROPERTIES,	// The properties are no longer supported
+	RULE_SPACER,			// The object becomes a 'target' with a spacer child, which gets the properties
+	RULE_USER_HEADERS,		// The property is removed, its value is kept for the user
+	RULE_PCH,				// The property is a header name, and becomes the code to include it
+	RULE_MOVE_TO_CHILDREN	// The property is moved to all the children
+};
+
+struct ConversionRuleDesc
+{
+	int major;
+	int minor;
+	const char* objClass;	// NULL for all classes
+	ConversionRuleKind kind;
+	const char* properties;	// Separated by '|'
+	const char* target;
+	const char* options;	// Separated by '|'
+};
+
+#define WINDOW_STYLES	"wxSIMPLE_BORDER|wxDOUBLE_BORDER|wxSUNKEN_BORDER|wxRAISED_BORDER|wxSTATIC_BORDER|wxNO_BORDER|"	\
+						"wxTRANSPARENT_WINDOW|wxTAB_TRAVERSAL|wxWANTS_CHARS|wxVSCROLL|wxHSCROLL|wxALWAYS_SHOW_SB|"		\
+						"wxCLIP_CHILDREN|wxFULL_REPAINT_ON_RESIZE"
+
+#define WINDOW_EXTRA_STYLES	"wxWS_EX_VALIDATE_RECURSIVELY|wxWS_EX_BLOCK_EVENTS|wxWS_EX_TRANSIENT|wxWS_EX_PROCESS_IDLE|"	\
+							"wxWS_EX_PROCESS_UI_UPDATES"
+
+#define AUI_PANE_PROPERTIES	"BottomDockable|LeftDockable|RightDockable|TopDockable|caption_visible|center_pane|"	\
+							"close_button|default_pane|dock|dock_fixed|docking|floatable|gripper|maximize_button|"	\
+							"minimize_button|moveable|pane_border|pin_button|resize|show|toolbar_pane"
+
+/**
+Changes of each version, in the order they are applied.
+Each object is converted after its children.
+*/
+static const ConversionRuleDesc s_conversionRules[] =
+{
+	// The property 'option' became 'proportion'
+	{ 1, 3, "sizeritem",		RULE_RENAME_PROPERTY,	"option",	"proportion",	NULL },
+	{ 1, 3, "gbsizeritem",		RULE_RENAME_PROPERTY,	"option",	"proportion",	NULL },
+	{ 1, 3, "spacer",			RULE_RENAME_PROPERTY,	"option",	"proportion",	NULL },
+
+	// The 'style' property used to have both wxWindow styles and the styles of the specific controls
+	// now it only has the styles of the specfic controls, and wxWindow styles are saved in window_style
+	// This also applies to 'extra_style', which was once combined with 'style'.
+	// And they were named 'WindowStyle' and one point, too...
+	{ 1, 3, NULL,				RULE_TRANSFER_OPTIONS,	"style|WindowStyle",				"window_style",			WINDOW_STYLES },
+	{ 1, 3, NULL,				RULE_TRANSFER_OPTIONS,	"style|extra_style|WindowStyle",	"window_extra_style",	WINDOW_EXTRA_STYLES },
+
+	// The class we once named "wxCheckList" really represented a "wxCheckListBox", now that we use the #class macro in
+	// code generation, it generates the wrong code
+	{ 1, 4, "wxCheckList",		RULE_RENAME_CLASS,		NULL,				"wxCheckListBox",	NULL },
+
+	// The "user_headers" property has been replaced by "precompiled_header" and the "header" subitem of "subclass"
+	{ 1, 5, "Project",			RULE_USER_HEADERS,		"user_headers",		NULL,				NULL },
+
+	// spacer used to be represented by its own class, it is now under a sizeritem like everything else.
+	// no need to check for a wxGridBagSizer, because it was introduced at the same time.
+	{ 1, 6, "spacer",			RULE_SPACER,			"width|height",		"sizeritem",		NULL },
+
+	// Version 1.7 now stores all font properties.
+	// The font property conversion is automatic because it is just an extension of the old values.
+	// Remove deprecated 2.6 things: wxDialog styles wxTHICK_FRAME and wxNO_3D
+	{ 1, 7, "Dialog",			RULE_REPLACE_FLAG,		"style",			"wxRESIZE_BORDER",	"wxTHICK_FRAME" },
+	{ 1, 7, "Dialog",			RULE_REPLACE_FLAG,		"style",			"",					"wxNO_3D" },
+
+	// The pch property is now the exact code to be generated, not just the header filename
+	{ 1, 8, "Project",			RULE_PCH,				"precompiled_header",	NULL,			NULL },
+
+	// stringlist properties are stored in a different format as of version 1.9
+	{ 1, 9, "Project",			RULE_STRINGLIST,		"namespace|bitmaps|icons",				NULL,	NULL },
+	{ 1, 9, "wxComboBox",		RULE_STRINGLIST,		"choices",								NULL,	NULL },
+	{ 1, 9, "wxChoice",			RULE_STRINGLIST,		"choices",								NULL,	NULL },
+	{ 1, 9, "wxListBox",		RULE_STRINGLIST,		"choices",								NULL,	NULL },
+	{ 1, 9, "wxRadioBox",		RULE_STRINGLIST,		"choices",								NULL,	NULL },
+	{ 1, 9, "wxCheckListBox",	RULE_STRINGLIST,		"choices",								NULL,	NULL },
+	{ 1, 9, "wxGrid",			RULE_STRINGLIST,		"col_label_values|row_label_values",	NULL,	NULL },
+
+	// event_handler moved to the forms in version 1.10
+	{ 1, 10, "Project",			RULE_MOVE_TO_CHILDREN,	"event_handler",	NULL,	NULL },
+
+	// Version 1.11 now stores bitmap property in the following format:
+	// 'source'; 'data' instead of old form 'data'; 'source'.
+	{ 1, 11, NULL,				RULE_BITMAP_SOURCE,		"bitmap",			NULL,	NULL },
+
+	// Classes from wxAdditions are now part of wxWidgets, or in their own namespace
+	{ 1, 12, "wxScintilla",				RULE_RENAME_ADDITIONS,	NULL,	"wxStyledTextCtrl",						NULL },
+	{ 1, 12, "wxTreeListCtrl",			RULE_RENAME_ADDITIONS,	NULL,	"wxadditions::wxTreeListCtrl",			NULL },
+	{ 1, 12, "wxTreeListCtrlColumn",	RULE_RENAME_ADDITIONS,	NULL,	"wxadditions::wxTreeListCtrlColumn",	NULL },
+
+	// Properties which are no longer supported
+	{ 1, 12, "Dialog",							RULE_REMOVE_PROPERTIES,	AUI_PANE_PROPERTIES "|validator_style|validator_type|aui_name",	NULL,	NULL },
+	{ 1, 12, "Panel",							RULE_REMOVE_PROPERTIES,	AUI_PANE_PROPERTIES "|validator_style|validator_type",				NULL,	NULL },
+	{ 1, 12, "wxStaticText",					RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+	{ 1, 12, "CustomControl",					RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+	{ 1, 12, "wxAuiNotebook",					RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+	{ 1, 12, "wxPanel",							RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+	{ 1, 12, "wxToolBar",						RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+	{ 1, 12, "wxStyledTextCtrl",				RULE_REMOVE_PROPERTIES,	"use_wxAddition|validator_style|validator_type",	NULL,	NULL },
+	{ 1, 12, "wxPropertyGridManager",			RULE_REMOVE_PROPERTIES,	"use_wxAddition|validator_style|validator_type",	NULL,	NULL },
+	{ 1, 12, "wxadditions::wxTreeListCtrl",		RULE_REMOVE_PROPERTIES,	"validator_style|validator_type",					NULL,	NULL },
+};
+
+struct ConversionRule
+{
+	ConversionRuleKind kind;
+	std::vector< std::string > properties;
+	std::string target;
+	std::set< std::string > options;
+};
+
+typedef std::vector< ConversionRule > ConversionRules;
+
+struct ConversionStep
+{
+	int major;
+	int minor;
+	std::map< std::string, ConversionRules > classRules;
+	ConversionRules commonRules;
+
+	const ConversionRules* Find( const std::string& objClass ) const
+	{
+		std::map< std::string, ConversionRules >::const_iterator rules = classRules.find( objClass );
+		return ( rules != classRules.end() ? &rules->second : NULL );
+	}
+};
+
+static void SplitNames( const char* names, std::vector< std::string >* result )
+{
+	if ( NULL == names )
+	{
+		return;
+	}
+
+	std::string list( names );
+	std::string::size_type start = 0;
+	while ( true )
+	{
+		std::string::size_type end = list.find( '|', start );
+		result->push_back( list.substr( start, end - start ) );
+		if ( std::string::npos == end )
+		{
+			break;
+		}
+		start = end + 1;
+	}
+}
+
+static std::string TrimOption( const std::string& option )
+{
+	static const char* whitespace = " \t\r\n\v\f";
+	std::string::size_type first = option.find_first_not_of( whitespace );
+	if ( std::string::npos == first )
+	{
+		return std::string();
+	}
+	return option.substr( first, option.find_last_not_of( whitespace ) - first + 1 );
+}
+
+static bool IsOlder( int fileMajor, int fileMinor, int major, int minor )
+{
+	return ( fileMajor < major || ( fileMajor == major && fileMinor < minor ) );
+}
+
+int ProjectConverter::CompareFileVersion( int fileMajor, int fileMinor, int major, int minor )
+{
+	if ( IsOlder( fileMajor, fileMinor, major, minor ) )
+	{
+		return -1;
+	}
+
+	// The files of version 1.14 are read as the current ones
+	int newestMinor = minor;
+	if ( 1 == major && minor < FBP_VERSION_MINOR_EXTENDED )
+	{
+		newestMinor = FBP_VERSION_MINOR_EXTENDED;
+	}
+	return ( IsOlder( major, newestMinor, fileMajor, fileMinor ) ? 1 : 0 );
+}
+
+const std::vector< ConversionStep >& ProjectConverter::GetSteps()
+{
+	// Built by the first converter, which has to be created before starting any thread
+	static std::vector< ConversionStep > steps;
+	if ( !steps.empty() )
+	{
+		return steps;
+	}
+
+	const size_t count = sizeof( s_conversionRules ) / sizeof( s_conversionRules[0] );
+	for ( size_t i = 0; i < count; ++i )
+	{
+		const ConversionRuleDesc& desc = s_conversionRules[i];
+
+		if ( steps.empty() || steps.back().major != desc.major || steps.back().minor != desc.minor )
+		{
+			steps.push_back( ConversionStep() );
+			steps.back().major = desc.major;
+			steps.back().minor = desc.minor;
+		}
+
+		ConversionRule rule;
+		rule.kind = desc.kind;
+		SplitNames( desc.properties, &rule.properties );
+		if ( desc.target != NULL )
+		{
+			rule.target = desc.target;
+		}
+
+		std::vector< std::string > options;
+		SplitNames( desc.options, &options );
+		rule.options.insert( options.begin(), options.end() );
+
+		ConversionStep& step = steps.back();
+		if ( NULL == desc.objClass )
+		{
+			step.commonRules.push_back( rule );
+		}
+		else
+		{
+			step.classRules[ desc.objClass ].push_back( rule );
+		}
+	}
+
+	return steps;
+}
+
+ProjectConverter::ProjectConverter( int fileMajor, int fileMinor )
+:
+m_fileMajor( fileMajor ),
+m_fileMinor( fileMinor ),
+m_additionsUpdated( false )
+{
+	const std::vector< ConversionStep >& steps = GetSteps();
+	std::vector< ConversionStep >::const_iterator step;
+	for ( step = steps.begin(); step != steps.end(); ++step )
+	{
+		if ( IsOlder( fileMajor, fileMinor, step->major, step->minor ) )
+		{
+			m_steps.push_back( &( *step ) );
+		}
+	}
+}
+
+void ProjectConverter::GetFileVersion( ticpp::Element* root, int* major, int* minor )
+{
+	*major = 0;
+	*minor = 0;
+
+	// Files without version have the project as the root element
+	if ( root->Value() != std::string( "object" ) )
+	{
+		try
+		{
+			ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
+			fileVersion->GetAttributeOrDefault( "major", major, 0 );
+			fileVersion->GetAttributeOrDefault( "minor", minor, 0 );
+		}
+		catch( ticpp::Exception& )
+		{
+		}
+	}
+}
+
+void ProjectConverter::ConvertObject( ticpp::Element* object )
+{
+	if ( !m_steps.empty() )
+	{
+		ConvertElement( object );
+	}
+}
+
+void ProjectConverter::ConvertDocument( ticpp::Document* doc, int major, int minor )
+{
+	ticpp::Element* root = doc->FirstChildElement();
+
+	if ( root->Value() == std::string( "object" ) )
+	{
+		ConvertObject( root );
+
+		// Create a clone of now-converted object tree, so it can be linked
+		// underneath the root element
+		std::auto_ptr< ticpp::Node > objectTree = root->Clone();
+
+		// Clear the document to add the declatation and the root element
+		doc->Clear();
+
+		// Add the declaration
+		doc->LinkEndChild( new ticpp::Declaration( "1.0", "UTF-8", "yes" ) );
+
+		// Add the root element, with file version
+		ticpp::Element* newRoot = new ticpp::Element( "wxFormBuilder_Project" );
+
+		ticpp::Element* fileVersion = new ticpp::Element( "FileVersion" );
+		fileVersion->SetAttribute( "major", major );
+		fileVersion->SetAttribute( "minor", minor );
+
+		newRoot->LinkEndChild( fileVersion );
+
+		// Add the object tree
+		newRoot->LinkEndChild( objectTree.release() );
+
+		doc->LinkEndChild( newRoot );
+	}
+	else
+	{
+		ConvertObject( root->FirstChildElement( "object" ) );
+		ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
+		fileVersion->SetAttribute( "major", major );
+		fileVersion->SetAttribute( "minor", minor );
+	}
+}
+
+void ProjectConverter::ConvertElement( ticpp::Element* object )
+{
+	ticpp::Iterator< ticpp::Element > child( "object" );
+	for ( child = object->FirstChildElement( "object", false ); child != child.end(); ++child )
+	{
+		ConvertElement( child.Get() );
+	}
+
+	// Find the properties once, the rules keep the index up to date
+	PropertyIndex properties;
+	ticpp::Iterator< ticpp::Element > prop( "property" );
+	for ( prop = object->FirstChildElement( "property", false ); prop != prop.end(); ++prop )
+	{
+		properties.insert( PropertyIndex::value_type( prop->GetAttribute( "name" ), prop.Get() ) );
+	}
+
+	std::string objClass = object->GetAttribute( "class" );
+
+	std::vector< const ConversionStep* >::iterator step;
+	for ( step = m_steps.begin(); step != m_steps.end(); ++step )
+	{
+		// If a rule renames the class, the rules of the new class in this step apply too
+		std::string stepClass;
+		do
+		{
+			stepClass = objClass;
+			const ConversionRules* rules = ( *step )->Find( stepClass );
+			if ( rules != NULL )
+			{
+				ConversionRules::const_iterator rule;
+				for ( rule = rules->begin(); rule != rules->end(); ++rule )
+				{
+					ApplyRule( object, &objClass, &properties, *rule );
+				}
+			}
+		}
+		while ( stepClass != objClass );
+
+		ConversionRules::const_iterator rule;
+		for ( rule = ( *step )->commonRules.begin(); rule != ( *step )->commonRules.end(); ++rule )
+		{
+			ApplyRule( object, &objClass, &properties, *rule );
+		}
+	}
+}
+
+void ProjectConverter::ApplyRule( ticpp::Element* object, std::string* objClass, PropertyIndex* properties, const ConversionRule& rule )
+{
+	switch ( rule.kind )
+	{
+		case RULE_RENAME_ADDITIONS:
+			m_additionsUpdated = true;
+			// fall through
+		case RULE_RENAME_CLASS:
+			*objClass = rule.target;
+			object->SetAttribute( "class", *objClass );
+			return;
+
+		case RULE_SPACER:
+			ConvertSpacer( object, objClass, properties, rule );
+			return;
+
+		default:
+			break;
+	}
+
+	// The rest of the rules work on the properties
+	std::vector< std::string >::const_iterator name;
+	for ( name = rule.properties.begin(); name != rule.properties.end(); ++name )
+	{
+		PropertyIndex::iterator found = properties->find( *name );
+		if ( found == properties->end() )
+		{
+			continue;
+		}
+
+		ticpp::Element* prop = found->second;
+		switch ( rule.kind )
+		{
+			case RULE_RENAME_PROPERTY:
+			{
+				prop->SetAttribute( "name", rule.target );
+				properties->erase( found );
+				properties->insert( PropertyIndex::value_type( rule.target, prop ) );
+				break;
+			}
+			case RULE_TRANSFER_OPTIONS:
+			{
+				TransferOptions( object, properties, found, rule.options, rule.target );
+				break;
+			}
+			case RULE_REPLACE_FLAG:
+			{
+				wxString styles = _WXSTR( prop->GetText( false ) );
+				const wxString flag = _WXSTR( *rule.options.begin() );
+				if ( !styles.empty() && TypeConv::FlagSet( flag, styles ) )
+				{
+					styles = TypeConv::ClearFlag( flag, styles );
+					if ( !rule.target.empty() )
+					{
+						styles = TypeConv::SetFlag( _WXSTR( rule.target ), styles );
+					}
+					prop->SetText( _STDSTR( styles ) );
+				}
+				break;
+			}
+			case RULE_STRINGLIST:
+			{
+				std::string value = prop->GetText( false );
+				if ( !value.empty() )
+				{
+					wxArrayString array = TypeConv::OldStringToArrayString( _WXSTR( value ) );
+					prop->SetText( _STDSTR( TypeConv::ArrayStringToString( array ) ) );
+				}
+				break;
+			}
+			case RULE_BITMAP_SOURCE:
+			{
+				wxString image = _WXSTR( prop->GetText( false ) );
+				if ( !image.empty() && image.AfterLast( ';' ).Contains( wxT("Load From") ) )
+				{
+					wxString source = image.AfterLast( ';' ).Trim().Trim( false );
+					wxString data = image.BeforeLast( ';' ).Trim().Trim( false );
+
+					prop->SetText( _STDSTR( source + wxT("; ") + data ) );
+				}
+				break;
+			}
+			case RULE_REMOVE_PROPERTIES:
+			{
+				m_propertiesRemoved[ *objClass ].insert( rule.properties.begin(), rule.properties.end() );
+				properties->erase( found );
+				object->RemoveChild( prop );
+				break;
+			}
+			case RULE_USER_HEADERS:
+			{
+				m_userHeaders = prop->GetText( false );
+				properties->erase( found );
+				object->RemoveChild( prop );
+				break;
+			}
+			case RULE_PCH:
+			{
+				// The goal of this conversion block is to determine which of two possible pch blocks to use
+				// The pch block that wxFB generated changed in version 1.6
+				std::string pch = prop->GetText( false );
+				if ( pch.empty() )
+				{
+					break;
+				}
+
+				if ( IsOlder( m_fileMajor, m_fileMinor, 1, 6 ) )
+				{
+					// use the older block
+					prop->SetText(
+									  "#include \"" + pch + "\""
+									"\n"
+									"\n#ifdef __BORLANDC__"
+									"\n#pragma hdrstop"
+									"\n#endif //__BORLANDC__"
+									"\n"
+									"\n#ifndef WX_PRECOMP"
+									"\n#include <wx/wx.h>"
+									"\n#endif //WX_PRECOMP"
+								);
+				}
+				else
+				{
+					// use the newer block
+					prop->SetText(
+									  "#ifdef WX_PRECOMP"
+									"\n"
+									"\n#include \"" + pch + "\""
+									"\n"
+									"\n#ifdef __BORLANDC__"
+									"\n#pragma hdrstop"
+									"\n#endif //__BORLANDC__"
+									"\n"
+									"\n#else"
+									"\n#include <wx/wx.h>"
+									"\n#endif //WX_PRECOMP"
+								);
+				}
+				break;
+			}
+			case RULE_MOVE_TO_CHILDREN:
+			{
+				ticpp::Iterator< ticpp::Element > child( "object" );
+				for ( child = object->FirstChildElement( "object", false ); child != child.end(); ++child )
+				{
+					child->LinkEndChild( prop->Clone().get() );
+				}
+
+				properties->erase( found );
+				object->RemoveChild( prop );
+				break;
+			}
+			default:
+				break;
+		}
+	}
+}
+
+void ProjectConverter::ConvertSpacer( ticpp::Element* object, std::string* objClass, PropertyIndex* properties, const ConversionRule& rule )
+{
+	// the goal is to change the class to sizeritem, then create a spacer child, then move "width" and "height" to the spacer
+	*objClass = rule.target;
+	object->SetAttribute( "class", *objClass );
+
+	ticpp::Element spacer( "object" );
+	spacer.SetAttribute( "class", "spacer" );
+
+	std::vector< std::string >::const_iterator name;
+	for ( name = rule.properties.begin(); name != rule.properties.end(); ++name )
+	{
+		PropertyIndex::iterator found = properties->find( *name );
+		if ( found != properties->end() )
+		{
+			ticpp::Element* prop = found->second;
+			spacer.LinkEndChild( prop->Clone().release() );
+			properties->erase( found );
+			object->RemoveChild( prop );
+		}
+	}
+
+	object->LinkEndChild( &spacer );
+}
+
+void ProjectConverter::TransferOptions( ticpp::Element* object, PropertyIndex* properties, PropertyIndex::iterator source, const std::set< std::string >& options, const std::string& target )
+{
+	ticpp::Element* prop = source->second;
+	std::string value = prop->GetText( false );
+
+	std::set< std::string > transfer;
+	std::set< std::string > keep;
+
+	// Sort options - if in the 'options' set, they should be transferred to the 'target' property
+	// otherwise, they should stay
+	std::string::size_type start = 0;
+	while ( start < value.length() )
+	{
+		std::string::size_type end = value.find( '|', start );
+		std::string option = TrimOption( value.substr( start, end - start ) );
+
+		if ( options.find( option ) != options.end() )
+		{
+			// Needs to be transferred
+			transfer.insert( option );
+		}
+		else
+		{
+			// Should be kept
+			keep.insert( option );
+		}
+
+		if ( std::string::npos == end )
+		{
+			break;
+		}
+
+		start = end + 1;
+		if ( start == value.length() )
+		{
+			// Empty option after the last separator
+			keep.insert( std::string() );
+		}
+	}
+
+	// If there are any to transfer, add to the target property, or make a new one
+	if ( !transfer.empty() )
+	{
+		std::string newOptionList;
+
+		PropertyIndex::iterator existing = properties->find( target );
+		if ( existing != properties->end() )
+		{
+			newOptionList += "|" + existing->second->GetText( false );
+		}
+
+		std::set< std::string >::iterator option;
+		for ( option = transfer.begin(); option != transfer.end(); ++option )
+		{
+			newOptionList += "|" + *option;
+		}
+
+		if ( existing != properties->end() )
+		{
+			existing->second->SetText( newOptionList.substr( 1 ) );
+		}
+		else
+		{
+			ticpp::Element newProp( "property" );
+			newProp.SetAttribute( "name", target );
+			newProp.SetText( newOptionList.substr( 1 ) );
+
+			ticpp::Node* inserted = object->InsertBeforeChild( prop, newProp );
+			properties->insert( PropertyIndex::value_type( target, inserted->ToElement() ) );
+		}
+	}
+
+	// Set the value of the property to whatever is left
+	if ( keep.empty() )
+	{
+		properties->erase( source );
+		object->RemoveChild( prop );
+	}
+	else
+	{
+		std::string newOptionList;
+
+		std::set< std::string >::iterator option;
+		for ( option = keep.begin(); option != keep.end(); ++option )
+		{
+			newOptionList += "|" + *option;
+		}
+
+		prop->SetText( newOptionList.substr( 1 ) );
+	}
+}
+
+/**
+Files waiting to be converted by ConvertFiles.
+*/
+class ConversionQueue
+{
+private:
+	wxMutex m_mutex;
+	std::vector< ProjectConverter::FileResult >* m_results;
+	size_t m_next;
+	int m_major;
+	int m_minor;
+
+	ProjectConverter::FileResult* Next()
+	{
+		wxMutexLocker lock( m_mutex );
+		if ( m_next >= m_results->size() )
+		{
+			return NULL;
+		}
+		return &( *m_results )[ m_next++ ];
+	}
+
+public:
+	ConversionQueue( std::vector< ProjectConverter::FileResult >* results, int major, int minor )
+	:
+	m_results( results ),
+	m_next( 0 ),
+	m_major( major ),
+	m_minor( minor )
+	{
+	}
+
+	/**
+	Converts files until there are no more left, can be called from several threads.
+	*/
+	void Run()
+	{
+		ProjectConverter::FileResult* result;
+		while ( ( result = Next() ) != NULL )
+		{
+			ProjectConverter::ConvertFile( m_major, m_minor, result );
+		}
+	}
+};
+
+class ConversionThread : public wxThread
+{
+private:
+	ConversionQueue* m_queue;
+
+public:
+	ConversionThread( ConversionQueue* queue )
+	:
+	wxThread( wxTHREAD_JOINABLE ),
+	m_queue( queue )
+	{
+	}
+
+	ExitCode Entry()
+	{
+		m_queue->Run();
+		return 0;
+	}
+};
+
+void ProjectConverter::ConvertFiles( const std::vector< wxString >& files, int major, int minor, unsigned int jobs, std::vector< FileResult >* results )
+{
+	results->clear();
+	results->resize( files.size() );
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		( *results )[i].path = files[i];
+		( *results )[i].converted = false;
+		( *results )[i].additionsUpdated = false;
+	}
+
+	// Everything shared by the threads is set up before they start
+	GetSteps();
+	TiXmlBase::SetCondenseWhiteSpace( false );
+
+	if ( 0 == jobs )
+	{
+		int cpus = wxThread::GetCPUCount();
+		jobs = ( cpus > 0 ? (unsigned int)cpus : 1 );
+	}
+	if ( jobs > files.size() )
+	{
+		jobs = (unsigned int)files.size();
+	}
+
+	ConversionQueue queue( results, major, minor );
+
+	std::vector< ConversionThread* > threads;
+	for ( unsigned int i = 1; i < jobs; ++i )
+	{
+		ConversionThread* thread = new ConversionThread( &queue );
+		if ( thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR )
+		{
+			delete thread;
+			break;
+		}
+		threads.push_back( thread );
+	}
+
+	// This thread converts files too, and any left if the others could not be started
+	queue.Run();
+
+	std::vector< ConversionThread* >::iterator thread;
+	for ( thread = threads.begin(); thread != threads.end(); ++thread )
+	{
+		( *thread )->Wait();
+		delete *thread;
+	}
+}
+
+void ProjectConverter::ConvertFile( int major, int minor, FileResult* result )
+{
+	// Runs in the conversion threads: no messages, and nothing shared with other files
+	try
+	{
+		MappedFile file;
+		if ( !file.Load( result->path ) )
+		{
+			result->error = "Unable to open file";
+			return;
+		}
+
+		ticpp::Document doc;
+		doc.UseArena();
+		doc.Parse( file.GetText() );
+
+		// Other encodings have to be converted interactively, see XMLUtils::LoadXMLFile.
+		// Encoding names are not case sensitive.
+		ticpp::Declaration* declaration = doc.FirstChild()->ToDeclaration();
+		std::string encoding = declaration->Encoding();
+		std::transform( encoding.begin(), encoding.end(), encoding.begin(), ::toupper );
+		if ( encoding != "UTF-8" )
+		{
+			result->error = "The file is not UTF-8, open it in wxFormBuilder to convert it";
+			return;
+		}
+
+		ticpp::Element* root = doc.FirstChildElement();
+
+		int fileMajor, fileMinor;
+		GetFileVersion( root, &fileMajor, &fileMinor );
+
+		int comparison = CompareFileVersion( fileMajor, fileMinor, major, minor );
+		if ( comparison > 0 )
+		{
+			result->error = "The file is newer than this version of wxFormBuilder";
+			return;
+		}
+
+		if ( 0 == comparison )
+		{
+			// Already up to date
+			return;
+		}
+
+		// Keep the original contents as they were read
+		const std::string path( result->path.mb_str( wxConvFile ) );
+		FILE* backup = fopen( ( path + ".bak" ).c_str(), "wb" );
+		if ( NULL == backup )
+		{
+			result->error = "Unable to create the backup file";
+			return;
+		}
+		bool written = ( fwrite( file.GetData(), 1, file.GetLength(), backup ) == file.GetLength() );
+		written = ( 0 == fclose( backup ) ) && written;
+		if ( !written )
+		{
+			result->error = "Unable to write the backup file";
+			return;
+		}
+
+		// The document has its own copy of the contents, and the file can not
+		// be replaced while it is mapped on some platforms
+		file.Close();
+
+		ProjectConverter converter( fileMajor, fileMinor );
+		converter.ConvertDocument( &doc, major, minor );
+
+		// Same as ProjectSnapshot::Save, the file is only replaced once the
+		// whole document was written
+		wxString tempName = result->path + wxT(".tmp");
+		try
+		{
+			doc.SaveFile( path + ".tmp" );
+		}
+		catch ( ticpp::Exception& )
+		{
+			::wxRemoveFile( tempName );
+			throw;
+		}
+		if ( !::wxRenameFile( tempName, result->path, true ) )
+		{
+			::wxRemoveFile( tempName );
+			result->error = "Unable to replace the file";
+			return;
+		}
+
+		result->converted = true;
+		result->userHeaders = converter.GetUserHeaders();
+		result->additionsUpdated = converter.GetAdditionsUpdated();
+		result->propertiesRemoved = converter.GetPropertiesRemoved();
+	}
+	catch ( ticpp::Exception& ex )
+	{
+		result->error = ex.m_details;
+	}
+}
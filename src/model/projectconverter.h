@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_CONVERTER__
+#define __PROJECT_CONVERTER__
+
+#include <wx/string.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+
+/**
+Minor revision of the files which save forms in their own files, see the
+'form_files' property, or leave out the default values, see 'sparse_file'.
+Older versions of wxFormBuilder would silently load them without those forms,
+or with their own defaults for the missing values, so only these files are
+written with it. They are otherwise the same as those of version 1.13, and
+both are read without conversion.
+*/
+#define FBP_VERSION_MINOR_EXTENDED 14
+
+namespace ticpp
+{
+	class Document;
+	class Element;
+}
+
+struct ConversionStep;
+struct ConversionRule;
+
+/**
+Converts project files from older versions to the current one.
+
+The changes of each version are described by a table of rules (renamed
+classes and properties, options moved to other properties, properties in
+old formats or no longer supported), built once. A converter selects the
+steps newer than the file, and applies all of them to each object in a
+single visit, finding the properties of the object only once.
+
+The converter does not show any message, what the caller has to tell the
+user is kept until the conversion is done. Converters only use their own
+data, so several files can be converted at the same time.
+*/
+class ProjectConverter
+{
+public:
+	typedef std::map< std::string, std::set< std::string > > PropertiesRemoved;
+
+	/**
+	Result of the conversion of a file by ConvertFiles.
+	*/
+	struct FileResult
+	{
+		wxString path;
+		bool converted;
+		std::string error;
+		std::string userHeaders;
+		bool additionsUpdated;
+		PropertiesRemoved propertiesRemoved;
+	};
+
+private:
+	int m_fileMajor;
+	int m_fileMinor;
+	std::vector< const ConversionStep* > m_steps;
+
+	std::string m_userHeaders;
+	bool m_additionsUpdated;
+	PropertiesRemoved m_propertiesRemoved;
+
+	typedef std::map< std::string, ticpp::Element* > PropertyIndex;
+
+	void ConvertElement( ticpp::Element* object );
+	void ApplyRule( ticpp::Element* object, std::string* objClass, PropertyIndex* properties, const ConversionRule& rule );
+	void ConvertSpacer( ticpp::Element* object, std::string* objClass, PropertyIndex* properties, const ConversionRule& rule );
+
+	/**
+	Moves the @a options found in the text of @a source to the @a target
+	property, which is created if it doesn't exist. @a source is removed if
+	it has no options left.
+	*/
+	void TransferOptions( ticpp::Element* object, PropertyIndex* properties, PropertyIndex::iterator source, const std::set< std::string >& options, const std::string& target );
+
+	static const std::vector< ConversionStep >& GetSteps();
+
+public:
+	/**
+	@param fileMajor The major revision of the file.
+	@param fileMinor The minor revision of the file.
+	*/
+	ProjectConverter( int fileMajor, int fileMinor );
+
+	/**
+	Gets the version of a project document.
+	@param root The root element of the document.
+	*/
+	static void GetFileVersion( ticpp::Element* root, int* major, int* minor );
+
+	/**
+	Compares the version of a file with the current version @a major.@a minor,
+	files of version 1.14 are also current (see FBP_VERSION_MINOR_EXTENDED).
+	@return < 0 if the file must be converted, > 0 if it is newer than this
+	        version of wxFormBuilder, 0 if it is read as it is.
+	*/
+	static int CompareFileVersion( int fileMajor, int fileMinor, int major, int minor );
+
+	/**
+	Converts an object element and all its children.
+	*/
+	void ConvertObject( ticpp::Element* object );
+
+	/**
+	Converts a whole project document, and sets its version to @a major.@a minor.
+	Files older than version 1.0 are changed to the current layout.
+	*/
+	void ConvertDocument( ticpp::Document* doc, int major, int minor );
+
+	/**
+	Value of the removed "user_headers" property, if it had one.
+	*/
+	const std::string& GetUserHeaders() const { return m_userHeaders; }
+
+	/**
+	Whether classes from wxAdditions were renamed.
+	*/
+	bool GetAdditionsUpdated() const { return m_additionsUpdated; }
+
+	/**
+	Classes which had properties removed, with the properties no longer supported.
+	*/
+	const PropertiesRemoved& GetPropertiesRemoved() const { return m_propertiesRemoved; }
+
+	/**
+	Converts project files to version @a major.@a minor, using up to @a jobs
+	threads. Each converted file is saved over the original, which is kept
+	with the ".bak" extension. Files of the current version are not changed.
+	@param results Receives the result of each file, in the order of @a files.
+	*/
+	static void ConvertFiles( const std::vector< wxString >& files, int major, int minor, unsigned int jobs, std::vector< FileResult >* results );
+
+	/**
+	Converts a project file, see ConvertFiles.
+	*/
+	static void ConvertFile( int major, int minor, FileResult* result );
+};
+
+#endif //__PROJECT_CONVERTER__
@@ -0,0 +1,712 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectjournal.h"
+#include "model/objectbase.h"
+#include "model/projectcache.h"
+#include "utils/mappedfile.h"
+#include "utils/stringutils.h"
+#include "utils/typeconv.h"
+#include "utils/debug.h"
+
+#include <ticpp.h>
+#include <wx/filefn.h>
+#include <algorithm>
+
+// Change the last character when the format changes
+#define JOURNAL_MAGIC "wxFBPJ1"
+#define JOURNAL_MAGIC_SIZE 8
+#define JOURNAL_HEADER_SIZE ( JOURNAL_MAGIC_SIZE + 16 )
+
+/*
+Format, all numbers are unsigned, stored as LEB128 unless noted:
+
+	magic		JOURNAL_MAGIC, null terminated
+	hash		project file hash, 8 bytes little endian
+	length		project file length, 8 bytes little endian
+	records		until the end of the file
+
+Each record is stored as the length of its contents, the low 32 bits of
+their hash (4 bytes little endian), to find records which were not written
+completely, and the contents: the record type and its values. Strings are
+stored as their length and UTF-8 bytes, paths as their length and the
+positions.
+*/
+
+static void WriteHeaderValue( std::string* buffer, wxUint64 value, int size )
+{
+	for ( int i = 0; i < size; ++i )
+	{
+		*buffer += (char)( value & 0xFF );
+		value >>= 8;
+	}
+}
+
+static wxUint64 ReadHeaderValue( const unsigned char* data, int size )
+{
+	wxUint64 value = 0;
+	for ( int i = size - 1; i >= 0; --i )
+	{
+		value = ( value << 8 ) | data[i];
+	}
+	return value;
+}
+
+ProjectJournal::ProjectJournal( PObjectDatabase objDb )
+:
+m_objDb( objDb ),
+m_cur( NULL ),
+m_end( NULL )
+{
+}
+
+ProjectJournal::~ProjectJournal()
+{
+	// Closed, not removed: only a deliberate Discard removes the changes
+	m_file.Close();
+}
+
+wxString ProjectJournal::GetJournalPath( const wxString& projectFile )
+{
+	return projectFile + wxT(".journal");
+}
+
+void ProjectJournal::Fail()
+{
+	LogDebug( wxT("Journal of %s stopped"), m_projectFile.c_str() );
+	Discard();
+}
+
+void ProjectJournal::Discard()
+{
+	if ( m_file.IsOpened() )
+	{
+		m_file.Close();
+	}
+
+	if ( !m_projectFile.empty() )
+	{
+		wxString path = GetJournalPath( m_projectFile );
+		if ( ::wxFileExists( path ) )
+		{
+			::wxRemoveFile( path );
+		}
+		m_projectFile.clear();
+	}
+}
+
+bool ProjectJournal::Start( const wxString& projectFile )
+{
+	if ( m_file.IsOpened() )
+	{
+		m_file.Close();
+	}
+	m_projectFile = projectFile;
+
+	wxUint64 hash, length;
+	if ( !ProjectCache::HashFile( projectFile, &hash, &length ) )
+	{
+		m_projectFile.clear();
+		return false;
+	}
+
+	std::string header( JOURNAL_MAGIC, JOURNAL_MAGIC_SIZE );
+	WriteHeaderValue( &header, hash, 8 );
+	WriteHeaderValue( &header, length, 8 );
+
+	if ( !m_file.Open( GetJournalPath( projectFile ), wxT("w+b") ) ||
+		 m_file.Write( header.data(), header.size() ) != header.size() ||
+		 !m_file.Flush() )
+	{
+		Fail();
+		return false;
+	}
+
+	return true;
+}
+
+bool ProjectJournal::Restart( const wxString& projectFile, wxFileOffset position )
+{
+	std::string changes;
+	if ( m_file.IsOpened() && position != wxInvalidOffset )
+	{
+		wxFileOffset end = m_file.Tell();
+		if ( position < JOURNAL_HEADER_SIZE || position > end || !m_file.Seek( position ) )
+		{
+			// The changes can't be kept, not recording them at all is safer
+			Fail();
+			return false;
+		}
+
+		changes.resize( (size_t)( end - position ) );
+		if ( !changes.empty() && m_file.Read( &changes[0], changes.size() ) != changes.size() )
+		{
+			Fail();
+			return false;
+		}
+	}
+
+	// Replaces the journal of the previous file, which could have another name
+	Discard();
+	if ( !Start( projectFile ) )
+	{
+		return false;
+	}
+
+	if ( !changes.empty() && ( m_file.Write( changes.data(), changes.size() ) != changes.size() || !m_file.Flush() ) )
+	{
+		Fail();
+		return false;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Writing
+
+void ProjectJournal::BeginRecord( RecordType type )
+{
+	m_record.clear();
+	m_record += (char)type;
+}
+
+void ProjectJournal::EndRecord()
+{
+	std::string frame;
+	WriteNumber( &frame, (unsigned int)m_record.size() );
+	WriteHeaderValue( &frame, StringUtils::Hash( m_record.data(), m_record.size() ), 4 );
+	frame += m_record;
+
+	// Flushed right away, a crash must not lose what is in the buffers
+	if ( m_file.Write( frame.data(), frame.size() ) != frame.size() || !m_file.Flush() )
+	{
+		Fail();
+	}
+}
+
+void ProjectJournal::WriteNumber( std::string* buffer, unsigned int value )
+{
+	while ( value >= 0x80 )
+	{
+		*buffer += (char)( ( value & 0x7F ) | 0x80 );
+		value >>= 7;
+	}
+	*buffer += (char)value;
+}
+
+void ProjectJournal::WriteString( const std::string& str )
+{
+	WriteNumber( &m_record, (unsigned int)str.size() );
+	m_record += str;
+}
+
+void ProjectJournal::WritePath( const Path& path )
+{
+	WriteNumber( &m_record, (unsigned int)path.size() );
+	for ( Path::const_iterator position = path.begin(); position != path.end(); ++position )
+	{
+		WriteNumber( &m_record, *position );
+	}
+}
+
+bool ProjectJournal::GetPath( PObjectBase object, Path* path )
+{
+	path->clear();
+
+	PObjectBase parent = object->GetParent();
+	while ( parent )
+	{
+		path->push_back( parent->GetChildPosition( object ) );
+		object = parent;
+		parent = object->GetParent();
+	}
+
+	if ( object->GetObjectTypeName() != wxT("project") )
+	{
+		return false;
+	}
+
+	std::reverse( path->begin(), path->end() );
+	return true;
+}
+
+void ProjectJournal::ObjectInserted( PObjectBase object )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	if ( !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	ticpp::Document doc;
+	ticpp::Element element;
+	object->SerializeObject( &element );
+	doc.LinkEndChild( &element );
+
+	TiXmlPrinter printer;
+	printer.SetStreamPrinting();
+	doc.Accept( &printer );
+
+	unsigned int position = path.back();
+	path.pop_back();
+
+	BeginRecord( RECORD_INSERT );
+	WritePath( path );
+	WriteNumber( &m_record, position );
+	WriteString( printer.Str() );
+	EndRecord();
+}
+
+void ProjectJournal::ObjectRemoving( PObjectBase object )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	if ( !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	BeginRecord( RECORD_REMOVE );
+	WritePath( path );
+	EndRecord();
+}
+
+void ProjectJournal::ObjectMoved( const Path& oldPath, PObjectBase object )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	if ( !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	unsigned int position = path.back();
+	path.pop_back();
+
+	BeginRecord( RECORD_MOVE );
+	WritePath( oldPath );
+	WritePath( path );
+	WriteNumber( &m_record, position );
+	EndRecord();
+}
+
+void ProjectJournal::PropertyModified( PProperty property )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	PObjectBase object = property->GetObject();
+	if ( !object || !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	BeginRecord( RECORD_PROPERTY );
+	WritePath( path );
+	WriteString( property->GetPropertyInfo()->GetUtf8Name() );
+	WriteString( property->GetUtf8Value() );
+	EndRecord();
+}
+
+void ProjectJournal::EventModified( PEvent event )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	PObjectBase object = event->GetObject();
+	if ( !object || !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	BeginRecord( RECORD_EVENT );
+	WritePath( path );
+	WriteString( event->GetEventInfo()->GetUtf8Name() );
+	WriteString( _STDSTR( event->GetValue() ) );
+	EndRecord();
+}
+
+void ProjectJournal::ObjectExpanded( PObjectBase object )
+{
+	if ( !IsActive() )
+	{
+		return;
+	}
+
+	Path path;
+	if ( !GetPath( object, &path ) )
+	{
+		Fail();
+		return;
+	}
+
+	BeginRecord( RECORD_EXPAND );
+	WritePath( path );
+	WriteNumber( &m_record, object->GetExpanded() ? 1 : 0 );
+	EndRecord();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Reading
+
+bool ProjectJournal::ReadHeader( const MappedFile& journal, const wxString& projectFile )
+{
+	if ( journal.GetLength() < JOURNAL_HEADER_SIZE || memcmp( journal.GetData(), JOURNAL_MAGIC, JOURNAL_MAGIC_SIZE ) != 0 )
+	{
+		return false;
+	}
+
+	// Changes to any other contents of the project file can't be replayed
+	wxUint64 hash, length;
+	if ( !ProjectCache::HashFile( projectFile, &hash, &length ) )
+	{
+		return false;
+	}
+
+	const unsigned char* data = reinterpret_cast< const unsigned char* >( journal.GetData() ) + JOURNAL_MAGIC_SIZE;
+	return ( ReadHeaderValue( data, 8 ) == hash && ReadHeaderValue( data + 8, 8 ) == length );
+}
+
+bool ProjectJournal::NextRecord( const unsigned char** cur, const unsigned char* end, const unsigned char** payload, size_t* length )
+{
+	const unsigned char* next = *cur;
+	unsigned int size;
+	if ( !ReadNumber( &next, end, &size ) || (size_t)( end - next ) < 4 + (size_t)size || 0 == size )
+	{
+		// The end of the journal, or a record which was not completely written
+		return false;
+	}
+
+	wxUint64 hash = ReadHeaderValue( next, 4 );
+	const unsigned char* data = next + 4;
+	if ( ( StringUtils::Hash( data, size ) & 0xFFFFFFFF ) != hash )
+	{
+		return false;
+	}
+
+	*payload = data;
+	*length = size;
+	*cur = data + size;
+	return true;
+}
+
+bool ProjectJournal::CanRecover( const wxString& projectFile )
+{
+	wxString path = GetJournalPath( projectFile );
+	if ( !::wxFileExists( path ) )
+	{
+		return false;
+	}
+
+	MappedFile journal;
+	if ( !journal.Load( path ) || !ReadHeader( journal, projectFile ) )
+	{
+		return false;
+	}
+
+	const unsigned char* cur = reinterpret_cast< const unsigned char* >( journal.GetData() ) + JOURNAL_HEADER_SIZE;
+	const unsigned char* end = reinterpret_cast< const unsigned char* >( journal.GetData() ) + journal.GetLength();
+	const unsigned char* payload;
+	size_t length;
+	return NextRecord( &cur, end, &payload, &length );
+}
+
+bool ProjectJournal::ReadNumber( const unsigned char** cur, const unsigned char* end, unsigned int* value )
+{
+	*value = 0;
+	for ( unsigned int shift = 0; shift < 32; shift += 7 )
+	{
+		if ( *cur == end )
+		{
+			return false;
+		}
+
+		unsigned char byte = *( *cur )++;
+		*value |= (unsigned int)( byte & 0x7F ) << shift;
+		if ( 0 == ( byte & 0x80 ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ProjectJournal::ReadNumber( unsigned int* value )
+{
+	return ReadNumber( &m_cur, m_end, value );
+}
+
+bool ProjectJournal::ReadString( std::string* str )
+{
+	unsigned int length;
+	if ( !ReadNumber( &length ) || (size_t)( m_end - m_cur ) < length )
+	{
+		return false;
+	}
+
+	str->assign( reinterpret_cast< const char* >( m_cur ), length );
+	m_cur += length;
+	return true;
+}
+
+bool ProjectJournal::ReadPath( Path* path )
+{
+	unsigned int count;
+	if ( !ReadNumber( &count ) || (size_t)( m_end - m_cur ) < count )
+	{
+		return false;
+	}
+
+	path->resize( count );
+	for ( unsigned int i = 0; i < count; ++i )
+	{
+		if ( !ReadNumber( &( *path )[i] ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+PObjectBase ProjectJournal::FindObject( PObjectBase project, const Path& path )
+{
+	PObjectBase object = project;
+	for ( Path::const_iterator position = path.begin(); position != path.end(); ++position )
+	{
+		if ( *position >= object->GetChildCount() )
+		{
+			return PObjectBase();
+		}
+		object = object->GetChild( *position );
+	}
+	return object;
+}
+
+bool ProjectJournal::Replay( PObjectBase project )
+{
+	if ( m_cur == m_end )
+	{
+		return false;
+	}
+
+	unsigned char type = *m_cur++;
+
+	Path path;
+	if ( !ReadPath( &path ) )
+	{
+		return false;
+	}
+
+	PObjectBase object = FindObject( project, path );
+	if ( !object )
+	{
+		return false;
+	}
+
+	switch ( type )
+	{
+		case RECORD_INSERT:
+		{
+			unsigned int position;
+			std::string xml;
+			if ( !ReadNumber( &position ) || !ReadString( &xml ) || position > object->GetChildCount() )
+			{
+				return false;
+			}
+
+			ticpp::Document doc;
+			doc.Parse( xml, true, TIXML_ENCODING_UTF8 );
+
+			PObjectBase child = m_objDb->CreateObject( doc.FirstChildElement() );
+			if ( !child )
+			{
+				return false;
+			}
+
+			object->AddChild( child );
+			child->SetParent( object );
+			object->ChangeChildPosition( child, position );
+			return true;
+		}
+		case RECORD_REMOVE:
+		{
+			PObjectBase parent = object->GetParent();
+			if ( !parent )
+			{
+				return false;
+			}
+
+			parent->RemoveChild( object );
+			object->SetParent( PObjectBase() );
+			return true;
+		}
+		case RECORD_MOVE:
+		{
+			Path parentPath;
+			unsigned int position;
+			PObjectBase oldParent = object->GetParent();
+			if ( !oldParent || !ReadPath( &parentPath ) || !ReadNumber( &position ) )
+			{
+				return false;
+			}
+
+			// The new parent is found without the object, like it was when it was moved
+			oldParent->RemoveChild( object );
+			PObjectBase parent = FindObject( project, parentPath );
+			if ( !parent || position > parent->GetChildCount() )
+			{
+				return false;
+			}
+
+			parent->AddChild( object );
+			object->SetParent( parent );
+			parent->ChangeChildPosition( object, position );
+			return true;
+		}
+		case RECORD_PROPERTY:
+		case RECORD_EVENT:
+		{
+			std::string name, value;
+			if ( !ReadString( &name ) || !ReadString( &value ) )
+			{
+				return false;
+			}
+
+			if ( RECORD_PROPERTY == type )
+			{
+				PProperty property = object->GetProperty( _WXSTR( name ) );
+				if ( !property )
+				{
+					return false;
+				}
+				property->SetUtf8Value( value );
+			}
+			else
+			{
+				PEvent event = object->GetEvent( _WXSTR( name ) );
+				if ( !event )
+				{
+					return false;
+				}
+				event->SetValue( _WXSTR( value ) );
+			}
+			return true;
+		}
+		case RECORD_EXPAND:
+		{
+			unsigned int expanded;
+			if ( !ReadNumber( &expanded ) )
+			{
+				return false;
+			}
+
+			object->SetExpanded( expanded != 0 );
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+bool ProjectJournal::Recover( const wxString& projectFile, PObjectBase project, unsigned int* changes )
+{
+	*changes = 0;
+
+	if ( m_file.IsOpened() )
+	{
+		m_file.Close();
+	}
+	m_projectFile.clear();
+
+	wxString path = GetJournalPath( projectFile );
+	std::string valid;
+	{
+		MappedFile journal;
+		if ( !journal.Load( path ) || !ReadHeader( journal, projectFile ) )
+		{
+			return false;
+		}
+
+		const unsigned char* begin = reinterpret_cast< const unsigned char* >( journal.GetData() );
+		const unsigned char* cur = begin + JOURNAL_HEADER_SIZE;
+		const unsigned char* end = begin + journal.GetLength();
+		const unsigned char* payload;
+		size_t length;
+
+		try
+		{
+			while ( NextRecord( &cur, end, &payload, &length ) )
+			{
+				m_cur = payload;
+				m_end = payload + length;
+				if ( !Replay( project ) )
+				{
+					return false;
+				}
+				++( *changes );
+			}
+		}
+		catch ( ticpp::Exception& )
+		{
+			return false;
+		}
+
+		m_cur = m_end = NULL;
+		valid.assign( journal.GetData(), cur - begin );
+	}
+
+	// New changes go after the last complete record, a record which was not
+	// completely written is dropped
+	m_projectFile = projectFile;
+	if ( !m_file.Open( path, wxT("w+b") ) ||
+		 m_file.Write( valid.data(), valid.size() ) != valid.size() ||
+		 !m_file.Flush() )
+	{
+		Fail();
+	}
+
+	return true;
+}
@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_JOURNAL__
+#define __PROJECT_JOURNAL__
+
+#include "utils/wxfbdefs.h"
+#include "model/database.h"
+#include <wx/ffile.h>
+#include <string>
+#include <vector>
+
+class MappedFile;
+
+/**
+Record of the changes made to a project since it was last saved.
+
+Every change made by a Command is appended to a file next to the project as
+soon as it is done, so the work is not lost if wxFormBuilder does not close
+normally. The journal only applies to the saved project file it was started
+for, it is emptied each time the project is saved, and removed when the
+project is closed.
+
+Objects are referred to by their path, the position of each object from the
+project down to them, so the changes have to be replayed in order.
+*/
+class ProjectJournal
+{
+public:
+	typedef std::vector< unsigned int > Path;
+
+private:
+	enum RecordType
+	{
+		RECORD_INSERT = 1,	// parent path, position, object as XML
+		RECORD_REMOVE,		// path
+		RECORD_MOVE,		// path, new parent path, position
+		RECORD_PROPERTY,	// path, name, value
+		RECORD_EVENT,		// path, name, value
+		RECORD_EXPAND		// path, expanded
+	};
+
+	PObjectDatabase m_objDb;
+	wxString m_projectFile;
+	wxFFile m_file;
+	std::string m_record;
+
+	// Reading
+	const unsigned char* m_cur;
+	const unsigned char* m_end;
+
+	void BeginRecord( RecordType type );
+	void EndRecord();
+	static void WriteNumber( std::string* buffer, unsigned int value );
+	void WriteString( const std::string& str );
+	void WritePath( const Path& path );
+
+	static bool ReadNumber( const unsigned char** cur, const unsigned char* end, unsigned int* value );
+	bool ReadNumber( unsigned int* value );
+	bool ReadString( std::string* str );
+	bool ReadPath( Path* path );
+
+	static bool ReadHeader( const MappedFile& journal, const wxString& projectFile );
+	static bool NextRecord( const unsigned char** cur, const unsigned char* end, const unsigned char** payload, size_t* length );
+
+	static PObjectBase FindObject( PObjectBase project, const Path& path );
+	bool Replay( PObjectBase project );
+
+	/**
+	Stops journaling after an error, a journal with missing changes must not be replayed.
+	*/
+	void Fail();
+
+	// Don't copy
+	ProjectJournal( const ProjectJournal& );
+	ProjectJournal& operator=( const ProjectJournal& );
+
+public:
+	ProjectJournal( PObjectDatabase objDb );
+	~ProjectJournal();
+
+	static wxString GetJournalPath( const wxString& projectFile );
+
+	/**
+	Starts an empty journal for the saved contents of @a projectFile.
+	@return false if the journal could not be created, changes will not be recorded.
+	*/
+	bool Start( const wxString& projectFile );
+
+	/**
+	Starts the journal again for the contents of @a projectFile, just saved,
+	keeping the changes recorded since @a position. Used when the project was
+	changed while it was being saved, those changes are not in the file.
+	*/
+	bool Restart( const wxString& projectFile, wxFileOffset position );
+
+	/**
+	Position where the next change will be recorded, for Restart.
+	*/
+	wxFileOffset GetPosition() { return m_file.IsOpened() ? m_file.Tell() : wxInvalidOffset; }
+
+	/**
+	Checks if there is a journal with changes for the saved contents of @a projectFile.
+	*/
+	static bool CanRecover( const wxString& projectFile );
+
+	/**
+	Applies the changes of the journal to @a project, which must have just
+	been loaded from @a projectFile. The journal is kept, and new changes
+	are appended to it.
+	@param changes Receives the number of changes applied.
+	@return false if some change could not be applied, @a project has to be
+	        loaded again.
+	*/
+	bool Recover( const wxString& projectFile, PObjectBase project, unsigned int* changes );
+
+	/**
+	Stops recording and removes the journal, its changes are not wanted.
+	*/
+	void Discard();
+
+	bool IsActive() const { return m_file.IsOpened(); }
+
+	/**
+	Gets the path of an object in the project.
+	@return false if the object is not in the project.
+	*/
+	static bool GetPath( PObjectBase object, Path* path );
+
+	void ObjectInserted( PObjectBase object );
+	void ObjectRemoving( PObjectBase object );
+	void ObjectMoved( const Path& oldPath, PObjectBase object );
+	void PropertyModified( PProperty property );
+	void EventModified( PEvent event );
+	void ObjectExpanded( PObjectBase object );
+};
+
+#endif //__PROJECT_JOURNAL__
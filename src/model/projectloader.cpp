@@ -0,0 +1,613 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectloader.h"
+#include "projectconverter.h"
+#include "model/objectbase.h"
+#include "utils/typeconv.h"
+#include "utils/debug.h"
+#include "utils/wxfbexception.h"
+#include <wx/filename.h>
+#include <cstdlib>
+
+#define ROOT_TAG "wxFormBuilder_Project"
+#define FORM_ROOT_TAG "wxFormBuilder_Form"
+#define FORM_TAG "form"
+#define FILE_TAG "file"
+#define FILEVERSION_TAG "FileVersion"
+#define DEFAULTS_TAG "Defaults"
+#define PACKAGE_TAG "package"
+#define VERSION_TAG "version"
+#define OBJECT_TAG "object"
+#define PROPERTY_TAG "property"
+#define EVENT_TAG "event"
+#define NAME_TAG "name"
+#define CLASS_TAG "class"
+#define EXPANDED_TAG "expanded"
+
+struct PendingValue
+{
+	std::string name;
+	std::string value;
+	bool event;
+};
+
+struct PendingObject
+{
+	std::string className;
+	bool expanded;
+	std::vector< PendingValue > values;
+	unsigned int childCount;
+};
+
+/**
+Objects inside a form, stored in document order, as they were read.
+*/
+class PendingChildren : public ChildrenLoader
+{
+private:
+	PObjectDatabase m_objDb;
+
+	// Versions of the defaults of a sparse file
+	bool m_sparse;
+	ObjectDatabase::DefaultsVersionMap m_defaultsVersions;
+
+	void BuildObject( PObjectBase parent, size_t* index );
+	void SkipObject( size_t* index );
+
+public:
+	std::vector< PendingObject > m_objects;
+	unsigned int m_count; // children of the form
+
+	PendingChildren( PObjectDatabase objDb, bool sparse, const ObjectDatabase::DefaultsVersionMap& defaultsVersions )
+	:
+	m_objDb( objDb ),
+	m_sparse( sparse ),
+	m_defaultsVersions( defaultsVersions ),
+	m_count( 0 )
+	{
+	}
+
+	void LoadChildren( PObjectBase object );
+};
+
+void PendingChildren::LoadChildren( PObjectBase object )
+{
+	// The objects were counted when the form was loaded
+	ObjectDatabase::CountedObjects counted( m_objDb.get() );
+
+	size_t index = 0;
+	for ( unsigned int i = 0; i < m_count; i++ )
+	{
+		BuildObject( object, &index );
+	}
+
+	// Not needed anymore
+	std::vector< PendingObject >().swap( m_objects );
+	m_count = 0;
+}
+
+void PendingChildren::SkipObject( size_t* index )
+{
+	const PendingObject& pending = m_objects[ (*index)++ ];
+	for ( unsigned int i = 0; i < pending.childCount; i++ )
+	{
+		SkipObject( index );
+	}
+}
+
+void PendingChildren::BuildObject( PObjectBase parent, size_t* index )
+{
+	size_t current = *index;
+	const PendingObject& pending = m_objects[ current ];
+
+	ProjectLoader::ObjectFrame frame;
+	if ( !ProjectLoader::CreateObject( m_objDb, pending.className, pending.expanded, parent, m_sparse ? &m_defaultsVersions : NULL, &frame ) )
+	{
+		m_objDb->CountDropped();
+		SkipObject( index );
+		return;
+	}
+	++(*index);
+
+	std::vector< PendingValue >::const_iterator value;
+	for ( value = pending.values.begin(); value != pending.values.end(); ++value )
+	{
+		ProjectLoader::SetValue( m_objDb, frame.object, _WXSTR( value->name ), value->value, value->event );
+	}
+
+	for ( unsigned int i = 0; i < pending.childCount; i++ )
+	{
+		BuildObject( frame.object, index );
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+ProjectLoader::ProjectLoader( PObjectDatabase objDb, int verMajor, int verMinor )
+:
+m_objDb( objDb ),
+m_verMajor( verMajor ),
+m_verMinor( verMinor ),
+m_utf8( false ),
+m_versionChecked( false ),
+m_needsDocument( false ),
+m_sparse( false ),
+m_formFile( false ),
+m_valueFound( false )
+{
+}
+
+bool ProjectLoader::Load( const wxString& path )
+{
+	m_utf8 = false;
+	m_versionChecked = false;
+	m_needsDocument = false;
+	m_sparse = false;
+	m_defaultsVersions.clear();
+	m_formFile = false;
+	m_form.reset();
+	m_path = path;
+	m_project.reset();
+	m_formFiles.clear();
+	m_elements.clear();
+	m_objects.clear();
+	m_pending.reset();
+	m_pendingObjects.clear();
+
+	XMLReader reader( this );
+	bool completed = reader.ParseFile( path );
+
+	if ( !completed || m_needsDocument || !m_project )
+	{
+		LogDebug( wxT("[ProjectLoader::Load] %s needs to be loaded through the DOM"), path.c_str() );
+		m_project.reset();
+		m_formFiles.clear();
+		return false;
+	}
+
+	return true;
+}
+
+PObjectBase ProjectLoader::LoadForm( const wxString& path, PObjectBase project )
+{
+	m_utf8 = false;
+	m_versionChecked = false;
+	m_needsDocument = false;
+	m_sparse = false;
+	m_defaultsVersions.clear();
+	m_formFile = true;
+	m_form.reset();
+	m_path = path;
+	m_project = project;
+	m_formFiles.clear();
+	m_elements.clear();
+	m_objects.clear();
+	m_pending.reset();
+	m_pendingObjects.clear();
+
+	// The form is built as a child of the project, like in project files
+	ObjectFrame frame;
+	frame.newobject = project;
+	frame.object = project;
+	m_objects.push_back( frame );
+
+	XMLReader reader( this );
+	bool completed = reader.ParseFile( path );
+
+	if ( !completed || m_needsDocument || !m_form )
+	{
+		LogDebug( wxT("[ProjectLoader::LoadForm] %s is not a form file"), path.c_str() );
+		if ( m_form )
+		{
+			project->RemoveChild( m_form );
+			m_form->SetParent( PObjectBase() );
+		}
+		return PObjectBase();
+	}
+
+	return m_form;
+}
+
+void ProjectLoader::LoadFormReference( const XMLAttributes& attributes )
+{
+	std::string file;
+	XMLReader::GetAttribute( attributes, FILE_TAG, &file );
+
+	// Stored relative to the project, with '/' as separator
+	wxFileName name( _WXSTR( file ), wxPATH_UNIX );
+	name.MakeAbsolute( ::wxPathOnly( m_path ) );
+	wxString path = name.GetFullPath();
+
+	ProjectLoader loader( m_objDb, m_verMajor, m_verMinor );
+	PObjectBase form = loader.LoadForm( path, m_project );
+	if ( !form )
+	{
+		THROW_WXFBEX( _("Unable to load the form file: ") << path )
+	}
+
+	m_formFiles[ form ] = path;
+}
+
+const wxString& ProjectLoader::GetName( const std::string& name )
+{
+	NameMap::iterator it = m_names.find( name );
+	if ( it == m_names.end() )
+	{
+		it = m_names.insert( NameMap::value_type( name, _WXSTR( name ) ) ).first;
+	}
+	return it->second;
+}
+
+bool ProjectLoader::OnDeclaration( const XMLAttributes& attributes )
+{
+	std::string encoding;
+	XMLReader::GetAttribute( attributes, "encoding", &encoding );
+
+	wxString name = _WXSTR( encoding ).Lower();
+	m_utf8 = ( wxT("utf-8") == name || wxT("utf8") == name );
+
+	// The DOM path takes care of the conversion to UTF-8
+	if ( !m_utf8 )
+	{
+		m_needsDocument = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool ProjectLoader::OnStartElement( const std::string& name, const XMLAttributes& attributes )
+{
+	if ( m_elements.empty() )
+	{
+		// Files without declaration, or from versions with "object" as root
+		if ( !m_utf8 || name != ( m_formFile ? FORM_ROOT_TAG : ROOT_TAG ) )
+		{
+			m_needsDocument = true;
+			return false;
+		}
+
+		m_elements.push_back( ELEMENT_OTHER );
+		return true;
+	}
+
+	ElementKind parent = m_elements.back();
+	if ( ELEMENT_SKIPPED == parent )
+	{
+		m_elements.push_back( ELEMENT_SKIPPED );
+		return true;
+	}
+
+	if ( 1 == m_elements.size() )
+	{
+		if ( FILEVERSION_TAG == name )
+		{
+			std::string major, minor;
+			XMLReader::GetAttribute( attributes, "major", &major );
+			XMLReader::GetAttribute( attributes, "minor", &minor );
+			m_versionChecked = true;
+
+			// Older files must be converted, and newer files rejected
+			if ( ProjectConverter::CompareFileVersion( atoi( major.c_str() ), atoi( minor.c_str() ), m_verMajor, m_verMinor ) != 0 )
+			{
+				m_needsDocument = true;
+				return false;
+			}
+
+			m_elements.push_back( ELEMENT_OTHER );
+			return true;
+		}
+
+		// Before the objects, which need the versions of the defaults
+		if ( DEFAULTS_TAG == name )
+		{
+			m_sparse = true;
+			m_elements.push_back( ELEMENT_DEFAULTS );
+			return true;
+		}
+
+		if ( OBJECT_TAG == name )
+		{
+			if ( !m_versionChecked )
+			{
+				m_needsDocument = true;
+				return false;
+			}
+
+			// Only the first object is the project, or the form in form files
+			if ( m_formFile ? !m_form : !m_project )
+			{
+				return StartObject( attributes );
+			}
+		}
+	}
+	else if ( ELEMENT_OBJECT == parent )
+	{
+		if ( OBJECT_TAG == name )
+		{
+			// The objects of the forms (the project is the first object)
+			// are built when they are needed
+			if ( 2 == m_objects.size() )
+			{
+				StartPendingObject( attributes );
+				return true;
+			}
+			return StartObject( attributes );
+		}
+
+		// Forms saved in their own files
+		if ( FORM_TAG == name && 1 == m_objects.size() && !m_formFile )
+		{
+			LoadFormReference( attributes );
+			m_elements.push_back( ELEMENT_SKIPPED );
+			return true;
+		}
+
+		if ( PROPERTY_TAG == name || EVENT_TAG == name )
+		{
+			StartValue( attributes, PROPERTY_TAG == name ? ELEMENT_PROPERTY : ELEMENT_EVENT );
+			return true;
+		}
+	}
+	else if ( ELEMENT_DEFAULTS == parent )
+	{
+		if ( PACKAGE_TAG == name )
+		{
+			std::string package, version;
+			XMLReader::GetAttribute( attributes, NAME_TAG, &package );
+			XMLReader::GetAttribute( attributes, VERSION_TAG, &version );
+			m_defaultsVersions[ package ] = atoi( version.c_str() );
+		}
+	}
+	else if ( ELEMENT_PENDING_OBJECT == parent )
+	{
+		if ( OBJECT_TAG == name )
+		{
+			StartPendingObject( attributes );
+			return true;
+		}
+
+		if ( PROPERTY_TAG == name || EVENT_TAG == name )
+		{
+			StartValue( attributes, PROPERTY_TAG == name ? ELEMENT_PENDING_PROPERTY : ELEMENT_PENDING_EVENT );
+			return true;
+		}
+	}
+
+	m_elements.push_back( ELEMENT_SKIPPED );
+	return true;
+}
+
+bool ProjectLoader::CreateObject( PObjectDatabase objDb, const std::string& className, bool expanded, PObjectBase parent,
+								  const ObjectDatabase::DefaultsVersionMap* defaults, ObjectFrame* frame )
+{
+	frame->newobject = objDb->CreateObject( className, parent );
+
+	// It is possible the CreateObject returns an "item" containing the object, e.g. SizerItem or SplitterItem
+	// If that is the case, reassign "object" to the actual object
+	frame->object = frame->newobject;
+	if ( frame->object && frame->object->GetChildCount() > 0 )
+	{
+		frame->object = frame->object->GetChild( 0 );
+	}
+
+	if ( !frame->object )
+	{
+		return false;
+	}
+
+	// Get the state of expansion in the object tree
+	frame->object->SetExpanded( expanded );
+
+	// Before the values of the file are loaded
+	if ( defaults )
+	{
+		objDb->RestoreDefaults( frame->object, *defaults );
+	}
+
+	if ( parent )
+	{
+		// set up parent/child relationship
+		parent->AddChild( frame->newobject );
+		frame->newobject->SetParent( parent );
+	}
+
+	return true;
+}
+
+bool ProjectLoader::StartObject( const XMLAttributes& attributes )
+{
+	std::string class_name;
+	XMLReader::GetAttribute( attributes, CLASS_TAG, &class_name );
+
+	std::string expanded;
+	bool isExpanded = !XMLReader::GetAttribute( attributes, EXPANDED_TAG, &expanded ) || expanded != "0";
+
+	PObjectBase parent;
+	if ( !m_objects.empty() )
+	{
+		parent = m_objects.back().object;
+	}
+
+	ObjectFrame frame;
+	if ( !CreateObject( m_objDb, class_name, isExpanded, parent, m_sparse ? &m_defaultsVersions : NULL, &frame ) )
+	{
+		// Same as the DOM loader, the whole subtree is ignored
+		m_objDb->CountDropped();
+		m_elements.push_back( ELEMENT_SKIPPED );
+		return true;
+	}
+
+	if ( !parent )
+	{
+		m_project = frame.newobject;
+	}
+	else if ( m_formFile && 1 == m_objects.size() )
+	{
+		m_form = frame.newobject;
+	}
+
+	m_objects.push_back( frame );
+	m_elements.push_back( ELEMENT_OBJECT );
+	return true;
+}
+
+void ProjectLoader::StartPendingObject( const XMLAttributes& attributes )
+{
+	if ( m_pendingObjects.empty() )
+	{
+		if ( !m_pending )
+		{
+			m_pending = PPendingChildren( new PendingChildren( m_objDb, m_sparse, m_defaultsVersions ) );
+			m_objects.back().object->SetChildrenLoader( m_pending );
+		}
+		m_pending->m_count++;
+	}
+	else
+	{
+		m_pending->m_objects[ m_pendingObjects.back() ].childCount++;
+	}
+
+	m_pendingObjects.push_back( m_pending->m_objects.size() );
+	m_pending->m_objects.push_back( PendingObject() );
+
+	PendingObject& pending = m_pending->m_objects.back();
+	XMLReader::GetAttribute( attributes, CLASS_TAG, &pending.className );
+
+	// Counted as if it was built, for the default names of new objects
+	PObjectInfo info = m_objDb->GetObjectInfo( _WXSTR( pending.className ) );
+	if ( info )
+	{
+		m_objDb->CountObject( info );
+	}
+
+	std::string expanded;
+	pending.expanded = !XMLReader::GetAttribute( attributes, EXPANDED_TAG, &expanded ) || expanded != "0";
+	pending.childCount = 0;
+
+	m_elements.push_back( ELEMENT_PENDING_OBJECT );
+}
+
+void ProjectLoader::StartValue( const XMLAttributes& attributes, ElementKind kind )
+{
+	m_valueName.clear();
+	XMLReader::GetAttribute( attributes, NAME_TAG, &m_valueName );
+	m_value.clear();
+	m_valueFound = false;
+
+	m_elements.push_back( kind );
+}
+
+bool ProjectLoader::OnEndElement( const std::string& /*name*/ )
+{
+	ElementKind kind = m_elements.back();
+	m_elements.pop_back();
+
+	switch ( kind )
+	{
+		case ELEMENT_OBJECT:
+			m_objects.pop_back();
+			m_pending.reset();
+			break;
+
+		case ELEMENT_PENDING_OBJECT:
+			m_pendingObjects.pop_back();
+			break;
+
+		case ELEMENT_PROPERTY:
+		case ELEMENT_EVENT:
+		case ELEMENT_PENDING_PROPERTY:
+		case ELEMENT_PENDING_EVENT:
+			EndValue( kind );
+			break;
+
+		default:
+			break;
+	}
+
+	return true;
+}
+
+bool ProjectLoader::OnText( const std::string& text )
+{
+	ElementKind kind = m_elements.empty() ? ELEMENT_OTHER : m_elements.back();
+	if ( m_valueFound || ( kind != ELEMENT_PROPERTY && kind != ELEMENT_EVENT &&
+						   kind != ELEMENT_PENDING_PROPERTY && kind != ELEMENT_PENDING_EVENT ) )
+	{
+		return true;
+	}
+
+	// Whitespace only text is dropped by TinyXML too
+	if ( text.find_first_not_of( " \t\n\r" ) != std::string::npos )
+	{
+		m_value = text;
+		m_valueFound = true;
+	}
+
+	return true;
+}
+
+void ProjectLoader::EndValue( ElementKind kind )
+{
+	if ( ELEMENT_PENDING_PROPERTY == kind || ELEMENT_PENDING_EVENT == kind )
+	{
+		PendingObject& pending = m_pending->m_objects[ m_pendingObjects.back() ];
+		pending.values.push_back( PendingValue() );
+
+		PendingValue& value = pending.values.back();
+		value.name.swap( m_valueName );
+		value.value.swap( m_value );
+		value.event = ( ELEMENT_PENDING_EVENT == kind );
+		return;
+	}
+
+	SetValue( m_objDb, m_objects.back().object, GetName( m_valueName ), m_value, ELEMENT_EVENT == kind );
+}
+
+void ProjectLoader::SetValue( PObjectDatabase objDb, PObjectBase object, const wxString& name, const std::string& value, bool event )
+{
+	if ( event )
+	{
+		PEvent objEvent = object->GetEvent( name );
+		if ( objEvent )
+		{
+			objEvent->SetValue( _WXSTR( value ) );
+		}
+		return;
+	}
+
+	PProperty prop = object->GetProperty( name );
+	if ( prop ) // does the property exist
+	{
+		// load the value, it is only converted if it is used
+		prop->SetUtf8Value( value );
+	}
+	else if ( !value.empty() )
+	{
+		objDb->CountDropped();
+		wxLogError( wxT("The property named \"%s\" of class \"%s\" is not supported by this version of wxFormBuilder.\n")
+					wxT("If your project file was just converted from an older version, then the conversion was not complete.\n")
+					wxT("Otherwise, this project is from a newer version of wxFormBuilder.\n\n")
+					wxT("The property's value is: %s\n")
+					wxT("If you save this project, YOU WILL LOSE DATA"), name.c_str(), object->GetClassName().c_str(), _WXSTR( value ).c_str() );
+	}
+}
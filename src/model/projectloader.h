@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_LOADER__
+#define __PROJECT_LOADER__
+
+#include "utils/wxfbdefs.h"
+#include "utils/xmlreader.h"
+#include "model/database.h"
+#include <map>
+
+class PendingChildren;
+typedef boost::shared_ptr< PendingChildren > PPendingChildren;
+
+/**
+Builds the object tree of a .fbp file while it is parsed, without loading
+the whole document in memory first.
+
+Only the project and its forms are built while loading. The objects inside
+each form are only stored as they are read, and built the first time the
+children of the form are accessed, see ChildrenLoader.
+
+Only files of the current version in UTF-8 are loaded this way. The rest
+(old versions, which have to be converted, and files in other encodings)
+must be loaded through the DOM, see ApplicationData::LoadProject.
+
+Projects saved with a file per form only have a reference to the file of
+each form, the forms are loaded from their files, see ProjectSnapshot.
+
+Sparse files only have the values which differ from the defaults, the
+objects get the defaults of the versions the file was written with before
+their values are loaded, see ObjectDatabase::RestoreDefaults.
+*/
+class ProjectLoader : public XMLReaderHandler
+{
+	friend class PendingChildren;
+
+public:
+	/**
+	Full path of the file of each form, for projects with a file per form.
+	*/
+	typedef std::map< PObjectBase, wxString > FormFileMap;
+
+private:
+	enum ElementKind
+	{
+		ELEMENT_OTHER,
+		ELEMENT_SKIPPED,
+		ELEMENT_DEFAULTS,
+		ELEMENT_OBJECT,
+		ELEMENT_PROPERTY,
+		ELEMENT_EVENT,
+		ELEMENT_PENDING_OBJECT,
+		ELEMENT_PENDING_PROPERTY,
+		ELEMENT_PENDING_EVENT
+	};
+
+	struct ObjectFrame
+	{
+		PObjectBase newobject; // the created object, maybe an "item" containing the object
+		PObjectBase object;    // the object which owns the properties
+	};
+
+	PObjectDatabase m_objDb;
+	const int m_verMajor;
+	const int m_verMinor;
+
+	bool m_utf8;
+	bool m_versionChecked;
+	bool m_needsDocument;
+
+	// Sparse file, with the versions of the defaults it was written with
+	bool m_sparse;
+	ObjectDatabase::DefaultsVersionMap m_defaultsVersions;
+
+	// Loading a form file, whose form is added to m_project
+	bool m_formFile;
+	PObjectBase m_form;
+
+	wxString m_path;
+	PObjectBase m_project;
+	FormFileMap m_formFiles;
+
+	std::vector< ElementKind > m_elements;
+	std::vector< ObjectFrame > m_objects;
+
+	// Children of the form being read, and the objects open inside it
+	PPendingChildren m_pending;
+	std::vector< size_t > m_pendingObjects;
+
+	// Property or event being read
+	std::string m_valueName;
+	std::string m_value;
+	bool m_valueFound;
+
+	// Property and event names are few and repeat a lot, convert them once
+	typedef std::map< std::string, wxString > NameMap;
+	NameMap m_names;
+
+	const wxString& GetName( const std::string& name );
+
+	bool StartObject( const XMLAttributes& attributes );
+	void StartPendingObject( const XMLAttributes& attributes );
+	void StartValue( const XMLAttributes& attributes, ElementKind kind );
+	void LoadFormReference( const XMLAttributes& attributes );
+	void EndValue( ElementKind kind );
+
+	/**
+	Creates an object as a child of @a parent.
+	@param defaults The versions of the defaults of a sparse file, NULL otherwise.
+	@return false if the object can not be a child of @a parent.
+	*/
+	static bool CreateObject( PObjectDatabase objDb, const std::string& className, bool expanded, PObjectBase parent,
+							  const ObjectDatabase::DefaultsVersionMap* defaults, ObjectFrame* frame );
+	static void SetValue( PObjectDatabase objDb, PObjectBase object, const wxString& name, const std::string& value, bool event );
+
+public:
+	/**
+	@param verMajor, verMinor Version of the files that can be streamed.
+	*/
+	ProjectLoader( PObjectDatabase objDb, int verMajor, int verMinor );
+
+	/**
+	Loads a project file.
+	@return false if the file could not be streamed and has to be loaded
+	        through the DOM, true otherwise.
+	@throw wxFBException If the file is not valid xml, or has unknown objects.
+	*/
+	bool Load( const wxString& path );
+
+	/**
+	Loads the file of a form, the form is added to the children of @a project.
+	@return The form, or an empty pointer if the file is not a form file of
+	        the current version in UTF-8.
+	@throw wxFBException If the file is not valid xml, or has unknown objects.
+	*/
+	PObjectBase LoadForm( const wxString& path, PObjectBase project );
+
+	PObjectBase GetProject() { return m_project; }
+
+	const FormFileMap& GetFormFiles() { return m_formFiles; }
+
+	bool OnDeclaration( const XMLAttributes& attributes );
+	bool OnStartElement( const std::string& name, const XMLAttributes& attributes );
+	bool OnEndElement( const std::string& name );
+	bool OnText( const std::string& text );
+};
+
+#endif //__PROJECT_LOADER__
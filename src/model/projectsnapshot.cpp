@@ -0,0 +1,310 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectsnapshot.h"
+#include "model/objectbase.h"
+#include "utils/xmlwriter.h"
+#include "utils/typeconv.h"
+
+#include <wx/intl.h>
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+
+#define PROJECT_ROOT_TAG "wxFormBuilder_Project"
+#define FORM_ROOT_TAG "wxFormBuilder_Form"
+#define FORM_TAG "form"
+
+ProjectSnapshot::ProjectSnapshot( int major, int minor )
+:
+m_major( major ),
+m_minor( minor ),
+m_sparse( false ),
+m_written( 0 ),
+m_total( 0 )
+{
+}
+
+void ProjectSnapshot::SetSparse( const std::map< std::string, int >& defaultsVersions )
+{
+	m_sparse = true;
+	m_defaultsVersions = defaultsVersions;
+}
+
+void ProjectSnapshot::AddProject( const wxString& path, PObjectBase project )
+{
+	m_files.push_back( File() );
+	File& file = m_files.back();
+	file.path = path;
+	file.form = false;
+	Capture( &file.nodes, project, true );
+}
+
+void ProjectSnapshot::AddProject( const wxString& path, PObjectBase project, const std::vector< wxString >& formFiles )
+{
+	m_files.push_back( File() );
+	File& file = m_files.back();
+	file.path = path;
+	file.form = false;
+	Capture( &file.nodes, project, false );
+
+	for ( std::vector< wxString >::const_iterator form = formFiles.begin(); form != formFiles.end(); ++form )
+	{
+		file.formFiles.push_back( _STDSTR( *form ) );
+	}
+}
+
+void ProjectSnapshot::AddForm( const wxString& path, PObjectBase form )
+{
+	m_files.push_back( File() );
+	File& file = m_files.back();
+	file.path = path;
+	file.form = true;
+	Capture( &file.nodes, form, true );
+}
+
+size_t ProjectSnapshot::GetObjectCount() const
+{
+	size_t count = 0;
+	for ( std::vector< File >::const_iterator file = m_files.begin(); file != m_files.end(); ++file )
+	{
+		count += file->nodes.size();
+	}
+	return count;
+}
+
+void ProjectSnapshot::Capture( std::vector< Node >* nodes, PObjectBase object, bool children )
+{
+	// The node is filled in place, so the values are not copied again
+	nodes->push_back( Node() );
+	size_t index = nodes->size() - 1;
+
+	{
+		Node& node = nodes->back();
+		node.className = object->GetUtf8ClassName();
+		node.expanded = object->GetExpanded();
+		node.children = ( children ? object->GetChildCount() : 0 );
+
+		// All the values are kept for ProjectCache, the defaults are left out when written
+		PropertyMap& properties = object->GetProperties();
+		node.properties.reserve( properties.size() );
+		for ( PropertyMap::iterator it = properties.begin(); it != properties.end(); ++it )
+		{
+			node.properties.push_back( ValueVector::value_type( it->second->GetPropertyInfo()->GetUtf8Name(), it->second->GetUtf8Value() ) );
+		}
+
+		// The defaults are in the same order as the properties
+		const std::vector< std::string >& defaults = object->GetObjectInfo()->GetUtf8DefaultValues();
+		node.defaults = ( defaults.size() == properties.size() ? &defaults : NULL );
+
+		EventMap& events = object->GetEvents();
+		node.events.reserve( events.size() );
+		for ( EventMap::iterator it = events.begin(); it != events.end(); ++it )
+		{
+			node.events.push_back( ValueVector::value_type( it->second->GetEventInfo()->GetUtf8Name(), _STDSTR( it->second->GetValue() ) ) );
+		}
+	}
+
+	// The reference is not valid after adding the children
+	unsigned int count = ( *nodes )[index].children;
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		Capture( nodes, object->GetChild( i ), true );
+	}
+}
+
+size_t ProjectSnapshot::WriteObject( XMLWriter* writer, const std::vector< Node >& nodes, size_t index, Progress* progress )
+{
+	const Node& node = nodes[index];
+
+	writer->StartElement( "object" );
+	writer->WriteAttribute( "class", node.className );
+	writer->WriteAttribute( "expanded", node.expanded ? 1 : 0 );
+
+	bool sparse = m_sparse && node.defaults != NULL;
+	for ( size_t i = 0; i < node.properties.size(); i++ )
+	{
+		// Default names are numbered when the object is created, so they are always written
+		const ValueVector::value_type& prop = node.properties[i];
+		if ( !sparse || prop.second != ( *node.defaults )[i] || "name" == prop.first )
+		{
+			writer->WriteTextElement( "property", "name", prop.first, prop.second );
+		}
+	}
+
+	for ( ValueVector::const_iterator event = node.events.begin(); event != node.events.end(); ++event )
+	{
+		// Events have no default handler
+		if ( !m_sparse || !event->second.empty() )
+		{
+			writer->WriteTextElement( "event", "name", event->first, event->second );
+		}
+	}
+
+	if ( progress )
+	{
+		progress->Update( ++m_written, m_total );
+	}
+
+	size_t next = index + 1;
+	for ( unsigned int i = 0; i < node.children; i++ )
+	{
+		next = WriteObject( writer, nodes, next, progress );
+	}
+
+	// The first object is closed by Write, after the references to the forms
+	if ( index > 0 )
+	{
+		writer->EndElement();
+	}
+	return next;
+}
+
+void ProjectSnapshot::Write( XMLWriter* writer, const File& file, Progress* progress )
+{
+  #if wxUSE_UNICODE
+	writer->WriteDeclaration( "1.0", "UTF-8", "yes" );
+	#else
+	writer->WriteDeclaration( "1.0", "ISO-8859-13", "yes" );
+	#endif
+
+	writer->StartElement( file.form ? FORM_ROOT_TAG : PROJECT_ROOT_TAG );
+
+	writer->StartElement( "FileVersion" );
+	writer->WriteAttribute( "major", m_major );
+	writer->WriteAttribute( "minor", m_minor );
+	writer->EndElement();
+
+	// Also tells the loader the file is sparse
+	if ( m_sparse )
+	{
+		writer->StartElement( "Defaults" );
+		std::map< std::string, int >::const_iterator version;
+		for ( version = m_defaultsVersions.begin(); version != m_defaultsVersions.end(); ++version )
+		{
+			writer->StartElement( "package" );
+			writer->WriteAttribute( "name", version->first );
+			writer->WriteAttribute( "version", version->second );
+			writer->EndElement();
+		}
+		writer->EndElement();
+	}
+
+	if ( !file.nodes.empty() )
+	{
+		WriteObject( writer, file.nodes, 0, progress );
+
+		// Inside the project object, after its properties
+		for ( std::vector< std::string >::const_iterator form = file.formFiles.begin(); form != file.formFiles.end(); ++form )
+		{
+			writer->StartElement( FORM_TAG );
+			writer->WriteAttribute( "file", *form );
+			writer->EndElement();
+		}
+
+		writer->EndElement();
+	}
+
+	writer->EndElement();
+}
+
+bool ProjectSnapshot::WriteFile( const File& file, const wxString& tempName, wxString* error, Progress* progress )
+{
+	// The directory of the forms may not exist yet
+	wxString dir = ::wxPathOnly( file.path );
+	if ( !dir.empty() && !::wxDirExists( dir ) && !wxFileName::Mkdir( dir, 0777, wxPATH_MKDIR_FULL ) )
+	{
+		*error = _( "Unable to create directory: " ) + dir;
+		return false;
+	}
+
+	wxFFile output( tempName, wxT( "w" ) );
+	if ( !output.IsOpened() )
+	{
+		*error = _( "Unable to create file: " ) + tempName;
+		return false;
+	}
+
+	XMLWriter writer( output.fp() );
+	Write( &writer, file, progress );
+	bool written = writer.Flush();
+
+	if ( !output.Close() || !written )
+	{
+		*error = _( "Unable to write file: " ) + tempName;
+		return false;
+	}
+
+	return true;
+}
+
+bool ProjectSnapshot::Save( wxString* error, Progress* progress )
+{
+	m_written = 0;
+	m_total = GetObjectCount();
+
+	// The forms go first, so the project never refers to a form not written yet
+	std::vector< const File* > files;
+	for ( std::vector< File >::const_iterator file = m_files.begin(); file != m_files.end(); ++file )
+	{
+		if ( file->form )
+		{
+			files.push_back( &*file );
+		}
+	}
+	for ( std::vector< File >::const_iterator file = m_files.begin(); file != m_files.end(); ++file )
+	{
+		if ( !file->form )
+		{
+			files.push_back( &*file );
+		}
+	}
+
+	// Nothing is replaced until all the files are written
+	std::vector< wxString > tempNames;
+	for ( size_t i = 0; i < files.size(); i++ )
+	{
+		tempNames.push_back( files[i]->path + wxT( ".tmp" ) );
+		if ( !WriteFile( *files[i], tempNames.back(), error, progress ) )
+		{
+			for ( std::vector< wxString >::iterator temp = tempNames.begin(); temp != tempNames.end(); ++temp )
+			{
+				::wxRemoveFile( *temp );
+			}
+			return false;
+		}
+	}
+
+	for ( size_t i = 0; i < files.size(); i++ )
+	{
+		if ( !::wxRenameFile( tempNames[i], files[i]->path, true ) )
+		{
+			for ( size_t j = i; j < files.size(); j++ )
+			{
+				::wxRemoveFile( tempNames[j] );
+			}
+			*error = _( "Unable to replace file: " ) + files[i]->path;
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_SNAPSHOT__
+#define __PROJECT_SNAPSHOT__
+
+#include "utils/wxfbdefs.h"
+#include <wx/string.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+
+class XMLWriter;
+
+/**
+Copy of the contents of a project, to write it while the project is edited.
+
+The snapshot is taken on the main thread, it only copies the values of the
+objects, already converted to the encoding of the file. Formatting and
+writing the files can then be done in another thread: the snapshot does
+not refer to any object of the project, and it is never modified once taken.
+
+Projects with a file per form are written as a project file with a
+reference to the file of each form, and a file for each form. A snapshot
+only has to contain the files which changed.
+
+Sparse files only have the values which differ from the defaults, and the
+version of the defaults of each package, see ObjectDatabase::RestoreDefaults.
+*/
+class ProjectSnapshot
+{
+	friend class ProjectCache;
+
+public:
+	/**
+	Receives the progress of Save.
+	*/
+	class Progress
+	{
+	public:
+		virtual ~Progress() {}
+		virtual void Update( size_t written, size_t total ) = 0;
+	};
+
+private:
+	typedef std::vector< std::pair< std::string, std::string > > ValueVector;
+
+	struct Node
+	{
+		std::string className;
+		bool expanded;
+		unsigned int children;
+
+		// All the values, the defaults are left out when a sparse file is written
+		ValueVector properties;
+		ValueVector events;
+
+		// Default values of the class, in the order of the properties, or NULL
+		// if they are not known. They are never modified once set.
+		const std::vector< std::string >* defaults;
+	};
+
+	struct File
+	{
+		wxString path;
+		bool form;
+
+		// Objects in the order they are written, each one followed by its children
+		std::vector< Node > nodes;
+
+		// Files of the forms of a project, written instead of the forms
+		std::vector< std::string > formFiles;
+	};
+
+	std::vector< File > m_files;
+	int m_major;
+	int m_minor;
+
+	bool m_sparse;
+	std::map< std::string, int > m_defaultsVersions;
+
+	// Progress of Save
+	size_t m_written;
+	size_t m_total;
+
+	void Capture( std::vector< Node >* nodes, PObjectBase object, bool children );
+	size_t WriteObject( XMLWriter* writer, const std::vector< Node >& nodes, size_t index, Progress* progress );
+	void Write( XMLWriter* writer, const File& file, Progress* progress );
+	bool WriteFile( const File& file, const wxString& tempName, wxString* error, Progress* progress );
+
+public:
+	/**
+	The files will be written as version @a major.@a minor.
+	*/
+	ProjectSnapshot( int major, int minor );
+
+	/**
+	Writes sparse files, must be called before adding the files.
+	@param defaultsVersions See ObjectDatabase::GetDefaultsVersions.
+	*/
+	void SetSparse( const std::map< std::string, int >& defaultsVersions );
+
+	/**
+	Adds a project saved in a single file.
+	*/
+	void AddProject( const wxString& path, PObjectBase project );
+
+	/**
+	Adds the project file of a project with a file per form.
+	@param formFiles The file of each form of the project, as written in the
+	       project file.
+	*/
+	void AddProject( const wxString& path, PObjectBase project, const std::vector< wxString >& formFiles );
+
+	/**
+	Adds the file of a form of a project with a file per form.
+	*/
+	void AddForm( const wxString& path, PObjectBase form );
+
+	size_t GetObjectCount() const;
+
+	/**
+	Writes all the files, through temporary files which then replace them,
+	so a failed save never leaves truncated files. The forms replace their
+	files before the project.
+	@param progress Optional, updated after each object.
+	@return false if some file could not be written, @a error receives the reason.
+	*/
+	bool Save( wxString* error, Progress* progress = NULL );
+};
+
+#endif //__PROJECT_SNAPSHOT__
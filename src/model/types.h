@@ -158,6 +158,64 @@ typedef enum
 	PT_PARENT,
 	PT_CLASS
 } PropertyType;
+
+/**
+Languages of the code templates, see ObjectInfo::GetCodeInfo.
+*/
+enum CodeLanguage
+{
+	LANGUAGE_CPP,
+	LANGUAGE_PYTHON,
+	LANGUAGE_LUA,
+	LANGUAGE_PHP,
+	LANGUAGE_COUNT
+};
+
+/**
+Templates the code generators use for the objects, kept in a table so they
+are found by index. The other templates, such as those of the events, are
+found by name.
+*/
+enum CodeTemplate
+{
+	TEMPLATE_CONSTRUCTION,
+	TEMPLATE_DECLARATION,
+	TEMPLATE_SETTINGS,
+	TEMPLATE_INCLUDE,
+	TEMPLATE_AFTER_ADDCHILD,
+	TEMPLATE_DESTRUCTION,
+	TEMPLATE_BASE,
+	TEMPLATE_CONS_CALL,
+	TEMPLATE_CONS_DECL,
+	TEMPLATE_CONS_DEF,
+	TEMPLATE_CLASS_DECL,
+	TEMPLATE_PAGE_ADD,
+	TEMPLATE_WINDOW_ADD,
+	TEMPLATE_SIZER_ADD,
+	TEMPLATE_SPACER_ADD,
+	TEMPLATE_TOOLBAR_ADD,
+	TEMPLATE_COLUMN_ADD,
+	TEMPLATE_VALVAR_DECLARATION,
+	TEMPLATE_GENERATED_EVENT_HANDLERS,
+	TEMPLATE_EVENT_HANDLER_COMMENT,
+	TEMPLATE_FILE_COMMENT,
+	TEMPLATE_HEADER_COMMENT,
+	TEMPLATE_HEADER_INCLUDE,
+	TEMPLATE_SOURCE_INCLUDE,
+	TEMPLATE_HEADER_PREAMBLE,
+	TEMPLATE_HEADER_EPILOGUE,
+	TEMPLATE_GUARD_MACRO_OPEN,
+	TEMPLATE_GUARD_MACRO_CLOSE,
+	TEMPLATE_CPP_PREAMBLE,
+	TEMPLATE_CPP_EPILOGUE,
+	TEMPLATE_PYTHON_PREAMBLE,
+	TEMPLATE_PYTHON_EPILOGUE,
+	TEMPLATE_LUA_PREAMBLE,
+	TEMPLATE_LUA_EPILOGUE,
+	TEMPLATE_PHP_PREAMBLE,
+	TEMPLATE_PHP_EPILOGUE,
+	TEMPLATE_COUNT
+};
 /*
 typedef enum
 {
@@ -30,8 +30,62 @@
 #include <wx/wfstream.h>
 #include <wx/txtstrm.h>
 #include <sstream>
+#include <memory>
 #include "model/objectbase.h"
 #include <ticpp.h>
+#include <xrcconv.h>
+
+XrcLoader::XrcLoader()
+:
+m_unsupported( NULL )
+{
+}
+
+XrcLoader::~XrcLoader()
+{
+	ClearImported();
+}
+
+void XrcLoader::AddUnsupported( int line, const std::string& className, const std::string& property, const char* reason, const wxString& message )
+{
+	if ( !m_unsupported )
+	{
+		if ( property.empty() )
+		{
+			wxLogError( wxT( "%s" ), message.c_str() );
+		}
+		else
+		{
+			LogDebug( wxT( "%s" ), message.c_str() );
+		}
+		return;
+	}
+
+	Unsupported unsupported;
+	unsupported.line = line;
+	unsupported.className = className;
+	unsupported.property = property;
+	unsupported.reason = reason;
+	m_unsupported->push_back( unsupported );
+}
+
+void XrcLoader::AddUnsupportedProperties( ticpp::Element* fbObj, const std::string& className )
+{
+	// See XrcToXfbFilter::GetXfbObject
+	ticpp::Element* element = fbObj->FirstChildElement( XRC_UNSUPPORTED_TAG, false );
+	while ( element )
+	{
+		std::string name;
+		int line = 0;
+		element->GetAttribute( "name", &name, false );
+		element->GetAttributeOrDefault( "line", &line, 0 );
+
+		AddUnsupported( line, className, name, "property", wxString::Format( wxT( "Property \"%s\" of class \"%s\" found on line %i was not imported" ),
+		                _WXSTR( name ).c_str(), _WXSTR( className ).c_str(), line ) );
+
+		element = element->NextSiblingElement( XRC_UNSUPPORTED_TAG, false );
+	}
+}
 
 PObjectBase XrcLoader::GetProject( ticpp::Document* xrcDoc )
 {
@@ -51,13 +105,20 @@ PObjectBase XrcLoader::GetProject( ticpp::Document* xrcDoc )
 	ticpp::Element *element = root->FirstChildElement( "object", false );
 	while ( element )
 	{
-		PObjectBase obj = GetObject( element, project );
+		ImportObject( element, project );
 		element = element->NextSiblingElement( "object", false );
 	}
 
 	return project;
 }
 
+void XrcLoader::ImportObject( ticpp::Element* xrcObj, PObjectBase project )
+{
+	assert( m_objDb );
+	GetObject( xrcObj, project );
+	ClearImported();
+}
+
 PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 {
 	// First, create the object by the name, the modify the properties
@@ -92,41 +153,9 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 			}
 		}
 
-		// Forms wxPanel, wxFrame, wxDialog are stored internally as Panel, Frame, and Dialog
-		// to prevent conflicts with wxPanel as a container
-		className = className.substr( 2, className.size() - 2 );
-	}
-
-	// Well, this is not nice. wxMenu class name is ambiguous, so we'll get the
-	// correct class by the context. If the parent of a wxMenu is another wxMenu
-	// then the class name will be "submenu"
-	else if ( className == "wxMenu" && ( parent->GetClassName() == wxT( "wxMenu" ) || parent->GetClassName() == wxT( "submenu" ) ) )
-	{
-		className = "submenu";
-	}
-
-	// "separator" is also ambiguous - could be a toolbar separator or a menu separator
-	else if ( className == "separator" )
-	{
-		if ( parent->GetClassName() == wxT( "wxToolBar" ) ||  parent->GetClassName() == wxT( "ToolBar" ) )
-		{
-			className = "toolSeparator";
-		}
 	}
 
-	// replace "spacer" with "sizeritem" so it will be imported as a "sizeritem"
-	// "sizeritem" is ambiguous - could also be a grid bag sizeritem
-	else if ( className == "spacer" || className == "sizeritem" )
-	{
-		if ( parent->GetClassName() == wxT( "wxGridBagSizer" ) )
-		{
-			className = "gbsizeritem";
-		}
-		else
-		{
-			className = "sizeritem";
-		}
-	}
+	className = GetClassName( className, parent );
 
 	PObjectBase object;
 	PObjectInfo objInfo = m_objDb->GetObjectInfo( _WXSTR( className ) );
@@ -135,18 +164,34 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 		IComponent *comp = objInfo->GetComponent();
 		if ( !comp )
 		{
-			wxLogError( _("No component found for class \"%s\", found on line %i."), _WXSTR( className ).c_str(), xrcObj->Row() );
+			AddUnsupported( xrcObj->Row(), className, std::string(), "no_component",
+			                wxString::Format( _("No component found for class \"%s\", found on line %i."), _WXSTR( className ).c_str(), xrcObj->Row() ) );
 		}
 		else
 		{
-			ticpp::Element *fbObj = comp->ImportFromXrc( xrcObj );
-			if ( !fbObj )
+			std::auto_ptr< ticpp::Element > fbObj;
+			ElementMap::iterator imported = m_imported.find( xrcObj->GetTiXmlPointer() );
+			if ( imported != m_imported.end() )
+			{
+				fbObj.reset( imported->second );
+				m_imported.erase( imported );
+			}
+			else
+			{
+				CountConversion( xrcObj );
+				fbObj.reset( comp->ImportFromXrc( xrcObj ) );
+			}
+
+			if ( !fbObj.get() )
 			{
-				wxLogError( _("ImportFromXrc returned NULL for class \"%s\", found on line %i."), _WXSTR( className ).c_str(), xrcObj->Row() );
+				AddUnsupported( xrcObj->Row(), className, std::string(), "import_failed",
+				                wxString::Format( _("ImportFromXrc returned NULL for class \"%s\", found on line %i."), _WXSTR( className ).c_str(), xrcObj->Row() ) );
 			}
 			else
 			{
-				object = m_objDb->CreateObject( fbObj, parent );
+				AddUnsupportedProperties( fbObj.get(), className );
+
+				object = m_objDb->CreateObject( fbObj.get(), parent );
 				if ( !object )
 				{
 					// Unable to create the object and add it to the parent - probably needs a sizer
@@ -163,7 +208,7 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 
 						if ( sizer )
 						{
-							object = m_objDb->CreateObject( fbObj, sizer );
+							object = m_objDb->CreateObject( fbObj.get(), sizer );
 							if ( object )
 							{
 								parent->AddChild( newsizer );
@@ -175,7 +220,8 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 
 				if ( !object )
 				{
-					wxLogError( wxT( "CreateObject failed for class \"%s\", with parent \"%s\", found on line %i" ), _WXSTR( className ).c_str(), parent->GetClassName().c_str(), xrcObj->Row() );
+					AddUnsupported( xrcObj->Row(), className, std::string(), "create_failed",
+					                wxString::Format( wxT( "CreateObject failed for class \"%s\", with parent \"%s\", found on line %i" ), _WXSTR( className ).c_str(), parent->GetClassName().c_str(), xrcObj->Row() ) );
 				}
 				else
 				{
@@ -187,6 +233,7 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 					if ( object )
 					{
 						// Recursively import the children
+						ImportBatches( xrcObj, object );
 						ticpp::Element *element = xrcObj->FirstChildElement( "object", false );
 						while ( element )
 						{
@@ -206,7 +253,8 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 		{
 			parent->AddChild( object );
 			object->SetParent( parent );
-			wxLogError( wxT( "Unknown class \"%s\" found on line %i, replaced with a wxPanel" ), _WXSTR( className ).c_str(), xrcObj->Row() );
+			AddUnsupported( xrcObj->Row(), className, std::string(), "unknown_class",
+			                wxString::Format( wxT( "Unknown class \"%s\" found on line %i, replaced with a wxPanel" ), _WXSTR( className ).c_str(), xrcObj->Row() ) );
 		}
 		else
 		{
@@ -214,9 +262,123 @@ PObjectBase XrcLoader::GetObject( ticpp::Element *xrcObj, PObjectBase parent )
 			                  wxT( "Unknown class \"%s\" found on line %i, and could not replace with a wxPanel as child of \"%s:%s\"" ),
 			                  _WXSTR( className ).c_str(), xrcObj->Row(), parent->GetPropertyAsString( wxT( "name" ) ).c_str(), parent->GetClassName().c_str() ) );
 
-			wxLogError( msg );
+			AddUnsupported( xrcObj->Row(), className, std::string(), "unknown_class", msg );
 		}
 	}
 
 	return object;
 }
+
+std::string XrcLoader::GetClassName( const std::string& xrcClassName, PObjectBase parent )
+{
+	std::string className = xrcClassName;
+	if ( parent->GetObjectTypeName() == wxT( "project" ) )
+	{
+		// Forms wxPanel, wxFrame, wxDialog are stored internally as Panel, Frame, and Dialog
+		// to prevent conflicts with wxPanel as a container
+		className = className.substr( 2, className.size() - 2 );
+	}
+
+	// Well, this is not nice. wxMenu class name is ambiguous, so we'll get the
+	// correct class by the context. If the parent of a wxMenu is another wxMenu
+	// then the class name will be "submenu"
+	else if ( className == "wxMenu" && ( parent->GetClassName() == wxT( "wxMenu" ) || parent->GetClassName() == wxT( "submenu" ) ) )
+	{
+		className = "submenu";
+	}
+
+	// "separator" is also ambiguous - could be a toolbar separator or a menu separator
+	else if ( className == "separator" )
+	{
+		if ( parent->GetClassName() == wxT( "wxToolBar" ) ||  parent->GetClassName() == wxT( "ToolBar" ) )
+		{
+			className = "toolSeparator";
+		}
+	}
+
+	// replace "spacer" with "sizeritem" so it will be imported as a "sizeritem"
+	// "sizeritem" is ambiguous - could also be a grid bag sizeritem
+	else if ( className == "spacer" || className == "sizeritem" )
+	{
+		if ( parent->GetClassName() == wxT( "wxGridBagSizer" ) )
+		{
+			className = "gbsizeritem";
+		}
+		else
+		{
+			className = "sizeritem";
+		}
+	}
+
+	return className;
+}
+
+void XrcLoader::ImportBatches( ticpp::Element* xrcObj, PObjectBase parent )
+{
+	typedef std::map< IXrcBatchComponent*, std::vector< ticpp::Element* > > BatchMap;
+	BatchMap batches;
+
+	ticpp::Element* element = xrcObj->FirstChildElement( "object", false );
+	while ( element )
+	{
+		PObjectInfo objInfo = m_objDb->GetObjectInfo( _WXSTR( GetClassName( element->GetAttribute( "class" ), parent ) ) );
+		IComponent* comp = ( objInfo ? objInfo->GetComponent() : NULL );
+		if ( comp )
+		{
+			BatchComponentMap::iterator found = m_batchComponents.find( comp );
+			if ( found == m_batchComponents.end() )
+			{
+				found = m_batchComponents.insert( BatchComponentMap::value_type( comp, dynamic_cast< IXrcBatchComponent* >( comp ) ) ).first;
+			}
+
+			if ( found->second )
+			{
+				batches[ found->second ].push_back( element );
+			}
+		}
+		element = element->NextSiblingElement( "object", false );
+	}
+
+	for ( BatchMap::iterator batch = batches.begin(); batch != batches.end(); ++batch )
+	{
+		// A single object is converted by GetObject as usual
+		std::vector< ticpp::Element* >& xrcObjs = batch->second;
+		if ( xrcObjs.size() < 2 )
+		{
+			continue;
+		}
+
+		std::vector< ticpp::Element* > elements( xrcObjs.size(), static_cast< ticpp::Element* >( NULL ) );
+		batch->first->ImportBatchFromXrc( &xrcObjs[0], xrcObjs.size(), &elements[0] );
+
+		for ( size_t i = 0; i < xrcObjs.size(); i++ )
+		{
+			CountConversion( xrcObjs[i] );
+			m_imported[ xrcObjs[i]->GetTiXmlPointer() ] = elements[i];
+		}
+	}
+}
+
+void XrcLoader::CountConversion( ticpp::Element* xrcObj )
+{
+#ifdef DEBUG
+	unsigned int& count = m_conversions[ xrcObj->GetTiXmlPointer() ];
+	++count;
+	assert( 1 == count && "XRC object converted more than once" );
+#else
+	wxUnusedVar( xrcObj );
+#endif
+}
+
+void XrcLoader::ClearImported()
+{
+	for ( ElementMap::iterator it = m_imported.begin(); it != m_imported.end(); ++it )
+	{
+		delete it->second;
+	}
+	m_imported.clear();
+
+#ifdef DEBUG
+	m_conversions.clear();
+#endif
+}
@@ -29,25 +29,89 @@
 #include "utils/wxfbdefs.h"
 #include "model/database.h"
 #include <ticpp.h>
+#include <string>
+#include <vector>
+#include <map>
+
+class IComponent;
+class IXrcBatchComponent;
 
 /**
  * Filtro de importación de un fichero XRC.
  */
 class XrcLoader
 {
+ public:
+  /**
+   * An XRC object, or a property of an object, which could not be imported.
+   */
+  struct Unsupported
+  {
+    int line;
+    std::string className;
+
+    // Empty if the problem is the object itself
+    std::string property;
+
+    // Short identifier of the problem, see XrcLoader::GetObject
+    std::string reason;
+  };
+
  private:
   PObjectDatabase m_objDb;
+  std::vector< Unsupported >* m_unsupported;
+
+  // Objects converted by the batch components, taken by GetObject. The
+  // ticpp wrappers are created again by each lookup, so the TinyXML nodes
+  // are the keys.
+  typedef std::map< TiXmlNode*, ticpp::Element* > ElementMap;
+  ElementMap m_imported;
+
+#ifdef DEBUG
+  // Each XRC object must be converted only once, by its batch or by itself
+  typedef std::map< TiXmlNode*, unsigned int > ConversionCountMap;
+  ConversionCountMap m_conversions;
+#endif
+
+  // The cast of each component is only done once
+  typedef std::map< IComponent*, IXrcBatchComponent* > BatchComponentMap;
+  BatchComponentMap m_batchComponents;
 
   PObjectBase GetObject(ticpp::Element *xrcObj, PObjectBase parent);
+  std::string GetClassName( const std::string& xrcClassName, PObjectBase parent );
+
+  /**
+   * Converts the children of @a xrcObj of each component implementing
+   * IXrcBatchComponent in a single call, before they are created.
+   */
+  void ImportBatches( ticpp::Element* xrcObj, PObjectBase parent );
+  void ClearImported();
+  void CountConversion( ticpp::Element* xrcObj );
+  void AddUnsupported( int line, const std::string& className, const std::string& property, const char* reason, const wxString& message );
+  void AddUnsupportedProperties( ticpp::Element* fbObj, const std::string& className );
 
  public:
+  XrcLoader();
+  ~XrcLoader();
 
   void SetObjectDatabase(PObjectDatabase db) { m_objDb = db; }
 
+  /**
+   * Collects what could not be imported in @a unsupported, instead of
+   * logging it.
+   */
+  void SetUnsupported( std::vector< Unsupported >* unsupported ) { m_unsupported = unsupported; }
+
   /**
    * Dado un árbol XML en formato XRC, crea el arbol de objetos asociado.
    */
   PObjectBase GetProject(ticpp::Document* xrcDoc);
+
+  /**
+   * Imports an object found directly in the "resource" element of an XRC
+   * file, a form or a bitmap, into @a project.
+   */
+  void ImportObject( ticpp::Element* xrcObj, PObjectBase project );
 };
 
 #endif //__XRC_FILTER__
@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xrcimporter.h"
+#include "model/objectbase.h"
+#include "model/projectsnapshot.h"
+#include "utils/xmlreader.h"
+#include "utils/typeconv.h"
+#include "utils/stringutils.h"
+#include "utils/wxfbexception.h"
+
+#include <ticpp.h>
+#include <boost/smart_ptr.hpp>
+#include <wx/thread.h>
+#include <wx/filename.h>
+#include <wx/ffile.h>
+#include <wx/intl.h>
+#include <sstream>
+
+typedef std::vector< boost::shared_ptr< TiXmlElement > > XrcObjectVector;
+
+/**
+Element which knows the line it was found on, as if it had been parsed by TinyXML.
+*/
+class XrcElement : public TiXmlElement
+{
+public:
+	XrcElement( const std::string& name, int line )
+	:
+	TiXmlElement( name )
+	{
+		location.row = line - 1;
+	}
+};
+
+/**
+Reads each object of the "resource" element of an XRC file into its own
+tree, the same tree TinyXML would build without condensing white space.
+*/
+class XrcReader : public XMLReaderHandler
+{
+private:
+	XMLReader m_reader;
+	XrcObjectVector* m_objects;
+
+	// Depth of the current element in the document, 1 for "resource"
+	size_t m_depth;
+
+	// Elements open in the object being read, from the object down
+	std::vector< TiXmlElement* > m_open;
+	std::string m_text;
+
+	void FlushText()
+	{
+		// Blank text is skipped, as TinyXML does
+		if ( !m_open.empty() && m_text.find_first_not_of( " \t\r\n" ) != std::string::npos )
+		{
+			m_open.back()->LinkEndChild( new TiXmlText( m_text ) );
+		}
+		m_text.clear();
+	}
+
+public:
+	XrcReader( XrcObjectVector* objects )
+	:
+	m_reader( this ),
+	m_objects( objects ),
+	m_depth( 0 )
+	{
+	}
+
+	void Read( const wxString& path )
+	{
+		m_reader.ParseFile( path );
+	}
+
+	bool OnDeclaration( const XMLAttributes& attributes )
+	{
+		// Other encodings have to be converted interactively, see XMLUtils::LoadXMLFile
+		std::string encoding;
+		if ( XMLReader::GetAttribute( attributes, "encoding", &encoding ) && encoding != "UTF-8" && encoding != "utf-8" )
+		{
+			THROW_WXFBEX( _("Only UTF-8 files can be imported without the GUI, this file is ") << _WXSTR( encoding ) )
+		}
+		return true;
+	}
+
+	bool OnStartElement( const std::string& name, const XMLAttributes& attributes )
+	{
+		++m_depth;
+		if ( 1 == m_depth )
+		{
+			if ( name != "resource" )
+			{
+				THROW_WXFBEX( _("Missing root element \"resource\"") )
+			}
+			return true;
+		}
+
+		// Only the objects of the resource are imported
+		if ( m_open.empty() && ( m_depth > 2 || name != "object" ) )
+		{
+			return true;
+		}
+
+		FlushText();
+
+		TiXmlElement* element = new XrcElement( name, m_reader.GetLine() );
+		for ( XMLAttributes::const_iterator attribute = attributes.begin(); attribute != attributes.end(); ++attribute )
+		{
+			element->SetAttribute( attribute->first, attribute->second );
+		}
+
+		if ( m_open.empty() )
+		{
+			m_objects->push_back( boost::shared_ptr< TiXmlElement >( element ) );
+		}
+		else
+		{
+			m_open.back()->LinkEndChild( element );
+		}
+		m_open.push_back( element );
+		return true;
+	}
+
+	bool OnEndElement( const std::string& /*name*/ )
+	{
+		// Everything inside an object is open
+		if ( !m_open.empty() )
+		{
+			FlushText();
+			m_open.pop_back();
+		}
+		--m_depth;
+		return true;
+	}
+
+	bool OnText( const std::string& text )
+	{
+		if ( !m_open.empty() )
+		{
+			m_text += text;
+		}
+		return true;
+	}
+};
+
+/**
+Files waiting to be imported by ImportFiles.
+*/
+class XrcImportQueue
+{
+private:
+	wxMutex m_mutex;
+
+	// Held while the objects of a file are imported
+	wxMutex m_importMutex;
+
+	std::vector< XrcImporter::FileResult >* m_results;
+	size_t m_next;
+	PObjectDatabase m_objDb;
+	int m_major;
+	int m_minor;
+
+	XrcImporter::FileResult* Next()
+	{
+		wxMutexLocker lock( m_mutex );
+		if ( m_next >= m_results->size() )
+		{
+			return NULL;
+		}
+		return &( *m_results )[ m_next++ ];
+	}
+
+	void Import( XrcImporter::FileResult* result );
+
+public:
+	XrcImportQueue( std::vector< XrcImporter::FileResult >* results, PObjectDatabase objDb, int major, int minor )
+	:
+	m_results( results ),
+	m_next( 0 ),
+	m_objDb( objDb ),
+	m_major( major ),
+	m_minor( minor )
+	{
+	}
+
+	/**
+	Imports files until there are no more left, can be called from several threads.
+	*/
+	void Run()
+	{
+		XrcImporter::FileResult* result;
+		while ( ( result = Next() ) != NULL )
+		{
+			Import( result );
+		}
+	}
+};
+
+void XrcImportQueue::Import( XrcImporter::FileResult* result )
+{
+	// Runs in the import threads: no messages, everything goes to the result
+	try
+	{
+		XrcObjectVector objects;
+		XrcReader reader( &objects );
+		reader.Read( result->path );
+
+		wxFileName output( result->path );
+		output.SetExt( wxT("fbp") );
+		result->output = output.GetFullPath();
+
+		ProjectSnapshot snapshot( m_major, m_minor );
+		{
+			wxMutexLocker lock( m_importMutex );
+
+			// Default names start from 1 in each file, as if it was imported alone
+			m_objDb->ResetObjectCounters();
+
+			PObjectBase project = m_objDb->CreateObject( "Project" );
+			project->GetProperty( wxT("name") )->SetValue( output.GetName() );
+			project->GetProperty( wxT("file") )->SetValue( output.GetName() );
+
+			XrcLoader loader;
+			loader.SetObjectDatabase( m_objDb );
+			loader.SetUnsupported( &result->unsupported );
+			for ( XrcObjectVector::iterator object = objects.begin(); object != objects.end(); ++object )
+			{
+				ticpp::Element element( object->get() );
+				loader.ImportObject( &element, project );
+			}
+
+			snapshot.AddProject( result->output, project );
+			result->objects = snapshot.GetObjectCount();
+		}
+
+		// Not needed to write the file
+		objects.clear();
+
+		wxString error;
+		if ( !snapshot.Save( &error ) )
+		{
+			result->error = _STDSTR( error );
+		}
+	}
+	catch ( wxFBException& ex )
+	{
+		result->error = _STDSTR( ex.what() );
+	}
+	catch ( ticpp::Exception& ex )
+	{
+		result->error = ex.m_details;
+	}
+}
+
+class XrcImportThread : public wxThread
+{
+private:
+	XrcImportQueue* m_queue;
+
+public:
+	XrcImportThread( XrcImportQueue* queue )
+	:
+	wxThread( wxTHREAD_JOINABLE ),
+	m_queue( queue )
+	{
+	}
+
+	ExitCode Entry()
+	{
+		m_queue->Run();
+		return 0;
+	}
+};
+
+void XrcImporter::ImportFiles( const std::vector< wxString >& files, PObjectDatabase objDb, int major, int minor, unsigned int jobs, std::vector< FileResult >* results )
+{
+	results->clear();
+	results->resize( files.size() );
+	for ( size_t i = 0; i < files.size(); ++i )
+	{
+		( *results )[i].path = files[i];
+		( *results )[i].objects = 0;
+	}
+
+	if ( 0 == jobs )
+	{
+		int cpus = wxThread::GetCPUCount();
+		jobs = ( cpus > 0 ? (unsigned int)cpus : 1 );
+	}
+	if ( jobs > files.size() )
+	{
+		jobs = (unsigned int)files.size();
+	}
+
+	XrcImportQueue queue( results, objDb, major, minor );
+
+	std::vector< XrcImportThread* > threads;
+	for ( unsigned int i = 1; i < jobs; ++i )
+	{
+		XrcImportThread* thread = new XrcImportThread( &queue );
+		if ( thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR )
+		{
+			delete thread;
+			break;
+		}
+		threads.push_back( thread );
+	}
+
+	// This thread imports files too, and any left if the others could not be started
+	queue.Run();
+
+	std::vector< XrcImportThread* >::iterator thread;
+	for ( thread = threads.begin(); thread != threads.end(); ++thread )
+	{
+		( *thread )->Wait();
+		delete *thread;
+	}
+}
+
+bool XrcImporter::WriteReport( const wxString& path, const std::vector< FileResult >& results )
+{
+	std::ostringstream json;
+	json << "{\n\t\"files\": [";
+
+	for ( std::vector< FileResult >::const_iterator result = results.begin(); result != results.end(); ++result )
+	{
+		json << ( result == results.begin() ? "\n" : ",\n" );
+		json << "\t\t{\n";
+		json << "\t\t\t\"path\": " << StringUtils::JsonString( _STDSTR( result->path ) ) << ",\n";
+		json << "\t\t\t\"output\": " << StringUtils::JsonString( _STDSTR( result->output ) ) << ",\n";
+		json << "\t\t\t\"imported\": " << ( result->error.empty() ? "true" : "false" ) << ",\n";
+		json << "\t\t\t\"error\": " << StringUtils::JsonString( result->error ) << ",\n";
+		json << "\t\t\t\"objects\": " << result->objects << ",\n";
+		json << "\t\t\t\"unsupported\": [";
+
+		std::vector< XrcLoader::Unsupported >::const_iterator unsupported;
+		for ( unsupported = result->unsupported.begin(); unsupported != result->unsupported.end(); ++unsupported )
+		{
+			json << ( unsupported == result->unsupported.begin() ? "\n" : ",\n" );
+			json << "\t\t\t\t{ \"line\": " << unsupported->line
+			     << ", \"class\": " << StringUtils::JsonString( unsupported->className )
+			     << ", \"property\": " << StringUtils::JsonString( unsupported->property )
+			     << ", \"reason\": " << StringUtils::JsonString( unsupported->reason ) << " }";
+		}
+
+		json << ( result->unsupported.empty() ? "]\n" : "\n\t\t\t]\n" );
+		json << "\t\t}";
+	}
+
+	json << ( results.empty() ? "]\n}\n" : "\n\t]\n}\n" );
+
+	wxFFile output( path, wxT("wb") );
+	if ( !output.IsOpened() )
+	{
+		return false;
+	}
+
+	std::string text = json.str();
+	bool written = ( output.Write( text.data(), text.size() ) == text.size() );
+	return output.Close() && written;
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __XRC_IMPORTER__
+#define __XRC_IMPORTER__
+
+#include "utils/wxfbdefs.h"
+#include "model/xrcfilter.h"
+#include <wx/string.h>
+#include <string>
+#include <vector>
+
+/**
+Imports XRC files as project files, without the GUI.
+
+The files are read with XMLReader, which only keeps the objects of the
+"resource" element in memory instead of the whole document. Several files
+are read and written at the same time, but the objects are imported one
+file at a time: neither the components nor the object database are thread
+safe, and the default names of the objects depend on the order in which
+they are created.
+*/
+class XrcImporter
+{
+public:
+	/**
+	Result of the import of a file by ImportFiles.
+	*/
+	struct FileResult
+	{
+		wxString path;
+
+		// The project file, the XRC file with the extension .fbp
+		wxString output;
+
+		// Empty if the file was imported
+		std::string error;
+
+		size_t objects;
+		std::vector< XrcLoader::Unsupported > unsupported;
+	};
+
+	/**
+	Imports each XRC file into a project file, next to it.
+	@param jobs The number of files to import at the same time, 0 for one per CPU.
+	@param results Receives the result of each file, in the same order as @a files.
+	*/
+	static void ImportFiles( const std::vector< wxString >& files, PObjectDatabase objDb, int major, int minor, unsigned int jobs, std::vector< FileResult >* results );
+
+	/**
+	Writes the results of ImportFiles as JSON, for scripts.
+	@return false if the file could not be written.
+	*/
+	static bool WriteReport( const wxString& path, const std::vector< FileResult >& results );
+};
+
+#endif //__XRC_IMPORTER__
@@ -27,6 +27,7 @@
 #include "bitmaps.h"
 #include "wxfbevent.h"
 #include "wxfbmanager.h"
+#include "projectsaver.h"
 
 #include "model/objectbase.h"
 #include "utils/typeconv.h"
@@ -34,6 +35,12 @@
 #include "utils/stringutils.h"
 #include "utils/wxfbipc.h"
 #include "utils/wxfbexception.h"
+#include "utils/startupprofile.h"
+#include "model/projectloader.h"
+#include "model/projectcache.h"
+#include "model/projectconverter.h"
+#include "model/projectsnapshot.h"
+#include "model/xrcimporter.h"
 #include "codegen/cppcg.h"
 #include "codegen/pythoncg.h"
 #include "codegen/phpcg.h"
@@ -52,6 +59,7 @@
 #include <wx/tokenzr.h>
 #include <wx/ffile.h>
 #include <wx/filename.h>
+#include <wx/dir.h>
 #include <wx/clipbrd.h>
 #include <wx/fs_mem.h>
 #include <wx/fs_arc.h>
@@ -79,6 +87,7 @@ class ExpandObjectCmd : public Command
 
 	public:
 		ExpandObjectCmd( PObjectBase object, bool expand );
+		PObjectBase GetModifiedObject() { return m_object; }
 };
 
 /**
@@ -102,6 +111,7 @@ class InsertObjectCmd : public Command
 
 	public:
 		InsertObjectCmd( ApplicationData *data, PObjectBase object, PObjectBase parent, int pos = -1 );
+		PObjectBase GetModifiedObject() { return m_parent; }
 };
 
 /**
@@ -124,6 +134,7 @@ class RemoveObjectCmd : public Command
 
 	public:
 		RemoveObjectCmd( ApplicationData *data, PObjectBase object );
+		PObjectBase GetModifiedObject() { return m_parent; }
 };
 
 /**
@@ -143,6 +154,7 @@ class ModifyPropertyCmd : public Command
 
 	public:
 		ModifyPropertyCmd( PProperty prop, wxString value );
+		PObjectBase GetModifiedObject() { return m_property->GetObject(); }
 };
 
 /**
@@ -162,6 +174,7 @@ class ModifyEventHandlerCmd : public Command
 
 	public:
 		ModifyEventHandlerCmd( PEvent event, wxString value );
+		PObjectBase GetModifiedObject() { return m_event->GetObject(); }
 };
 
 /**
@@ -181,6 +194,7 @@ class ShiftChildCmd : public Command
 
 	public:
 		ShiftChildCmd( PObjectBase object, int pos );
+		PObjectBase GetModifiedObject() { return m_object->GetParent(); }
 
 };
 
@@ -207,6 +221,7 @@ class CutObjectCmd : public Command
 
 	public:
 		CutObjectCmd( ApplicationData *data, PObjectBase object );
+		PObjectBase GetModifiedObject() { return m_parent; }
 };
 
 /**
@@ -228,6 +243,9 @@ class ReparentObjectCmd : public Command
 
 	public:
 		ReparentObjectCmd ( PObjectBase sizeritem, PObjectBase sizer );
+
+		// Both sizers are in the same form
+		PObjectBase GetModifiedObject() { return m_sizer; }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -241,11 +259,17 @@ ExpandObjectCmd::ExpandObjectCmd( PObjectBase object, bool expand )
 void ExpandObjectCmd::DoExecute()
 {
 	m_object->SetExpanded( m_expand );
+
+	if ( GetJournal() )
+		GetJournal()->ObjectExpanded( m_object );
 }
 
 void ExpandObjectCmd::DoRestore()
 {
 	m_object->SetExpanded( !m_expand );
+
+	if ( GetJournal() )
+		GetJournal()->ObjectExpanded( m_object );
 }
 
 InsertObjectCmd::InsertObjectCmd( ApplicationData *data, PObjectBase object,
@@ -263,6 +287,9 @@ void InsertObjectCmd::DoExecute()
 	if ( m_pos >= 0 )
 		m_parent->ChangeChildPosition( m_object, m_pos );
 
+	if ( GetJournal() )
+		GetJournal()->ObjectInserted( m_object );
+
 	PObjectBase obj = m_object;
 	while ( obj && obj->GetObjectInfo()->GetObjectType()->IsItem() )
 	{
@@ -276,6 +303,9 @@ void InsertObjectCmd::DoExecute()
 
 void InsertObjectCmd::DoRestore()
 {
+	if ( GetJournal() )
+		GetJournal()->ObjectRemoving( m_object );
+
 	m_parent->RemoveChild( m_object );
 	m_object->SetParent( PObjectBase() );
 	m_data->SelectObject( m_oldSelected );
@@ -294,6 +324,9 @@ RemoveObjectCmd::RemoveObjectCmd( ApplicationData *data, PObjectBase object )
 
 void RemoveObjectCmd::DoExecute()
 {
+	if ( GetJournal() )
+		GetJournal()->ObjectRemoving( m_object );
+
 	m_parent->RemoveChild( m_object );
 	m_object->SetParent( PObjectBase() );
 	m_data->DetermineObjectToSelect( m_parent, m_oldPos );
@@ -306,6 +339,10 @@ void RemoveObjectCmd::DoRestore()
 
 	// restauramos la posición
 	m_parent->ChangeChildPosition( m_object, m_oldPos );
+
+	if ( GetJournal() )
+		GetJournal()->ObjectInserted( m_object );
+
 	m_data->SelectObject( m_oldSelected, true, false );
 }
 
@@ -320,11 +357,17 @@ ModifyPropertyCmd::ModifyPropertyCmd( PProperty prop, wxString value )
 void ModifyPropertyCmd::DoExecute()
 {
 	m_property->SetValue( m_newValue );
+
+	if ( GetJournal() )
+		GetJournal()->PropertyModified( m_property );
 }
 
 void ModifyPropertyCmd::DoRestore()
 {
 	m_property->SetValue( m_oldValue );
+
+	if ( GetJournal() )
+		GetJournal()->PropertyModified( m_property );
 }
 
 //-----------------------------------------------------------------------------
@@ -338,11 +381,17 @@ ModifyEventHandlerCmd::ModifyEventHandlerCmd( PEvent event, wxString value )
 void ModifyEventHandlerCmd::DoExecute()
 {
 	m_event->SetValue( m_newValue );
+
+	if ( GetJournal() )
+		GetJournal()->EventModified( m_event );
 }
 
 void ModifyEventHandlerCmd::DoRestore()
 {
 	m_event->SetValue( m_oldValue );
+
+	if ( GetJournal() )
+		GetJournal()->EventModified( m_event );
 }
 
 //-----------------------------------------------------------------------------
@@ -362,8 +411,15 @@ void ShiftChildCmd::DoExecute()
 {
 	if ( m_oldPos != m_newPos )
 	{
+		ProjectJournal::Path oldPath;
+		if ( GetJournal() )
+			ProjectJournal::GetPath( m_object, &oldPath );
+
 		PObjectBase parent ( m_object->GetParent() );
 		parent->ChangeChildPosition( m_object, m_newPos );
+
+		if ( GetJournal() )
+			GetJournal()->ObjectMoved( oldPath, m_object );
 	}
 }
 
@@ -371,8 +427,15 @@ void ShiftChildCmd::DoRestore()
 {
 	if ( m_oldPos != m_newPos )
 	{
+		ProjectJournal::Path oldPath;
+		if ( GetJournal() )
+			ProjectJournal::GetPath( m_object, &oldPath );
+
 		PObjectBase parent ( m_object->GetParent() );
 		parent->ChangeChildPosition( m_object, m_oldPos );
+
+		if ( GetJournal() )
+			GetJournal()->ObjectMoved( oldPath, m_object );
 	}
 }
 
@@ -392,6 +455,9 @@ void CutObjectCmd::DoExecute()
 	// guardamos el clipboard ???
 	//m_clipboard = m_data->GetClipboardObject();
 
+	if ( GetJournal() )
+		GetJournal()->ObjectRemoving( m_object );
+
 	m_data->SetClipboardObject( m_object );
 	m_parent->RemoveChild( m_object );
 	m_object->SetParent( PObjectBase() );
@@ -405,7 +471,8 @@ void CutObjectCmd::DoRestore()
 	m_object->SetParent( m_parent );
 	m_parent->ChangeChildPosition( m_object, m_oldPos );
 
-
+	if ( GetJournal() )
+		GetJournal()->ObjectInserted( m_object );
 
 	// restauramos el clipboard
 	//m_data->SetClipboardObject(m_clipboard);
@@ -425,17 +492,31 @@ ReparentObjectCmd ::ReparentObjectCmd ( PObjectBase sizeritem, PObjectBase sizer
 
 void ReparentObjectCmd::DoExecute()
 {
+	ProjectJournal::Path oldPath;
+	if ( GetJournal() )
+		ProjectJournal::GetPath( m_sizeritem, &oldPath );
+
 	m_oldSizer->RemoveChild( m_sizeritem );
 	m_sizeritem->SetParent( m_sizer );
 	m_sizer->AddChild( m_sizeritem );
+
+	if ( GetJournal() )
+		GetJournal()->ObjectMoved( oldPath, m_sizeritem );
 }
 
 void ReparentObjectCmd::DoRestore()
 {
+	ProjectJournal::Path oldPath;
+	if ( GetJournal() )
+		ProjectJournal::GetPath( m_sizeritem, &oldPath );
+
 	m_sizer->RemoveChild( m_sizeritem );
 	m_sizeritem->SetParent( m_oldSizer );
 	m_oldSizer->AddChild( m_sizeritem );
 	m_oldSizer->ChangeChildPosition( m_sizeritem, m_oldPosition);
+
+	if ( GetJournal() )
+		GetJournal()->ObjectMoved( oldPath, m_sizeritem );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -473,6 +554,14 @@ ApplicationData::ApplicationData( const wxString &rootdir )
 		m_modFlag( false ),
 		m_warnOnAdditionsUpdate( true ),
 		m_objDb( new ObjectDatabase() ),
+		m_journal( m_objDb ),
+		m_saver( new ProjectSaver ),
+		m_changeCount( 0 ),
+		m_saveChangeCount( 0 ),
+		m_saveJournalPosition( wxInvalidOffset ),
+		m_saveFailed( false ),
+		m_projectModified( false ),
+		m_savingProject( false ),
 		m_manager( new wxFBManager ),
 		m_ipc( new wxFBIPC ),
 		m_fbpVerMajor( 1 ),
@@ -494,10 +583,15 @@ ApplicationData::ApplicationData( const wxString &rootdir )
 	// Support for loading files from archives
 	wxFileSystem::AddHandler( new wxArchiveFSHandler );
 	wxFileSystem::AddHandler( new wxFilterFSHandler );
+
+	m_cmdProc.SetJournal( &m_journal );
 }
 
 ApplicationData::~ApplicationData()
 {
+	// Closing normally, the changes not saved were not wanted
+	m_journal.Discard();
+
 	#ifdef __WXFB_DEBUG__
         delete m_debugLogTarget;
         m_debugLogTarget = 0;
@@ -598,7 +692,13 @@ void ApplicationData::ResolveNameConflict( PObjectBase obj )
 		it = name_set.find( name );
 	}
 
-	nameProp->SetValue( name );
+	if ( name != originalName )
+	{
+		nameProp->SetValue( name );
+
+		// The object is already in the journal with its original name
+		m_journal.PropertyModified( nameProp );
+	}
 }
 
 void ApplicationData::ResolveSubtreeNameConflicts( PObjectBase obj, PObjectBase topObj )
@@ -931,7 +1031,7 @@ bool ApplicationData::PasteObjectFromClipboard( PObjectBase parent )
         }
 	}
 
-    if ( wxTheClipboard->IsSupported( wxFBDataObjectFormat ) )
+    if ( wxTheClipboard->IsSupported( wxFBBinaryDataObjectFormat ) || wxTheClipboard->IsSupported( wxFBDataObjectFormat ) )
     {
         wxFBDataObject data;
         if ( wxTheClipboard->GetData( data ) )
@@ -961,7 +1061,7 @@ bool ApplicationData::CanPasteObjectFromClipboard()
         }
 	}
 
-	bool canPaste = wxTheClipboard->IsSupported( wxFBDataObjectFormat );
+	bool canPaste = ( wxTheClipboard->IsSupported( wxFBBinaryDataObjectFormat ) || wxTheClipboard->IsSupported( wxFBDataObjectFormat ) );
 
 	if( wxTheClipboard->IsOpened() )
 		wxTheClipboard->Close();
@@ -1179,6 +1279,8 @@ void ApplicationData::MergeProject( PObjectBase project )
 		value.Trim();
 		value << wxT(" ") << project->GetPropertyAsString( _("bitmaps") );
 		prop->SetValue( value );
+		m_journal.PropertyModified( prop );
+		ObjectModified( thisProject );
 	}
 	prop = thisProject->GetProperty( _("icons") );
 	if ( prop )
@@ -1187,6 +1289,8 @@ void ApplicationData::MergeProject( PObjectBase project )
 		value.Trim();
 		value << wxT(" ") << project->GetPropertyAsString( _("icons") );
 		prop->SetValue( value );
+		m_journal.PropertyModified( prop );
+		ObjectModified( thisProject );
 	}
 
 	NotifyProjectRefresh();
@@ -1220,6 +1324,14 @@ void ApplicationData::ModifyEventHandler( PEvent evt, wxString value )
 
 void ApplicationData::SaveProject( const wxString& filename )
 {
+	if ( m_saver->IsSaving() )
+	{
+		m_pendingSave = filename;
+		return;
+	}
+
+	COUNT_CONVERSIONS( wxT("Save") )
+
 	// Make sure this file is not already open
 
 	if ( !m_ipc->VerifySingleInstance( filename, false ) )
@@ -1233,862 +1345,623 @@ void ApplicationData::SaveProject( const wxString& filename )
 		return;
 	}
 
-	try
-	{
-		ticpp::Document doc;
-		m_project->Serialize( &doc );
-		doc.SaveFile( std::string( filename.mb_str( wxConvFile ) ) );
+	// Only the projects which need version 1.14 are saved with it, the others can
+	// still be opened by older versions of wxFormBuilder
+	bool sparse = ( m_project->GetPropertyAsInteger( wxT( "sparse_file" ) ) != 0 );
+	wxString formDir = m_project->GetPropertyAsString( wxT( "form_files" ) );
+	int minor = ( sparse || !formDir.empty() ? FBP_VERSION_MINOR_EXTENDED : m_fbpVerMinor );
 
-		m_projectFile = filename;
-		SetProjectPath( ::wxPathOnly( filename ) );
-		m_modFlag = false;
-		m_cmdProc.SetSavePoint();
-		NotifyProjectSaved();
-	}
-	catch ( ticpp::Exception& ex )
+	// Only the values are copied here, the files are formatted and written by the saver
+	boost::shared_ptr< ProjectSnapshot > snapshot( new ProjectSnapshot( m_fbpVerMajor, minor ) );
+	if ( sparse )
 	{
-		wxString message = _WXSTR( ex.m_details );
-
-		if ( message.empty() )
-		{
-			message = wxString( ex.m_details.c_str(), wxConvFile );
-		}
-
-		THROW_WXFBEX( message )
+		snapshot->SetSparse( m_objDb->GetDefaultsVersions() );
 	}
-}
-
-bool ApplicationData::LoadProject( const wxString &file, bool checkSingleInstance )
-
-{
-	LogDebug( wxT( "LOADING" ) );
-
-	if ( !wxFileName::FileExists( file ) )
+	boost::shared_ptr< ProjectCache > cache;
+	if ( formDir.empty() )
 	{
-		wxLogError( wxT( "This file does not exist: %s" ), file.c_str() );
-		return false;
-	}
+		snapshot->AddProject( filename, m_project );
+		m_savingFormFiles.clear();
 
-	if ( checkSingleInstance )
+		// Written by the saver from the snapshot
+		cache.reset( new ProjectCache( m_objDb ) );
+	}
+	else
 	{
-		if ( !m_ipc->VerifySingleInstance( file ) )
-		{
-			return false;
-		}
+		AddFormFiles( snapshot.get(), filename, formDir );
 	}
 
-	try
+	// Checked once the snapshot is built, which can load the children of the forms
+	if ( m_project->IsIncomplete() )
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, false, file );
-
-		ticpp::Element* root = doc.FirstChildElement();
-
-		m_objDb->ResetObjectCounters();
+		m_savingFormFiles.clear();
+		if ( wxYES == wxMessageBox( wxString::Format( wxT( "Some objects of the project could not be loaded, it cannot be saved without losing them.
+Would you like to reload it from %s?
 
-		int fbpVerMajor = 0;
-		int fbpVerMinor = 0;
-
-		if ( root->Value() != std::string( "object" ) )
+NOTE: The changes made since it was opened will be lost!" ), m_projectFile.c_str() ),
+		                            wxT( "Incomplete Project" ), wxICON_ERROR | wxYES_NO, wxTheApp->GetTopWindow() ) )
 		{
-			try
-			{
-				ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
-				fileVersion->GetAttributeOrDefault( "major", &fbpVerMajor, 0 );
-				fileVersion->GetAttributeOrDefault( "minor", &fbpVerMinor, 0 );
-			}
-			catch( ticpp::Exception& )
+			// Read from the file, the cache could be the cause
+			wxString cachePath = ProjectCache::GetCachePath( m_projectFile );
+			if ( ::wxFileExists( cachePath ) )
 			{
+				::wxRemoveFile( cachePath );
 			}
+			LoadProject( m_projectFile, false );
 		}
+		return;
+	}
 
-		bool older = false;
-		bool newer = false;
-
-		if ( m_fbpVerMajor == fbpVerMajor )
-		{
-			older = ( fbpVerMinor < m_fbpVerMinor );
-			newer = ( fbpVerMinor > m_fbpVerMinor );
-		}
-		else
-		{
-			older = ( fbpVerMajor < m_fbpVerMajor );
-			newer = ( fbpVerMajor > m_fbpVerMajor );
-		}
+	// Changes made from now on are saved next time
+	m_savingForms.clear();
+	m_savingForms.swap( m_modifiedForms );
+	m_savingProject = m_projectModified;
+	m_projectModified = false;
 
-		if ( newer )
-		{
-			wxMessageBox( wxT( "This project file is newer than this version of wxFormBuilder.\n" )
-			              wxT( "It cannot be opened.\n\n" )
-			              wxT( "Please download an updated version from http://www.wxFormBuilder.org" ), _( "New Version" ), wxICON_ERROR );
-			return false;
-		}
+	m_saveChangeCount = m_changeCount;
+	m_saveJournalPosition = m_journal.GetPosition();
+	m_saver->Start( snapshot, filename, cache );
+}
 
-		if ( older )
-		{
-			if ( wxYES == wxMessageBox( wxT( "This project file is not of the current version.\n" )
-			                            wxT( "Would you to attempt automatic conversion?\n\n" )
-			                            wxT( "NOTE: This will modify your project file on disk!" ), _( "Old Version" ), wxYES_NO ) )
-			{
-				// we make a backup of the project
-				::wxCopyFile( file, file + wxT( ".bak" ) );
+void ApplicationData::AddFormFiles( ProjectSnapshot* snapshot, const wxString& filename, const wxString& formDir )
+{
+	wxString projectDir = ::wxPathOnly( filename );
+	wxString dir = formDir;
+	dir.Replace( wxT( "\\" ), wxT( "/" ) );
 
-				if ( !ConvertProject( file, fbpVerMajor, fbpVerMinor ) )
-				{
-					wxLogError( wxT( "Unable to convert project" ) );
-					return false;
-				}
+	std::vector< wxString > files;
+	std::set< wxString > used;
+	m_savingFormFiles.clear();
+	bool projectChanged = m_projectModified || filename != m_projectFile;
 
-				XMLUtils::LoadXMLFile( doc, false, file );
-				root = doc.FirstChildElement();
-			}
-			else
-			{
-				return false;
-			}
-		}
-
-		ticpp::Element* object = root->FirstChildElement( "object" );
-		PObjectBase proj;
+	for ( unsigned int i = 0; i < m_project->GetChildCount(); i++ )
+	{
+		PObjectBase form = m_project->GetChild( i );
 
-		try
+		// Named after the form, which should be unique anyway
+		wxString name = form->GetPropertyAsString( wxT( "name" ) );
+		if ( name.empty() )
 		{
-			proj = m_objDb->CreateObject( object );
+			name = form->GetClassName();
 		}
-		catch ( wxFBException& ex )
+
+		wxFileName relative( dir + wxT( "/" ) + name + wxT( ".fbf" ), wxPATH_UNIX );
+		for ( int suffix = 2; used.count( relative.GetFullPath( wxPATH_UNIX ).Lower() ) > 0; ++suffix )
 		{
-			wxLogError( ex.what() );
-			return false;
+			relative.SetName( wxString::Format( wxT( "%s_%d" ), name.c_str(), suffix ) );
 		}
+		used.insert( relative.GetFullPath( wxPATH_UNIX ).Lower() );
+		files.push_back( relative.GetFullPath( wxPATH_UNIX ) );
+
+		wxFileName absolute( relative );
+		absolute.MakeAbsolute( projectDir );
+		wxString path = absolute.GetFullPath();
+		m_savingFormFiles[ form ] = path;
 
-		if ( proj && proj->GetObjectTypeName() == wxT( "project" ) )
+		// Forms are written when they changed, or when they have to be moved
+		ProjectLoader::FormFileMap::iterator old = m_formFiles.find( form );
+		bool moved = ( old == m_formFiles.end() || old->second != path );
+		if ( moved || m_modifiedForms.count( form ) > 0 )
 		{
-			PObjectBase old_proj = m_project;
-			m_project = proj;
-			m_selObj = m_project;
-			m_modFlag = false;
-			m_cmdProc.Reset();
-			m_projectFile = file;
-			SetProjectPath( ::wxPathOnly( file ) );
-			NotifyProjectLoaded();
-			NotifyProjectRefresh();
+			snapshot->AddForm( path, form );
 		}
+		projectChanged = projectChanged || moved;
 	}
-	catch( ticpp::Exception& ex )
+
+	if ( projectChanged || m_formFiles.size() != m_savingFormFiles.size() )
 	{
-		wxLogError( _WXSTR( ex.m_details ) );
-		return false;
+		snapshot->AddProject( filename, m_project, files );
 	}
+}
 
-	return true;
+bool ApplicationData::IsSaving()
+{
+	return m_saver->IsSaving();
 }
 
-bool ApplicationData::ConvertProject( const wxString& path, int fileMajor, int fileMinor )
+bool ApplicationData::WaitForSave()
 {
-	try
+	bool saved = true;
+	while ( m_saver->IsSaving() )
 	{
-		ticpp::Document doc;
-		XMLUtils::LoadXMLFile( doc, false, path );
-
-		ticpp::Element* root = doc.FirstChildElement();
-
-		if ( root->Value() == std::string( "object" ) )
-		{
-			ConvertProjectProperties( root, path, fileMajor, fileMinor );
-			ConvertObject( root, fileMajor, fileMinor );
-
-			// Create a clone of now-converted object tree, so it can be linked
-			// underneath the root element
-			std::auto_ptr< ticpp::Node > objectTree = root->Clone();
-
-			// Clear the document to add the declatation and the root element
-			doc.Clear();
-
-			// Add the declaration
-			doc.LinkEndChild( new ticpp::Declaration( "1.0", "UTF-8", "yes" ) );
+		m_saver->Wait();
+		saved = saved && !m_saveFailed;
+	}
+	return saved;
+}
 
-			// Add the root element, with file version
-			ticpp::Element* newRoot = new ticpp::Element( "wxFormBuilder_Project" );
+void ApplicationData::ProjectSaveProgress( int percent )
+{
+	NotifyProjectSaving( percent );
+}
 
-			ticpp::Element* fileVersion = new ticpp::Element( "FileVersion" );
-			fileVersion->SetAttribute( "major", m_fbpVerMajor );
-			fileVersion->SetAttribute( "minor", m_fbpVerMinor );
+void ApplicationData::ProjectSaveFinished( const wxString& filename, bool saved, const wxString& error )
+{
+	m_saveFailed = !saved;
+	if ( saved )
+	{
+		bool changed = ( m_changeCount != m_saveChangeCount );
 
-			newRoot->LinkEndChild( fileVersion );
+		// The journal starts again from the saved file, with the changes made
+		// while it was being written
+		m_journal.Restart( filename, changed ? m_saveJournalPosition : wxInvalidOffset );
 
-			// Add the object tree
-			newRoot->LinkEndChild( objectTree.release() );
+		// The files of forms which were renamed or removed are not part of the project anymore
+		std::set< wxString > files;
+		ProjectLoader::FormFileMap::iterator form;
+		for ( form = m_savingFormFiles.begin(); form != m_savingFormFiles.end(); ++form )
+		{
+			files.insert( form->second );
+		}
+		for ( form = m_formFiles.begin(); form != m_formFiles.end(); ++form )
+		{
+			if ( files.count( form->second ) == 0 && ::wxFileExists( form->second ) )
+			{
+				::wxRemoveFile( form->second );
+			}
+		}
+		m_formFiles.swap( m_savingFormFiles );
+		m_savingFormFiles.clear();
+		m_savingForms.clear();
 
-			doc.LinkEndChild( newRoot );
+		m_projectFile = filename;
+		SetProjectPath( ::wxPathOnly( filename ) );
+		if ( changed )
+		{
+			m_cmdProc.ClearSavePoint();
 		}
 		else
 		{
-			// Handle project separately because it only occurs once
-			ticpp::Element* project = root->FirstChildElement( "object" );
-			ConvertProjectProperties( project, path, fileMajor, fileMinor );
-			ConvertObject( project, fileMajor, fileMinor );
-			ticpp::Element* fileVersion = root->FirstChildElement( "FileVersion" );
-			fileVersion->SetAttribute( "major", m_fbpVerMajor );
-			fileVersion->SetAttribute( "minor", m_fbpVerMinor );
+			m_modFlag = false;
+			m_cmdProc.SetSavePoint();
 		}
-
-		doc.SaveFile();
+		NotifyProjectSaved();
 	}
-	catch ( ticpp::Exception& ex )
+	else
 	{
-		wxLogError( _WXSTR( ex.m_details ) );
-		return false;
+		wxLogError( error );
+
+		// Whatever was being saved still has to be saved
+		m_modifiedForms.insert( m_savingForms.begin(), m_savingForms.end() );
+		m_projectModified = m_projectModified || m_savingProject;
+		m_savingFormFiles.clear();
+		m_savingForms.clear();
 	}
 
-	return true;
+	// The requests made while saving are saved together
+	if ( !m_pendingSave.empty() )
+	{
+		wxString pending = m_pendingSave;
+		m_pendingSave.clear();
+
+		if ( !saved || pending != filename || m_changeCount != m_saveChangeCount )
+		{
+			SaveProject( pending );
+		}
+	}
 }
 
-void ApplicationData::ConvertProjectProperties( ticpp::Element* project, const wxString& path, int fileMajor, int fileMinor )
+bool ApplicationData::LoadProject( const wxString &file, bool checkSingleInstance )
 
 {
-	// Ensure that this is the "project" element
-	std::string objClass;
-	project->GetAttribute( "class", &objClass );
+	StartupProfile::Timer timer( "ApplicationData::LoadProject", file );
+	LogDebug( wxT( "LOADING" ) );
+	COUNT_CONVERSIONS( wxT("Load") )
+
+	WaitForSave();
 
-	if ( objClass != "Project" )
+	if ( !wxFileName::FileExists( file ) )
 	{
-		return;
+		wxLogError( wxT( "This file does not exist: %s" ), file.c_str() );
+		return false;
 	}
 
-	// Reusable sets for finding properties
-	std::set< std::string > oldProps;
-	std::set< ticpp::Element* > newProps;
-
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 5 ) )
+	if ( checkSingleInstance )
 	{
-		// Find the user_headers property
-
-		oldProps.insert( "user_headers" );
-		GetPropertiesToConvert( project, oldProps, &newProps );
-
-		std::string user_headers;
-		if ( !newProps.empty() )
-		{
-			user_headers = ( *newProps.begin() )->GetText( false );
-			project->RemoveChild( *newProps.begin() );
-		}
-
-		if ( !user_headers.empty() )
+		if ( !m_ipc->VerifySingleInstance( file ) )
 		{
-			wxString 	msg  = _( "The \"user_headers\" property has been removed.\n" );
-			msg += _( "Its purpose was to provide a place to include precompiled headers or\n" );
-			msg += _( "headers for subclasses.\n" );
-			msg += _( "There is now a \"precompiled_header\" property and a \"header\" subitem\n" );
-			msg += _( "on the subclass property.\n\n" );
-			msg += _( "Would you like the current value of the \"user_headers\" property to be saved\n" );
-			msg += _( "to a file so that you can distribute the headers among the \"precompiled_header\"\n" );
-			msg += _( "and \"subclass\" properties\?" );
-
-			if ( wxYES == wxMessageBox( msg, _( "The \"user_headers\" property has been removed" ), wxICON_QUESTION | wxYES_NO | wxYES_DEFAULT, wxTheApp->GetTopWindow() ) )
-			{
-				wxString name;
-				wxFileName::SplitPath( path, NULL, NULL, &name, NULL );
-				wxFileDialog dialog( wxTheApp->GetTopWindow(), _( "Save \"user_headers\"" ), ::wxPathOnly( path ),
-				                     name + wxT( "_user_headers.txt" ), wxT( "All files (*.*)|*.*" ), wxFD_SAVE );
-
-				if ( dialog.ShowModal() == wxID_OK )
-				{
-					wxString wxuser_headers = _WXSTR( user_headers );
-					wxString filename = dialog.GetPath();
-					bool success = false;
-					wxFFile output( filename, wxT( "w" ) );
-
-					if ( output.IsOpened() )
-					{
-						if ( output.Write( wxuser_headers ) )
-						{
-							output.Close();
-							success = true;
-						}
-					}
-
-					if ( !success )
-					{
-						wxLogError( _( "Unable to open %s for writing.\nUser Headers:\n%s" ), filename.c_str(), wxuser_headers.c_str() );
-					}
-				}
-			}
+			return false;
 		}
 	}
 
+	PObjectBase proj;
+	ProjectLoader::FormFileMap formFiles;
 
-	// The pch property is now the exact code to be generated, not just the header filename
-	// The goal of this conversion block is to determine which of two possible pch blocks to use
-	// The pch block that wxFB generated changed in version 1.6
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 8 ) )
+	try
 	{
-		oldProps.clear();
-		newProps.clear();
-		oldProps.insert( "precompiled_header" );
-		GetPropertiesToConvert( project, oldProps, &newProps );
+		// Unchanged projects are rebuilt from their cache
+		ProjectCache cache( m_objDb );
+		m_objDb->ResetObjectCounters();
+		proj = cache.Load( file );
 
-		if ( !newProps.empty() )
+		if ( !proj )
 		{
-			std::string pch = ( *newProps.begin() )->GetText( false );
-			if ( !pch.empty() )
+			unsigned int dropped = m_objDb->GetDroppedCount();
+
+			// Projects of the current version are built while the file is parsed,
+			// only older files need the DOM to be converted
+			m_objDb->ResetObjectCounters();
+			ProjectLoader loader( m_objDb, m_fbpVerMajor, m_fbpVerMinor );
+			if ( loader.Load( file ) )
 			{
-				if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 6 ) )
-				{
-					// use the older block
-					( *newProps.begin() )->SetText(
-														  "#include \"" + pch + "\""
-														"\n"
-														"\n#ifdef __BORLANDC__"
-														"\n#pragma hdrstop"
-														"\n#endif //__BORLANDC__"
-														"\n"
-														"\n#ifndef WX_PRECOMP"
-														"\n#include <wx/wx.h>"
-														"\n#endif //WX_PRECOMP"
-													);
-				}
-				else
+				proj = loader.GetProject();
+				formFiles = loader.GetFormFiles();
+			}
+			else
+			{
+				m_objDb->ResetObjectCounters();
+				if ( !LoadProjectDocument( file, &proj, &formFiles ) )
 				{
-					// use the newer block
-					( *newProps.begin() )->SetText(
-														  "#ifdef WX_PRECOMP"
-														"\n"
-														"\n#include \"" + pch + "\""
-														"\n"
-														"\n#ifdef __BORLANDC__"
-														"\n#pragma hdrstop"
-														"\n#endif //__BORLANDC__"
-														"\n"
-														"\n#else"
-														"\n#include <wx/wx.h>"
-														"\n#endif //WX_PRECOMP"
-													);
+					return false;
 				}
 			}
-		}
-	}
 
-	// The format of string list properties changed in version 1.9
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 9 ) )
-	{
-		oldProps.clear();
-		newProps.clear();
-		oldProps.insert( "namespace" );
-		oldProps.insert( "bitmaps" );
-		oldProps.insert( "icons" );
-		GetPropertiesToConvert( project, oldProps, &newProps );
-
-		std::set< ticpp::Element* >::iterator prop;
-		for ( prop = newProps.begin(); prop != newProps.end(); ++prop )
-		{
-			std::string value = ( *prop )->GetText( false );
-			if ( !value.empty() )
+			// Only written if the whole tree was built, e.g. for converted
+			// projects, otherwise it is written when the project is saved.
+			// The cache must not hide the errors of an incomplete load.
+			if ( m_objDb->GetDroppedCount() == dropped )
 			{
-				wxArrayString array = TypeConv::OldStringToArrayString( _WXSTR( value ) );
-				( *prop )->SetText( _STDSTR( TypeConv::ArrayStringToString( array ) ) );
+				cache.Save( file, proj );
 			}
 		}
 	}
-
-	// event_handler moved to the forms in version 1.10
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 10 ) )
+	catch ( wxFBException& ex )
 	{
-		oldProps.clear();
-		newProps.clear();
-		oldProps.insert( "event_handler" );
-		GetPropertiesToConvert( project, oldProps, &newProps );
-
-
-		if ( !newProps.empty() )
-		{
-			ticpp::Iterator< ticpp::Element > object( "object" );
-			for ( object = project->FirstChildElement( "object", false ); object != object.end(); ++object )
-			{
-				object->LinkEndChild( ( *newProps.begin() )->Clone().get() );
-			}
-
-			project->RemoveChild( *newProps.begin() );
-		}
+		wxLogError( ex.what() );
+		return false;
 	}
-}
-
-void ApplicationData::ConvertObject( ticpp::Element* parent, int fileMajor, int fileMinor )
-{
-	ticpp::Iterator< ticpp::Element > object( "object" );
-
-	for ( object = parent->FirstChildElement( "object", false ); object != object.end(); ++object )
+	catch( ticpp::Exception& ex )
 	{
-		ConvertObject( object.Get(), fileMajor, fileMinor );
+		wxLogError( _WXSTR( ex.m_details ) );
+		return false;
 	}
 
-	// Reusable sets to find properties with
-	std::set< std::string > oldProps;
-
-	std::set< ticpp::Element* > newProps;
-
-	std::set< ticpp::Element* >::iterator newProp;
-
-	// Get the class of the object
-	std::string objClass;
-
-	parent->GetAttribute( "class", &objClass );
-
-	/* The changes below will convert an unversioned file to version 1.3 */
-
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 3 ) )
+	if ( proj && proj->GetObjectTypeName() == wxT( "project" ) )
 	{
-		// The property 'option' became 'proportion'
+		// The changes of the project being closed were not wanted
+		m_journal.Discard();
 
-		if ( objClass == "sizeritem" ||  objClass == "gbsizeritem" || objClass == "spacer" )
+		bool recovered = false;
+		if ( ProjectJournal::CanRecover( file ) )
 		{
-			oldProps.clear();
-			newProps.clear();
-			oldProps.insert( "option" );
-			GetPropertiesToConvert( parent, oldProps, &newProps );
-
-			if ( !newProps.empty() )
+			if ( wxYES == wxMessageBox( wxString::Format( wxT( "There are unsaved changes to %s from a previous session.\nWould you like to recover them?" ), file.c_str() ),
+			                            wxT( "Recover Changes" ), wxICON_QUESTION | wxYES_NO, wxTheApp->GetTopWindow() ) )
 			{
-				// One in, one out
-				( *newProps.begin() )->SetAttribute( "name", "proportion" );
+				unsigned int changes;
+				if ( !m_journal.Recover( file, proj, &changes ) )
+				{
+					// Some changes could have been applied, start again from the file
+					wxLogError( wxT( "The changes to %s could not be recovered" ), file.c_str() );
+					::wxRemoveFile( ProjectJournal::GetJournalPath( file ) );
+					return LoadProject( file, false );
+				}
+				LogDebug( wxT( "Recovered %u changes" ), changes );
+				recovered = true;
 			}
 		}
 
-		// The 'style' property used to have both wxWindow styles and the styles of the specific controls
-		// now it only has the styles of the specfic controls, and wxWindow styles are saved in window_style
-		// This also applies to 'extra_style', which was once combined with 'style'.
-		// And they were named 'WindowStyle' and one point, too...
-
-		std::set< wxString > windowStyles;
-		windowStyles.insert( wxT( "wxSIMPLE_BORDER" ) );
-		windowStyles.insert( wxT( "wxDOUBLE_BORDER" ) );
-		windowStyles.insert( wxT( "wxSUNKEN_BORDER" ) );
-		windowStyles.insert( wxT( "wxRAISED_BORDER" ) );
-		windowStyles.insert( wxT( "wxSTATIC_BORDER" ) );
-		windowStyles.insert( wxT( "wxNO_BORDER" ) );
-		windowStyles.insert( wxT( "wxTRANSPARENT_WINDOW" ) );
-		windowStyles.insert( wxT( "wxTAB_TRAVERSAL" ) );
-		windowStyles.insert( wxT( "wxWANTS_CHARS" ) );
-		windowStyles.insert( wxT( "wxVSCROLL" ) );
-		windowStyles.insert( wxT( "wxHSCROLL" ) );
-		windowStyles.insert( wxT( "wxALWAYS_SHOW_SB" ) );
-		windowStyles.insert( wxT( "wxCLIP_CHILDREN" ) );
-		windowStyles.insert( wxT( "wxFULL_REPAINT_ON_RESIZE" ) );
-
-		// Transfer the window styles
-		oldProps.clear();
-		newProps.clear();
-
-		oldProps.insert( "style" );
-
-		oldProps.insert( "WindowStyle" );
-
-		GetPropertiesToConvert( parent, oldProps, &newProps );
-
-		for ( newProp = newProps.begin(); newProp != newProps.end(); ++newProp )
+		if ( !recovered )
 		{
-			TransferOptionList( *newProp, &windowStyles, "window_style" );
+			m_journal.Start( file );
 		}
 
+		m_formFiles.swap( formFiles );
+		m_modifiedForms.clear();
+		m_projectModified = recovered;
+		if ( recovered )
+		{
+			// The recovered changes were not made through commands, all the files are saved
+			for ( unsigned int i = 0; i < proj->GetChildCount(); i++ )
+			{
+				m_modifiedForms.insert( proj->GetChild( i ) );
+			}
+		}
 
-		std::set< wxString > extraWindowStyles;
-		extraWindowStyles.insert( wxT( "wxWS_EX_VALIDATE_RECURSIVELY" ) );
-		extraWindowStyles.insert( wxT( "wxWS_EX_BLOCK_EVENTS" ) );
-		extraWindowStyles.insert( wxT( "wxWS_EX_TRANSIENT" ) );
-		extraWindowStyles.insert( wxT( "wxWS_EX_PROCESS_IDLE" ) );
-		extraWindowStyles.insert( wxT( "wxWS_EX_PROCESS_UI_UPDATES" ) );
-
-		// Transfer the window extra styles
-		oldProps.clear();
-		newProps.clear();
-
-		oldProps.insert( "style" );
+		PObjectBase old_proj = m_project;
+		m_project = proj;
+		m_selObj = m_project;
+		m_modFlag = recovered;
+		m_cmdProc.Reset();
+		if ( recovered )
+		{
+			// Undo can't go back to the saved file
+			m_cmdProc.ClearSavePoint();
+		}
+		m_projectFile = file;
+		SetProjectPath( ::wxPathOnly( file ) );
+		NotifyProjectLoaded();
+		NotifyProjectRefresh();
+	}
 
-		oldProps.insert( "extra_style" );
+	return true;
+}
 
-		oldProps.insert( "WindowStyle" );
+bool ApplicationData::LoadProjectDocument( const wxString &file, PObjectBase* proj, ProjectLoader::FormFileMap* formFiles )
+{
+	ticpp::Document doc;
+	XMLUtils::LoadXMLFile( doc, false, file );
 
-		GetPropertiesToConvert( parent, oldProps, &newProps );
+	ticpp::Element* root = doc.FirstChildElement();
 
-		for ( newProp = newProps.begin(); newProp != newProps.end(); ++newProp )
-		{
-			TransferOptionList( *newProp, &extraWindowStyles, "window_extra_style" );
-		}
-	}
+	int fbpVerMajor;
+	int fbpVerMinor;
+	ProjectConverter::GetFileVersion( root, &fbpVerMajor, &fbpVerMinor );
 
-	/* The file is now at least version 1.3 */
+	int comparison = ProjectConverter::CompareFileVersion( fbpVerMajor, fbpVerMinor, m_fbpVerMajor, m_fbpVerMinor );
+	bool older = ( comparison < 0 );
+	bool newer = ( comparison > 0 );
 
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 4 ) )
+	if ( newer )
 	{
-		if ( objClass == "wxCheckList" )
-		{
-			// The class we once named "wxCheckList" really represented a "wxCheckListBox", now that we use the #class macro in
-			// code generation, it generates the wrong code
-			parent->SetAttribute( "class", "wxCheckListBox" );
-		}
+		wxMessageBox( wxT( "This project file is newer than this version of wxFormBuilder.\n" )
+		              wxT( "It cannot be opened.\n\n" )
+		              wxT( "Please download an updated version from http://www.wxFormBuilder.org" ), _( "New Version" ), wxICON_ERROR );
+		return false;
 	}
 
-	/* The file is now at least version 1.4 */
-
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 6 ) )
+	if ( older )
 	{
-		if ( objClass == "spacer" )
+		if ( wxYES == wxMessageBox( wxT( "This project file is not of the current version.\n" )
+		                            wxT( "Would you to attempt automatic conversion?\n\n" )
+		                            wxT( "NOTE: This will modify your project file on disk!" ), _( "Old Version" ), wxYES_NO ) )
 		{
-			// spacer used to be represented by its own class, it is now under a sizeritem like everything else.
-			// no need to check for a wxGridBagSizer, because it was introduced at the same time.
-
-			// the goal is to change the class to sizeritem, then create a spacer child, then move "width" and "height" to the spacer
-			parent->SetAttribute( "class", "sizeritem" );
-			ticpp::Element spacer( "object" );
-			spacer.SetAttribute( "class", "spacer" );
+			// we make a backup of the project
+			::wxCopyFile( file, file + wxT( ".bak" ) );
 
-			oldProps.clear();
-			newProps.clear();
-			oldProps.insert( "width" );
-			GetPropertiesToConvert( parent, oldProps, &newProps );
-
-			if ( !newProps.empty() )
+			// The document is converted as it was loaded, and the objects are built from it
+			try
 			{
-				// One in, one out
-				ticpp::Element* width = *newProps.begin();
-				spacer.LinkEndChild( width->Clone().release() );
-				parent->RemoveChild( width );
-			}
+				ProjectConverter converter( fbpVerMajor, fbpVerMinor );
+				converter.ConvertDocument( &doc, m_fbpVerMajor, m_fbpVerMinor );
 
-			oldProps.clear();
-			newProps.clear();
-			oldProps.insert( "height" );
-			GetPropertiesToConvert( parent, oldProps, &newProps );
+				if ( !converter.GetUserHeaders().empty() )
+				{
+					SaveUserHeaders( converter.GetUserHeaders(), file );
+				}
+				ReportConversion( converter.GetAdditionsUpdated(), converter.GetPropertiesRemoved() );
 
-			if ( !newProps.empty() )
+				doc.SaveFile();
+			}
+			catch ( ticpp::Exception& ex )
 			{
-				// One in, one out
-				ticpp::Element* height = *newProps.begin();
-				spacer.LinkEndChild( height->Clone().release() );
-				parent->RemoveChild( height );
+				wxLogError( _WXSTR( ex.m_details ) );
+				wxLogError( wxT( "Unable to convert project" ) );
+				return false;
 			}
-			parent->LinkEndChild( &spacer );
+
+			root = doc.FirstChildElement();
+		}
+		else
+		{
+			return false;
 		}
 	}
 
-	/* The file is now at least version 1.6 */
+	// Sparse files need the defaults they were written with
+	ObjectDatabase::DefaultsVersionMap defaults;
+	bool sparse = ObjectDatabase::ReadDefaultsVersions( root, &defaults );
 
-	// Version 1.7 now stores all font properties.
-	// The font property conversion is automatic because it is just an extension of the old values.
+	ticpp::Element* object = root->FirstChildElement( "object" );
+	*proj = m_objDb->CreateObject( object, PObjectBase(), sparse ? &defaults : NULL );
 
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 7 ) )
+	// Forms saved in their own files
+	ticpp::Element* form = object->FirstChildElement( "form", false );
+	while ( form && *proj )
 	{
-		// Remove deprecated 2.6 things
+		wxFileName name( _WXSTR( form->GetAttribute( "file" ) ), wxPATH_UNIX );
+		name.MakeAbsolute( ::wxPathOnly( file ) );
 
-		// wxDialog styles wxTHICK_FRAME and wxNO_3D
-		if ( objClass == "Dialog" )
+		ProjectLoader loader( m_objDb, m_fbpVerMajor, m_fbpVerMinor );
+		PObjectBase formObject = loader.LoadForm( name.GetFullPath(), *proj );
+		if ( !formObject )
 		{
-			oldProps.clear();
-			newProps.clear();
-			oldProps.insert( "style" );
-			GetPropertiesToConvert( parent, oldProps, &newProps );
-
-			if ( !newProps.empty() )
-			{
-				ticpp::Element* style = *newProps.begin();
-				wxString styles = _WXSTR( style->GetText( false ) );
-				if ( !styles.empty() )
-				{
-					if ( TypeConv::FlagSet( wxT("wxTHICK_FRAME"), styles ) )
-					{
-						styles = TypeConv::ClearFlag( wxT("wxTHICK_FRAME"), styles );
-						styles = TypeConv::SetFlag( wxT("wxRESIZE_BORDER"), styles );
-					}
-
-					styles = TypeConv::ClearFlag( wxT("wxNO_3D"), styles );
-					style->SetText( _STDSTR( styles ) );
-				}
-			}
+			THROW_WXFBEX( _( "Unable to load the form file: " ) << name.GetFullPath() )
 		}
-	}
+		( *formFiles )[ formObject ] = name.GetFullPath();
 
-	/* The file is now at least version 1.7 */
+		form = form->NextSiblingElement( "form", false );
+	}
 
-	// The update to 1.8 only affected project properties
-	// See ConvertProjectProperties
+	return true;
+}
 
-	/* The file is now at least version 1.8 */
+void ApplicationData::ConvertObject( ticpp::Element* object, int fileMajor, int fileMinor )
+{
+	ProjectConverter converter( fileMajor, fileMinor );
+	converter.ConvertObject( object );
+	ReportConversion( converter.GetAdditionsUpdated(), converter.GetPropertiesRemoved() );
+}
 
-	// stringlist properties are stored in a different format as of version 1.9
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 9 ) )
+void ApplicationData::ReportConversion( bool additionsUpdated, const std::map< std::string, std::set< std::string > >& propertiesRemoved )
+{
+	if( m_warnOnAdditionsUpdate && additionsUpdated )
 	{
-		oldProps.clear();
-		newProps.clear();
+		m_warnOnAdditionsUpdate = false;
+		wxLogWarning( _("Updated classes from wxAdditions. You must use the latest version of wxAdditions to continue.\nNote wxScintilla is now wxStyledListCtrl, wxTreeListCtrl is now wxadditions::wxTreeListCtrl, and wxTreeListCtrlColumn is now wxadditions::wxTreeListCtrlColumn") );
+	}
 
-		if  (	objClass == "wxComboBox"	||
-				objClass == "wxChoice"		||
-				objClass == "wxListBox"		||
-				objClass == "wxRadioBox"	||
-				objClass == "wxCheckListBox"
-			)
-		{
-			oldProps.insert( "choices" );
-		}
-		else if ( objClass == "wxGrid" )
-		{
-			oldProps.insert( "col_label_values" );
-			oldProps.insert( "row_label_values" );
-		}
+	if ( !propertiesRemoved.empty() )
+	{
+		m_objDb->CountDropped();
+	}
 
-		if ( !oldProps.empty() )
+	static std::set< std::string > propertyRemovalWarnings;
+	std::map< std::string, std::set< std::string > >::const_iterator it;
+	for ( it = propertiesRemoved.begin(); it != propertiesRemoved.end(); ++it )
+	{
+		if( 0 == propertyRemovalWarnings.count( it->first ) )
 		{
-			GetPropertiesToConvert( parent, oldProps, &newProps );
+			std::stringstream ss;
+			std::ostream_iterator< std::string > out_it (ss, ", ");
+			std::copy( it->second.begin(), it->second.end(), out_it );
 
-			std::set< ticpp::Element* >::iterator prop;
-			for ( prop = newProps.begin(); prop != newProps.end(); ++prop )
-			{
-				std::string value = ( *prop )->GetText( false );
-				if ( !value.empty() )
-				{
-					wxArrayString array = TypeConv::OldStringToArrayString( _WXSTR( value ) );
-					( *prop )->SetText( _STDSTR( TypeConv::ArrayStringToString( array ) ) );
-				}
-			}
+			wxLogMessage( _("Removed properties for class %s because they are no longer supported: %s"), _WXSTR( it->first ).c_str(), _WXSTR( ss.str() ).c_str() );
+			propertyRemovalWarnings.insert( it->first );
 		}
 	}
+}
 
-	/* The file is now at least version 1.9 */
-
-	// Version 1.11 now stores bitmap property in the following format:
-	// 'source'; 'data' instead of old form 'data'; 'source'.
+void ApplicationData::SaveUserHeaders( const std::string& userHeaders, const wxString& path )
+{
+	wxString 	msg  = _( "The \"user_headers\" property has been removed.\n" );
+	msg += _( "Its purpose was to provide a place to include precompiled headers or\n" );
+	msg += _( "headers for subclasses.\n" );
+	msg += _( "There is now a \"precompiled_header\" property and a \"header\" subitem\n" );
+	msg += _( "on the subclass property.\n\n" );
+	msg += _( "Would you like the current value of the \"user_headers\" property to be saved\n" );
+	msg += _( "to a file so that you can distribute the headers among the \"precompiled_header\"\n" );
+	msg += _( "and \"subclass\" properties\?" );
 
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 11 ) )
+	if ( wxYES == wxMessageBox( msg, _( "The \"user_headers\" property has been removed" ), wxICON_QUESTION | wxYES_NO | wxYES_DEFAULT, wxTheApp->GetTopWindow() ) )
 	{
-		oldProps.clear();
-		newProps.clear();
-		oldProps.insert( "bitmap" );
-		GetPropertiesToConvert( parent, oldProps, &newProps );
+		wxString name;
+		wxFileName::SplitPath( path, NULL, NULL, &name, NULL );
+		wxFileDialog dialog( wxTheApp->GetTopWindow(), _( "Save \"user_headers\"" ), ::wxPathOnly( path ),
+		                     name + wxT( "_user_headers.txt" ), wxT( "All files (*.*)|*.*" ), wxFD_SAVE );
 
-		std::set< ticpp::Element* >::iterator prop;
-		for ( prop = newProps.begin(); prop != newProps.end(); ++prop )
+		if ( dialog.ShowModal() == wxID_OK )
 		{
-			ticpp::Element* bitmap = *prop;
+			wxString wxuser_headers = _WXSTR( userHeaders );
+			wxString filename = dialog.GetPath();
+			bool success = false;
+			wxFFile output( filename, wxT( "w" ) );
 
-			wxString image = _WXSTR( bitmap->GetText( false ) );
-			if ( !image.empty() )
+			if ( output.IsOpened() )
 			{
-				if( image.AfterLast( ';' ).Contains( _("Load From") ) )
+				if ( output.Write( wxuser_headers ) )
 				{
-					wxString source = image.AfterLast( ';' ).Trim().Trim(false);
-					wxString data = image.BeforeLast( ';' ).Trim().Trim(false);
-
-					bitmap->SetText( _STDSTR( source + wxT("; ") + data ) );
+					output.Close();
+					success = true;
 				}
 			}
-		}
-
-		/* oldProps.clear();
-		newProps.clear();
-		oldProps.insert( "choices" );
-		GetPropertiesToConvert( parent, oldProps, &newProps );
-
-		for ( prop = newProps.begin(); prop != newProps.end(); ++prop )
-		{
-			ticpp::Element* choices = *prop;
-
-			wxString content = _WXSTR( choices->GetText( false ) );
-			if ( !content.empty() )
-			{
-				content.Replace( wxT("\" \""), wxT(";") );
-				content.Replace( wxT("\""), wxT("") );
-
-				choices->SetText( _STDSTR( content ) );
-			}
-		}*/
-	}
 
-	/* The file is now at least version 1.11 */
-	if ( fileMajor < 1 || ( 1 == fileMajor && fileMinor < 12 ) )
-	{
-		bool classUpdated = false;
-		if( "wxScintilla" == objClass )
-		{
-			objClass = "wxStyledTextCtrl";
-			parent->SetAttribute( "class", objClass );
-			classUpdated = true;
-		}
-		if( "wxTreeListCtrl" == objClass )
-		{
-			objClass = "wxadditions::wxTreeListCtrl";
-			parent->SetAttribute( "class", objClass );
-			classUpdated = true;
-		}
-		if( "wxTreeListCtrlColumn" == objClass )
-		{
-			objClass = "wxadditions::wxTreeListCtrlColumn";
-			parent->SetAttribute( "class", objClass );
-			classUpdated = true;
-		}
-		if( m_warnOnAdditionsUpdate && classUpdated )
-		{
-			m_warnOnAdditionsUpdate = false;
-			wxLogWarning( _("Updated classes from wxAdditions. You must use the latest version of wxAdditions to continue.\nNote wxScintilla is now wxStyledListCtrl, wxTreeListCtrl is now wxadditions::wxTreeListCtrl, and wxTreeListCtrlColumn is now wxadditions::wxTreeListCtrlColumn") );
-		}
-		
-		typedef std::map< std::string, std::set< std::string > > PropertiesToRemove;
-
-		static std::set< std::string > propertyRemovalWarnings;
-		const PropertiesToRemove& propertiesToRemove = GetPropertiesToRemove_v1_12();
-		PropertiesToRemove::const_iterator it = propertiesToRemove.find( objClass );
-		if( it != propertiesToRemove.end() )
-		{
-			RemoveProperties( parent, it->second );
-			if( 0 == propertyRemovalWarnings.count( objClass ) )
+			if ( !success )
 			{
-				std::stringstream ss;
-				std::ostream_iterator< std::string > out_it (ss, ", ");
-				std::copy( it->second.begin(), it->second.end(), out_it );
-				
-				wxLogMessage( _("Removed properties for class %s because they are no longer supported: %s"), objClass, ss.str() );
-				propertyRemovalWarnings.insert( objClass );
+				wxLogError( _( "Unable to open %s for writing.\nUser Headers:\n%s" ), filename.c_str(), wxuser_headers.c_str() );
 			}
 		}
 	}
-	/* The file is now at least version 1.12 */
 }
 
-void ApplicationData::GetPropertiesToConvert( ticpp::Node* parent, const std::set< std::string >& names, std::set< ticpp::Element* >* properties )
+bool ApplicationData::UpgradeProjects( const wxString& path, unsigned int jobs )
 {
-	// Clear result set
-	properties->clear();
-
-	ticpp::Iterator< ticpp::Element > prop( "property" );
-
-	for ( prop = parent->FirstChildElement( "property", false ); prop != prop.end(); ++prop )
+	wxArrayString found;
+	if ( ::wxDirExists( path ) )
 	{
-		std::string name;
-		prop->GetAttribute( "name", &name );
-
-		if ( names.find( name ) != names.end() )
-		{
-			properties->insert( prop.Get() );
-		}
+		wxDir::GetAllFiles( path, &found, wxT( "*.fbp" ) );
 	}
-}
-	
-void ApplicationData::RemoveProperties( ticpp::Node* parent, const std::set< std::string >& names )
-{
-	ticpp::Iterator< ticpp::Element > prop( "property" );
-
-	for ( prop = parent->FirstChildElement( "property", false ); prop != prop.end(); )
+	else
 	{
-		ticpp::Element element = *prop;
-		++prop;
-		
-		std::string name;
-		element.GetAttribute( "name", &name );
-		
-		if ( names.find( name ) != names.end() )
-		{
-			parent->RemoveChild( &element );
-		}
-	}	
-}
-
-void ApplicationData::TransferOptionList( ticpp::Element* prop, std::set< wxString >* options, const std::string& newPropName )
-
-{
-	wxString value = _WXSTR( prop->GetText( false ) );
-
-	std::set< wxString > transfer;
-
-	std::set< wxString > keep;
-
-	// Sort options - if in the 'options' set, they should be transferred to a property named 'newPropName'
-	// otherwise, they should stay
-	wxStringTokenizer tkz( value, wxT( "|" ), wxTOKEN_RET_EMPTY_ALL );
+		found.Add( path );
+	}
 
-	while ( tkz.HasMoreTokens() )
+	std::vector< wxString > files;
+	for ( size_t i = 0; i < found.GetCount(); ++i )
 	{
-		wxString option = tkz.GetNextToken();
-		option.Trim( false );
-		option.Trim( true );
-
-		if ( options->find( option ) != options->end() )
-		{
-			// Needs to be transferred
-			transfer.insert( option );
-		}
-		else
-		{
-			// Should be kept
-			keep.insert( option );
-		}
+		files.push_back( found[i] );
 	}
 
-	// Reusable sets to find properties with
-	std::set< std::string > oldProps;
-
-	std::set< ticpp::Element* > newProps;
+	std::vector< ProjectConverter::FileResult > results;
+	ProjectConverter::ConvertFiles( files, m_fbpVerMajor, m_fbpVerMinor, jobs, &results );
 
-	// If there are any to transfer, add to the target property, or make a new one
-	ticpp::Node* parent = prop->Parent();
-
-	if ( !transfer.empty() )
+	bool success = true;
+	std::vector< ProjectConverter::FileResult >::iterator result;
+	for ( result = results.begin(); result != results.end(); ++result )
 	{
-		// Check for the target property
-		ticpp::Element* newProp;
-		wxString newOptionList;
-
-		oldProps.clear();
-		oldProps.insert( newPropName );
-		GetPropertiesToConvert( parent, oldProps, &newProps );
-
-		if ( !newProps.empty() )
-		{
-			newProp = *newProps.begin();
-			newOptionList << wxT( "|" ) << _WXSTR( newProp->GetText( false ) );
-		}
-		else
+		if ( !result->error.empty() )
 		{
-			newProp = new ticpp::Element( "property" );
-			newProp->SetAttribute( "name", newPropName );
+			wxLogError( _( "Unable to convert %s: %s" ), result->path.c_str(), _WXSTR( result->error ).c_str() );
+			success = false;
+			continue;
 		}
 
-		std::set< wxString >::iterator option;
-
-		for ( option = transfer.begin(); option != transfer.end(); ++option )
+		if ( !result->converted )
 		{
-			newOptionList << wxT( "|" ) << *option;
+			continue;
 		}
 
-		newProp->SetText( _STDSTR( newOptionList.substr( 1 ) ) );
+		wxLogMessage( _( "Converted %s" ), result->path.c_str() );
+		ReportConversion( result->additionsUpdated, result->propertiesRemoved );
 
-		if ( newProps.empty() )
+		if ( !result->userHeaders.empty() )
 		{
-			parent->InsertBeforeChild( prop, *newProp );
-			delete newProp;
+			// Saved where the interactive conversion suggests
+			wxFileName headers( result->path );
+			headers.SetName( headers.GetName() + wxT( "_user_headers" ) );
+			headers.SetExt( wxT( "txt" ) );
+
+			wxString userHeaders = _WXSTR( result->userHeaders );
+			wxFFile output( headers.GetFullPath(), wxT( "w" ) );
+			if ( output.IsOpened() && output.Write( userHeaders ) )
+			{
+				wxLogMessage( _( "The \"user_headers\" property has been removed, its value was saved to %s" ), headers.GetFullPath().c_str() );
+			}
+			else
+			{
+				wxLogError( _( "Unable to open %s for writing.\nUser Headers:\n%s" ), headers.GetFullPath().c_str(), userHeaders.c_str() );
+			}
 		}
 	}
 
-	// Set the value of the property to whatever is left
-	if ( keep.empty() )
+	return success;
+}
+
+bool ApplicationData::ImportXrcFiles( const wxString& path, unsigned int jobs, const wxString& report )
+{
+	wxArrayString found;
+	if ( ::wxDirExists( path ) )
 	{
-		parent->RemoveChild( prop );
+		wxDir::GetAllFiles( path, &found, wxT( "*.xrc" ) );
 	}
 	else
 	{
+		found.Add( path );
+	}
 
-		std::set< wxString >::iterator option;
+	std::vector< wxString > files;
+	for ( size_t i = 0; i < found.GetCount(); ++i )
+	{
+		files.push_back( found[i] );
+	}
 
-		wxString newOptionList;
+	std::vector< XrcImporter::FileResult > results;
+	XrcImporter::ImportFiles( files, m_objDb, m_fbpVerMajor, m_fbpVerMinor, jobs, &results );
 
-		for ( option = keep.begin(); option != keep.end(); ++option )
+	bool success = true;
+	std::vector< XrcImporter::FileResult >::iterator result;
+	for ( result = results.begin(); result != results.end(); ++result )
+	{
+		if ( !result->error.empty() )
 		{
-			newOptionList << wxT( "|" ) << *option;
+			wxLogError( _( "Unable to import %s: %s" ), result->path.c_str(), _WXSTR( result->error ).c_str() );
+			success = false;
+			continue;
 		}
 
-		prop->SetText( _STDSTR( newOptionList.substr( 1 ) ) );
+		wxLogMessage( _( "Imported %s to %s" ), result->path.c_str(), result->output.c_str() );
+		if ( !result->unsupported.empty() && report.empty() )
+		{
+			wxLogWarning( _( "%u elements of %s were not imported" ), (unsigned int)result->unsupported.size(), result->path.c_str() );
+		}
+	}
+
+	if ( !report.empty() && !XrcImporter::WriteReport( report, results ) )
+	{
+		wxLogError( _( "Unable to write file: %s" ), report.c_str() );
+		success = false;
 	}
+
+	return success;
 }
 
 void ApplicationData::NewProject()
 
 {
+	WaitForSave();
+	m_journal.Discard();
+	m_formFiles.clear();
+	m_modifiedForms.clear();
+	m_projectModified = false;
 	m_project = m_objDb->CreateObject( "Project" );
 	m_selObj = m_project;
 	m_modFlag = false;
@@ -2101,6 +1974,8 @@ void ApplicationData::NewProject()
 
 void ApplicationData::GenerateCode( bool panelOnly )
 {
+	COUNT_CONVERSIONS( wxT("Generate") )
+
 #ifdef USE_FLATNOTEBOOK
 	NotifyCodeGeneration( panelOnly );
 #else
@@ -2331,7 +2206,12 @@ void ApplicationData::MoveHierarchy( PObjectBase obj, bool up )
 
 void ApplicationData::Undo()
 {
-	m_cmdProc.Undo();
+	++m_changeCount;
+	PCommand command = m_cmdProc.Undo();
+	if ( command )
+	{
+		ObjectModified( command->GetModifiedObject() );
+	}
 	m_modFlag = !m_cmdProc.IsAtSavePoint();
 	NotifyProjectRefresh();
 	CheckProjectTree( m_project );
@@ -2340,7 +2220,12 @@ void ApplicationData::Undo()
 
 void ApplicationData::Redo()
 {
-	m_cmdProc.Redo();
+	++m_changeCount;
+	PCommand command = m_cmdProc.Redo();
+	if ( command )
+	{
+		ObjectModified( command->GetModifiedObject() );
+	}
 	m_modFlag = !m_cmdProc.IsAtSavePoint();
 	NotifyProjectRefresh();
 	CheckProjectTree( m_project );
@@ -2695,7 +2580,28 @@ bool ApplicationData::IsModified()
 void ApplicationData::Execute( PCommand cmd )
 {
 	m_modFlag = true;
+	++m_changeCount;
 	m_cmdProc.Execute( cmd );
+	ObjectModified( cmd->GetModifiedObject() );
+}
+
+void ApplicationData::ObjectModified( PObjectBase object )
+{
+	// Find the form containing the object
+	PObjectBase form = object;
+	while ( form && form->GetParent() && form->GetParent()->GetObjectTypeName() != wxT( "project" ) )
+	{
+		form = form->GetParent();
+	}
+
+	if ( !form || !form->GetParent() )
+	{
+		// The project itself, or its list of forms
+		m_projectModified = true;
+		return;
+	}
+
+	m_modifiedForms.insert( form );
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2755,6 +2661,13 @@ void ApplicationData::NotifyProjectSaved()
 	NotifyEvent( event );
 }
 
+void ApplicationData::NotifyProjectSaving( int percent )
+{
+	wxFBEvent event( wxEVT_FB_PROJECT_SAVING );
+	event.SetString( wxString::Format( wxT( "Saving project... %d%%" ), percent ) );
+	NotifyEvent( event );
+}
+
 void ApplicationData::NotifyObjectExpanded( PObjectBase obj )
 {
 	wxFBObjectEvent event( wxEVT_FB_OBJECT_EXPANDED, obj );
@@ -2871,80 +2784,3 @@ wxString ApplicationData::GetEmbeddedFilesOutputPath()
 {
 	return GetPathProperty( wxT("embedded_files_path") );
 }
-
-ApplicationData::PropertiesToRemove& ApplicationData::GetPropertiesToRemove_v1_12( void ) const
-{
-	static PropertiesToRemove propertiesToRemove;
-	if( propertiesToRemove.empty() )
-	{
-		propertiesToRemove[ "Dialog" ].insert( "BottomDockable" );
-		propertiesToRemove[ "Dialog" ].insert( "LeftDockable" );
-		propertiesToRemove[ "Dialog" ].insert( "RightDockable" );
-		propertiesToRemove[ "Dialog" ].insert( "TopDockable" );
-		propertiesToRemove[ "Dialog" ].insert( "caption_visible" );
-		propertiesToRemove[ "Dialog" ].insert( "center_pane" );
-		propertiesToRemove[ "Dialog" ].insert( "close_button" );
-		propertiesToRemove[ "Dialog" ].insert( "default_pane" );
-		propertiesToRemove[ "Dialog" ].insert( "dock" );
-		propertiesToRemove[ "Dialog" ].insert( "dock_fixed" );
-		propertiesToRemove[ "Dialog" ].insert( "docking" );
-		propertiesToRemove[ "Dialog" ].insert( "floatable" );
-		propertiesToRemove[ "Dialog" ].insert( "gripper" );
-		propertiesToRemove[ "Dialog" ].insert( "maximize_button" );
-		propertiesToRemove[ "Dialog" ].insert( "minimize_button" );
-		propertiesToRemove[ "Dialog" ].insert( "moveable" );
-		propertiesToRemove[ "Dialog" ].insert( "pane_border" );
-		propertiesToRemove[ "Dialog" ].insert( "pin_button" );
-		propertiesToRemove[ "Dialog" ].insert( "resize" );
-		propertiesToRemove[ "Dialog" ].insert( "show" );
-		propertiesToRemove[ "Dialog" ].insert( "toolbar_pane" );
-		propertiesToRemove[ "Dialog" ].insert( "validator_style" );
-		propertiesToRemove[ "Dialog" ].insert( "validator_type" );
-		propertiesToRemove[ "Dialog" ].insert( "aui_name" );
-		
-		propertiesToRemove[ "Panel" ].insert( "BottomDockable" );
-		propertiesToRemove[ "Panel" ].insert( "LeftDockable" );
-		propertiesToRemove[ "Panel" ].insert( "RightDockable" );
-		propertiesToRemove[ "Panel" ].insert( "TopDockable" );
-		propertiesToRemove[ "Panel" ].insert( "caption_visible" );
-		propertiesToRemove[ "Panel" ].insert( "center_pane" );
-		propertiesToRemove[ "Panel" ].insert( "close_button" );
-		propertiesToRemove[ "Panel" ].insert( "default_pane" );
-		propertiesToRemove[ "Panel" ].insert( "dock" );
-		propertiesToRemove[ "Panel" ].insert( "dock_fixed" );
-		propertiesToRemove[ "Panel" ].insert( "docking" );
-		propertiesToRemove[ "Panel" ].insert( "floatable" );
-		propertiesToRemove[ "Panel" ].insert( "gripper" );
-		propertiesToRemove[ "Panel" ].insert( "maximize_button" );
-		propertiesToRemove[ "Panel" ].insert( "minimize_button" );
-		propertiesToRemove[ "Panel" ].insert( "moveable" );
-		propertiesToRemove[ "Panel" ].insert( "pane_border" );
-		propertiesToRemove[ "Panel" ].insert( "pin_button" );
-		propertiesToRemove[ "Panel" ].insert( "resize" );
-		propertiesToRemove[ "Panel" ].insert( "show" );
-		propertiesToRemove[ "Panel" ].insert( "toolbar_pane" );
-		propertiesToRemove[ "Panel" ].insert( "validator_style" );
-		propertiesToRemove[ "Panel" ].insert( "validator_type" );		
-		
-		propertiesToRemove[ "wxStaticText" ].insert( "validator_style" );
-		propertiesToRemove[ "wxStaticText" ].insert( "validator_type" );
-		propertiesToRemove[ "CustomControl" ].insert( "validator_style" );
-		propertiesToRemove[ "CustomControl" ].insert( "validator_type" );
-		propertiesToRemove[ "wxAuiNotebook" ].insert( "validator_style" );
-		propertiesToRemove[ "wxAuiNotebook" ].insert( "validator_type" );
-		propertiesToRemove[ "wxPanel" ].insert( "validator_style" );
-		propertiesToRemove[ "wxPanel" ].insert( "validator_type" );	
-		propertiesToRemove[ "wxToolBar" ].insert( "validator_style" );
-		propertiesToRemove[ "wxToolBar" ].insert( "validator_type" );	
-		propertiesToRemove[ "wxStyledTextCtrl" ].insert( "use_wxAddition" );
-		propertiesToRemove[ "wxStyledTextCtrl" ].insert( "validator_style" );
-		propertiesToRemove[ "wxStyledTextCtrl" ].insert( "validator_type" );
-		propertiesToRemove[ "wxPropertyGridManager" ].insert( "use_wxAddition" );
-		propertiesToRemove[ "wxPropertyGridManager" ].insert( "validator_style" );
-		propertiesToRemove[ "wxPropertyGridManager" ].insert( "validator_type" );	
-
-		propertiesToRemove[ "wxadditions::wxTreeListCtrl" ].insert( "validator_style" );
-		propertiesToRemove[ "wxadditions::wxTreeListCtrl" ].insert( "validator_type" );	
-	}	
-	return propertiesToRemove;
-}
@@ -29,7 +29,10 @@
 #include "utils/wxfbdefs.h"
 #include "model/database.h"
 #include "rad/cmdproc.h"
+#include "model/projectjournal.h"
+#include "model/projectloader.h"
 #include <set>
+#include <map>
 
 namespace ticpp
 {
@@ -47,6 +50,9 @@ class wxFBManager;
 
 class wxFBIPC;
 
+class ProjectSaver;
+class ProjectSnapshot;
+
 #define AppData()         	(ApplicationData::Get())
 #define AppDataCreate(path) (ApplicationData::Get(path))
 #define AppDataInit()	      (ApplicationData::Initialize())
@@ -80,6 +86,27 @@ class ApplicationData
 		// Procesador de comandos Undo/Redo
 		CommandProcessor m_cmdProc;
 
+		// Changes not saved yet, to recover them after a crash
+		ProjectJournal m_journal;
+
+		// Writes the project in the background
+		boost::shared_ptr< ProjectSaver > m_saver;
+		wxString m_pendingSave;				// saved again when the save in progress finishes
+		unsigned int m_changeCount;			// commands executed, undone or redone
+		unsigned int m_saveChangeCount;		// m_changeCount when the snapshot being saved was taken
+		wxFileOffset m_saveJournalPosition;	// first change recorded after the snapshot
+		bool m_saveFailed;
+
+		// Projects with a file per form, only the files which changed are saved
+		ProjectLoader::FormFileMap m_formFiles;		// file of each form, as loaded or last saved
+		std::set< PObjectBase > m_modifiedForms;	// forms changed since they were saved
+		bool m_projectModified;						// the project file changed since it was saved
+
+		// State of the save in progress, restored if it fails
+		ProjectLoader::FormFileMap m_savingFormFiles;
+		std::set< PObjectBase > m_savingForms;
+		bool m_savingProject;
+
 		wxString m_projectFile;
 
 		wxString m_projectPath;
@@ -101,6 +128,13 @@ class ApplicationData
 
 		void NotifyProjectSaved();
 
+		void NotifyProjectSaving( int percent );
+
+		// Called by ProjectSaver on the main thread
+		friend class ProjectSaver;
+		void ProjectSaveProgress( int percent );
+		void ProjectSaveFinished( const wxString& filename, bool saved, const wxString& error );
+
 		void NotifyObjectExpanded( PObjectBase obj );
 
 		void NotifyObjectSelected( PObjectBase obj, bool force = false );
@@ -125,7 +159,8 @@ class ApplicationData
 		/**
 		 * Resuelve un posible conflicto de nombres.
 		 * @note el objeto a comprobar debe estar insertado en proyecto, por tanto
-		 *       no es válida para arboles "flotantes".
+		 *       no es válida para arboles "flotantes". The new name is written
+		 *       to the journal, after the insertion of the object.
 		 */
 		void ResolveNameConflict( PObjectBase obj );
 
@@ -179,38 +214,38 @@ class ApplicationData
 
 
 		/**
-		Convert the properties of the project element. Handle this separately because it does not repeat.
-		@param project The project element.
-		@param path The path to the project file.
-		@param fileMajor The major revision of the file.
-		@param fileMinor The minor revision of the file.
+		Loads a project through the DOM, converting it first if it is from an older version.
+		Used when the file can not be streamed by ProjectLoader.
+		@param file The path to the project file.
+		@param proj Receives the loaded project.
+		@param formFiles Receives the file of each form, if it has a file per form.
+		@return false if the project could not be loaded, or the user cancelled the conversion.
+		*/
+		bool LoadProjectDocument( const wxString& file, PObjectBase* proj, ProjectLoader::FormFileMap* formFiles );
+
+		/**
+		Keeps track of the files to save for a change to the contents of @a object.
 		*/
-		void ConvertProjectProperties( ticpp::Element* project, const wxString& path, int fileMajor, int fileMinor );
+		void ObjectModified( PObjectBase object );
 
 		/**
-		Iterates through 'property' element children of @a parent.
-		Saves all properties with a 'name' attribute matching one of @a names into @a properties
-		@param parent Object element with child properties.
-		@param names Set of property names to search for.
-		@param properties Pointer to a set in which to store the result of the search.
+		Takes the snapshot of a project with a file per form, with only the
+		files which changed.
+		@param formDir Directory of the forms, relative to the project.
 		*/
-		void GetPropertiesToConvert( ticpp::Node* parent, const std::set< std::string >& names, std::set< ticpp::Element* >* properties );
+		void AddFormFiles( ProjectSnapshot* snapshot, const wxString& filename, const wxString& formDir );
 
 		/**
-		Iterates through 'property' element children of @a parent.
-		Removes all properties with a 'name' attribute matching one of @a names
-		@param parent Object element with child properties.
-		@param names Set of property names to search for.
+		Tells the user about the changes made by a conversion which may need their attention.
 		*/
-		void RemoveProperties( ticpp::Node* parent, const std::set< std::string >& names );
+		void ReportConversion( bool additionsUpdated, const std::map< std::string, std::set< std::string > >& propertiesRemoved );
 
 		/**
-		Transfers @a options from the text of @a prop to the text of @a newPropName, which will be created if it doesn't exist.
-		@param prop Property containing the options to transfer.
-		@param options Set of options to search for and transfer.
-		@param newPropName Name of property to transfer to, will be created if non-existant.
+		Offers the user to save the value of the removed "user_headers" property.
+		@param userHeaders The value of the property.
+		@param path The path to the project file.
 		*/
-		void TransferOptionList( ticpp::Element* prop, std::set< wxString >* options, const std::string& newPropName );
+		void SaveUserHeaders( const std::string& userHeaders, const wxString& path );
 
 		void PropagateExpansion(PObjectBase obj, bool expand, bool up);
 
@@ -226,9 +261,6 @@ class ApplicationData
 		wxLog* m_debugLogTarget;
 		#endif
 
-		typedef std::map< std::string, std::set< std::string > > PropertiesToRemove;
-		PropertiesToRemove& GetPropertiesToRemove_v1_12( void ) const;
-
 	public:
 
 		~ApplicationData();
@@ -258,18 +290,42 @@ class ApplicationData
 		// Operaciones sobre los datos
 		bool LoadProject( const wxString &file, bool checkSingleInstance = true );
 
+		/**
+		Saves the project in the background, the project can be edited in the
+		meantime. If a save is in progress, the project is saved again when it
+		finishes, once for all the requests made while waiting. Errors are
+		reported when the save finishes.
+		*/
 		void SaveProject( const wxString &filename );
 
+		bool IsSaving();
+
+		/**
+		Waits until the project is saved, including saves requested meanwhile.
+		@return false if a save failed.
+		*/
+		bool WaitForSave();
+
 		void NewProject();
 
 		/**
-		Convert a project from an older version.
-		@param path The path to the project file
-		@param fileMajor The major revision of the file
-		@param fileMinor The minor revision of the file
-		@return true if successful, false otherwise
+		Converts all the project files in a directory, or a single file, to the current version.
+		Files are converted in parallel, without asking the user anything.
+		@param path The project file or directory.
+		@param jobs The number of files to convert at the same time, 0 for one per CPU.
+		@return false if some file could not be converted.
+		*/
+		bool UpgradeProjects( const wxString& path, unsigned int jobs );
+
+		/**
+		Imports all the XRC files in a directory, or a single file, each one into a project file next to it.
+		Files are imported in parallel, without asking the user anything.
+		@param path The XRC file or directory.
+		@param jobs The number of files to import at the same time, 0 for one per CPU.
+		@param report Optional, file where a JSON summary of the import is written, with what could not be imported.
+		@return false if some file could not be imported.
 		*/
-		bool ConvertProject( const wxString& path, int fileMajor, int fileMinor );
+		bool ImportXrcFiles( const wxString& path, unsigned int jobs, const wxString& report );
 
 		/**
 		Recursive function used to convert the object tree in the project file to the latest version.
@@ -369,6 +425,7 @@ class ApplicationData
 
 		const int m_fbpVerMajor;
 
+		/** Version of the files written, except those which need FBP_VERSION_MINOR_EXTENDED. */
 		const int m_fbpVerMinor;
 
 		/** Path to the fbp file that is opened. */
@@ -27,44 +27,144 @@
 #include "tinyxml.h"
 #include <default.xpm>
 #include <wx/image.h>
+#include <wx/imaglist.h>
 #include "utils/typeconv.h"
 #include "utils/stringutils.h"
 #include "utils/wxfbexception.h"
+#include "utils/startupprofile.h"
 
 #include <ticpp.h>
 
-static std::map< wxString, wxBitmap > m_bitmaps;
+typedef std::pair< wxString, unsigned int > BitmapKey;
+typedef std::map< BitmapKey, wxBitmap > BitmapMap;
+
+// File of each icon of the application, by name
+static std::map< wxString, wxString > s_files;
+
+// Icons of the application by name and size, 0 for the original size
+static BitmapMap s_bitmaps;
+
+// Images of files by path and size
+static BitmapMap s_fileBitmaps;
+
+static wxImageList* s_imageList = NULL;
+static std::map< wxString, int > s_classIcons;
+
+static wxBitmap ScaleBitmap( const wxBitmap& bitmap, unsigned int size )
+{
+	// rescale it to requested size
+	if ( size != 0 && bitmap.IsOk() && ( bitmap.GetWidth() != (int)size || bitmap.GetHeight() != (int)size ) )
+	{
+		wxImage image = bitmap.ConvertToImage();
+		return wxBitmap( image.Scale( size, size ) );
+	}
+	return bitmap;
+}
 
 wxBitmap AppBitmaps::GetBitmap( wxString iconname, unsigned int size )
 {
-	std::map< wxString, wxBitmap >::iterator bitmap;
-	bitmap = m_bitmaps.find( iconname );
+	BitmapMap::iterator bitmap = s_bitmaps.find( BitmapKey( iconname, size ) );
+	if ( bitmap != s_bitmaps.end() )
+	{
+		return bitmap->second;
+	}
+
 	wxBitmap bmp;
-	if ( bitmap != m_bitmaps.end() )
+	if ( size != 0 )
 	{
-		bmp = m_bitmaps[iconname];
+		bmp = ScaleBitmap( GetBitmap( iconname, 0 ), size );
 	}
 	else
 	{
-		bmp = m_bitmaps[ wxT("unknown") ];
+		std::map< wxString, wxString >::iterator file = s_files.find( iconname );
+		if ( file != s_files.end() )
+		{
+			bmp = wxBitmap( file->second, wxBITMAP_TYPE_ANY );
+		}
+		else if ( iconname != wxT("unknown") )
+		{
+			bmp = GetBitmap( wxT("unknown"), 0 );
+		}
+		else
+		{
+			bmp = wxBitmap( default_xpm );
+		}
+	}
+
+	s_bitmaps[ BitmapKey( iconname, size ) ] = bmp;
+	return bmp;
+}
+
+wxBitmap AppBitmaps::GetFileBitmap( const wxString& path, unsigned int size )
+{
+	BitmapMap::iterator bitmap = s_fileBitmaps.find( BitmapKey( path, size ) );
+	if ( bitmap != s_fileBitmaps.end() )
+	{
+		return bitmap->second;
 	}
+
+	wxBitmap bmp;
 	if ( size != 0 )
 	{
-		// rescale it to requested size
-		if ( bmp.GetWidth() != (int)size || bmp.GetHeight() != (int)size )
+		bmp = ScaleBitmap( GetFileBitmap( path, 0 ), size );
+	}
+	else if ( ::wxFileExists( path ) )
+	{
+		wxImage image( path, wxBITMAP_TYPE_ANY );
+		if ( image.IsOk() )
 		{
-			wxImage image = bmp.ConvertToImage();
-			bmp = wxBitmap( image.Scale(size, size) );
+			bmp = wxBitmap( image );
 		}
 	}
+
+	s_fileBitmaps[ BitmapKey( path, size ) ] = bmp;
 	return bmp;
 }
 
+wxImageList* AppBitmaps::GetImageList()
+{
+	if ( NULL == s_imageList )
+	{
+		s_imageList = new wxImageList( ICON_SIZE, ICON_SIZE );
+		s_imageList->Add( GetBitmap( wxT("project"), ICON_SIZE ) );
+	}
+	return s_imageList;
+}
+
+int AppBitmaps::AddClassIcon( const wxString& className, const wxBitmap& icon )
+{
+	std::map< wxString, int >::iterator index = s_classIcons.find( className );
+	if ( index != s_classIcons.end() )
+	{
+		return index->second;
+	}
+
+	int added = GetImageList()->Add( ScaleBitmap( icon, ICON_SIZE ) );
+	s_classIcons[ className ] = added;
+	return added;
+}
+
+int AppBitmaps::GetClassIconIndex( const wxString& className )
+{
+	std::map< wxString, int >::iterator index = s_classIcons.find( className );
+	return ( index != s_classIcons.end() ? index->second : 0 );
+}
+
+void AppBitmaps::Destroy()
+{
+	delete s_imageList;
+	s_imageList = NULL;
+	s_classIcons.clear();
+	s_bitmaps.clear();
+	s_fileBitmaps.clear();
+}
+
 void AppBitmaps::LoadBitmaps( wxString filepath, wxString iconpath )
 {
+	StartupProfile::Timer timer( "AppBitmaps::LoadBitmaps" );
+
 	try
 	{
-		m_bitmaps[ wxT("unknown") ] = wxBitmap( default_xpm );
 
 		ticpp::Document doc;
 		XMLUtils::LoadXMLFile( doc, true, filepath );
@@ -75,7 +175,9 @@ void AppBitmaps::LoadBitmaps( wxString filepath, wxString iconpath )
 		{
 			wxString name = _WXSTR( elem->GetAttribute("name") );
 			wxString file = _WXSTR( elem->GetAttribute("file") );
-			m_bitmaps[name] = wxBitmap( iconpath + file, wxBITMAP_TYPE_ANY );
+
+			// Decoded when it is first needed
+			s_files[name] = iconpath + file;
 
 			elem = elem->NextSiblingElement( "icon", false );
 		}
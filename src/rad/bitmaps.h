@@ -33,11 +33,48 @@
 #include "wx/wx.h"
 #include <map>
 
+class wxImageList;
+
+/**
+Icons of the application and of the classes.
+
+Each image is decoded the first time it is requested, and each size of it
+is only scaled once: the bitmaps are kept by name, or file, and size.
+*/
 class AppBitmaps
 {
 public:
 	static wxBitmap GetBitmap( wxString iconname, unsigned int size = 0 );
 	static void LoadBitmaps( wxString filepath, wxString iconpath );
+
+	/**
+	Gets the image of a file, as GetBitmap.
+	@return An invalid bitmap if the file can not be read.
+	*/
+	static wxBitmap GetFileBitmap( const wxString& path, unsigned int size = 0 );
+
+	/**
+	Image list with the icons of the classes, at ICON_SIZE, shared by the
+	views which show them. The first image is the icon of the project, used
+	for the classes without an icon. It is owned by AppBitmaps.
+	*/
+	static wxImageList* GetImageList();
+
+	/**
+	Adds the icon of a class to the image list, unless it was already added.
+	@return The index of the icon in the image list.
+	*/
+	static int AddClassIcon( const wxString& className, const wxBitmap& icon );
+
+	/**
+	@return The index of the icon of a class in the image list, 0 if it was not added.
+	*/
+	static int GetClassIconIndex( const wxString& className );
+
+	/**
+	Frees the bitmaps, before wxWidgets is cleaned up.
+	*/
+	static void Destroy();
 };
 
 #endif //__WXFB__BITMAPS_H__
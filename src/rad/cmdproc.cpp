@@ -27,12 +27,14 @@
 
 CommandProcessor::CommandProcessor()
 :
-m_savePoint( 0 )
+m_savePoint( 0 ),
+m_journal( NULL )
 {
 }
 
 void CommandProcessor::Execute(PCommand command)
 {
+  command->SetJournal(m_journal);
   command->Execute();
   m_undoStack.push(command);
 
@@ -40,28 +42,34 @@ void CommandProcessor::Execute(PCommand command)
     m_redoStack.pop();
 }
 
-void CommandProcessor::Undo()
+PCommand CommandProcessor::Undo()
 {
   if (!m_undoStack.empty())
   {
     PCommand command = m_undoStack.top();
     m_undoStack.pop();
 
+    command->SetJournal(m_journal);
     command->Restore();
     m_redoStack.push(command);
+    return command;
   }
+  return PCommand();
 }
 
-void CommandProcessor::Redo()
+PCommand CommandProcessor::Redo()
 {
   if (!m_redoStack.empty())
   {
     PCommand command = m_redoStack.top();
     m_redoStack.pop();
 
+    command->SetJournal(m_journal);
     command->Execute();
     m_undoStack.push(command);
+    return command;
   }
+  return PCommand();
 }
 
 void CommandProcessor::Reset()
@@ -94,10 +102,16 @@ bool CommandProcessor::IsAtSavePoint()
 	return m_undoStack.size() == m_savePoint;
 }
 
+void CommandProcessor::ClearSavePoint()
+{
+	m_savePoint = (size_t)-1;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Command::Command()
 {
   m_executed = false;
+  m_journal = NULL;
 }
 
 void Command::Execute()
@@ -28,8 +28,10 @@
 
 #include <stack>
 #include <boost/smart_ptr.hpp>
+#include "utils/wxfbdefs.h"
 
 class Command;
+class ProjectJournal;
 typedef boost::shared_ptr<Command> PCommand;
 
 class CommandProcessor
@@ -40,18 +42,34 @@ class CommandProcessor
   CommandStack m_undoStack;
   CommandStack m_redoStack;
   size_t m_savePoint;
+  ProjectJournal* m_journal;
 
  public:
    CommandProcessor();
+
+   /**
+    * Sets the journal where the commands record their changes, if any.
+    */
+   void SetJournal(ProjectJournal* journal) { m_journal = journal; }
+
    void Execute(PCommand command);
 
-   void Undo();
-   void Redo();
+   /**
+    * @return The command undone or redone, if any.
+    */
+   PCommand Undo();
+   PCommand Redo();
    void Reset();
 
    void SetSavePoint();
    bool IsAtSavePoint();
 
+   /**
+    * There is no state matching the saved file, used when the project was
+    * modified before any command was executed.
+    */
+   void ClearSavePoint();
+
    bool CanUndo();
    bool CanRedo();
 };
@@ -61,6 +79,7 @@ class Command
 {
  private:
   bool m_executed;
+  ProjectJournal* m_journal;
 
  protected:
   /**
@@ -73,12 +92,25 @@ class Command
    */
   virtual void DoRestore() = 0;
 
+  /**
+   * Journal where the changes must be recorded, NULL if there is none.
+   */
+  ProjectJournal* GetJournal() { return m_journal; }
+
  public:
   Command();
   virtual ~Command() {};
 
   void Execute();
   void Restore();
+
+  /**
+   * Object whose contents the command changes: its properties, or its
+   * children when they are added, removed or moved.
+   */
+  virtual PObjectBase GetModifiedObject() = 0;
+
+  void SetJournal(ProjectJournal* journal) { m_journal = journal; }
 };
 
 #endif //__COMMAND_PROC__
@@ -49,20 +49,20 @@ void CustomKeysEvtHandler::OnKeyPress(wxKeyEvent &event)
     LogDebug( wxT("#### Prueba del parser ####") );
 
     PObjectBase obj = AppData()->GetSelectedObject();
-    PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( wxT("C++") );
+    PCodeInfo code_info = obj->GetObjectInfo()->GetCodeInfo( LANGUAGE_CPP );
 
     LogDebug( wxT("#### Plantillas ####") );
 
 #if wxVERSION_NUMBER < 2900
-    LogDebug((wxChar *)(code_info->GetTemplate( wxT("construction") ).c_str()));
-    LogDebug((wxChar *)(code_info->GetTemplate( wxT("declaration") ).c_str()));
+    LogDebug((wxChar *)(code_info->GetTemplate( TEMPLATE_CONSTRUCTION ).c_str()));
+    LogDebug((wxChar *)(code_info->GetTemplate( TEMPLATE_DECLARATION ).c_str()));
 #else
-    LogDebug( code_info->GetTemplate( wxT("construction") ) );
-    LogDebug( code_info->GetTemplate( wxT("declaration") ) );
+    LogDebug( code_info->GetTemplate( TEMPLATE_CONSTRUCTION ) );
+    LogDebug( code_info->GetTemplate( TEMPLATE_DECLARATION ) );
 #endif
     LogDebug( wxT("#### Código ####") );
     {
-      CppTemplateParser parser(obj,code_info->GetTemplate( wxT("construction") ), false, false, wxEmptyString );
+      CppTemplateParser parser(obj,code_info->GetTemplate( TEMPLATE_CONSTRUCTION ), false, false, wxEmptyString );
 
 #if wxVERSION_NUMBER < 2900
       LogDebug((wxChar *)parser.ParseTemplate().c_str());
@@ -71,7 +71,7 @@ void CustomKeysEvtHandler::OnKeyPress(wxKeyEvent &event)
 #endif
     }
     {
-      CppTemplateParser parser(obj,code_info->GetTemplate( wxT("declaration") ), false, false, wxEmptyString );
+      CppTemplateParser parser(obj,code_info->GetTemplate( TEMPLATE_DECLARATION ), false, false, wxEmptyString );
 
 #if wxVERSION_NUMBER < 2900
       LogDebug((wxChar *)parser.ParseTemplate().c_str());
@@ -23,27 +23,396 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "dataobject.h"
 #include "model/objectbase.h"
+#include "model/database.h"
 #include "utils/typeconv.h"
 #include <ticpp.h>
 #include <string>
+#include <vector>
+#include <map>
 #include "rad/appdata.h"
 #include <wx/utils.h>
 
-#include <ticpp.h>
+#define CLIPBOARD_MAGIC "wxFBCB1"
+#define CLIPBOARD_MAGIC_SIZE 8
+#define CLIPBOARD_MAX_DEPTH 1000
+
+WPObjectBase wxFBDataObject::s_copied;
+unsigned int wxFBDataObject::s_copyId = 0;
+
+static void WriteNumber( std::string* buffer, unsigned int value )
+{
+	while ( value >= 0x80 )
+	{
+		*buffer += (char)( ( value & 0x7F ) | 0x80 );
+		value >>= 7;
+	}
+	*buffer += (char)value;
+}
+
+/**
+Writes the binary form of the clipboard: a header, the strings used, and
+the objects, each one followed by its children. Each property and event is
+written as the indices of its name and value in the strings.
+*/
+class ClipboardWriter
+{
+private:
+	typedef std::map< std::string, unsigned int > StringIndexMap;
+	StringIndexMap m_index;
+	std::vector< const std::string* > m_strings;
+	std::string m_objects;
+
+	unsigned int AddString( const std::string& str )
+	{
+		StringIndexMap::iterator it = m_index.find( str );
+		if ( it == m_index.end() )
+		{
+			it = m_index.insert( StringIndexMap::value_type( str, (unsigned int)m_strings.size() ) ).first;
+			m_strings.push_back( &it->first );
+		}
+		return it->second;
+	}
+
+public:
+	void WriteObject( PObjectBase object )
+	{
+		WriteNumber( &m_objects, AddString( object->GetUtf8ClassName() ) );
+		m_objects += (char)( object->GetExpanded() ? 1 : 0 );
+
+		PropertyMap& properties = object->GetProperties();
+		WriteNumber( &m_objects, (unsigned int)properties.size() );
+		for ( PropertyMap::iterator prop = properties.begin(); prop != properties.end(); ++prop )
+		{
+			WriteNumber( &m_objects, AddString( prop->second->GetPropertyInfo()->GetUtf8Name() ) );
+			WriteNumber( &m_objects, AddString( prop->second->GetUtf8Value() ) );
+		}
+
+		EventMap& events = object->GetEvents();
+		WriteNumber( &m_objects, (unsigned int)events.size() );
+		for ( EventMap::iterator event = events.begin(); event != events.end(); ++event )
+		{
+			WriteNumber( &m_objects, AddString( event->second->GetEventInfo()->GetUtf8Name() ) );
+			WriteNumber( &m_objects, AddString( _STDSTR( event->second->GetValue() ) ) );
+		}
+
+		WriteNumber( &m_objects, object->GetChildCount() );
+		for ( unsigned int i = 0; i < object->GetChildCount(); i++ )
+		{
+			WriteObject( object->GetChild( i ) );
+		}
+	}
+
+	void Write( std::string* data, int major, int minor, unsigned int copyId, wxUint64 signature )
+	{
+		data->assign( CLIPBOARD_MAGIC, CLIPBOARD_MAGIC_SIZE );
+		WriteNumber( data, (unsigned int)major );
+		WriteNumber( data, (unsigned int)minor );
+		WriteNumber( data, (unsigned int)wxGetProcessId() );
+		WriteNumber( data, copyId );
+		for ( int i = 0; i < 8; ++i )
+		{
+			*data += (char)( signature & 0xFF );
+			signature >>= 8;
+		}
+
+		WriteNumber( data, (unsigned int)m_strings.size() );
+		for ( std::vector< const std::string* >::iterator str = m_strings.begin(); str != m_strings.end(); ++str )
+		{
+			WriteNumber( data, (unsigned int)( *str )->length() );
+			*data += **str;
+		}
+		*data += m_objects;
+	}
+};
+
+/**
+Reads the binary form of the clipboard, see ClipboardWriter.
+*/
+class ClipboardReader
+{
+private:
+	const unsigned char* m_cur;
+	const unsigned char* m_end;
+	std::vector< std::string > m_strings;
+
+	bool ReadNumber( unsigned int* value )
+	{
+		*value = 0;
+		for ( unsigned int shift = 0; shift < 32; shift += 7 )
+		{
+			if ( m_cur == m_end )
+			{
+				return false;
+			}
+
+			unsigned char byte = *m_cur++;
+			*value |= (unsigned int)( byte & 0x7F ) << shift;
+			if ( 0 == ( byte & 0x80 ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool ReadString( const std::string** str )
+	{
+		unsigned int index;
+		if ( !ReadNumber( &index ) || index >= m_strings.size() )
+		{
+			return false;
+		}
+		*str = &m_strings[ index ];
+		return true;
+	}
+
+public:
+	struct Header
+	{
+		int major;
+		int minor;
+		unsigned long processId;
+		unsigned int copyId;
+		wxUint64 signature;
+	};
+
+	ClipboardReader( const std::string& data )
+	:
+	m_cur( reinterpret_cast< const unsigned char* >( data.data() ) ),
+	m_end( m_cur + data.size() )
+	{
+	}
+
+	static bool IsBinary( const std::string& data )
+	{
+		return 0 == data.compare( 0, CLIPBOARD_MAGIC_SIZE, CLIPBOARD_MAGIC, CLIPBOARD_MAGIC_SIZE );
+	}
+
+	bool ReadHeader( Header* header )
+	{
+		m_cur += CLIPBOARD_MAGIC_SIZE;
+
+		unsigned int major, minor, processId;
+		if ( !ReadNumber( &major ) || !ReadNumber( &minor ) || !ReadNumber( &processId ) ||
+			 !ReadNumber( &header->copyId ) || m_end - m_cur < 8 )
+		{
+			return false;
+		}
+		header->major = (int)major;
+		header->minor = (int)minor;
+		header->processId = processId;
+
+		header->signature = 0;
+		for ( int i = 7; i >= 0; --i )
+		{
+			header->signature = ( header->signature << 8 ) | m_cur[i];
+		}
+		m_cur += 8;
+		return true;
+	}
+
+	bool ReadStrings()
+	{
+		unsigned int count;
+		if ( !ReadNumber( &count ) || count > (unsigned int)( m_end - m_cur ) )
+		{
+			return false;
+		}
+
+		m_strings.resize( count );
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			unsigned int size;
+			if ( !ReadNumber( &size ) || size > (unsigned int)( m_end - m_cur ) )
+			{
+				return false;
+			}
+			m_strings[i].assign( reinterpret_cast< const char* >( m_cur ), size );
+			m_cur += size;
+		}
+		return true;
+	}
+
+	/**
+	Builds the objects straight from the values, only valid with the object
+	database they were copied with.
+	*/
+	PObjectBase ReadObject( PObjectDatabase objDb, unsigned int depth )
+	{
+		PObjectBase none;
+
+		const std::string* str;
+		if ( depth > CLIPBOARD_MAX_DEPTH || !ReadString( &str ) || m_cur == m_end )
+		{
+			return none;
+		}
+
+		PObjectInfo info = objDb->GetObjectInfo( _WXSTR( *str ) );
+		if ( !info )
+		{
+			return none;
+		}
+
+		PObjectBase object = objDb->NewObject( info );
+		object->SetExpanded( *m_cur++ != 0 );
+
+		// The values are in the order of the maps, see ClipboardWriter
+		unsigned int count;
+		PropertyMap& properties = object->GetProperties();
+		if ( !ReadNumber( &count ) || count != properties.size() )
+		{
+			return none;
+		}
+		for ( PropertyMap::iterator prop = properties.begin(); prop != properties.end(); ++prop )
+		{
+			if ( !ReadString( &str ) || !ReadString( &str ) )
+			{
+				return none;
+			}
+			prop->second->SetUtf8Value( *str );
+		}
+
+		EventMap& events = object->GetEvents();
+		if ( !ReadNumber( &count ) || count != events.size() )
+		{
+			return none;
+		}
+		for ( EventMap::iterator event = events.begin(); event != events.end(); ++event )
+		{
+			if ( !ReadString( &str ) || !ReadString( &str ) )
+			{
+				return none;
+			}
+			event->second->SetValue( _WXSTR( *str ) );
+		}
+
+		if ( !ReadNumber( &count ) )
+		{
+			return none;
+		}
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			PObjectBase child = ReadObject( objDb, depth + 1 );
+			if ( !child )
+			{
+				return none;
+			}
+			object->AddChild( child );
+			child->SetParent( object );
+		}
+
+		return object;
+	}
+
+	/**
+	Builds the XML of the objects, as in a project file, to convert them or
+	load them by name.
+	*/
+	bool ReadElement( ticpp::Element* element, unsigned int depth )
+	{
+		const std::string* name;
+		const std::string* value;
+		if ( depth > CLIPBOARD_MAX_DEPTH || !ReadString( &name ) || m_cur == m_end )
+		{
+			return false;
+		}
+
+		element->SetValue( "object" );
+		element->SetAttribute( "class", *name );
+		element->SetAttribute( "expanded", *m_cur++ != 0 ? 1 : 0 );
+
+		const char* tags[] = { "property", "event" };
+		unsigned int count;
+		for ( int list = 0; list < 2; ++list )
+		{
+			if ( !ReadNumber( &count ) )
+			{
+				return false;
+			}
+			for ( unsigned int i = 0; i < count; i++ )
+			{
+				if ( !ReadString( &name ) || !ReadString( &value ) )
+				{
+					return false;
+				}
+				ticpp::Element valueElement( tags[list] );
+				valueElement.SetAttribute( "name", *name );
+				valueElement.SetText( *value );
+				element->LinkEndChild( &valueElement );
+			}
+		}
+
+		if ( !ReadNumber( &count ) )
+		{
+			return false;
+		}
+		for ( unsigned int i = 0; i < count; i++ )
+		{
+			ticpp::Element child;
+			if ( !ReadElement( &child, depth + 1 ) )
+			{
+				return false;
+			}
+			element->LinkEndChild( &child );
+		}
+
+		return true;
+	}
+};
 
 wxFBDataObject::wxFBDataObject( PObjectBase obj )
 :
-wxDataObject()
+wxDataObject(),
+m_major( 0 ),
+m_minor( 0 ),
+m_signature( 0 ),
+m_copyId( 0 )
 {
 	if ( obj )
+	{
+		// Everything else is rendered from the copy when it is requested
+		PObjectDatabase objDb = AppData()->GetObjectDatabase();
+		m_object = objDb->CopyObject( obj );
+		m_major = AppData()->m_fbpVerMajor;
+		m_minor = AppData()->m_fbpVerMinor;
+		m_signature = objDb->GetSignature();
+
+		m_copyId = ++s_copyId;
+		s_copied = m_object;
+	}
+}
+
+wxFBDataObject::~wxFBDataObject()
+{
+}
+
+const std::string& wxFBDataObject::GetData( const wxDataFormat& format ) const
+{
+	if ( !m_object )
+	{
+		return m_data;
+	}
+
+	if ( format == wxFBBinaryDataObjectFormat )
+	{
+		if ( m_data.empty() )
+		{
+			ClipboardWriter writer;
+			writer.WriteObject( m_object );
+			writer.Write( &m_data, m_major, m_minor, m_copyId, m_signature );
+		}
+		return m_data;
+	}
+
+	if ( m_text.empty() )
 	{
 		// create xml representation of ObjectBase
 		ticpp::Element element;
-		obj->SerializeObject( &element );
+		m_object->SerializeObject( &element );
 
 		// add version info to xml data, just in case it is pasted into a different version of wxFB
-		element.SetAttribute( "fbp_version_major", AppData()->m_fbpVerMajor );
-		element.SetAttribute( "fbp_version_minor", AppData()->m_fbpVerMinor );
+		element.SetAttribute( "fbp_version_major", m_major );
+		element.SetAttribute( "fbp_version_minor", m_minor );
 
 		ticpp::Document doc;
 		doc.LinkEndChild( &element );
@@ -59,12 +428,9 @@ wxDataObject()
         #endif
 
         doc.Accept( &printer );
-		m_data = printer.Str();
+		m_text = printer.Str();
 	}
-}
-
-wxFBDataObject::~wxFBDataObject()
-{
+	return m_text;
 }
 
 void wxFBDataObject::GetAllFormats( wxDataFormat* formats, Direction dir ) const
@@ -72,32 +438,35 @@ void wxFBDataObject::GetAllFormats( wxDataFormat* formats, Direction dir ) const
 	switch ( dir )
 	{
 		case Get:
-			formats[0] = wxFBDataObjectFormat;
-			formats[1] = wxDF_TEXT;
+			formats[0] = wxFBBinaryDataObjectFormat;
+			formats[1] = wxFBDataObjectFormat;
+			formats[2] = wxDF_TEXT;
 			break;
 		case Set:
-			formats[0] = wxFBDataObjectFormat;
+			formats[0] = wxFBBinaryDataObjectFormat;
+			formats[1] = wxFBDataObjectFormat;
 			break;
 		default:
 			break;
 	}
 }
 
-bool wxFBDataObject::GetDataHere( const wxDataFormat&, void* buf ) const
+bool wxFBDataObject::GetDataHere( const wxDataFormat& format, void* buf ) const
 {
 	if ( NULL == buf )
 	{
 		return false;
 	}
 
-	memcpy( (char*)buf, m_data.c_str(), m_data.length() );
+	const std::string& data = GetData( format );
+	memcpy( (char*)buf, data.c_str(), data.length() );
 
 	return true;
 }
 
-size_t wxFBDataObject::GetDataSize( const wxDataFormat& /*format*/ ) const
+size_t wxFBDataObject::GetDataSize( const wxDataFormat& format ) const
 {
-	return m_data.length();
+	return GetData( format ).length();
 }
 
 size_t wxFBDataObject::GetFormatCount( Direction dir ) const
@@ -105,9 +474,9 @@ size_t wxFBDataObject::GetFormatCount( Direction dir ) const
 	switch ( dir )
 	{
 		case Get:
-			return 2;
+			return 3;
 		case Set:
-			return 1;
+			return 2;
 		default:
 			return 0;
 	}
@@ -115,31 +484,109 @@ size_t wxFBDataObject::GetFormatCount( Direction dir ) const
 
 wxDataFormat wxFBDataObject::GetPreferredFormat( Direction /*dir*/ ) const
 {
-	return wxFBDataObjectFormat;
+	return wxFBBinaryDataObjectFormat;
 }
 
 bool wxFBDataObject::SetData( const wxDataFormat& format, size_t len, const void *buf )
 {
-	if ( format != wxFBDataObjectFormat )
+	// GetObj tells the binary form from the XML by its header
+	if ( format != wxFBBinaryDataObjectFormat && format != wxFBDataObjectFormat )
 	{
 		return false;
 	}
 
+	m_object.reset();
 	m_data.assign( reinterpret_cast< const char* >( buf ), len );
+	m_text.clear();
 	return true;
 }
 
 PObjectBase wxFBDataObject::GetObj()
 {
+	PObjectDatabase db = AppData()->GetObjectDatabase();
+	if ( m_object )
+	{
+		return db->CopyObject( m_object );
+	}
+
 	if ( m_data.empty() )
 	{
 		return PObjectBase();
 	}
 
+	// Copied by an older version of wxFormBuilder
+	if ( !ClipboardReader::IsBinary( m_data ) )
+	{
+		return GetObjFromXml();
+	}
+
+	ClipboardReader reader( m_data );
+	ClipboardReader::Header header;
+	if ( !reader.ReadHeader( &header ) )
+	{
+		wxLogError( _("The object in the clipboard is not valid") );
+		return PObjectBase();
+	}
+
+	// Copied by this process, and still held by the clipboard
+	PObjectBase copied = s_copied.lock();
+	if ( copied && header.processId == (unsigned long)wxGetProcessId() && header.copyId == s_copyId )
+	{
+		return db->CopyObject( copied );
+	}
+
+	if ( header.major > AppData()->m_fbpVerMajor || ( AppData()->m_fbpVerMajor == header.major && header.minor > AppData()->m_fbpVerMinor ) )
+	{
+		wxLogError( _("This object cannot be pasted because it is from a newer version of wxFormBuilder") );
+	}
+
+	if ( !reader.ReadStrings() )
+	{
+		wxLogError( _("The object in the clipboard is not valid") );
+		return PObjectBase();
+	}
+
+	PObjectBase object;
+	if ( header.major == AppData()->m_fbpVerMajor && header.minor == AppData()->m_fbpVerMinor && header.signature == db->GetSignature() )
+	{
+		object = reader.ReadObject( db, 1 );
+	}
+	else
+	{
+		// Another set of plugins, or another version: the values are loaded by name
+		try
+		{
+			ticpp::Element element;
+			if ( reader.ReadElement( &element, 1 ) )
+			{
+				if ( header.major < AppData()->m_fbpVerMajor || ( AppData()->m_fbpVerMajor == header.major && header.minor < AppData()->m_fbpVerMinor ) )
+				{
+					AppData()->ConvertObject( &element, header.major, header.minor );
+				}
+				object = db->CreateObject( &element );
+			}
+		}
+		catch( ticpp::Exception& ex )
+		{
+			wxLogError( _WXSTR( ex.m_details ) );
+			return PObjectBase();
+		}
+	}
+
+	if ( !object )
+	{
+		wxLogError( _("The object in the clipboard is not valid") );
+	}
+	return object;
+}
+
+PObjectBase wxFBDataObject::GetObjFromXml()
+{
 	// Read Object from xml
 	try
 	{
 		ticpp::Document doc;
+		doc.UseArena();
 		doc.Parse( m_data, true, TIXML_ENCODING_UTF8 );
 		ticpp::Element* element = doc.FirstChildElement();
 
@@ -29,12 +29,45 @@
 #include <wx/dnd.h>
 #include "utils/wxfbdefs.h"
 
+// The XML of the objects, the only format of the older versions
 #define wxFBDataObjectFormat wxDataFormat( wxT("wxFormBuilderDataFormat") )
 
+// The binary form of the objects, see wxFBDataObject
+#define wxFBBinaryDataObjectFormat wxDataFormat( wxT("wxFormBuilderBinaryDataFormat") )
+
+/**
+Objects copied to the clipboard.
+
+The copied object is cloned, and its data is only rendered when it is
+requested: a compact binary form for wxFBBinaryDataObjectFormat, with the
+values of each object in the order the objects store them, and the XML of
+the object for wxFBDataObjectFormat and the text format. The older versions
+only know the XML. Pasting in the process which copied the object
+clones it again, without decoding anything, and the binary form is decoded
+without names while the object database is the same one it was made with.
+*/
 class wxFBDataObject : public wxDataObject
 {
 private:
-	std::string m_data;
+	// The copy held by the clipboard, empty when the data comes from it
+	PObjectBase m_object;
+	int m_major;
+	int m_minor;
+	wxUint64 m_signature;
+
+	// Identifies the copy, see s_copied
+	unsigned int m_copyId;
+
+	// Rendered when they are first requested
+	mutable std::string m_data;
+	mutable std::string m_text;
+
+	// The last object copied by this process, while the clipboard holds it
+	static WPObjectBase s_copied;
+	static unsigned int s_copyId;
+
+	const std::string& GetData( const wxDataFormat& format ) const;
+	PObjectBase GetObjFromXml();
 
 public:
 	wxFBDataObject( PObjectBase obj = PObjectBase() );
@@ -1235,10 +1235,140 @@ void VisualEditor::OnObjectRemoved( wxFBObjectEvent & )
 	Create();
 }
 
-void VisualEditor::OnPropertyModified( wxFBPropertyEvent &)
+bool VisualEditor::UpdateProperty( PProperty property )
+{
+	// The panes and pages are set up when the form is created
+	if ( !property || !m_form || m_auimgr || m_wizard )
+	{
+		return false;
+	}
+
+	PObjectBase obj = property->GetObject();
+	if ( !obj || obj == m_form )
+	{
+		return false;
+	}
+
+	ObjectBaseMap::iterator it = m_baseobjects.find( obj.get() );
+	if ( it == m_baseobjects.end() )
+	{
+		return false;
+	}
+	wxObject* wxobject = it->second;
+
+	IComponent* comp = obj->GetObjectInfo()->GetComponent();
+	if ( !comp )
+	{
+		return false;
+	}
+
+	wxWindow* window = NULL;
+	if ( COMPONENT_TYPE_WINDOW == comp->GetComponentType() )
+	{
+		window = wxDynamicCast( wxobject, wxWindow );
+	}
+
+	IPropertyUpdateComponent* update = dynamic_cast< IPropertyUpdateComponent* >( comp );
+	if ( !update || !update->UpdateProperty( wxobject, obj.get(), PropertyHandle( property->GetNameId() ) ) )
+	{
+		// The properties applied by SetupWindow are common to all the windows
+		if ( !window || !UpdateWindowProperty( obj, window, property ) )
+		{
+			return false;
+		}
+	}
+
+	UpdateLayout( window );
+	return true;
+}
+
+bool VisualEditor::UpdateWindowProperty( PObjectBase obj, wxWindow* window, PProperty property )
+{
+	wxString name = property->GetName();
+	wxString value = property->GetValue();
+
+	if ( name == wxT("enabled") )
+	{
+		window->Enable( property->GetValueAsInteger() != 0 );
+		return true;
+	}
+
+	if ( name == wxT("hidden") )
+	{
+		window->Show( !property->GetValueAsInteger() );
+		return true;
+	}
+
+	if ( name == wxT("tooltip") )
+	{
+		window->SetToolTip( value );
+		return true;
+	}
+
+	// The children only inherit the font and colours when they are created,
+	// and the default values can only be restored by creating the window again
+	if ( obj->GetChildCount() > 0 || value.empty() )
+	{
+		return false;
+	}
+
+	if ( name == wxT("font") )
+	{
+		window->SetFont( TypeConv::StringToFont( value ) );
+		return true;
+	}
+
+	if ( name == wxT("fg") )
+	{
+		window->SetForegroundColour( TypeConv::StringToColour( value ) );
+		window->Refresh();
+		return true;
+	}
+
+	if ( name == wxT("bg") )
+	{
+		window->SetBackgroundColour( TypeConv::StringToColour( value ) );
+		window->Refresh();
+		return true;
+	}
+
+	return false;
+}
+
+void VisualEditor::UpdateLayout( wxWindow* window )
+{
+	// The best sizes cached by the parents depend on the window modified
+	for ( wxWindow* parent = window; parent && parent != m_back; parent = parent->GetParent() )
+	{
+		parent->InvalidateBestSize();
+		parent->Layout();
+	}
+
+	m_back->Layout();
+
+	// Same as in Create, the size property was already adjusted then
+	wxSize backSize( m_form->GetPropertyAsSize( wxT("size") ) );
+	if ( backSize.GetHeight() == wxDefaultCoord || backSize.GetWidth() == wxDefaultCoord )
+	{
+		m_back->GetSizer()->Fit( m_back );
+		m_back->SetClientSize( m_back->GetBestSize() );
+		m_back->SetSize( backSize );
+	}
+
+	m_back->Refresh();
+	Refresh();
+}
+
+void VisualEditor::OnPropertyModified( wxFBPropertyEvent& event )
 {
 	if ( !m_stopModifiedEvent )
 	{
+		if ( UpdateProperty( event.GetFBProperty() ) )
+		{
+			UpdateVirtualSize();
+			return;
+		}
+
 		PObjectBase aux = m_back->GetSelectedObject();
 		Create();
 		if ( aux )
@@ -125,6 +125,11 @@ class VisualEditor : public wxScrolledWindow
   void Create();
   void DeleteAbstractObjects();
 
+  // Apply a modified property without creating the form again
+  bool UpdateProperty( PProperty property );
+  bool UpdateWindowProperty( PObjectBase obj, wxWindow* window, PProperty property );
+  void UpdateLayout( wxWindow* window );
+
   void ClearAui();
   void SetupAui( PObjectBase obj, wxWindow* window );
   void ScanPanes( wxWindow* parent );
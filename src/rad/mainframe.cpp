@@ -162,6 +162,7 @@ EVT_FB_OBJECT_SELECTED( MainFrame::OnObjectSelected )
 EVT_FB_PROJECT_LOADED( MainFrame::OnProjectLoaded )
 EVT_FB_PROJECT_REFRESH( MainFrame::OnProjectRefresh )
 EVT_FB_PROJECT_SAVED( MainFrame::OnProjectSaved )
+EVT_FB_PROJECT_SAVING( MainFrame::OnProjectSaving )
 EVT_FB_PROPERTY_MODIFIED( MainFrame::OnPropertyModified )
 EVT_FB_EVENT_HANDLER_MODIFIED( MainFrame::OnEventHandlerModified )
 
@@ -717,6 +718,11 @@ void MainFrame::OnProjectSaved( wxFBEvent& )
 	UpdateFrame();
 }
 
+void MainFrame::OnProjectSaving( wxFBEvent& event )
+{
+	GetStatusBar()->SetStatusText( event.GetString() );
+}
+
 void MainFrame::OnObjectExpanded( wxFBObjectEvent& )
 {
 	UpdateFrame();
@@ -1332,6 +1338,9 @@ bool MainFrame::SaveWarning()
 {
 	int result = wxYES;
 
+	// If the save in progress fails, the project is still modified
+	AppData()->WaitForSave();
+
 	if ( AppData()->IsModified() )
 	{
 		result = ::wxMessageBox( wxT( "Current project file has been modified...\n" )
@@ -1344,6 +1353,12 @@ bool MainFrame::SaveWarning()
 		{
 			wxCommandEvent dummy;
 			OnSaveProject( dummy );
+
+			// The project is closed only once it is saved
+			if ( !AppData()->WaitForSave() )
+			{
+				return false;
+			}
 		}
 	}
 
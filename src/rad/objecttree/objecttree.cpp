@@ -68,6 +68,7 @@ wxPanel( parent, id )
     Connect( wxID_ANY, wxEVT_FB_OBJECT_SELECTED, wxFBObjectEventHandler( ObjectTree::OnObjectSelected ) );
     Connect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_EXPANDED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
     Connect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_COLLAPSED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
+    Connect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_EXPANDING, wxTreeEventHandler( ObjectTree::OnItemExpanding ) );
 
     m_altKeyIsDown = false;
 }
@@ -133,6 +134,7 @@ void ObjectTree::RebuildTree()
 	// Clear the old tree and map
 	m_tcObjects->DeleteAllItems();
 	m_map.clear();
+	m_unpopulated.clear();
 
 	if (project)
 	{
@@ -333,6 +335,15 @@ void ObjectTree::AddChildren(PObjectBase obj, wxTreeItemId &parent, bool is_root
 		// Set the name
 		UpdateItem( new_parent, obj );
 
+		// Don't build the children of a form just to show them, wait until
+		// the item is expanded
+		if ( obj->HasUnloadedChildren() )
+		{
+			m_unpopulated.insert( obj );
+			m_tcObjects->SetItemHasChildren( new_parent, true );
+			return;
+		}
+
 		// Add the rest of the children
 		unsigned int count = obj->GetChildCount();
 		unsigned int i;
@@ -347,13 +358,8 @@ void ObjectTree::AddChildren(PObjectBase obj, wxTreeItemId &parent, bool is_root
 
 int ObjectTree::GetImageIndex (wxString name)
 {
-	int index = 0; //default icon
-
-	IconIndexMap::iterator it = m_iconIdx.find(name);
-	if (it != m_iconIdx.end())
-		index = it->second;
-
-	return index;
+	// 0 is the default icon
+	return AppBitmaps::GetClassIconIndex( name );
 }
 
 void ObjectTree::UpdateItem(wxTreeItemId id, PObjectBase obj)
@@ -376,15 +382,7 @@ void ObjectTree::UpdateItem(wxTreeItemId id, PObjectBase obj)
 void ObjectTree::Create()
 {
 	// Cramos la lista de iconos obteniendo los iconos de los paquetes.
-	unsigned int index = 0;
-	m_iconList = new wxImageList(ICON_SIZE,ICON_SIZE);
-
-	{
-		wxBitmap icon = AppBitmaps::GetBitmap(wxT("project"), ICON_SIZE);
-		m_iconList->Add(icon);
-		m_iconIdx.insert(IconIndexMap::value_type( wxT("_default_"),index++));
-	}
-
+	// The list is shared with the palette, the icons it added are not added again
 	unsigned int pkg_count = AppData()->GetPackageCount();
 	for (unsigned int i = 0; i< pkg_count;i++)
 	{
@@ -393,17 +391,22 @@ void ObjectTree::Create()
 		unsigned int j;
 		for (j=0;j<pkg->GetObjectCount();j++)
 		{
-			wxString comp_name(pkg->GetObjectInfo(j)->GetClassName());
-			m_iconList->Add( pkg->GetObjectInfo(j)->GetIconFile() );
-			m_iconIdx.insert(IconIndexMap::value_type(comp_name,index++));
+			PObjectInfo info = pkg->GetObjectInfo(j);
+			AppBitmaps::AddClassIcon( info->GetClassName(), info->GetIconFile() );
 		}
 	}
 
-	m_tcObjects->AssignImageList(m_iconList);
+	m_tcObjects->SetImageList( AppBitmaps::GetImageList() );
 }
 
 void ObjectTree::RestoreItemStatus(PObjectBase obj)
 {
+	// Expanding it would load the children
+	if ( m_unpopulated.find( obj ) != m_unpopulated.end() )
+	{
+		return;
+	}
+
 	ObjectItemMap::iterator item_it = m_map.find(obj);
 	if (item_it != m_map.end())
 	{
@@ -428,6 +431,12 @@ void ObjectTree::AddItem(PObjectBase item, PObjectBase parent)
 		while( parent && parent->GetObjectInfo()->GetObjectType()->IsItem() ) parent = parent->GetParent();
 
 		// add new item to the object tree
+		// The new item is added with the rest of the children
+		if ( PopulateItem( parent ) )
+		{
+			return;
+		}
+
 		ObjectItemMap::iterator it = m_map.find( parent );
 		if( (it != m_map.end()) && it->second.IsOk() )
 		{
@@ -452,12 +461,66 @@ void ObjectTree::ClearMap(PObjectBase obj)
 {
 	m_map.erase( obj );
 
+	// The children were never added
+	if ( m_unpopulated.erase( obj ) > 0 )
+	{
+		return;
+	}
+
 	for ( unsigned int i = 0; i < obj->GetChildCount(); i++ )
 	{
 		ClearMap( obj->GetChild( i ) );
 	}
 }
 
+bool ObjectTree::PopulateItem(PObjectBase obj)
+{
+	if ( m_unpopulated.erase( obj ) == 0 )
+	{
+		return false;
+	}
+
+	ObjectItemMap::iterator it = m_map.find( obj );
+	if ( it == m_map.end() || !it->second.IsOk() )
+	{
+		return false;
+	}
+
+	wxTreeItemId id = it->second;
+
+	Disconnect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_EXPANDED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
+	Disconnect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_COLLAPSED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
+
+	// This builds the children
+	unsigned int count = obj->GetChildCount();
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		AddChildren( obj->GetChild( i ), id );
+	}
+
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		RestoreItemStatus( obj->GetChild( i ) );
+	}
+
+	m_tcObjects->SetItemHasChildren( id, count > 0 );
+
+	Connect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_COLLAPSED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
+	Connect( wxID_ANY, wxEVT_COMMAND_TREE_ITEM_EXPANDED, wxTreeEventHandler( ObjectTree::OnExpansionChange ) );
+
+	return true;
+}
+
+void ObjectTree::OnItemExpanding(wxTreeEvent &event)
+{
+	PObjectBase obj = GetObjectFromTreeItem( event.GetItem() );
+	if ( obj )
+	{
+		PopulateItem( obj );
+	}
+	event.Skip();
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // wxFormBuilder Event Handlers
 /////////////////////////////////////////////////////////////////////////////
@@ -494,6 +557,18 @@ void ObjectTree::OnObjectSelected( wxFBObjectEvent &event )
 {
     PObjectBase obj = event.GetFBObject();
 
+	// The object may be inside a form whose children were not added yet
+	if ( m_map.find( obj ) == m_map.end() )
+	{
+		for ( PObjectBase parent = obj->GetParent(); parent; parent = parent->GetParent() )
+		{
+			if ( PopulateItem( parent ) )
+			{
+				break;
+			}
+		}
+	}
+
 	// Find the tree item associated with the object and select it
 	ObjectItemMap::iterator it = m_map.find(obj);
 	if ( it != m_map.end() )
@@ -28,6 +28,7 @@
 
 #include "utils/wxfbdefs.h"
 #include <map>
+#include <set>
 #include "rad/customkeys.h"
 
 #include <wx/treectrl.h>
@@ -40,12 +41,12 @@ class ObjectTree : public wxPanel
 {
 private:
    typedef std::map< PObjectBase, wxTreeItemId> ObjectItemMap;
-   typedef std::map<wxString, int> IconIndexMap;
 
    ObjectItemMap m_map;
 
-   wxImageList *m_iconList;
-   IconIndexMap m_iconIdx;
+   // Objects whose children were not loaded when their item was created,
+   // their items are filled when expanded
+   std::set< PObjectBase > m_unpopulated;
 
    wxTextCtrl* m_txtSelected;
    wxTreeCtrl* m_tcObjects;
@@ -65,6 +66,7 @@ private:
    void AddItem(PObjectBase item, PObjectBase parent);
    void RemoveItem(PObjectBase item);
    void ClearMap(PObjectBase obj);
+   bool PopulateItem(PObjectBase obj);
 
    PObjectBase GetObjectFromTreeItem( wxTreeItemId item );
 
@@ -80,6 +82,7 @@ public:
   void OnBeginDrag(wxTreeEvent &event);
   void OnEndDrag(wxTreeEvent &event);
   void OnExpansionChange(wxTreeEvent &event);
+  void OnItemExpanding(wxTreeEvent &event);
 
   void OnProjectLoaded ( wxFBEvent &event );
   void OnProjectSaved  ( wxFBEvent &event );
@@ -29,6 +29,7 @@
 #include "utils/debug.h"
 #include "utils/wxfbdefs.h"
 #include "utils/typeconv.h"
+#include "utils/startupprofile.h"
 #include "rad/title.h"
 #include "wx/config.h"
 #include "rad/appdata.h"
@@ -40,6 +41,10 @@
 
 #define ID_PALETTE_BUTTON 999
 
+// Items of the menu of the search results, below the ids of the tools
+#define ID_SEARCH_RESULT ( wxID_HIGHEST + 1 )
+#define MAX_SEARCH_RESULTS 500
+
 #ifdef __WXGTK__
 	#if wxCHECK_VERSION( 2, 8, 0 )
 		#define DRAG_OPTION 0
@@ -57,6 +62,8 @@
 wxWindowID wxFbPalette::nextId = wxID_HIGHEST + 1000;
 
 BEGIN_EVENT_TABLE( wxFbPalette, wxPanel )
+	// Before EVT_TOOL, menu items send the same events as the tools
+	EVT_MENU_RANGE( ID_SEARCH_RESULT, ID_SEARCH_RESULT + MAX_SEARCH_RESULTS - 1, wxFbPalette::OnSearchResult )
 	#ifdef __WXMAC__
 		EVT_BUTTON( -1, wxFbPalette::OnButtonClick )
 	#else
@@ -64,10 +71,16 @@ BEGIN_EVENT_TABLE( wxFbPalette, wxPanel )
 	#endif
 	EVT_SPIN_UP( -1, wxFbPalette::OnSpinUp )
 	EVT_SPIN_DOWN( -1, wxFbPalette::OnSpinDown )
+	#ifdef USE_FLATNOTEBOOK
+		EVT_FLATNOTEBOOK_PAGE_CHANGED( -1, wxFbPalette::OnPageChanged )
+	#else
+		EVT_AUINOTEBOOK_PAGE_CHANGED( -1, wxFbPalette::OnPageChanged )
+	#endif
+	EVT_SEARCHCTRL_SEARCH_BTN( -1, wxFbPalette::OnSearch )
 END_EVENT_TABLE()
 
 wxFbPalette::wxFbPalette( wxWindow *parent, int id )
-		: wxPanel( parent, id ), m_notebook( NULL )
+		: wxPanel( parent, id ), m_search( NULL ), m_notebook( NULL )
 {
 }
 
@@ -85,7 +98,8 @@ void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxToolBar *toolbar )
 		{
 			toolbar->AddSeparator();
 		}
-		if ( NULL == info->GetComponent() )
+		// The libraries of the components are loaded when they are used
+		if ( !info->HasComponent() )
 		{
 #if wxVERSION_NUMBER < 2900
 			LogDebug( _( "Missing Component for Class \"%s\" of Package \"%s\"." ), info->GetClassName().c_str(), pkg->GetPackageName().c_str() );
@@ -99,6 +113,9 @@ void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxToolBar *toolbar )
 
 			wxBitmap icon = info->GetIconFile();
 
+			// The object tree uses the same icons
+			AppBitmaps::AddClassIcon( widget, icon );
+
 			#ifdef __WXMAC__
 				wxBitmapButton* button = new wxBitmapButton( toolbar, nextId++, icon );
 				button->SetToolTip( widget );
@@ -113,9 +130,88 @@ void wxFbPalette::PopulateToolbar( PObjectPackage pkg, wxToolBar *toolbar )
 	}
 }
 
+wxSize wxFbPalette::BuildPage( size_t index )
+{
+	if ( index >= m_pages.size() )
+	{
+		return wxDefaultSize;
+	}
+
+	wxPanel *panel = m_pages[index];
+	if ( m_tv[index] != NULL )
+	{
+		return panel->GetSizer()->GetMinSize();
+	}
+
+	PObjectPackage pkg = AppData()->GetPackage( index );
+	wxBoxSizer *sizer = new wxBoxSizer( wxHORIZONTAL );
+
+#if wxVERSION_NUMBER >= 2900
+	wxAuiToolBar *toolbar = new wxAuiToolBar( panel, -1, wxDefaultPosition, wxDefaultSize, wxAUI_TB_DEFAULT_STYLE | wxAUI_TB_OVERFLOW | wxNO_BORDER );
+	toolbar->SetToolBitmapSize( wxSize( 22, 22 ) );
+	PopulateToolbar( pkg, toolbar );
+	m_tv[index] = toolbar;
+
+	sizer->Add( toolbar, 1, wxEXPAND, 0 );
+#else
+	wxPanel *tbPanel = new wxPanel( panel, -1 );
+	//tbPanel->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
+	wxBoxSizer *tbSizer = new wxBoxSizer( wxHORIZONTAL );
+
+	wxPanel *sbPanel = new wxPanel( panel, -1 );
+	//sbPanel->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
+	wxBoxSizer *sbSizer = new wxBoxSizer( wxHORIZONTAL );
+
+	wxToolBar *toolbar = new wxToolBar( tbPanel, -1, wxDefaultPosition, wxDefaultSize, wxTB_NODIVIDER | wxTB_FLAT );
+	toolbar->SetToolBitmapSize( wxSize( 22, 22 ) );
+	//toolbar->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
+	PopulateToolbar( pkg, toolbar );
+	m_tv[index] = toolbar;
+
+	tbSizer->Add( toolbar, 1, wxEXPAND | wxALIGN_CENTER_VERTICAL );
+	tbPanel->SetSizer( tbSizer );
+
+	wxSpinButton *sb = new wxSpinButton( sbPanel, -1, wxDefaultPosition, wxDefaultSize, wxSP_HORIZONTAL );
+	sb->SetRange( 0, ( int )pkg->GetObjectCount() - 1 );
+	sb->SetValue( 0 );
+	sbSizer->Add( sb, 0, wxEXPAND );//wxALL | wxALIGN_TOP, 0);
+	sbPanel->SetSizer( sbSizer );
+
+	sizer->Add( tbPanel, 1, wxEXPAND, 0 );
+	sizer->Add( sbPanel, 0, wxEXPAND, 0 );
+#endif
+
+	panel->SetAutoLayout( true );
+	panel->SetSizer( sizer );
+	panel->Layout();
+
+	return sizer->GetMinSize();
+}
+
+int wxFbPalette::GetSelectedPackage()
+{
+	int selection = m_notebook->GetSelection();
+	if ( selection < 0 )
+	{
+		return wxNOT_FOUND;
+	}
+
+	wxWindow *page = m_notebook->GetPage( selection );
+	for ( size_t i = 0; i < m_pages.size(); i++ )
+	{
+		if ( m_pages[i] == page )
+		{
+			return (int)i;
+		}
+	}
+	return wxNOT_FOUND;
+}
+
 void wxFbPalette::Create()
 {
-	wxBoxSizer *top_sizer = new wxBoxSizer( wxVERTICAL );
+	StartupProfile::Timer timer( "wxFbPalette::Create" );
+
+	wxBoxSizer *top_sizer = new wxBoxSizer( wxHORIZONTAL );
 
 #ifdef USE_FLATNOTEBOOK
 	long nbStyle;
@@ -147,78 +243,52 @@ void wxFbPalette::Create()
 	wxSize minsize;
 #endif
 
+	m_tv.assign( pkg_count, (ToolbarVector::value_type)NULL );
+	m_posVector.assign( pkg_count, 0 );
 	for ( unsigned int i = 0; i < pkg_count;i++ )
 	{
 		PObjectPackage pkg = AppData()->GetPackage( i );
 		wxString pkg_name = pkg->GetPackageName();
 
+		// The toolbar is created when the page is shown
 		wxPanel *panel = new wxPanel( m_notebook, -1 );
-		//panel->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
-		wxBoxSizer *sizer = new wxBoxSizer( wxHORIZONTAL );
-
-#if wxVERSION_NUMBER >= 2900
-		wxAuiToolBar *toolbar = new wxAuiToolBar( panel, -1, wxDefaultPosition, wxDefaultSize, wxAUI_TB_DEFAULT_STYLE | wxAUI_TB_OVERFLOW | wxNO_BORDER );
-		toolbar->SetToolBitmapSize( wxSize( 22, 22 ) );
-		PopulateToolbar( pkg, toolbar );
-		m_tv.push_back( toolbar );
+		m_pages.push_back( panel );
 
-		sizer->Add( toolbar, 1, wxEXPAND, 0 );
-#else
-		wxPanel *tbPanel = new wxPanel( panel, -1 );
-		//tbPanel->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
-		wxBoxSizer *tbSizer = new wxBoxSizer( wxHORIZONTAL );
-
-		wxPanel *sbPanel = new wxPanel( panel, -1 );
-		//sbPanel->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
-		wxBoxSizer *sbSizer = new wxBoxSizer( wxHORIZONTAL );
-
-		wxToolBar *toolbar = new wxToolBar( tbPanel, -1, wxDefaultPosition, wxDefaultSize, wxTB_NODIVIDER | wxTB_FLAT );
-		toolbar->SetToolBitmapSize( wxSize( 22, 22 ) );
-		//toolbar->SetBackgroundColour( wxSystemSettings::GetColour( wxSYS_COLOUR_3DFACE ) );
-		PopulateToolbar( pkg, toolbar );
-		m_tv.push_back( toolbar );
-
-		tbSizer->Add( toolbar, 1, wxEXPAND | wxALIGN_CENTER_VERTICAL );
-		tbPanel->SetSizer( tbSizer );
-
-		wxSpinButton *sb = new wxSpinButton( sbPanel, -1, wxDefaultPosition, wxDefaultSize, wxSP_HORIZONTAL );
-		sb->SetRange( 0, ( int )pkg->GetObjectCount() - 1 );
-		sb->SetValue( 0 );
-		m_posVector.push_back( 0 );
-		sbSizer->Add( sb, 0, wxEXPAND );//wxALL | wxALIGN_TOP, 0);
-		sbPanel->SetSizer( sbSizer );
-
-		sizer->Add( tbPanel, 1, wxEXPAND, 0 );
-		sizer->Add( sbPanel, 0, wxEXPAND, 0 );
+		m_notebook->AddPage( panel, pkg_name, false, i );
+#ifndef USE_FLATNOTEBOOK
+		m_notebook->SetPageBitmap( i, pkg->GetPackageIcon() );
 #endif
+	}
 
-		panel->SetAutoLayout( true );
-		panel->SetSizer( sizer );
-		sizer->Fit( panel );
-		sizer->SetSizeHints( panel );
-
+	// The pages have the same height, the first one shown gives the size of the palette
+	int selected = GetSelectedPackage();
+	if ( selected >= 0 )
+	{
+		wxSize pageSize = BuildPage( selected );
 #ifndef USE_FLATNOTEBOOK
-		wxSize cursize = panel->GetSize();
-		if( cursize.x > minsize.x ) minsize.x = cursize.x;
-		if( cursize.y > minsize.y ) minsize.y = cursize.y + 30;
+		minsize.x = pageSize.x;
+		minsize.y = pageSize.y + 30;
 #endif
+	}
 
-		m_notebook->AddPage( panel, pkg_name, false, i );
+	m_search = new wxSearchCtrl( this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxSize( 160, -1 ) );
+	m_search->SetToolTip( _("Find a component in all the packages") );
 #ifndef USE_FLATNOTEBOOK
-		m_notebook->SetPageBitmap( i, pkg->GetPackageIcon() );
+	minsize.x += m_search->GetSize().x + 4;
 #endif
 
-	}
 	//Title *title = new Title( this, wxT("Component Palette") );
 	//top_sizer->Add(title,0,wxEXPAND,0);
 #ifdef USE_FLATNOTEBOOK
 	top_sizer->Add( m_notebook, 1, wxEXPAND, 0 );
+	top_sizer->Add( m_search, 0, wxALL, 2 );
 	SetAutoLayout( true );
 	SetSizer( top_sizer );
 	top_sizer->Fit( this );
 	top_sizer->SetSizeHints( this );
 #else
 	top_sizer->Add( m_notebook, 1, wxEXPAND, 0 );
+	top_sizer->Add( m_search, 0, wxALL, 2 );
 	SetSizer( top_sizer );
 	SetSize( minsize );
 	SetMinSize( minsize );
@@ -230,7 +300,8 @@ void wxFbPalette::Create()
 void wxFbPalette::OnSpinUp( wxSpinEvent& )
 {
 #if wxVERSION_NUMBER < 2900
-	int page = m_notebook->GetSelection();
+	int page = GetSelectedPackage();
+	if ( page < 0 || NULL == m_tv[page] ) return;
 	PObjectPackage pkg = AppData()->GetPackage( page );
 
 	if (( int )pkg->GetObjectCount() - m_posVector[page] - 1 <= 0 ) return;
@@ -245,7 +316,8 @@ void wxFbPalette::OnSpinUp( wxSpinEvent& )
 void wxFbPalette::OnSpinDown( wxSpinEvent& )
 {
 #if wxVERSION_NUMBER < 2900
-	int page = m_notebook->GetSelection();
+	int page = GetSelectedPackage();
+	if ( page < 0 || NULL == m_tv[page] ) return;
 	if ( m_posVector[page] <= 0 ) return;
 
 	m_posVector[page]--;
@@ -281,6 +353,12 @@ void wxFbPalette::OnButtonClick( wxCommandEvent &event )
 	#else
 		for ( unsigned int i = 0; i < m_tv.size(); i++ )
 		{
+			// Pages not shown yet have no toolbar
+			if ( NULL == m_tv[i] )
+			{
+				continue;
+			}
+
 			#if wxVERSION_NUMBER >= 2900
 			if ( m_tv[i]->GetToolIndex( event.GetId() ) != wxNOT_FOUND )
 			#else
@@ -295,6 +373,66 @@ void wxFbPalette::OnButtonClick( wxCommandEvent &event )
 	#endif
 }
 
+#ifdef USE_FLATNOTEBOOK
+void wxFbPalette::OnPageChanged( wxFlatNotebookEvent& event )
+#else
+void wxFbPalette::OnPageChanged( wxAuiNotebookEvent& event )
+#endif
+{
+	int package = GetSelectedPackage();
+	if ( package >= 0 )
+	{
+		BuildPage( package );
+	}
+	event.Skip();
+}
+
+void wxFbPalette::OnSearch( wxCommandEvent& )
+{
+	wxString text = m_search->GetValue().Lower();
+	text.Trim().Trim( false );
+	if ( text.empty() )
+	{
+		return;
+	}
+
+	// Only the classes of the packages are searched, no page is created
+	m_results.clear();
+	wxMenu menu;
+	unsigned int pkg_count = AppData()->GetPackageCount();
+	for ( unsigned int i = 0; i < pkg_count && m_results.size() < MAX_SEARCH_RESULTS; i++ )
+	{
+		PObjectPackage pkg = AppData()->GetPackage( i );
+		for ( unsigned int j = 0; j < pkg->GetObjectCount() && m_results.size() < MAX_SEARCH_RESULTS; j++ )
+		{
+			PObjectInfo info = pkg->GetObjectInfo( j );
+			if ( info->HasComponent() && info->GetClassName().Lower().Contains( text ) )
+			{
+				menu.Append( ID_SEARCH_RESULT + (int)m_results.size(), info->GetClassName() + wxT(" (") + pkg->GetPackageName() + wxT(")") );
+				m_results.push_back( info );
+			}
+		}
+	}
+
+	if ( m_results.empty() )
+	{
+		menu.Append( ID_SEARCH_RESULT, _("No components found") );
+		menu.Enable( ID_SEARCH_RESULT, false );
+	}
+
+	wxPoint pos = m_search->GetPosition();
+	PopupMenu( &menu, pos.x, pos.y + m_search->GetSize().y );
+}
+
+void wxFbPalette::OnSearchResult( wxCommandEvent& event )
+{
+	size_t index = event.GetId() - ID_SEARCH_RESULT;
+	if ( index < m_results.size() )
+	{
+		AppData()->CreateObject( m_results[index]->GetClassName() );
+	}
+}
+
 wxFbPalette::~wxFbPalette()
 {
 #ifdef USE_FLATNOTEBOOK
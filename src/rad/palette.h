@@ -33,6 +33,7 @@
 #include <wx/aui/auibook.h>
 #endif
 #include <wx/spinbutt.h>
+#include <wx/srchctrl.h>
 #include <vector>
 #include <utils/wxfbdefs.h>
 #include <model/database.h>
@@ -46,10 +47,21 @@ typedef std::vector<wxAuiToolBar*> ToolbarVector;
 typedef std::vector<wxToolBar*> ToolbarVector;
 #endif
 
+/**
+ * The pages of the packages are empty until they are shown, their toolbars
+ * are only created then. The search box finds the components of every
+ * package, without creating their pages.
+ */
 class wxFbPalette : public wxPanel
 {
  private:
+  // The toolbar of each package, NULL until its page is shown
   ToolbarVector m_tv;
+  std::vector<wxPanel*> m_pages;
+  wxSearchCtrl *m_search;
+
+  // Components listed by the last search
+  std::vector<PObjectInfo> m_results;
 #ifdef USE_FLATNOTEBOOK
   wxFlatNotebook *m_notebook;
   wxFlatNotebookImageList m_icons;
@@ -65,6 +77,17 @@ class wxFbPalette : public wxPanel
   void PopulateToolbar(PObjectPackage pkg, wxToolBar *toolbar);
 #endif
 
+  /**
+   * Creates the toolbar of the page of a package, if it was not created yet.
+   * @return The minimum size of the page.
+   */
+  wxSize BuildPage(size_t index);
+
+  /**
+   * Package of the selected page, the pages may have been moved.
+   */
+  int GetSelectedPackage();
+
   DECLARE_EVENT_TABLE()
 
  public:
@@ -79,6 +102,13 @@ class wxFbPalette : public wxPanel
   void OnSpinUp(wxSpinEvent& e);
   void OnSpinDown(wxSpinEvent& e);
   void OnButtonClick(wxCommandEvent &event);
+#ifdef USE_FLATNOTEBOOK
+  void OnPageChanged(wxFlatNotebookEvent& event);
+#else
+  void OnPageChanged(wxAuiNotebookEvent& event);
+#endif
+  void OnSearch(wxCommandEvent& event);
+  void OnSearchResult(wxCommandEvent& event);
 };
 /*
 class PaletteButton : public wxBitmapButton
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "projectsaver.h"
+#include "appdata.h"
+#include "model/projectsnapshot.h"
+#include "model/projectcache.h"
+
+#include <wx/thread.h>
+
+static const wxEventType wxEVT_PROJECT_SAVE_PROGRESS = wxNewEventType();
+static const wxEventType wxEVT_PROJECT_SAVE_FINISHED = wxNewEventType();
+
+class ProjectSaver::SaveThread : public wxThread, public ProjectSnapshot::Progress
+{
+private:
+	ProjectSaver* m_saver;
+	long m_id;
+	boost::shared_ptr< ProjectSnapshot > m_snapshot;
+	boost::shared_ptr< ProjectCache > m_cache;
+	wxString m_filename;
+	int m_percent;
+
+	// Result, read after the thread is joined
+	bool m_saved;
+	wxString m_error;
+
+public:
+	SaveThread( ProjectSaver* saver, long id, boost::shared_ptr< ProjectSnapshot > snapshot,
+				boost::shared_ptr< ProjectCache > cache, const wxString& filename )
+	:
+	wxThread( wxTHREAD_JOINABLE ),
+	m_saver( saver ),
+	m_id( id ),
+	m_snapshot( snapshot ),
+	m_cache( cache ),
+	m_filename( filename.c_str() ), // Not shared with the main thread
+	m_percent( -1 ),
+	m_saved( false )
+	{
+	}
+
+	bool IsSaved() const { return m_saved; }
+	const wxString& GetError() const { return m_error; }
+
+	ExitCode Entry()
+	{
+		m_saved = m_snapshot->Save( &m_error, this );
+
+		// Not being able to write the cache is not an error, the project is saved
+		if ( m_saved && m_cache )
+		{
+			m_cache->Save( m_filename, *m_snapshot );
+		}
+
+		wxCommandEvent event( wxEVT_PROJECT_SAVE_FINISHED );
+		event.SetExtraLong( m_id );
+		m_saver->AddPendingEvent( event );
+		return 0;
+	}
+
+	void Update( size_t written, size_t total )
+	{
+		// Only when it changes, to not flood the event loop
+		int percent = (int)( written * 100 / total );
+		if ( percent != m_percent )
+		{
+			m_percent = percent;
+			wxCommandEvent event( wxEVT_PROJECT_SAVE_PROGRESS );
+			event.SetInt( percent );
+			event.SetExtraLong( m_id );
+			m_saver->AddPendingEvent( event );
+		}
+	}
+};
+
+ProjectSaver::ProjectSaver()
+:
+m_thread( NULL ),
+m_id( 0 )
+{
+	Connect( wxEVT_PROJECT_SAVE_PROGRESS, wxCommandEventHandler( ProjectSaver::OnProgress ) );
+	Connect( wxEVT_PROJECT_SAVE_FINISHED, wxCommandEventHandler( ProjectSaver::OnFinished ) );
+}
+
+ProjectSaver::~ProjectSaver()
+{
+	if ( m_thread )
+	{
+		m_thread->Wait();
+		delete m_thread;
+	}
+}
+
+void ProjectSaver::Start( boost::shared_ptr< ProjectSnapshot > snapshot, const wxString& filename,
+						  boost::shared_ptr< ProjectCache > cache )
+{
+	m_filename = filename;
+	m_thread = new SaveThread( this, ++m_id, snapshot, cache, filename );
+	if ( m_thread->Create() != wxTHREAD_NO_ERROR || m_thread->Run() != wxTHREAD_NO_ERROR )
+	{
+		delete m_thread;
+		m_thread = NULL;
+
+		wxString error;
+		bool saved = snapshot->Save( &error );
+		if ( saved && cache )
+		{
+			cache->Save( filename, *snapshot );
+		}
+		Finish( saved, error );
+	}
+}
+
+void ProjectSaver::OnProgress( wxCommandEvent& event )
+{
+	// Events of a save already reported by Wait are ignored
+	if ( m_thread && event.GetExtraLong() == m_id )
+	{
+		AppData()->ProjectSaveProgress( event.GetInt() );
+	}
+}
+
+void ProjectSaver::OnFinished( wxCommandEvent& event )
+{
+	// Ignored if Wait already reported the result
+	if ( m_thread && event.GetExtraLong() == m_id )
+	{
+		Join();
+	}
+}
+
+void ProjectSaver::Wait()
+{
+	if ( m_thread )
+	{
+		Join();
+	}
+}
+
+void ProjectSaver::Join()
+{
+	m_thread->Wait();
+	bool saved = m_thread->IsSaved();
+	wxString error = m_thread->GetError();
+	delete m_thread;
+	m_thread = NULL;
+
+	Finish( saved, error );
+}
+
+void ProjectSaver::Finish( bool saved, const wxString& error )
+{
+	AppData()->ProjectSaveFinished( m_filename, saved, error );
+}
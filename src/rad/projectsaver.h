@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PROJECT_SAVER__
+#define __PROJECT_SAVER__
+
+#include <wx/event.h>
+#include <boost/smart_ptr.hpp>
+
+class ProjectSnapshot;
+class ProjectCache;
+
+/**
+Writes project snapshots in a worker thread, so the project can still be
+edited while it is saved.
+
+The thread only uses the snapshot, and writes the cache of the project from
+it. Its progress and result are sent back as events, and handled on the main
+thread by ApplicationData.
+*/
+class ProjectSaver : public wxEvtHandler
+{
+private:
+	class SaveThread;
+	SaveThread* m_thread;
+	wxString m_filename;
+
+	// Identifies the events of the save in progress
+	long m_id;
+
+	void OnProgress( wxCommandEvent& event );
+	void OnFinished( wxCommandEvent& event );
+	void Join();
+	void Finish( bool saved, const wxString& error );
+
+public:
+	ProjectSaver();
+	~ProjectSaver();
+
+	/**
+	Starts writing @a snapshot, the project @a filename, nothing must be being saved.
+	If the thread can not be started, the snapshot is written before returning.
+	@param cache Optional, written from the snapshot once it is saved.
+	*/
+	void Start( boost::shared_ptr< ProjectSnapshot > snapshot, const wxString& filename,
+				boost::shared_ptr< ProjectCache > cache = boost::shared_ptr< ProjectCache >() );
+
+	bool IsSaving() const { return m_thread != NULL; }
+
+	/**
+	Waits for the save in progress, if any, and reports its result right away.
+	If the result starts another save, that one is not waited for.
+	*/
+	void Wait();
+};
+
+#endif //__PROJECT_SAVER__
@@ -28,6 +28,7 @@
 
 DEFINE_EVENT_TYPE( wxEVT_FB_PROJECT_LOADED )
 DEFINE_EVENT_TYPE( wxEVT_FB_PROJECT_SAVED )
+DEFINE_EVENT_TYPE( wxEVT_FB_PROJECT_SAVING )
 DEFINE_EVENT_TYPE( wxEVT_FB_OBJECT_EXPANDED )
 DEFINE_EVENT_TYPE( wxEVT_FB_OBJECT_SELECTED )
 DEFINE_EVENT_TYPE( wxEVT_FB_OBJECT_CREATED )
@@ -72,6 +73,7 @@ wxString wxFBEvent::GetEventName()
 {
 	CASE( wxEVT_FB_PROJECT_LOADED )
 	CASE( wxEVT_FB_PROJECT_SAVED )
+	CASE( wxEVT_FB_PROJECT_SAVING )
 	CASE( wxEVT_FB_OBJECT_EXPANDED )
 	CASE( wxEVT_FB_OBJECT_SELECTED )
 	CASE( wxEVT_FB_OBJECT_CREATED )
@@ -104,6 +104,7 @@ typedef void (wxEvtHandler::*wxFBEventHandlerEventFunction)  (wxFBEventHandlerEv
 BEGIN_DECLARE_EVENT_TYPES()
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_PROJECT_LOADED,    -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_PROJECT_SAVED,     -1 )
+  DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_PROJECT_SAVING,    -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_OBJECT_EXPANDED,   -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_OBJECT_SELECTED,   -1 )
   DECLARE_LOCAL_EVENT_TYPE( wxEVT_FB_OBJECT_CREATED,    -1 )
@@ -120,6 +121,9 @@ END_DECLARE_EVENT_TYPES()
 #define EVT_FB_PROJECT_SAVED(fn) \
   wx__DECLARE_EVT0(wxEVT_FB_PROJECT_SAVED,wxFBEventHandler(fn))
 
+#define EVT_FB_PROJECT_SAVING(fn) \
+  wx__DECLARE_EVT0(wxEVT_FB_PROJECT_SAVING,wxFBEventHandler(fn))
+
 #define EVT_FB_OBJECT_EXPANDED(fn) \
   wx__DECLARE_EVT0(wxEVT_FB_OBJECT_EXPANDED,wxFBObjectEventHandler(fn))
 
@@ -204,3 +204,9 @@ wxNoObject* wxFBManager::NewNoObject()
 {
     return new wxNoObject;
 }
+
+PropertyHandle wxFBManager::GetPropertyHandle( const wxString& name )
+{
+	// Needs no editor, the libraries resolve their handles when they are loaded
+	return PropertyHandle( PropertyInfo::RegisterName( name ) );
+}
@@ -50,6 +50,8 @@ public:
 
 	// Returns true if selection changed, false if already selected
 	bool SelectObject( wxObject* wxobject );
+
+	PropertyHandle GetPropertyHandle( const wxString& name );
 };
 
 #endif //WXFBMANAGER
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Loads the sample projects and saves each one through both serializers of
+// ObjectBase, XMLWriter must write exactly what TinyXML prints. Returns the
+// number of failed tests.
+//
+// Usage: projectwritertest [data directory [project ...]]
+// The defaults are those of output/bin: the data directory of wxFormBuilder
+// and the projects bundled with the sources.
+
+#include "rad/appdata.h"
+#include "model/objectbase.h"
+#include "model/projectconverter.h"
+#include "utils/stringutils.h"
+#include "utils/typeconv.h"
+#include "utils/wxfbexception.h"
+#include "utils/xmlwriter.h"
+#include <ticpp.h>
+
+#include <wx/filename.h>
+#include <wx/image.h>
+#include <wx/init.h>
+
+#include <cstdio>
+#include <string>
+
+static int s_pass = 0;
+static int s_fail = 0;
+
+static void XmlTest( const wxString& testString, const std::string& expected, const std::string& found )
+{
+	if ( expected == found )
+	{
+		printf( "[pass] %s\n", _STDSTR( testString ).c_str() );
+		++s_pass;
+	}
+	else
+	{
+		printf( "[fail] %s\n--- expected ---\n%s\n--- found ---\n%s\n", _STDSTR( testString ).c_str(), expected.c_str(), found.c_str() );
+		++s_fail;
+	}
+}
+
+static const wxChar* s_samples[] =
+{
+	wxT("../../src/rad/geninheritclass/GenInheritedDlg.fbp"),
+	wxT("../../sdk/plugin_interface/forms/wizard.fbp"),
+};
+
+static std::string ReadFile( const wxString& path )
+{
+	std::string text;
+	FILE* file = fopen( path.mb_str( wxConvFile ), "rb" );
+	if ( !file )
+	{
+		return text;
+	}
+
+	char buffer[4096];
+	size_t read;
+	while ( ( read = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+	{
+		text.append( buffer, read );
+	}
+	fclose( file );
+	return text;
+}
+
+/**
+Builds a project as ApplicationData::LoadProjectDocument does, converting it
+in memory when it is from an older version, so the sample is not modified.
+*/
+static PObjectBase LoadProject( const wxString& path )
+{
+	ticpp::Document doc;
+	XMLUtils::LoadXMLFile( doc, false, path );
+
+	ticpp::Element* root = doc.FirstChildElement();
+
+	int fbpVerMajor;
+	int fbpVerMinor;
+	ProjectConverter::GetFileVersion( root, &fbpVerMajor, &fbpVerMinor );
+
+	if ( ProjectConverter::CompareFileVersion( fbpVerMajor, fbpVerMinor, AppData()->m_fbpVerMajor, AppData()->m_fbpVerMinor ) < 0 )
+	{
+		ProjectConverter converter( fbpVerMajor, fbpVerMinor );
+		converter.ConvertDocument( &doc, AppData()->m_fbpVerMajor, AppData()->m_fbpVerMinor );
+		root = doc.FirstChildElement();
+	}
+
+	ObjectDatabase::DefaultsVersionMap defaults;
+	bool sparse = ObjectDatabase::ReadDefaultsVersions( root, &defaults );
+
+	return AppData()->GetObjectDatabase()->CreateObject( root->FirstChildElement( "object" ), PObjectBase(), sparse ? &defaults : NULL );
+}
+
+/**
+The project as saved through the document, like the project files were.
+*/
+static std::string PrintProject( PObjectBase project )
+{
+	wxString path = wxFileName::CreateTempFileName( wxT("fbp") );
+
+	ticpp::Document doc;
+	project->Serialize( &doc );
+	doc.SaveFile( std::string( path.mb_str( wxConvFile ) ) );
+
+	std::string text = ReadFile( path );
+	::wxRemoveFile( path );
+	return text;
+}
+
+/**
+The project as saved through XMLWriter, in a file opened as TinyXML opens it.
+*/
+static std::string WriteProject( PObjectBase project )
+{
+	wxString path = wxFileName::CreateTempFileName( wxT("fbp") );
+
+	std::string text;
+	FILE* file = fopen( path.mb_str( wxConvFile ), "w" );
+	if ( file )
+	{
+		XMLWriter writer( file );
+		project->Serialize( &writer );
+		bool written = writer.Flush();
+		fclose( file );
+
+		if ( written )
+		{
+			text = ReadFile( path );
+		}
+	}
+
+	::wxRemoveFile( path );
+	return text;
+}
+
+int main( int argc, char** argv )
+{
+	wxInitializer initializer;
+	wxInitAllImageHandlers();
+
+	// The objects of the projects need the plugins, not the GUI
+	wxString dataDir = ( argc > 1 ? wxString( argv[1], wxConvLocal ) : wxString( wxT("..") ) );
+	AppDataCreate( dataDir );
+	try
+	{
+		AppDataInit();
+	}
+	catch ( wxFBException& ex )
+	{
+		XmlTest( wxT("Load the plugins"), "", _STDSTR( ex.what() ) );
+		AppDataDestroy();
+		return s_fail;
+	}
+
+	wxArrayString projects;
+	for ( int i = 2; i < argc; i++ )
+	{
+		projects.Add( wxString( argv[i], wxConvLocal ) );
+	}
+	if ( projects.IsEmpty() )
+	{
+		for ( size_t i = 0; i < WXSIZEOF( s_samples ); i++ )
+		{
+			projects.Add( s_samples[i] );
+		}
+	}
+
+	for ( size_t i = 0; i < projects.GetCount(); i++ )
+	{
+		wxString name = wxFileName( projects[i] ).GetFullName();
+
+		PObjectBase project;
+		try
+		{
+			project = LoadProject( projects[i] );
+		}
+		catch ( wxFBException& ex )
+		{
+			XmlTest( wxT("Load ") + name, "", _STDSTR( ex.what() ) );
+			continue;
+		}
+		catch ( ticpp::Exception& ex )
+		{
+			XmlTest( wxT("Load ") + name, "", ex.m_details );
+			continue;
+		}
+
+		if ( !project )
+		{
+			XmlTest( wxT("Load ") + name, "project", "" );
+			continue;
+		}
+
+		std::string printed = PrintProject( project );
+		XmlTest( wxT("TinyXML saves ") + name, "true", printed.empty() ? "false" : "true" );
+		XmlTest( wxT("XMLWriter output matches TinyXML for ") + name, printed, WriteProject( project ) );
+	}
+
+	AppDataDestroy();
+
+	printf( "\nPass %d, Fail %d\n", s_pass, s_fail );
+	return s_fail;
+}
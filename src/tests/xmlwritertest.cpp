@@ -0,0 +1,304 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Checks that XMLWriter saves projects exactly as TinyXML prints them, the
+// same way xmltest.cpp checks TinyXML. Returns the number of failed tests.
+
+#include "utils/xmlwriter.h"
+#include <tinyxml.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static int s_pass = 0;
+static int s_fail = 0;
+
+static void XmlTest( const char* testString, const std::string& expected, const std::string& found )
+{
+	if ( expected == found )
+	{
+		printf( "[pass] %s\n", testString );
+		++s_pass;
+	}
+	else
+	{
+		printf( "[fail] %s\n--- expected ---\n%s\n--- found ---\n%s\n", testString, expected.c_str(), found.c_str() );
+		++s_fail;
+	}
+}
+
+static std::string ReadAll( FILE* file )
+{
+	std::string text;
+	rewind( file );
+
+	char buffer[4096];
+	size_t read;
+	while ( ( read = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+	{
+		text.append( buffer, read );
+	}
+	return text;
+}
+
+static std::string PrintDocument( TiXmlDocument& doc )
+{
+	FILE* file = tmpfile();
+	doc.SaveFile( file );
+	std::string text = ReadAll( file );
+	fclose( file );
+	return text;
+}
+
+/**
+A value of the sample project, written by both serializers.
+*/
+struct Value
+{
+	const char* name;
+	std::string text;
+
+	// Text read back, when the parser decodes it
+	const char* read;
+};
+
+struct Object
+{
+	const char* className;
+	std::vector< Value > properties;
+	std::vector< Value > events;
+	std::vector< Object > children;
+};
+
+static Object CreateProject()
+{
+	// Covers the entities, quotes in attributes, control characters,
+	// character references, empty values and non-ASCII UTF-8
+	Value properties[] =
+	{
+		{ "name", "MyProject", NULL },
+		{ "title", "Fish & <Chips> \"now\" isn't", NULL },
+		{ "label", "Gr\xC3\xB6\xC3\x9F" "e \xE2\x82\xAC \xE6\x97\xA5\xE6\x9C\xAC", NULL },
+		{ "tooltip", "line 1\nline 2\ttab", NULL },
+		{ "value", "&#xA9; kept", "\xC2\xA9 kept" },
+		{ "help", "", NULL },
+		{ "choices", "\"a\" \"b&c\"", NULL },
+	};
+
+	Value events[] =
+	{
+		{ "OnButtonClick", "OnOk", NULL },
+		{ "OnChar", "", NULL },
+	};
+
+	Object button;
+	button.className = "wxButton";
+	button.properties.assign( properties + 1, properties + 7 );
+	button.events.assign( events, events + 2 );
+
+	Object sizerItem;
+	sizerItem.className = "sizeritem";
+	sizerItem.properties.push_back( properties[0] );
+	sizerItem.children.push_back( button );
+
+	Object sizer;
+	sizer.className = "wxBoxSizer";
+	sizer.children.push_back( sizerItem );
+	sizer.children.push_back( sizerItem );
+
+	Object form;
+	form.className = "Dialog";
+	form.properties.push_back( properties[2] );
+	form.children.push_back( sizer );
+
+	Object project;
+	project.className = "Project";
+	project.properties.push_back( properties[0] );
+	project.children.push_back( form );
+	return project;
+}
+
+static void WriteObject( XMLWriter* writer, const Object& object )
+{
+	writer->StartElement( "object" );
+	writer->WriteAttribute( "class", object.className );
+	writer->WriteAttribute( "expanded", 1 );
+
+	for ( std::vector< Value >::const_iterator prop = object.properties.begin(); prop != object.properties.end(); ++prop )
+	{
+		writer->WriteTextElement( "property", "name", prop->name, prop->text );
+	}
+	for ( std::vector< Value >::const_iterator event = object.events.begin(); event != object.events.end(); ++event )
+	{
+		writer->WriteTextElement( "event", "name", event->name, event->text );
+	}
+	for ( std::vector< Object >::const_iterator child = object.children.begin(); child != object.children.end(); ++child )
+	{
+		WriteObject( writer, *child );
+	}
+
+	writer->EndElement();
+}
+
+static void AddValue( TiXmlElement* parent, const char* tag, const Value& value )
+{
+	// As ticpp::Element::SetText, which adds the text even if it is empty
+	TiXmlElement element( tag );
+	element.SetAttribute( "name", value.name );
+	element.InsertEndChild( TiXmlText( value.text ) );
+	parent->InsertEndChild( element );
+}
+
+static void AddObject( TiXmlElement* parent, const Object& object )
+{
+	TiXmlElement element( "object" );
+	element.SetAttribute( "class", object.className );
+	element.SetAttribute( "expanded", 1 );
+
+	for ( std::vector< Value >::const_iterator prop = object.properties.begin(); prop != object.properties.end(); ++prop )
+	{
+		AddValue( &element, "property", *prop );
+	}
+	for ( std::vector< Value >::const_iterator event = object.events.begin(); event != object.events.end(); ++event )
+	{
+		AddValue( &element, "event", *event );
+	}
+	for ( std::vector< Object >::const_iterator child = object.children.begin(); child != object.children.end(); ++child )
+	{
+		AddObject( &element, *child );
+	}
+
+	parent->InsertEndChild( element );
+}
+
+static std::string WriteProject( const Object& project )
+{
+	FILE* file = tmpfile();
+	XMLWriter writer( file );
+
+	writer.WriteDeclaration( "1.0", "UTF-8", "yes" );
+	writer.StartElement( "wxFormBuilder_Project" );
+	writer.StartElement( "FileVersion" );
+	writer.WriteAttribute( "major", 1 );
+	writer.WriteAttribute( "minor", 15 );
+	writer.EndElement();
+	WriteObject( &writer, project );
+	writer.EndElement();
+
+	std::string text;
+	if ( writer.Flush() )
+	{
+		text = ReadAll( file );
+	}
+	fclose( file );
+	return text;
+}
+
+static std::string PrintProject( const Object& project )
+{
+	TiXmlDocument doc;
+	doc.InsertEndChild( TiXmlDeclaration( "1.0", "UTF-8", "yes" ) );
+
+	TiXmlElement root( "wxFormBuilder_Project" );
+	TiXmlElement version( "FileVersion" );
+	version.SetAttribute( "major", 1 );
+	version.SetAttribute( "minor", 15 );
+	root.InsertEndChild( version );
+	AddObject( &root, project );
+	doc.InsertEndChild( root );
+
+	return PrintDocument( doc );
+}
+
+static bool CompareValue( TiXmlElement* element, const Value& value )
+{
+	const char* text = element->GetText();
+	return ( value.name == std::string( element->Attribute( "name" ) ) &&
+			std::string( value.read ? value.read : value.text.c_str() ) == std::string( text ? text : "" ) );
+}
+
+/**
+Compares the values read back with the ones written.
+*/
+static bool CompareObject( TiXmlElement* element, const Object& object )
+{
+	if ( !element || std::string( "object" ) != element->Value() || object.className != std::string( element->Attribute( "class" ) ) )
+	{
+		return false;
+	}
+
+	TiXmlElement* child = element->FirstChildElement();
+	for ( std::vector< Value >::const_iterator prop = object.properties.begin(); prop != object.properties.end(); ++prop )
+	{
+		if ( !child || !CompareValue( child, *prop ) )
+		{
+			return false;
+		}
+		child = child->NextSiblingElement();
+	}
+	for ( std::vector< Value >::const_iterator event = object.events.begin(); event != object.events.end(); ++event )
+	{
+		if ( !child || !CompareValue( child, *event ) )
+		{
+			return false;
+		}
+		child = child->NextSiblingElement();
+	}
+	for ( std::vector< Object >::const_iterator sub = object.children.begin(); sub != object.children.end(); ++sub )
+	{
+		if ( !CompareObject( child, *sub ) )
+		{
+			return false;
+		}
+		child = child->NextSiblingElement();
+	}
+
+	return ( NULL == child );
+}
+
+int main()
+{
+	Object project = CreateProject();
+
+	std::string written = WriteProject( project );
+	XmlTest( "XMLWriter output matches TinyXML", PrintProject( project ), written );
+
+	TiXmlDocument doc;
+	doc.Parse( written.c_str(), 0, TIXML_ENCODING_UTF8 );
+	XmlTest( "XMLWriter output is parsed", "", doc.Error() ? doc.ErrorDesc() : "" );
+
+	TiXmlElement* root = doc.RootElement();
+	TiXmlElement* object = ( root ? root->FirstChildElement( "object" ) : NULL );
+	XmlTest( "Values are read back unchanged", "true", CompareObject( object, project ) ? "true" : "false" );
+
+	// An element without children is closed in the same tag
+	FILE* file = tmpfile();
+	XMLWriter writer( file );
+	writer.StartElement( "empty" );
+	writer.EndElement();
+	writer.Flush();
+	XmlTest( "Empty element", "<empty />\n", ReadAll( file ) );
+	fclose( file );
+
+	printf( "\nPass %d, Fail %d\n", s_pass, s_fail );
+	return s_fail;
+}
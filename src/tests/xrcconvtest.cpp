@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Converts sizer items to XRC and back through the components of the layout
+// plugin, which is linked into the test as it is into its library. Returns
+// the number of failed tests.
+
+#include <component.h>
+#include <xrcconv.h>
+#include <ticpp.h>
+#include <wx/init.h>
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+static int s_pass = 0;
+static int s_fail = 0;
+
+static void XrcTest( const char* testString, const std::string& expected, const std::string& found )
+{
+	if ( expected == found )
+	{
+		printf( "[pass] %s\n", testString );
+		++s_pass;
+	}
+	else
+	{
+		printf( "[fail] %s\n--- expected ---\n%s\n--- found ---\n%s\n", testString, expected.c_str(), found.c_str() );
+		++s_fail;
+	}
+}
+
+// Names of the properties, by the id of their handle
+static std::vector< wxString > s_handleNames;
+
+/**
+Manager of the plugin, which only gives the handles of the properties.
+*/
+class TestManager : public IManager
+{
+public:
+	size_t GetChildCount( wxObject* ) { return 0; }
+	wxObject* GetChild( wxObject*, size_t ) { return NULL; }
+	wxObject* GetParent( wxObject* ) { return NULL; }
+	IObject* GetIParent( wxObject* ) { return NULL; }
+	IObject* GetIObject( wxObject* ) { return NULL; }
+	void ModifyProperty( wxObject*, wxString, wxString, bool ) {}
+	wxNoObject* NewNoObject() { return NULL; }
+	bool SelectObject( wxObject* ) { return false; }
+
+	PropertyHandle GetPropertyHandle( const wxString& name )
+	{
+		for ( size_t i = 0; i < s_handleNames.size(); i++ )
+		{
+			if ( s_handleNames[i] == name )
+			{
+				return PropertyHandle( (int)i );
+			}
+		}
+		s_handleNames.push_back( name );
+		return PropertyHandle( (int)s_handleNames.size() - 1 );
+	}
+};
+
+/**
+Object of a project, with the values of its properties as text.
+*/
+class TestObject : public IObject
+{
+private:
+	wxString m_class;
+	std::map< wxString, wxString > m_values;
+
+	static wxString GetName( const PropertyHandle& handle )
+	{
+		return ( handle.IsOk() && handle.GetId() < (int)s_handleNames.size() ? s_handleNames[ handle.GetId() ] : wxString() );
+	}
+
+public:
+	TestObject( const wxString& classname )
+	:
+	m_class( classname )
+	{
+	}
+
+	void SetValue( const wxString& name, const wxString& value )
+	{
+		m_values[ name ] = value;
+	}
+
+	bool IsNull( const wxString& pname )
+	{
+		std::map< wxString, wxString >::iterator value = m_values.find( pname );
+		return ( value == m_values.end() || value->second.empty() );
+	}
+
+	int GetPropertyAsInteger( const wxString& pname )
+	{
+		long value = 0;
+		GetPropertyAsString( pname ).ToLong( &value );
+		return (int)value;
+	}
+
+	wxFontContainer GetPropertyAsFont( const wxString& ) { return wxFontContainer(); }
+	wxColour GetPropertyAsColour( const wxString& ) { return wxColour(); }
+
+	wxString GetPropertyAsString( const wxString& pname )
+	{
+		std::map< wxString, wxString >::iterator value = m_values.find( pname );
+		return ( value == m_values.end() ? wxString() : value->second );
+	}
+
+	wxPoint GetPropertyAsPoint( const wxString& ) { return wxDefaultPosition; }
+	wxSize GetPropertyAsSize( const wxString& ) { return wxDefaultSize; }
+	wxBitmap GetPropertyAsBitmap( const wxString& ) { return wxNullBitmap; }
+	wxArrayInt GetPropertyAsArrayInt( const wxString& ) { return wxArrayInt(); }
+	wxArrayString GetPropertyAsArrayString( const wxString& ) { return wxArrayString(); }
+
+	double GetPropertyAsFloat( const wxString& pname )
+	{
+		double value = 0;
+		GetPropertyAsString( pname ).ToDouble( &value );
+		return value;
+	}
+
+	wxString GetChildFromParentProperty( const wxString&, const wxString& ) { return wxEmptyString; }
+	wxString GetClassName() { return m_class; }
+	unsigned int GetChildCount() { return 0; }
+	wxString GetObjectTypeName() { return m_class; }
+	IObject* GetChildPtr( unsigned int ) { return NULL; }
+
+	bool IsNullByHandle( const PropertyHandle& handle ) { return IsNull( GetName( handle ) ); }
+	int GetPropertyAsIntegerByHandle( const PropertyHandle& handle ) { return GetPropertyAsInteger( GetName( handle ) ); }
+	wxFontContainer GetPropertyAsFontByHandle( const PropertyHandle& handle ) { return GetPropertyAsFont( GetName( handle ) ); }
+	wxColour GetPropertyAsColourByHandle( const PropertyHandle& handle ) { return GetPropertyAsColour( GetName( handle ) ); }
+	wxString GetPropertyAsStringByHandle( const PropertyHandle& handle ) { return GetPropertyAsString( GetName( handle ) ); }
+	wxPoint GetPropertyAsPointByHandle( const PropertyHandle& handle ) { return GetPropertyAsPoint( GetName( handle ) ); }
+	wxSize GetPropertyAsSizeByHandle( const PropertyHandle& handle ) { return GetPropertyAsSize( GetName( handle ) ); }
+	wxBitmap GetPropertyAsBitmapByHandle( const PropertyHandle& handle ) { return GetPropertyAsBitmap( GetName( handle ) ); }
+	wxArrayInt GetPropertyAsArrayIntByHandle( const PropertyHandle& handle ) { return GetPropertyAsArrayInt( GetName( handle ) ); }
+	wxArrayString GetPropertyAsArrayStringByHandle( const PropertyHandle& handle ) { return GetPropertyAsArrayString( GetName( handle ) ); }
+	double GetPropertyAsFloatByHandle( const PropertyHandle& handle ) { return GetPropertyAsFloat( GetName( handle ) ); }
+};
+
+static IComponent* FindComponent( IComponentLibrary* lib, const wxString& name )
+{
+	for ( unsigned int i = 0; i < lib->GetComponentCount(); i++ )
+	{
+		if ( lib->GetComponentName( i ) == name )
+		{
+			return lib->GetComponent( i );
+		}
+	}
+	return NULL;
+}
+
+/**
+Text of a property of an XRC object.
+*/
+static std::string GetXrcValue( ticpp::Element* xrcObj, const char* name )
+{
+	ticpp::Element* property = ( xrcObj ? xrcObj->FirstChildElement( name, false ) : NULL );
+	return ( property ? property->GetText( false ) : "<missing>" );
+}
+
+/**
+Text of a property of an object of a project.
+*/
+static std::string GetXfbValue( ticpp::Element* xfbObj, const char* name )
+{
+	ticpp::Element* property = ( xfbObj ? xfbObj->FirstChildElement( "property", false ) : NULL );
+	for ( ; property; property = property->NextSiblingElement( "property", false ) )
+	{
+		if ( property->GetAttribute( "name" ) == name )
+		{
+			return property->GetText( false );
+		}
+	}
+	return "<missing>";
+}
+
+int main()
+{
+	wxInitializer initializer;
+
+	TestManager manager;
+	IComponentLibrary* lib = GetComponentLibrary( &manager );
+
+	IComponent* component = FindComponent( lib, wxT("sizeritem") );
+	IXrcBatchComponent* batch = dynamic_cast< IXrcBatchComponent* >( component );
+	if ( !batch )
+	{
+		XrcTest( "The sizeritem component converts batches", "true", "false" );
+		FreeComponentLibrary( lib );
+		return s_fail;
+	}
+
+	// The synonyms create the library again without a manager
+	ticpp::Document doc;
+	doc.Parse( "<object class=\"sizeritem\"><option>2</option><flag>wxGROW|wxALL</flag><border>4</border></object>" );
+	ticpp::Element* xrcObj = doc.FirstChildElement( "object" );
+	ticpp::Element* xfbObj = component->ImportFromXrc( xrcObj );
+	XrcTest( "Import the proportion", "2", GetXfbValue( xfbObj, "proportion" ) );
+	XrcTest( "Import the flag with synonyms", "wxEXPAND|wxALL", GetXfbValue( xfbObj, "flag" ) );
+	XrcTest( "Import the border", "4", GetXfbValue( xfbObj, "border" ) );
+	delete xfbObj;
+
+	// The handles are still those of the manager
+	TestObject first( wxT("sizeritem") );
+	first.SetValue( wxT("proportion"), wxT("1") );
+	first.SetValue( wxT("flag"), wxT("wxALL|wxEXPAND") );
+	first.SetValue( wxT("border"), wxT("5") );
+
+	TestObject second( wxT("sizeritem") );
+	second.SetValue( wxT("proportion"), wxT("0") );
+	second.SetValue( wxT("flag"), wxT("wxALIGN_CENTER_VERTICAL") );
+	second.SetValue( wxT("border"), wxT("0") );
+
+	IObject* objects[] = { &first, &second };
+	ticpp::Element* elements[2];
+	batch->ExportBatchToXrc( objects, 2, elements );
+	XrcTest( "Export the proportion", "1", GetXrcValue( elements[0], "option" ) );
+	XrcTest( "Export the flag", "wxALL|wxEXPAND", GetXrcValue( elements[0], "flag" ) );
+	XrcTest( "Export the border", "5", GetXrcValue( elements[0], "border" ) );
+	XrcTest( "Export the second object", "wxALIGN_CENTER_VERTICAL", GetXrcValue( elements[1], "flag" ) );
+
+	// And back
+	ticpp::Element* imported[2];
+	batch->ImportBatchFromXrc( elements, 2, imported );
+	XrcTest( "Round trip of the proportion", "1", GetXfbValue( imported[0], "proportion" ) );
+	XrcTest( "Round trip of the flag", "wxALL|wxEXPAND", GetXfbValue( imported[0], "flag" ) );
+	XrcTest( "Round trip of the border", "5", GetXfbValue( imported[0], "border" ) );
+	XrcTest( "Round trip of the second object", "wxALIGN_CENTER_VERTICAL", GetXfbValue( imported[1], "flag" ) );
+
+	for ( size_t i = 0; i < 2; i++ )
+	{
+		delete elements[i];
+		delete imported[i];
+	}
+	FreeComponentLibrary( lib );
+
+	printf( "\nPass %d, Fail %d\n", s_pass, s_fail );
+	return s_fail;
+}
@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "mappedfile.h"
+
+#include <wx/ffile.h>
+#include <cstring>
+
+#ifdef __UNIX__
+	#include <sys/types.h>
+	#include <sys/stat.h>
+	#include <sys/mman.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+:
+m_data( NULL ),
+m_length( 0 ),
+m_map( NULL ),
+m_mapLength( 0 ),
+m_terminated( false ),
+m_text( NULL )
+{
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+void MappedFile::Close()
+{
+#ifdef __UNIX__
+	if ( m_map != NULL )
+	{
+		munmap( m_map, m_mapLength );
+	}
+#endif
+
+	m_map = NULL;
+	m_mapLength = 0;
+	m_terminated = false;
+	m_data = NULL;
+	m_length = 0;
+	m_text = NULL;
+	m_buffer.clear();
+}
+
+bool MappedFile::Map( const wxString& path )
+{
+	Close();
+
+#ifdef __UNIX__
+	int fd = open( path.fn_str(), O_RDONLY );
+	if ( -1 == fd )
+	{
+		return false;
+	}
+
+	struct stat info;
+	if ( fstat( fd, &info ) != 0 || !S_ISREG( info.st_mode ) || 0 == info.st_size )
+	{
+		// Empty files can't be mapped
+		close( fd );
+		return false;
+	}
+
+	size_t length = (size_t)info.st_size;
+	void* map = mmap( NULL, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+	// The mapping keeps its own reference to the file
+	close( fd );
+
+	if ( MAP_FAILED == map )
+	{
+		return false;
+	}
+
+	madvise( map, length, MADV_SEQUENTIAL );
+
+	m_map = map;
+	m_mapLength = length;
+	m_data = static_cast< const char* >( map );
+	m_length = length;
+
+	// The rest of the last page is filled with zeros, so the contents are
+	// already null terminated unless the file fills the page completely
+	long pageSize = sysconf( _SC_PAGESIZE );
+	m_terminated = ( pageSize > 0 && length % (size_t)pageSize != 0 );
+
+	return true;
+#else
+	wxUnusedVar( path );
+	return false;
+#endif
+}
+
+bool MappedFile::Load( const wxString& path )
+{
+	if ( Map( path ) )
+	{
+		return true;
+	}
+
+	wxFFile file( path, wxT("rb") );
+	if ( !file.IsOpened() )
+	{
+		return false;
+	}
+
+	wxFileOffset length = file.Length();
+	if ( length < 0 )
+	{
+		return false;
+	}
+
+	m_buffer.resize( (size_t)length );
+	if ( length > 0 && file.Read( &m_buffer[0], m_buffer.size() ) != m_buffer.size() )
+	{
+		m_buffer.clear();
+		return false;
+	}
+
+	m_data = m_buffer.c_str();
+	m_length = m_buffer.size();
+	return true;
+}
+
+const char* MappedFile::GetText()
+{
+	if ( m_text != NULL )
+	{
+		return m_text;
+	}
+
+	bool hasCR = ( m_length > 0 && memchr( m_data, '\r', m_length ) != NULL );
+
+	if ( IsMapped() )
+	{
+		if ( !hasCR && m_terminated )
+		{
+			m_text = m_data;
+			return m_text;
+		}
+
+		// The mapping is read only, the conversion needs a copy
+		m_buffer.assign( m_data, m_length );
+	}
+
+	if ( hasCR )
+	{
+		// Same conversion TiXmlDocument::LoadFile does, in place
+		std::string::size_type write = 0;
+		const std::string::size_type length = m_buffer.size();
+		for ( std::string::size_type read = 0; read < length; ++read )
+		{
+			char c = m_buffer[ read ];
+			if ( '\r' == c )
+			{
+				c = '\n';
+				if ( read + 1 < length && '\n' == m_buffer[ read + 1 ] )
+				{
+					++read;
+				}
+			}
+			m_buffer[ write++ ] = c;
+		}
+		m_buffer.resize( write );
+	}
+
+	m_text = m_buffer.c_str();
+	return m_text;
+}
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __MAPPED_FILE__
+#define __MAPPED_FILE__
+
+#include <wx/string.h>
+#include <string>
+
+/**
+Read only view of the contents of a file.
+
+On Unix the file is mapped into memory, so its contents are not copied
+until someone needs to modify them. On other platforms, or if the file can
+not be mapped, the file is read into a buffer in a single call.
+*/
+class MappedFile
+{
+private:
+	const char* m_data;
+	size_t m_length;
+
+	void* m_map;
+	size_t m_mapLength;
+	bool m_terminated;
+
+	std::string m_buffer;
+	const char* m_text;
+
+	// Don't copy
+	MappedFile( const MappedFile& );
+	MappedFile& operator=( const MappedFile& );
+
+public:
+	MappedFile();
+	~MappedFile();
+
+	/**
+	Maps the file into memory, only supported on Unix.
+	@return false if the file could not be mapped.
+	*/
+	bool Map( const wxString& path );
+
+	/**
+	Maps the file into memory or, if that is not possible, reads it.
+	@return false if the file could not be opened.
+	*/
+	bool Load( const wxString& path );
+
+	/**
+	Releases the contents of the file, which must be done before writing it.
+	*/
+	void Close();
+
+	bool IsMapped() const { return m_map != NULL; }
+
+	const char* GetData() const { return m_data; }
+	size_t GetLength() const { return m_length; }
+
+	/**
+	Gets the contents of the file as a null terminated string, with "\r\n"
+	and "\r" converted to "\n" like TinyXML does when it reads a file.
+	The mapped memory is returned as it is when there is nothing to convert
+	and the end of the mapping is already zero filled.
+	*/
+	const char* GetText();
+};
+
+#endif //__MAPPED_FILE__
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "startupprofile.h"
+#include "stringutils.h"
+#include "typeconv.h"
+
+#include <wx/stopwatch.h>
+#include <wx/thread.h>
+#include <wx/ffile.h>
+#include <sstream>
+#include <vector>
+#include <cstdio>
+
+/**
+A phase of the startup, and the phases started while it was running.
+*/
+struct StartupPhase
+{
+	const char* name;
+	std::string detail;
+
+	// Microseconds since StartupProfile::Enable
+	wxLongLong start;
+	wxLongLong end;
+
+	std::vector< size_t > children;
+};
+
+static bool s_enabled = false;
+static wxString s_path;
+static wxStopWatch s_clock;
+
+// The first phase is the whole startup, it is never closed by a timer
+static std::vector< StartupPhase > s_phases;
+static std::vector< size_t > s_running;
+
+static wxLongLong Now()
+{
+#if wxVERSION_NUMBER >= 2903
+	return s_clock.TimeInMicro();
+#else
+	return wxLongLong( s_clock.Time() ) * 1000;
+#endif
+}
+
+static std::string Milliseconds( const wxLongLong& micro )
+{
+	char text[32];
+	sprintf( text, "%.3f", micro.ToDouble() / 1000.0 );
+	return text;
+}
+
+static void WritePhase( std::ostringstream& json, size_t index, const std::string& indent )
+{
+	const StartupPhase& phase = s_phases[index];
+	json << indent << "{ \"phase\": " << StringUtils::JsonString( phase.name );
+	if ( !phase.detail.empty() )
+	{
+		json << ", \"detail\": " << StringUtils::JsonString( phase.detail );
+	}
+	json << ", \"start_ms\": " << Milliseconds( phase.start );
+	json << ", \"duration_ms\": " << Milliseconds( phase.end - phase.start );
+	json << ", \"children\": [";
+
+	for ( std::vector< size_t >::const_iterator child = phase.children.begin(); child != phase.children.end(); ++child )
+	{
+		json << ( child == phase.children.begin() ? "\n" : ",\n" );
+		WritePhase( json, *child, indent + "\t" );
+	}
+
+	json << ( phase.children.empty() ? "] }" : "\n" + indent + "] }" );
+}
+
+StartupProfile::Timer::Timer( const char* phase, const wxString& detail )
+:
+m_running( s_enabled && wxThread::IsMain() )
+{
+	if ( !m_running )
+	{
+		return;
+	}
+
+	size_t index = s_phases.size();
+	s_phases[ s_running.back() ].children.push_back( index );
+
+	s_phases.push_back( StartupPhase() );
+	StartupPhase& added = s_phases.back();
+	added.name = phase;
+	added.detail = _STDSTR( detail );
+	added.start = Now();
+	s_running.push_back( index );
+}
+
+StartupProfile::Timer::~Timer()
+{
+	// Timers still running when the profile is finished are closed by Finish
+	if ( m_running && s_enabled )
+	{
+		s_phases[ s_running.back() ].end = Now();
+		s_running.pop_back();
+	}
+}
+
+void StartupProfile::Enable( const wxString& path )
+{
+	s_path = path;
+	s_phases.clear();
+	s_running.clear();
+
+	s_phases.push_back( StartupPhase() );
+	s_phases.back().name = "startup";
+	s_running.push_back( 0 );
+
+	s_clock.Start();
+	s_phases.back().start = Now();
+	s_enabled = true;
+}
+
+bool StartupProfile::IsEnabled()
+{
+	return s_enabled;
+}
+
+bool StartupProfile::Finish()
+{
+	if ( !s_enabled )
+	{
+		return true;
+	}
+	s_enabled = false;
+
+	wxLongLong end = Now();
+	for ( std::vector< size_t >::iterator running = s_running.begin(); running != s_running.end(); ++running )
+	{
+		s_phases[ *running ].end = end;
+	}
+
+	std::ostringstream json;
+	json << "{\n\t\"total_ms\": " << Milliseconds( end ) << ",\n\t\"phases\":\n";
+	WritePhase( json, 0, "\t" );
+	json << "\n}\n";
+
+	s_phases.clear();
+	s_running.clear();
+
+	wxFFile output( s_path, wxT("wb") );
+	if ( !output.IsOpened() )
+	{
+		return false;
+	}
+
+	std::string text = json.str();
+	bool written = ( output.Write( text.data(), text.size() ) == text.size() );
+	return output.Close() && written;
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __STARTUP_PROFILE__
+#define __STARTUP_PROFILE__
+
+#include <wx/string.h>
+
+/**
+Times the phases of the startup, for the --startup-profile option.
+
+Each phase is timed by a Timer object, the phases started while another one
+is running are its children. Nothing is recorded until Enable is called, and
+only in the main thread, so the timers can be left in code which also runs
+later or in other threads.
+*/
+class StartupProfile
+{
+public:
+	/**
+	Times the scope it is declared in.
+	*/
+	class Timer
+	{
+	private:
+		bool m_running;
+
+		Timer( const Timer& );
+		Timer& operator=( const Timer& );
+
+	public:
+		/**
+		@param phase Name of the phase, usually the function timed.
+		@param detail What the phase works on, such as the file loaded.
+		*/
+		Timer( const char* phase, const wxString& detail = wxEmptyString );
+		~Timer();
+	};
+
+	/**
+	Starts recording, the times of the report are relative to this call.
+	@param path File where Finish writes the report.
+	*/
+	static void Enable( const wxString& path );
+
+	static bool IsEnabled();
+
+	/**
+	Stops recording and writes the report, if it was enabled. Only the first
+	call does something.
+	@return false if the report could not be written.
+	*/
+	static bool Finish();
+};
+
+#endif //__STARTUP_PROFILE__
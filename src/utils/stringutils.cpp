@@ -26,8 +26,12 @@
 #include "stringutils.h"
 #include "typeconv.h"
 #include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
 #include <ticpp.h>
 #include "wxfbexception.h"
+#include "mappedfile.h"
 
 #include <wx/ffile.h>
 #include <wx/fontmap.h>
@@ -45,6 +49,57 @@ wxString StringUtils::IntToStr(int num)
   return result;
 }
 
+wxUint64 StringUtils::Hash( const void* data, size_t length, wxUint64 hash )
+{
+	const unsigned char* bytes = static_cast< const unsigned char* >( data );
+	for ( size_t i = 0; i < length; ++i )
+	{
+		hash ^= bytes[i];
+		hash *= wxULL(1099511628211);
+	}
+	return hash;
+}
+
+std::string StringUtils::JsonString( const std::string& value )
+{
+	std::string json( 1, '"' );
+	for ( std::string::const_iterator c = value.begin(); c != value.end(); ++c )
+	{
+		switch ( *c )
+		{
+			case '"':
+				json += "\\\"";
+				break;
+			case '\\':
+				json += "\\\\";
+				break;
+			case '\n':
+				json += "\\n";
+				break;
+			case '\r':
+				json += "\\r";
+				break;
+			case '\t':
+				json += "\\t";
+				break;
+			default:
+				if ( (unsigned char)*c < 0x20 )
+				{
+					char escaped[7];
+					sprintf( escaped, "\\u%04x", (unsigned int)(unsigned char)*c );
+					json += escaped;
+				}
+				else
+				{
+					json += *c;
+				}
+				break;
+		}
+	}
+	json += '"';
+	return json;
+}
+
 wxString StringUtils::GetSupportedEncodings( bool columnateWithTab, wxArrayString* array )
 {
 	wxString result = wxEmptyString;
@@ -220,9 +275,18 @@ void XMLUtils::LoadXMLFile( ticpp::Document& doc, bool condenseWhiteSpace, const
 		{
 			THROW_WXFBEX( _("The file does not exist.\nFile: ") << path )
 		}
+		MappedFile file;
+		if ( !file.Load( path ) )
+		{
+			THROW_WXFBEX( _("Unable to open file: ") << path )
+		}
+
+		// Parse straight from the mapped file, instead of letting TinyXML read it
 		TiXmlBase::SetCondenseWhiteSpace( condenseWhiteSpace );
+		doc.Clear();
 		doc.SetValue( std::string( path.mb_str( wxConvFile ) ) );
-		doc.LoadFile();
+		doc.UseArena();
+		doc.Parse( file.GetText() );
 	}
 	catch ( ticpp::Exception& )
 	{
@@ -276,9 +340,19 @@ void XMLUtils::LoadXMLFile( TiXmlDocument& doc, bool condenseWhiteSpace, const w
 		THROW_WXFBEX( _("The file does not exist.\nFile: ") << path )
 	}
 
+	MappedFile file;
+	if ( !file.Load( path ) )
+	{
+		THROW_WXFBEX( _("Unable to open file: ") << path )
+	}
+
+	// Parse straight from the mapped file, instead of letting TinyXML read it
 	TiXmlBase::SetCondenseWhiteSpace( condenseWhiteSpace );
+	doc.Clear();
 	doc.SetValue( std::string( path.mb_str( wxConvFile ) ) );
-	if ( !doc.LoadFile() )
+	doc.UseArena();
+	doc.Parse( file.GetText() );
+	if ( doc.Error() )
 	{
 		// Ask user to all wxFB to convert the file to UTF-8 and add the XML declaration
 		wxString msg = _("This xml file could not be loaded. This could be the result of an unsupported encoding.\n");
@@ -314,6 +388,33 @@ void XMLUtils::LoadXMLFile( TiXmlDocument& doc, bool condenseWhiteSpace, const w
 	LoadXMLFileImp( doc, condenseWhiteSpace, path, declaration );
 }
 
+bool XMLUtils::TryLoadXMLFile( ticpp::Document& doc, const wxString& path )
+{
+	MappedFile file;
+	if ( path.empty() || !file.Load( path ) )
+	{
+		return false;
+	}
+
+	try
+	{
+		doc.Clear();
+		doc.SetValue( std::string( path.mb_str( wxConvFile ) ) );
+		doc.UseArena();
+		doc.Parse( file.GetText() );
+
+		ticpp::Declaration* declaration = doc.FirstChild()->ToDeclaration();
+
+		// wxFontMapper is not used, it is not thread safe
+		std::string encoding = declaration->Encoding();
+		std::transform( encoding.begin(), encoding.end(), encoding.begin(), ::tolower );
+		return ( "utf-8" == encoding || "utf8" == encoding );
+	}
+	catch ( ticpp::Exception& )
+	{
+		return false;
+	}
+}
 
 void XMLUtils::ConvertAndAddDeclaration( const wxString& path, wxFontEncoding encoding, bool backup )
 {
@@ -24,6 +24,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <wx/string.h>
+#include <string>
 
 namespace ticpp
 {
@@ -37,6 +38,16 @@ namespace StringUtils
 {
   wxString IntToStr(int num);
 
+  /**
+  64 bit FNV-1a hash, pass the previous result as @a hash to continue hashing.
+  */
+  wxUint64 Hash( const void* data, size_t length, wxUint64 hash = wxULL(14695981039346656037) );
+
+  /**
+  Quoted JSON string of the UTF-8 @a value, for the reports written from the command line.
+  */
+  std::string JsonString( const std::string& value );
+
   wxString GetSupportedEncodings( bool columnateWithTab = true, wxArrayString* array = NULL );
   wxFontEncoding GetEncodingFromUser( const wxString& message );
 };
@@ -49,6 +60,11 @@ namespace XMLUtils
 	void LoadXMLFile( ticpp::Document& doc, bool condenseWhiteSpace, const wxString& path = wxEmptyString );
 	void LoadXMLFile( TiXmlDocument& doc, bool condenseWhiteSpace, const wxString& path = wxEmptyString );
 
+	// Loads a valid UTF-8 file with its declaration, without asking anything, so it can be
+	// used from other threads. TiXmlBase::SetCondenseWhiteSpace must have been called before.
+	// Returns false for the files LoadXMLFile would ask about.
+	bool TryLoadXMLFile( ticpp::Document& doc, const wxString& path );
+
 	// Converts to UTF-8 and prepends declaration
 	void ConvertAndAddDeclaration( const wxString& path, wxFontEncoding encoding = wxFONTENCODING_SYSTEM, bool backup = true );
 	void ConvertAndChangeDeclaration( const wxString& path, const wxString& version, const wxString& standalone, wxFontEncoding encoding = wxFONTENCODING_SYSTEM, bool backup = true );
@@ -138,14 +138,39 @@ wxString TypeConv::_StringToWxString(const std::string &str)
     return _StringToWxString(str.c_str());
 }
 
+#ifdef __WXFB_DEBUG__
+static unsigned long s_toWxStringCount = 0;
+static unsigned long s_toStringCount = 0;
+
+TypeConv::ConversionCounter::ConversionCounter( const wxString& operation )
+:
+m_operation( operation ),
+m_toWxString( s_toWxStringCount ),
+m_toString( s_toStringCount )
+{
+}
+
+TypeConv::ConversionCounter::~ConversionCounter()
+{
+	LogDebug( wxT("%s: %lu conversions to wxString, %lu to UTF-8"), m_operation.c_str(),
+				s_toWxStringCount - m_toWxString, s_toStringCount - m_toString );
+}
+#endif
+
 wxString TypeConv::_StringToWxString(const char *str)
 {
+#ifdef __WXFB_DEBUG__
+    ++s_toWxStringCount;
+#endif
     wxString newstr( str, wxConvUTF8 );
     return newstr;
 }
 
 std::string TypeConv::_WxStringToString(const wxString &str)
 {
+#ifdef __WXFB_DEBUG__
+    ++s_toStringCount;
+#endif
     std::string newstr( str.mb_str(wxConvUTF8) );
     return newstr;
 }
@@ -225,16 +250,31 @@ wxSize TypeConv::StringToSize (const wxString &val)
 
 int TypeConv::BitlistToInt (const wxString &str)
 {
+    // This is called for every bitlist property each time the designer is
+    // refreshed, so scan the string in place instead of using a tokenizer
+    PMacroDictionary dic = MacroDictionary::GetInstance();
+
     int result = 0;
-    wxStringTokenizer tkz(str, wxT("|"));
-    while (tkz.HasMoreTokens())
+    size_t start = 0;
+    const size_t length = str.length();
+    while (start < length)
     {
-        wxString token;
-        token = tkz.GetNextToken();
-        token.Trim(true);
-        token.Trim(false);
-
-        result |= GetMacroValue(token);
+        size_t end = str.find(wxT('|'), start);
+        if (wxString::npos == end)
+            end = length;
+
+        size_t first = start;
+        size_t last = end;
+        while (first < last && wxIsspace(str[first]))
+            ++first;
+        while (last > first && wxIsspace(str[last - 1]))
+            --last;
+
+        int value = 0;
+        if (last > first && dic->SearchMacro(str.substr(first, last - first), &value))
+            result |= value;
+
+        start = end + 1;
     }
 
     return result;
@@ -1013,10 +1053,24 @@ void MacroDictionary::Destroy()
     s_instance = 0;
 }
 
-bool MacroDictionary::SearchMacro(wxString name, int *result)
+void MacroDictionary::RemoveLoader( Loader* loader )
+{
+    if ( s_instance != 0 && s_instance->m_loader == loader )
+    {
+        s_instance->m_loader = NULL;
+    }
+}
+
+bool MacroDictionary::SearchMacro(const wxString& name, int *result)
 {
     bool found = false;
-    MacroMap::iterator it = m_map.find(name);
+    MacroValueMap::iterator it = m_map.find(name);
+
+    // The macro may be in a library which is not loaded yet, only the
+    // library which declares it is loaded
+    if (it == m_map.end() && m_loader != NULL && m_loader->LoadMacro(name))
+        it = m_map.find(name);
+
     if (it != m_map.end())
     {
         found = true;
@@ -1026,10 +1080,10 @@ bool MacroDictionary::SearchMacro(wxString name, int *result)
     return found;
 }
 
-bool MacroDictionary::SearchSynonymous(wxString synName, wxString& result)
+bool MacroDictionary::SearchSynonymous(const wxString& synName, wxString& result)
 {
     bool found = false;
-    SynMap::iterator it = m_synMap.find(synName);
+    MacroSynonymousMap::iterator it = m_synMap.find(synName);
     if (it != m_synMap.end())
     {
         found = true;
@@ -1042,17 +1096,72 @@ bool MacroDictionary::SearchSynonymous(wxString synName, wxString& result)
 #define MACRO(x) m_map.insert(MacroMap::value_type(#x,x))
 #define MACRO2(x,y) m_map.insert(MacroMap::value_type(#x,y))*/
 
-void MacroDictionary::AddMacro(wxString name, int value)
+bool MacroDictionary::SearchMacroNames(int value, wxArrayString* names)
+{
+    MacroNameMap::iterator it = m_names.find(value);
+    if (it == m_names.end())
+        return false;
+
+    if (names)
+        *names = it->second;
+
+    return true;
+}
+
+void MacroDictionary::AddMacro(const wxString& name, int value)
 {
-    m_map.insert(MacroMap::value_type(name,value));
+    // keep the first registered value, like the old std::map::insert did
+    if (m_map.find(name) != m_map.end())
+        return;
+
+    m_map[name] = value;
+    m_names[value].Add(name);
+}
+
+void MacroDictionary::SetMacro(const wxString& name, int value)
+{
+    MacroValueMap::iterator it = m_map.find(name);
+    if (it == m_map.end())
+    {
+        AddMacro(name, value);
+        return;
+    }
+
+    if (it->second == value)
+        return;
+
+    // the name moves to its new value in the reverse map
+    MacroNameMap::iterator names = m_names.find(it->second);
+    if (names != m_names.end())
+    {
+        names->second.Remove(name);
+        if (names->second.IsEmpty())
+            m_names.erase(names);
+    }
+
+    it->second = value;
+    m_names[value].Add(name);
+}
+
+void MacroDictionary::AddMacros(const wxArrayString& names, const wxArrayInt& values)
+{
+    wxASSERT(names.GetCount() == values.GetCount());
+
+    for (size_t i = 0; i < names.GetCount(); i++)
+    {
+        AddMacro(names[i], values[i]);
+    }
 }
 
-void MacroDictionary::AddSynonymous(wxString synName, wxString name)
+void MacroDictionary::AddSynonymous(const wxString& synName, const wxString& name)
 {
-    m_synMap.insert(SynMap::value_type(synName, name));
+    if (m_synMap.find(synName) == m_synMap.end())
+        m_synMap[synName] = name;
 }
 
 MacroDictionary::MacroDictionary()
+:
+m_loader( NULL )
 {
     // Las macros serán incluidas en las bibliotecas de componentes...
     // Sizers macros
@@ -28,6 +28,7 @@
 
 #include "wx/wx.h"
 #include <wx/string.h>
+#include <wx/hashmap.h>
 #include <vector>
 #include <map>
 #include "model/types.h"
@@ -38,6 +39,13 @@
 #define _STDSTR(x) TypeConv::_WxStringToString(x)
 #define _ANSISTR(x) TypeConv::_WxStringToAnsiString(x)
 
+// Logs the conversions made by _WXSTR and _STDSTR until the end of the scope, in debug builds
+#ifdef __WXFB_DEBUG__
+#define COUNT_CONVERSIONS(operation) TypeConv::ConversionCounter conversionCounter( operation );
+#else
+#define COUNT_CONVERSIONS(operation)
+#endif
+
 namespace TypeConv
 {
 	wxString _StringToWxString( const std::string &str );
@@ -45,6 +53,25 @@ namespace TypeConv
 	std::string _WxStringToString( const wxString &str );
 	std::string _WxStringToAnsiString( const wxString & str );
 
+#ifdef __WXFB_DEBUG__
+	/**
+	Counts the conversions between UTF-8 and wxString made while it exists,
+	and logs them when it is destroyed. The counts are not exact if other
+	threads convert strings at the same time.
+	*/
+	class ConversionCounter
+	{
+	private:
+		wxString m_operation;
+		unsigned long m_toWxString;
+		unsigned long m_toString;
+
+	public:
+		ConversionCounter( const wxString& operation );
+		~ConversionCounter();
+	};
+#endif
+
 	wxPoint StringToPoint( const wxString &str );
 	bool    StringToPoint( const wxString &str, wxPoint *point );
 	wxSize  StringToSize( const wxString &str );
@@ -112,26 +139,80 @@ namespace TypeConv
 class MacroDictionary;
 typedef MacroDictionary* PMacroDictionary;
 
+WX_DECLARE_STRING_HASH_MAP( int, MacroValueMap );
+WX_DECLARE_STRING_HASH_MAP( wxString, MacroSynonymousMap );
+WX_DECLARE_HASH_MAP( int, wxArrayString, wxIntegerHash, wxIntegerEqual, MacroNameMap );
+
 class MacroDictionary
 {
+public:
+	/**
+	Registers more macros when a macro is not found, see SetLoader.
+	*/
+	class Loader
+	{
+	public:
+		virtual ~Loader() {}
+
+		/**
+		Registers the macros of the library which declares @a name, if it
+		was not loaded. Other libraries are never tried.
+		@return false if no library was loaded.
+		*/
+		virtual bool LoadMacro( const wxString& name ) = 0;
+	};
+
 private:
-	typedef std::map<wxString, int> MacroMap;
 	static PMacroDictionary s_instance;
 
-	typedef std::map<wxString, wxString> SynMap;
+	Loader* m_loader;
+
+	MacroValueMap m_map;
+	MacroSynonymousMap m_synMap;
 
-	MacroMap m_map;
-	SynMap m_synMap;
+	// Reverse map, value -> names registered with that value
+	MacroNameMap m_names;
 
 	MacroDictionary();
 
 public:
 	static PMacroDictionary GetInstance();
 	static void Destroy();
-	bool SearchMacro( wxString name, int *result );
-	void AddMacro( wxString name, int value );
-	void AddSynonymous( wxString synName, wxString name );
-	bool SearchSynonymous( wxString synName, wxString& result );
+	bool SearchMacro( const wxString& name, int *result );
+	void AddMacro( const wxString& name, int value );
+
+	/**
+	Registers all the macros of a component library at once.
+	Names already registered keep their first value, as with AddMacro.
+	*/
+	void AddMacros( const wxArrayString& names, const wxArrayInt& values );
+
+	/**
+	Replaces the value of a macro registered before, see
+	ObjectDatabase::ImportComponentLibrary.
+	*/
+	void SetMacro( const wxString& name, int value );
+
+	/**
+	Gets all the macro names registered with @a value, in registration order.
+	Only the macros of the libraries loaded so far are known, see SetLoader.
+	@return false if no macro has that value.
+	*/
+	bool SearchMacroNames( int value, wxArrayString* names );
+
+	void AddSynonymous( const wxString& synName, const wxString& name );
+	bool SearchSynonymous( const wxString& synName, wxString& result );
+
+	/**
+	Sets the loader called by SearchMacro when a macro is not found.
+	*/
+	void SetLoader( Loader* loader ) { m_loader = loader; }
+
+	/**
+	Removes @a loader, if it is the loader of the dictionary, which may
+	have been destroyed already.
+	*/
+	static void RemoveLoader( Loader* loader );
 };
 
 #endif //__TYPE_UTILS__
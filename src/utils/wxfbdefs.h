@@ -30,6 +30,7 @@
 #include <wx/string.h>
 
 class ObjectBase;
+class ChildrenLoader;
 class ObjectInfo;
 class ObjectPackage;
 class Property;
@@ -51,6 +52,7 @@ class StringCodeWriter;
 typedef boost::shared_ptr<OptionList> POptionList;
 typedef boost::shared_ptr<ObjectBase> PObjectBase;
 typedef boost::weak_ptr<ObjectBase>   WPObjectBase;
+typedef boost::shared_ptr<ChildrenLoader> PChildrenLoader;
 typedef boost::shared_ptr<ObjectPackage>   PObjectPackage;
 typedef boost::weak_ptr<ObjectPackage>   WPObjectPackage;
 
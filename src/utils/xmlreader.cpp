@@ -0,0 +1,536 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xmlreader.h"
+#include "wxfbexception.h"
+#include "mappedfile.h"
+
+#include <wx/ffile.h>
+#include <wx/intl.h>
+#include <cstring>
+#include <cstdlib>
+
+#define XMLREADER_BUFFER_SIZE 65536
+
+XMLReader::XMLReader( XMLReaderHandler* handler )
+:
+m_handler( handler ),
+m_file( NULL ),
+m_cur( NULL ),
+m_end( NULL ),
+m_line( 1 )
+{
+}
+
+bool XMLReader::GetAttribute( const XMLAttributes& attributes, const char* name, std::string* value )
+{
+	XMLAttributes::const_iterator attribute;
+	for ( attribute = attributes.begin(); attribute != attributes.end(); ++attribute )
+	{
+		if ( attribute->first == name )
+		{
+			*value = attribute->second;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool XMLReader::ParseFile( const wxString& path )
+{
+	m_path = path;
+	m_cur = m_end = NULL;
+	m_line = 1;
+
+	// Read straight from the mapped file if possible, Fill() will have nothing
+	// to add then. Otherwise the file is read in blocks.
+	MappedFile mapped;
+	wxFFile file;
+	if ( mapped.Map( path ) )
+	{
+		m_file = NULL;
+		m_cur = mapped.GetData();
+		m_end = m_cur + mapped.GetLength();
+	}
+	else
+	{
+		if ( !file.Open( path, wxT("rb") ) )
+		{
+			THROW_WXFBEX( _("Unable to open file: ") << path )
+		}
+		m_file = file.fp();
+		m_buffer.resize( XMLREADER_BUFFER_SIZE );
+	}
+
+	m_openElements.clear();
+
+	// Skip the UTF-8 byte order mark
+	if ( 0xEF == Peek() && !Match( "\xEF\xBB\xBF" ) )
+	{
+		Error( _("Invalid byte order mark") );
+	}
+
+	bool completed = Parse();
+	m_file = NULL;
+	return completed;
+}
+
+bool XMLReader::Fill()
+{
+	if ( NULL == m_file )
+	{
+		return false;
+	}
+
+	size_t count = fread( &m_buffer[0], 1, m_buffer.size(), m_file );
+	m_cur = &m_buffer[0];
+	m_end = m_cur + count;
+	return count > 0;
+}
+
+void XMLReader::Error( const wxString& message )
+{
+	THROW_WXFBEX( message << wxT("\nFile: ") << m_path << wxString::Format( wxT("\nLine: %i"), m_line ) )
+}
+
+bool XMLReader::Parse()
+{
+	m_text.clear();
+
+	int c;
+	while ( ( c = Peek() ) != EOF )
+	{
+		if ( c != '<' )
+		{
+			ReadText();
+			continue;
+		}
+
+		if ( !FlushText() )
+		{
+			return false;
+		}
+
+		Get();
+		c = Peek();
+		if ( '?' == c )
+		{
+			Get();
+			ReadName( &m_name );
+			if ( "xml" == m_name )
+			{
+				ReadAttributes();
+				if ( !Match( "?>" ) )
+				{
+					Error( _("Malformed xml declaration") );
+				}
+				if ( !m_handler->OnDeclaration( m_attributes ) )
+				{
+					return false;
+				}
+			}
+			else
+			{
+				// Other processing instructions are not interesting
+				SkipUntil( "?>" );
+			}
+		}
+		else if ( '!' == c )
+		{
+			Get();
+			if ( Match( "--" ) )
+			{
+				SkipUntil( "-->" );
+			}
+			else if ( Match( "[CDATA[" ) )
+			{
+				std::string::size_type length = 0;
+				while ( length < 3 || m_text.compare( length - 3, 3, "]]>" ) != 0 )
+				{
+					c = Get();
+					if ( EOF == c )
+					{
+						Error( _("Unterminated CDATA section") );
+					}
+					m_text += (char)c;
+					++length;
+				}
+				m_text.resize( length - 3 );
+				if ( !FlushText() )
+				{
+					return false;
+				}
+			}
+			else
+			{
+				// <!DOCTYPE ...>
+				SkipUntil( ">" );
+			}
+		}
+		else if ( '/' == c )
+		{
+			Get();
+			ReadName( &m_name );
+			SkipSpaces();
+			Expect( '>' );
+
+			if ( m_openElements.empty() || m_openElements.back() != m_name )
+			{
+				Error( wxString::Format( _("Unexpected closing tag </%s>"), wxString( m_name.c_str(), wxConvUTF8 ).c_str() ) );
+			}
+			m_openElements.pop_back();
+
+			if ( !m_handler->OnEndElement( m_name ) )
+			{
+				return false;
+			}
+		}
+		else
+		{
+			ReadName( &m_name );
+			if ( m_name.empty() )
+			{
+				Error( _("Missing element name") );
+			}
+			ReadAttributes();
+
+			bool empty = Match( "/" );
+			Expect( '>' );
+
+			if ( !m_handler->OnStartElement( m_name, m_attributes ) )
+			{
+				return false;
+			}
+
+			if ( empty )
+			{
+				if ( !m_handler->OnEndElement( m_name ) )
+				{
+					return false;
+				}
+			}
+			else
+			{
+				m_openElements.push_back( m_name );
+			}
+		}
+	}
+
+	if ( !FlushText() )
+	{
+		return false;
+	}
+
+	if ( !m_openElements.empty() )
+	{
+		Error( wxString::Format( _("Missing closing tag </%s>"), wxString( m_openElements.back().c_str(), wxConvUTF8 ).c_str() ) );
+	}
+
+	return true;
+}
+
+bool XMLReader::FlushText()
+{
+	if ( m_text.empty() )
+	{
+		return true;
+	}
+
+	bool result = m_handler->OnText( m_text );
+	m_text.clear();
+	return result;
+}
+
+bool XMLReader::Match( const char* str )
+{
+	// Only called with strings that can not contain a new line, so the
+	// line count does not need to be updated here
+	for ( const char* expected = str; *expected != 0; ++expected )
+	{
+		if ( Peek() != (unsigned char)*expected )
+		{
+			if ( expected != str )
+			{
+				Error( wxString::Format( _("Expected \"%s\""), wxString( str, wxConvUTF8 ).c_str() ) );
+			}
+			return false;
+		}
+		++m_cur;
+	}
+	return true;
+}
+
+void XMLReader::Expect( char c )
+{
+	if ( Get() != (unsigned char)c )
+	{
+		Error( wxString::Format( _("Expected '%c'"), (wxChar)c ) );
+	}
+}
+
+void XMLReader::SkipSpaces()
+{
+	int c = Peek();
+	while ( ' ' == c || '\t' == c || '\n' == c || '\r' == c )
+	{
+		Get();
+		c = Peek();
+	}
+}
+
+void XMLReader::SkipUntil( const char* terminator )
+{
+	const size_t length = strlen( terminator );
+	size_t matched = 0;
+	while ( matched < length )
+	{
+		int c = Get();
+		if ( EOF == c )
+		{
+			Error( wxString::Format( _("Expected \"%s\""), wxString( terminator, wxConvUTF8 ).c_str() ) );
+		}
+
+		if ( c == (unsigned char)terminator[ matched ] )
+		{
+			++matched;
+		}
+		else
+		{
+			matched = ( c == (unsigned char)terminator[0] ? 1 : 0 );
+		}
+	}
+}
+
+void XMLReader::ReadName( std::string* name )
+{
+	name->clear();
+	int c = Peek();
+	while ( c != EOF && c != ' ' && c != '\t' && c != '\n' && c != '\r' &&
+			c != '/' && c != '>' && c != '=' && c != '?' )
+	{
+		*name += (char)c;
+		++m_cur;
+		c = Peek();
+	}
+}
+
+void XMLReader::ReadAttributes()
+{
+	m_attributes.clear();
+
+	SkipSpaces();
+	int c = Peek();
+	while ( c != EOF && c != '/' && c != '>' && c != '?' )
+	{
+		m_attributes.push_back( XMLAttributes::value_type() );
+		XMLAttributes::value_type& attribute = m_attributes.back();
+
+		ReadName( &attribute.first );
+		if ( attribute.first.empty() )
+		{
+			Error( _("Missing attribute name") );
+		}
+
+		SkipSpaces();
+		Expect( '=' );
+		SkipSpaces();
+
+		int quote = Get();
+		if ( quote != '"' && quote != '\'' )
+		{
+			Error( _("Attribute values must be quoted") );
+		}
+		ReadAttributeValue( (char)quote, &attribute.second );
+
+		SkipSpaces();
+		c = Peek();
+	}
+}
+
+void XMLReader::ReadAttributeValue( char quote, std::string* value )
+{
+	value->clear();
+	for ( ;; )
+	{
+		int c = Peek();
+		if ( EOF == c )
+		{
+			Error( _("Unterminated attribute value") );
+		}
+		else if ( c == (unsigned char)quote )
+		{
+			++m_cur;
+			return;
+		}
+		else if ( '&' == c )
+		{
+			ReadEntity( value );
+		}
+		else if ( '\r' == c )
+		{
+			ReadNewLine( value );
+		}
+		else
+		{
+			*value += (char)Get();
+		}
+	}
+}
+
+void XMLReader::ReadText()
+{
+	for ( ;; )
+	{
+		if ( m_cur == m_end && !Fill() )
+		{
+			return;
+		}
+
+		// Copy the plain characters in one go
+		const char* start = m_cur;
+		while ( m_cur < m_end && *m_cur != '<' && *m_cur != '&' && *m_cur != '\r' )
+		{
+			if ( '\n' == *m_cur )
+			{
+				++m_line;
+			}
+			++m_cur;
+		}
+		m_text.append( start, m_cur - start );
+
+		if ( m_cur == m_end )
+		{
+			continue;
+		}
+
+		switch ( *m_cur )
+		{
+			case '<':
+				return;
+			case '&':
+				ReadEntity( &m_text );
+				break;
+			default:
+				ReadNewLine( &m_text );
+				break;
+		}
+	}
+}
+
+void XMLReader::ReadNewLine( std::string* value )
+{
+	// "\r\n" and "\r" are stored as "\n", like TinyXML does
+	++m_cur;
+	++m_line;
+	*value += '\n';
+	if ( '\n' == Peek() )
+	{
+		++m_cur;
+	}
+}
+
+void XMLReader::ReadEntity( std::string* value )
+{
+	// Skip '&'
+	++m_cur;
+
+	std::string entity;
+	int c = Peek();
+	while ( c != EOF && c != ';' && entity.size() < 10 && c != '<' && c != '&' && c != '\n' && c != '\r' )
+	{
+		entity += (char)c;
+		++m_cur;
+		c = Peek();
+	}
+
+	if ( c != ';' )
+	{
+		// Not an entity, keep the text as it is
+		*value += '&';
+		*value += entity;
+		return;
+	}
+	++m_cur;
+
+	if ( "amp" == entity )
+	{
+		*value += '&';
+	}
+	else if ( "lt" == entity )
+	{
+		*value += '<';
+	}
+	else if ( "gt" == entity )
+	{
+		*value += '>';
+	}
+	else if ( "quot" == entity )
+	{
+		*value += '"';
+	}
+	else if ( "apos" == entity )
+	{
+		*value += '\'';
+	}
+	else if ( entity.size() > 1 && '#' == entity[0] )
+	{
+		unsigned long code;
+		if ( 'x' == entity[1] || 'X' == entity[1] )
+		{
+			code = strtoul( entity.c_str() + 2, NULL, 16 );
+		}
+		else
+		{
+			code = strtoul( entity.c_str() + 1, NULL, 10 );
+		}
+
+		// Encode the character as UTF-8
+		if ( code < 0x80 )
+		{
+			*value += (char)code;
+		}
+		else if ( code < 0x800 )
+		{
+			*value += (char)( 0xC0 | ( code >> 6 ) );
+			*value += (char)( 0x80 | ( code & 0x3F ) );
+		}
+		else if ( code < 0x10000 )
+		{
+			*value += (char)( 0xE0 | ( code >> 12 ) );
+			*value += (char)( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+			*value += (char)( 0x80 | ( code & 0x3F ) );
+		}
+		else
+		{
+			*value += (char)( 0xF0 | ( code >> 18 ) );
+			*value += (char)( 0x80 | ( ( code >> 12 ) & 0x3F ) );
+			*value += (char)( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+			*value += (char)( 0x80 | ( code & 0x3F ) );
+		}
+	}
+	else
+	{
+		// Unknown entity, keep it as it is
+		*value += '&';
+		*value += entity;
+		*value += ';';
+	}
+}
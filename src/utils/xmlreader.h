@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __XML_READER__
+#define __XML_READER__
+
+#include <wx/string.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <utility>
+
+/**
+Attributes of an element, in document order.
+*/
+typedef std::vector< std::pair< std::string, std::string > > XMLAttributes;
+
+/**
+Receives the contents of a document while XMLReader parses it.
+Returning false from any callback stops the parser.
+*/
+class XMLReaderHandler
+{
+public:
+	virtual ~XMLReaderHandler() {}
+
+	/**
+	Called for the <?xml ... ?> declaration, if the document has one.
+	*/
+	virtual bool OnDeclaration( const XMLAttributes& /*attributes*/ ) { return true; }
+
+	virtual bool OnStartElement( const std::string& name, const XMLAttributes& attributes ) = 0;
+	virtual bool OnEndElement( const std::string& name ) = 0;
+
+	/**
+	Called with the text found between two tags, with the entities already
+	replaced and the line endings converted to '\n', the same way TinyXML
+	does it. CDATA sections are reported by their own call.
+	*/
+	virtual bool OnText( const std::string& text ) = 0;
+};
+
+/**
+Streaming (SAX like) xml parser.
+
+Unlike TinyXML, no document is built: the file is read in blocks and the
+handler is notified as elements are found, so memory usage does not depend
+on the size of the file. Only the subset of xml written by wxFormBuilder is
+understood: DTDs are skipped and the text is expected to be UTF-8.
+*/
+class XMLReader
+{
+private:
+	XMLReaderHandler* m_handler;
+
+	FILE* m_file;
+	wxString m_path;
+	std::vector< char > m_buffer;
+	const char* m_cur;
+	const char* m_end;
+	int m_line;
+
+	std::vector< std::string > m_openElements;
+
+	// Reused between callbacks to avoid allocations
+	std::string m_name;
+	std::string m_text;
+	XMLAttributes m_attributes;
+
+	bool Fill();
+
+	int Peek()
+	{
+		if ( m_cur == m_end && !Fill() )
+		{
+			return EOF;
+		}
+		return (unsigned char)*m_cur;
+	}
+
+	int Get()
+	{
+		int c = Peek();
+		if ( c != EOF )
+		{
+			++m_cur;
+			if ( '\n' == c )
+			{
+				++m_line;
+			}
+		}
+		return c;
+	}
+
+	bool Parse();
+	bool Match( const char* str );
+	void Expect( char c );
+	void SkipSpaces();
+	void SkipUntil( const char* terminator );
+	void ReadName( std::string* name );
+	void ReadAttributes();
+	void ReadText();
+	void ReadAttributeValue( char quote, std::string* value );
+	void ReadNewLine( std::string* value );
+	void ReadEntity( std::string* value );
+	bool FlushText();
+
+	void Error( const wxString& message );
+
+public:
+	XMLReader( XMLReaderHandler* handler );
+
+	/**
+	Parses a whole file.
+	@return false if the handler stopped the parser, true otherwise.
+	@throw wxFBException If the file could not be opened or is not well formed.
+	*/
+	bool ParseFile( const wxString& path );
+
+	/**
+	Line of the file being parsed, for the callbacks of the handler.
+	*/
+	int GetLine() const { return m_line; }
+
+	/**
+	Gets the value of an attribute.
+	@return false if there is no attribute named @a name.
+	*/
+	static bool GetAttribute( const XMLAttributes& attributes, const char* name, std::string* value );
+};
+
+#endif //__XML_READER__
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xmlwriter.h"
+
+#define XMLWRITER_BUFFER_SIZE 65536
+
+XMLWriter::XMLWriter( FILE* file )
+:
+m_file( file ),
+m_tagOpen( false ),
+m_error( false )
+{
+	m_buffer.reserve( XMLWRITER_BUFFER_SIZE + 1024 );
+}
+
+bool XMLWriter::Flush()
+{
+	if ( !m_buffer.empty() )
+	{
+		if ( fwrite( m_buffer.data(), 1, m_buffer.size(), m_file ) != m_buffer.size() )
+		{
+			m_error = true;
+		}
+		m_buffer.clear();
+	}
+
+	if ( fflush( m_file ) != 0 )
+	{
+		m_error = true;
+	}
+
+	return !m_error;
+}
+
+void XMLWriter::CheckBuffer()
+{
+	if ( m_buffer.size() >= XMLWRITER_BUFFER_SIZE )
+	{
+		if ( fwrite( m_buffer.data(), 1, m_buffer.size(), m_file ) != m_buffer.size() )
+		{
+			m_error = true;
+		}
+		m_buffer.clear();
+	}
+}
+
+void XMLWriter::WriteIndent( size_t depth )
+{
+	for ( size_t i = 0; i < depth; ++i )
+	{
+		Write( "    " );
+	}
+}
+
+void XMLWriter::WriteEncoded( const std::string& str )
+{
+	// Same escaping as TiXmlBase::EncodeString
+	const size_t length = str.length();
+	size_t i = 0;
+	while ( i < length )
+	{
+		unsigned char c = (unsigned char)str[i];
+
+		if ( '&' == c && i + 2 < length && '#' == str[i + 1] && 'x' == str[i + 2] )
+		{
+			// Hexadecimal character reference, pass through unchanged
+			while ( i + 1 < length )
+			{
+				m_buffer += str[i];
+				++i;
+				if ( ';' == str[i] )
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			switch ( c )
+			{
+				case '&':	m_buffer += "&amp;";	break;
+				case '<':	m_buffer += "&lt;";		break;
+				case '>':	m_buffer += "&gt;";		break;
+				case '\"':	m_buffer += "&quot;";	break;
+				case '\'':	m_buffer += "&apos;";	break;
+				default:
+					if ( c < 32 )
+					{
+						static const char hex[] = "0123456789ABCDEF";
+						m_buffer += "&#x";
+						m_buffer += hex[ c >> 4 ];
+						m_buffer += hex[ c & 0x0F ];
+						m_buffer += ';';
+					}
+					else
+					{
+						m_buffer += (char)c;
+					}
+					break;
+			}
+			++i;
+		}
+	}
+}
+
+void XMLWriter::CloseTag()
+{
+	if ( m_tagOpen )
+	{
+		Write( ">" );
+		m_tagOpen = false;
+	}
+}
+
+void XMLWriter::WriteDeclaration( const char* version, const char* encoding, const char* standalone )
+{
+	Write( "<?xml " );
+	if ( *version )
+	{
+		Write( "version=\"" ); Write( version ); Write( "\" " );
+	}
+	if ( *encoding )
+	{
+		Write( "encoding=\"" ); Write( encoding ); Write( "\" " );
+	}
+	if ( *standalone )
+	{
+		Write( "standalone=\"" ); Write( standalone ); Write( "\" " );
+	}
+	Write( "?>\n" );
+}
+
+void XMLWriter::StartElement( const char* name )
+{
+	if ( !m_elements.empty() )
+	{
+		CloseTag();
+
+		OpenElement& parent = m_elements.back();
+		parent.children++;
+		parent.textOnly = false;
+		Write( "\n" );
+	}
+
+	WriteIndent( m_elements.size() );
+	Write( "<" );
+	Write( name );
+
+	OpenElement element;
+	element.name = name;
+	element.children = 0;
+	element.textOnly = true;
+	m_elements.push_back( element );
+	m_tagOpen = true;
+}
+
+void XMLWriter::WriteAttribute( const char* name, const std::string& value )
+{
+	const char* quote = ( value.find( '\"' ) == std::string::npos ? "\"" : "'" );
+
+	Write( " " );
+	WriteEncoded( name );
+	Write( "=" );
+	Write( quote );
+	WriteEncoded( value );
+	Write( quote );
+}
+
+void XMLWriter::WriteAttribute( const char* name, int value )
+{
+	char buffer[32];
+	sprintf( buffer, "%d", value );
+	WriteAttribute( name, std::string( buffer ) );
+}
+
+void XMLWriter::WriteText( const std::string& text )
+{
+	CloseTag();
+	m_elements.back().children++;
+	WriteEncoded( text );
+}
+
+void XMLWriter::EndElement()
+{
+	OpenElement& element = m_elements.back();
+
+	if ( 0 == element.children )
+	{
+		Write( " />" );
+		m_tagOpen = false;
+	}
+	else if ( 1 == element.children && element.textOnly )
+	{
+		Write( "</" );
+		Write( element.name );
+		Write( ">" );
+	}
+	else
+	{
+		Write( "\n" );
+		WriteIndent( m_elements.size() - 1 );
+		Write( "</" );
+		Write( element.name );
+		Write( ">" );
+	}
+
+	m_elements.pop_back();
+
+	// Each node of the document goes in its own line
+	if ( m_elements.empty() )
+	{
+		Write( "\n" );
+	}
+
+	CheckBuffer();
+}
+
+void XMLWriter::WriteTextElement( const char* name, const char* attribute, const std::string& attributeValue, const std::string& text )
+{
+	StartElement( name );
+	WriteAttribute( attribute, attributeValue );
+	WriteText( text );
+	EndElement();
+}
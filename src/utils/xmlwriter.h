@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// wxFormBuilder - A Visual Dialog Editor for wxWidgets.
+// Copyright (C) 2005 José Antonio Hurtado
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __XML_WRITER__
+#define __XML_WRITER__
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+Streaming xml writer, the counterpart of XMLReader.
+
+The output is formatted exactly as TinyXML prints a document, so files
+written with it are identical to the ones saved through a ticpp::Document,
+but no document has to be built. The output is buffered and written to
+the file in blocks. All strings are expected to be UTF-8.
+*/
+class XMLWriter
+{
+private:
+	struct OpenElement
+	{
+		std::string name;
+		unsigned int children;
+		bool textOnly;
+	};
+
+	FILE* m_file;
+	std::string m_buffer;
+	std::vector< OpenElement > m_elements;
+	bool m_tagOpen;
+	bool m_error;
+
+	void Write( const char* str ) { m_buffer += str; }
+	void Write( const std::string& str ) { m_buffer += str; }
+	void WriteIndent( size_t depth );
+	void WriteEncoded( const std::string& str );
+	void CloseTag();
+	void CheckBuffer();
+
+public:
+	XMLWriter( FILE* file );
+
+	void WriteDeclaration( const char* version, const char* encoding, const char* standalone );
+
+	void StartElement( const char* name );
+	void WriteAttribute( const char* name, const std::string& value );
+	void WriteAttribute( const char* name, int value );
+	void WriteText( const std::string& text );
+	void EndElement();
+
+	/**
+	Shortcut for an element with a single attribute and text, e.g. <property name="...">text</property>
+	*/
+	void WriteTextElement( const char* name, const char* attribute, const std::string& attributeValue, const std::string& text );
+
+	/**
+	Writes the buffered output to the file. Must be called before closing it.
+	@return false if there was an error writing the file.
+	*/
+	bool Flush();
+};
+
+#endif //__XML_WRITER__